@@ -25,7 +25,7 @@
 
 // This should match the order of flaps on the spool, with the first being the
 // "home" flap.
-const uint8_t flaps[NUM_FLAPS] = {
+constexpr uint8_t flaps[NUM_FLAPS] = {
   ' ',
   'a', 'b', 'c', 'd', 'e', 'f', 'g', 'h', 'i', 'j', 'k', 'l', 'm',
   'n', 'o', 'p', 'q', 'r', 's', 't', 'u', 'v', 'w', 'x', 'y', 'z',
@@ -0,0 +1,36 @@
+/*
+   Copyright 2022 Scott Bezek and the splitflap contributors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+#pragma once
+
+#include <Arduino.h>
+
+/**
+ * Arduino Stream that can also hand over received data in bulk, so consumers can process input a chunk at
+ * a time rather than through per-byte read() calls.
+ *
+ * The serial protocols depend on this rather than on UartStream, so they can run against any transport
+ * (e.g. an in-memory stream when exercising the protocol code off-device).
+ */
+class ChunkedStream : public Stream {
+    public:
+        virtual ~ChunkedStream() {}
+
+        /**
+         * Reads up to size bytes that have already been received, without blocking. Returns the number of
+         * bytes read.
+         */
+        virtual size_t readInto(uint8_t* buffer, size_t size) = 0;
+};
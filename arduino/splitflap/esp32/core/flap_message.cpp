@@ -0,0 +1,142 @@
+/*
+   Copyright 2022 Scott Bezek and the splitflap contributors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+#include "flap_message.h"
+
+// Index of character c in flaps[], searching from index i, or FLAP_INDEX_NONE
+static constexpr uint8_t findFlap(uint8_t c, uint8_t i) {
+    return i >= NUM_FLAPS ? FLAP_INDEX_NONE : (flaps[i] == c ? i : findFlap(c, i + 1));
+}
+
+static constexpr uint8_t toLowerCase(uint8_t c) {
+    return (c >= 'A' && c <= 'Z') ? c - 'A' + 'a' : c;
+}
+
+static constexpr uint8_t findFlapIgnoringCase(uint8_t c) {
+    return findFlap(c, 0) != FLAP_INDEX_NONE ? findFlap(c, 0) : findFlap(toLowerCase(c), 0);
+}
+
+#define FLAP_INDEXES_4(c) findFlapIgnoringCase(c), findFlapIgnoringCase(c + 1), findFlapIgnoringCase(c + 2), \
+    findFlapIgnoringCase(c + 3)
+#define FLAP_INDEXES_16(c) FLAP_INDEXES_4(c), FLAP_INDEXES_4(c + 4), FLAP_INDEXES_4(c + 8), FLAP_INDEXES_4(c + 12)
+#define FLAP_INDEXES_64(c) FLAP_INDEXES_16(c), FLAP_INDEXES_16(c + 16), FLAP_INDEXES_16(c + 32), \
+    FLAP_INDEXES_16(c + 48)
+
+// Flap index for every character, built at compile time so looking up a character is a single load
+static constexpr uint8_t FLAP_INDEX_BY_CHAR[256] = {
+    FLAP_INDEXES_64(0), FLAP_INDEXES_64(64), FLAP_INDEXES_64(128), FLAP_INDEXES_64(192),
+};
+
+static_assert(FLAP_INDEX_BY_CHAR['A'] == FLAP_INDEX_BY_CHAR['a'], "Upper case letters should show lower case flaps");
+static_assert(FLAP_INDEX_BY_CHAR[flaps[0]] == 0, "Lookup table doesn't match flaps[]");
+
+static constexpr uint8_t BLANK_FLAP_INDEX = FLAP_INDEX_BY_CHAR[' '];
+
+FlapMessage::FlapMessage() {
+    fill(BLANK_FLAP_INDEX);
+}
+
+FlapMessage::FlapMessage(const char* text, FlapAlignment alignment) {
+    setText(text, strlen(text), alignment);
+}
+
+FlapMessage::FlapMessage(const char* text, size_t length, FlapAlignment alignment) {
+    setText(text, length, alignment);
+}
+
+FlapMessage FlapMessage::unchanged() {
+    FlapMessage message;
+    message.fill(FLAP_INDEX_NONE);
+    return message;
+}
+
+uint8_t FlapMessage::flapIndex(char c) {
+    return FLAP_INDEX_BY_CHAR[(uint8_t)c];
+}
+
+void FlapMessage::setText(const char* text, size_t length, FlapAlignment alignment) {
+    fill(BLANK_FLAP_INDEX);
+    if (length >= NUM_MODULES) {
+        write(0, text, length);
+        return;
+    }
+
+    switch (alignment) {
+        case FlapAlignment::LEFT:
+            write(0, text, length);
+            break;
+        case FlapAlignment::CENTER:
+            write((NUM_MODULES - length) / 2, text, length);
+            break;
+        case FlapAlignment::RIGHT:
+            write(NUM_MODULES - length, text, length);
+            break;
+        case FlapAlignment::JUSTIFY:
+            justify(text, length);
+            break;
+    }
+}
+
+void FlapMessage::write(uint8_t start, const char* text, size_t length) {
+    for (size_t i = 0; i < length && start + i < NUM_MODULES; i++) {
+        flap_indexes_[start + i] = flapIndex(text[i]);
+    }
+}
+
+void FlapMessage::justify(const char* text, size_t length) {
+    // Count the words and the characters in them; runs of spaces between words are replaced by the padding
+    uint8_t words = 0;
+    uint8_t word_chars = 0;
+    for (size_t i = 0; i < length; i++) {
+        if (text[i] != ' ') {
+            word_chars++;
+            if (i == 0 || text[i - 1] == ' ') {
+                words++;
+            }
+        }
+    }
+    if (words < 2 || word_chars + words - 1 > NUM_MODULES) {
+        write(0, text, length);
+        return;
+    }
+
+    // Leftmost gaps get any remainder
+    uint8_t gaps = words - 1;
+    uint8_t padding = NUM_MODULES - word_chars;
+    uint8_t module = 0;
+    uint8_t gap = 0;
+    for (size_t i = 0; i < length; i++) {
+        if (text[i] == ' ') {
+            continue;
+        }
+        if (module > 0 && text[i - 1] == ' ') {
+            module += padding / gaps + (gap < padding % gaps ? 1 : 0);
+            gap++;
+        }
+        flap_indexes_[module++] = flapIndex(text[i]);
+    }
+}
+
+void FlapMessage::fill(uint8_t flap_index) {
+    memset(flap_indexes_, flap_index, sizeof(flap_indexes_));
+}
+
+void FlapMessage::toText(char* buf, size_t size) const {
+    assert(size > NUM_MODULES);
+    for (uint8_t i = 0; i < NUM_MODULES; i++) {
+        buf[i] = flap_indexes_[i] == FLAP_INDEX_NONE ? '?' : flaps[flap_indexes_[i]];
+    }
+    buf[NUM_MODULES] = '\0';
+}
@@ -0,0 +1,126 @@
+/*
+   Copyright 2022 Scott Bezek and the splitflap contributors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+#pragma once
+
+#include <Arduino.h>
+
+#include "config.h"
+
+// Flap index of a module that should be left as it is, e.g. for a character that isn't on any flap
+#define FLAP_INDEX_NONE 0xFF
+static_assert(NUM_FLAPS < FLAP_INDEX_NONE, "Too many flaps to fit in uint8_t flap indexes");
+
+enum class FlapAlignment {
+    LEFT,
+    CENTER,
+    RIGHT,
+    // Words are spread out so that the first starts at the first module and the last ends at the last module
+    JUSTIFY,
+};
+
+/**
+ * What to show on every module, as flap indexes into flaps[].
+ *
+ * Characters are resolved to flap indexes once, when the message is built, through a lookup table generated at
+ * compile time from flaps[]. Messages are fixed-size and never allocate, so they can be passed around by value
+ * (e.g. from message providers through to SplitflapTask's command queue).
+ */
+class FlapMessage {
+    public:
+        // All modules blank
+        FlapMessage();
+
+        // Text aligned across the modules, which are otherwise blank. Text longer than NUM_MODULES is truncated.
+        explicit FlapMessage(const char* text, FlapAlignment alignment = FlapAlignment::LEFT);
+        FlapMessage(const char* text, size_t length, FlapAlignment alignment = FlapAlignment::LEFT);
+
+        // All modules left as they are
+        static FlapMessage unchanged();
+
+        // Flap index for a character (upper case letters fall back to the lower case flap), or FLAP_INDEX_NONE
+        static uint8_t flapIndex(char c);
+
+        // Replaces the whole message with aligned text
+        void setText(const char* text, size_t length, FlapAlignment alignment = FlapAlignment::LEFT);
+
+        // Writes text to consecutive modules from start, leaving other modules as they are
+        void write(uint8_t start, const char* text, size_t length);
+
+        // Flap index for a module, or FLAP_INDEX_NONE
+        uint8_t operator[](uint8_t module) const {
+            return flap_indexes_[module];
+        }
+
+        void set(uint8_t module, uint8_t flap_index) {
+            flap_indexes_[module] = flap_index;
+        }
+
+        bool operator==(const FlapMessage& other) const {
+            return memcmp(flap_indexes_, other.flap_indexes_, sizeof(flap_indexes_)) == 0;
+        }
+
+        bool operator!=(const FlapMessage& other) const {
+            return !(*this == other);
+        }
+
+        // Writes the message as text (for logging), with '?' for modules that are left as they are. size must be
+        // at least NUM_MODULES + 1.
+        void toText(char* buf, size_t size) const;
+
+    private:
+        uint8_t flap_indexes_[NUM_MODULES];
+
+        void fill(uint8_t flap_index);
+        void justify(const char* text, size_t length);
+};
+
+// Up to this many messages are shown in turn by a MessageProvider
+#define MAX_FLAP_MESSAGES 4
+
+/**
+ * A short, fixed-capacity list of messages, so that lists can be copied around without allocating.
+ */
+class FlapMessageList {
+    public:
+        size_t size() const {
+            return count_;
+        }
+
+        bool empty() const {
+            return count_ == 0;
+        }
+
+        void clear() {
+            count_ = 0;
+        }
+
+        // Returns false (and drops the message) if the list is full
+        bool push_back(const FlapMessage& message) {
+            if (count_ >= MAX_FLAP_MESSAGES) {
+                return false;
+            }
+            messages_[count_++] = message;
+            return true;
+        }
+
+        const FlapMessage& operator[](size_t i) const {
+            return messages_[i];
+        }
+
+    private:
+        FlapMessage messages_[MAX_FLAP_MESSAGES];
+        uint8_t count_ = 0;
+};
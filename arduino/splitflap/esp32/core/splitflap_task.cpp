@@ -28,12 +28,39 @@
 
 static_assert(QCMD_FLAP + NUM_FLAPS <= 255, "Too many flaps to fit in uint8_t command structure");
 
+// Time taken to move delta_steps from rest, following the acceleration profile in SplitflapModule::Update()
+static uint32_t simulateMoveMicros(uint32_t delta_steps) {
+  uint32_t elapsed_micros = 0;
+  uint8_t accel_step = 0;
+  uint16_t period = pgm_read_word_near(Acceleration::ACCEL_STEP_PERIODS);
+  while (delta_steps > 0 || accel_step > 0) {
+    elapsed_micros += period;
+    uint8_t target_accel_step = delta_steps > Acceleration::MAX_ACCEL_STEP ? Acceleration::MAX_ACCEL_STEP : delta_steps;
+    if (accel_step < target_accel_step) {
+      accel_step++;
+    } else if (accel_step > target_accel_step) {
+      accel_step--;
+    }
+    period = pgm_read_word_near(Acceleration::ACCEL_STEP_PERIODS + accel_step);
+    if (accel_step > 0 && delta_steps > 0) {
+      delta_steps--;
+    }
+  }
+  return elapsed_micros;
+}
+
 SplitflapTask::SplitflapTask(const uint8_t task_core, const LedMode led_mode) : Task("Splitflap", 2048, 1, task_core), led_mode_(led_mode), state_semaphore_(xSemaphoreCreateMutex()) {
   assert(state_semaphore_ != NULL);
   xSemaphoreGive(state_semaphore_);
 
   queue_ = xQueueCreate(5, sizeof(Command));
   assert(queue_ != NULL);
+
+  for (uint8_t i = 0; i <= NUM_FLAPS; i++) {
+    // Rounded up, like SplitflapModule::GetTargetStepForFlapIndex()
+    uint32_t steps = ((uint32_t)i * GEAR_RATIO_INPUT_STEPS + GEAR_RATIO_OUTPUT_FLAPS - 1) / GEAR_RATIO_OUTPUT_FLAPS;
+    move_millis_[i] = simulateMoveMicros(steps) / 1000;
+  }
 }
 
 SplitflapTask::~SplitflapTask() {
@@ -281,20 +308,6 @@ void SplitflapTask::runUpdate() {
     updateStateCache();
 }
 
-int8_t SplitflapTask::findFlapIndex(uint8_t character) {
-    if (character <= 'Z' && character >= 'A')
-    {
-        character = character - ('Z' - 'z');
-    }
-    for (int8_t i = 0; i < NUM_FLAPS; i++) {
-        if (character == flaps[i])
-        {
-            return i;
-        }
-    }
-    return -1;
-}
-
 void SplitflapTask::updateStateCache() {
     SplitflapState new_state;
     new_state.mode = sensor_test_ ? SplitflapMode::MODE_SENSOR_TEST : SplitflapMode::MODE_RUN;
@@ -313,6 +326,9 @@ void SplitflapTask::updateStateCache() {
     if (memcmp(&state_cache_, &new_state, sizeof(state_cache_))) {
         SemaphoreGuard lock(state_semaphore_);
         memcpy(&state_cache_, &new_state, sizeof(state_cache_));
+        for (uint8_t i = 0; i < state_change_listener_count_; i++) {
+            xTaskNotifyGive(state_change_listeners_[i]);
+        }
     }
 }
 
@@ -322,12 +338,12 @@ void SplitflapTask::log(const char* msg) {
     }
 }
 
-void SplitflapTask::showString(const char* str, uint8_t length, bool force_full_rotation) {
+void SplitflapTask::showMessage(const FlapMessage& message, bool force_full_rotation) {
     Command command = {};
     command.command_type = CommandType::MODULES;
-    for (uint8_t i = 0; i < length; i++) {
-        int8_t index = findFlapIndex(str[i]);
-        if (index != -1) {
+    for (uint8_t i = 0; i < NUM_MODULES; i++) {
+        uint8_t index = message[i];
+        if (index != FLAP_INDEX_NONE) {
             if (force_full_rotation || index != modules[i]->GetTargetFlapIndex()) {
                 command.data.module_command[i] = QCMD_FLAP + index;
             }
@@ -336,6 +352,12 @@ void SplitflapTask::showString(const char* str, uint8_t length, bool force_full_
     assert(xQueueSendToBack(queue_, &command, portMAX_DELAY) == pdTRUE);
 }
 
+void SplitflapTask::showString(const char* str, uint8_t length, bool force_full_rotation) {
+    FlapMessage message = FlapMessage::unchanged();
+    message.write(0, str, length);
+    showMessage(message, force_full_rotation);
+}
+
 void SplitflapTask::resetAll() {
     Command command = {};
     command.command_type = CommandType::MODULES;
@@ -374,6 +396,12 @@ SplitflapState SplitflapTask::getState() {
     return state_cache_;
 }
 
+void SplitflapTask::addStateChangeListener(TaskHandle_t task) {
+    SemaphoreGuard lock(state_semaphore_);
+    assert(state_change_listener_count_ < MAX_STATE_CHANGE_LISTENERS);
+    state_change_listeners_[state_change_listener_count_++] = task;
+}
+
 void SplitflapTask::setLogger(Logger* logger) {
     logger_ = logger;
 }
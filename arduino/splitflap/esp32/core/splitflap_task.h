@@ -16,6 +16,7 @@
 #pragma once
 
 #include "config.h"
+#include "flap_message.h"
 #include "logger.h"
 #include "src/splitflap_module_data.h"
 
@@ -113,6 +114,8 @@ struct Command {
 #define QCMD_DISABLE        4
 #define QCMD_FLAP           5
 
+#define MAX_STATE_CHANGE_LISTENERS 4
+
 class SplitflapTask : public Task<SplitflapTask> {
     friend class Task<SplitflapTask>; // Allow base Task to invoke protected run()
 
@@ -122,14 +125,24 @@ class SplitflapTask : public Task<SplitflapTask> {
         
         SplitflapState getState();
 
+        void showMessage(const FlapMessage& message, bool force_full_rotation = FORCE_FULL_ROTATION);
+        // Shows str on the first length modules (leaving the others as they are)
         void showString(const char *str, uint8_t length, bool force_full_rotation = FORCE_FULL_ROTATION);
         void resetAll();
         void disableAll();
         void setLed(uint8_t id, bool on);
         void setSensorTest(bool sensor_test);
         void setLogger(Logger* logger);
+
+        // The given task is notified (xTaskNotifyGive) whenever the state changes
+        void addStateChangeListener(TaskHandle_t task);
         void postRawCommand(Command command);
 
+        // Estimated time for a module at rest to move forward by delta_flaps flaps (0 to NUM_FLAPS) and stop
+        uint16_t estimateMoveMillis(uint8_t delta_flaps) const {
+            return move_millis_[delta_flaps];
+        }
+
     protected:
         void run();
 
@@ -146,6 +159,9 @@ class SplitflapTask : public Task<SplitflapTask> {
         bool sensor_test_ = SENSOR_TEST;
         ModuleConfigs current_configs_ = {};
 
+        // See estimateMoveMillis()
+        uint16_t move_millis_[NUM_FLAPS + 1];
+
 #ifdef CHAINLINK
         uint8_t loopback_current_out_index_ = 0;
         uint16_t loopback_step_index_ = 0;
@@ -155,12 +171,12 @@ class SplitflapTask : public Task<SplitflapTask> {
 
         // Cached state. Protected by state_semaphore_
         SplitflapState state_cache_;
+        TaskHandle_t state_change_listeners_[MAX_STATE_CHANGE_LISTENERS] = {};
+        uint8_t state_change_listener_count_ = 0;
         void updateStateCache();
 
         void processQueue();
         void runUpdate();
         void sensorTestUpdate();
         void log(const char* msg);
-
-        int8_t findFlapIndex(uint8_t character);
 };
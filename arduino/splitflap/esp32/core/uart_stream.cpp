@@ -19,7 +19,7 @@
 #include "config.h"
 #include "uart_stream.h"
 
-UartStream::UartStream() : Stream() {
+UartStream::UartStream() : ChunkedStream() {
 }
 
 void UartStream::begin() {
@@ -35,22 +35,51 @@ void UartStream::begin() {
     assert(uart_driver_install(uart_port_, 32000, 32000, 0, NULL, 0) == ESP_OK);
 }
 
+void UartStream::setBaudRate(uint32_t baud_rate) {
+    assert(uart_wait_tx_done(uart_port_, portMAX_DELAY) == ESP_OK);
+    assert(uart_set_baudrate(uart_port_, baud_rate) == ESP_OK);
+}
+
 int UartStream::peek() {
-    return -1;
+    if (peeked_ < 0) {
+        uint8_t b;
+        if (uart_read_bytes(uart_port_, &b, 1, 0) == 1) {
+            peeked_ = b;
+        }
+    }
+    return peeked_;
 }
 
 int UartStream::available() {
     size_t size = 0;
     assert(uart_get_buffered_data_len(uart_port_, &size) == ESP_OK);
-    return size;
+    return size + (peeked_ >= 0 ? 1 : 0);
 }
 
 int UartStream::read() {
+    if (peeked_ >= 0) {
+        int b = peeked_;
+        peeked_ = -1;
+        return b;
+    }
     uint8_t b;
     int res = uart_read_bytes(uart_port_, &b, 1, 0);
     return res != 1 ? -1 : b;
 }
 
+size_t UartStream::readInto(uint8_t* buffer, size_t size) {
+    if (size == 0) {
+        return 0;
+    }
+    size_t count = 0;
+    if (peeked_ >= 0) {
+        buffer[count++] = peeked_;
+        peeked_ = -1;
+    }
+    int res = uart_read_bytes(uart_port_, buffer + count, size - count, 0);
+    return res > 0 ? count + res : count;
+}
+
 void UartStream::flush() {
 
 }
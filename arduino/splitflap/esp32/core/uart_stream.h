@@ -19,6 +19,8 @@
 
 #include <driver/uart.h>
 
+#include "chunked_stream.h"
+
 /**
  * Implementation of an Arduino Stream for UART serial communications using the esp uart driver
  * directly, rather than the Arduino HAL which has a small fixed underlying rx FIFO size and
@@ -26,12 +28,22 @@
  * 
  * This is not a full or optimized implementation; just the minimal necessary for this project.
  */
-class UartStream : public Stream {
+class UartStream : public ChunkedStream {
     public:
         UartStream();
 
         void begin();
 
+        /**
+         * Changes the baud rate of the link. Blocks until anything already written has been transmitted,
+         * so it goes out at the previous rate.
+         */
+        void setBaudRate(uint32_t baud_rate);
+
+        // ChunkedStream methods. Prefer readInto() over read() for anything but single bytes, since each
+        // call goes through the uart driver.
+        size_t readInto(uint8_t* buffer, size_t size) override;
+
         // Stream methods
         int available() override;
         int read() override;
@@ -44,4 +56,7 @@ class UartStream : public Stream {
 
     private:
         const uart_port_t uart_port_ = UART_NUM_0;
+
+        // Byte already taken from the uart driver by peek(), or -1
+        int peeked_ = -1;
 };
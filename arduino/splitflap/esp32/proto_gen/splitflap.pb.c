@@ -18,6 +18,12 @@ PB_BIND(PB_Log, PB_Log, 2)
 PB_BIND(PB_Ack, PB_Ack, AUTO)
 
 
+PB_BIND(PB_BaudRateResponse, PB_BaudRateResponse, AUTO)
+
+
+PB_BIND(PB_ScheduleUploadResponse, PB_ScheduleUploadResponse, AUTO)
+
+
 PB_BIND(PB_SupervisorState, PB_SupervisorState, 2)
 
 
@@ -45,6 +51,18 @@ PB_BIND(PB_SplitflapConfig_ModuleConfig, PB_SplitflapConfig_ModuleConfig, AUTO)
 PB_BIND(PB_RequestState, PB_RequestState, AUTO)
 
 
+PB_BIND(PB_Subscribe, PB_Subscribe, AUTO)
+
+
+PB_BIND(PB_WindowConfig, PB_WindowConfig, AUTO)
+
+
+PB_BIND(PB_BaudRateChange, PB_BaudRateChange, AUTO)
+
+
+PB_BIND(PB_ScheduleUpload, PB_ScheduleUpload, 2)
+
+
 PB_BIND(PB_ToSplitflap, PB_ToSplitflap, 2)
 
 
@@ -18,6 +18,25 @@ typedef enum _PB_SplitflapState_ModuleState_State {
     PB_SplitflapState_ModuleState_State_STATE_DISABLED = 4 
 } PB_SplitflapState_ModuleState_State;
 
+typedef enum _PB_BaudRateResponse_Status { 
+    PB_BaudRateResponse_Status_ACCEPTED = 0, 
+    PB_BaudRateResponse_Status_REJECTED = 1, 
+    PB_BaudRateResponse_Status_CONFIRMED = 2, 
+    PB_BaudRateResponse_Status_REVERTED = 3 
+} PB_BaudRateResponse_Status;
+
+typedef enum _PB_ScheduleUploadResponse_Status { 
+    PB_ScheduleUploadResponse_Status_OK = 0, 
+    PB_ScheduleUploadResponse_Status_NO_PARTITION = 1, 
+    PB_ScheduleUploadResponse_Status_TOO_LARGE = 2, 
+    PB_ScheduleUploadResponse_Status_NOT_STARTED = 3, 
+    PB_ScheduleUploadResponse_Status_BAD_OFFSET = 4, 
+    PB_ScheduleUploadResponse_Status_INCOMPLETE = 5, 
+    PB_ScheduleUploadResponse_Status_CRC_MISMATCH = 6, 
+    PB_ScheduleUploadResponse_Status_INVALID_SCHEDULE = 7, 
+    PB_ScheduleUploadResponse_Status_FLASH_ERROR = 8 
+} PB_ScheduleUploadResponse_Status;
+
 typedef enum _PB_SupervisorState_State { 
     PB_SupervisorState_State_UNKNOWN = 0, 
     PB_SupervisorState_State_STARTING_VERIFY_PSU_OFF = 1, 
@@ -43,19 +62,59 @@ typedef enum _PB_SplitflapCommand_ModuleCommand_Action {
     PB_SplitflapCommand_ModuleCommand_Action_RESET_AND_HOME = 2 
 } PB_SplitflapCommand_ModuleCommand_Action;
 
+typedef enum _PB_BaudRateChange_Phase { 
+    PB_BaudRateChange_Phase_PROPOSE = 0, 
+    PB_BaudRateChange_Phase_CONFIRM = 1 
+} PB_BaudRateChange_Phase;
+
+typedef enum _PB_ScheduleUpload_Phase { 
+    PB_ScheduleUpload_Phase_BEGIN = 0, 
+    PB_ScheduleUpload_Phase_DATA = 1, 
+    PB_ScheduleUpload_Phase_COMMIT = 2 
+} PB_ScheduleUpload_Phase;
+
 /* Struct definitions */
+typedef PB_BYTES_ARRAY_T(256) PB_ScheduleUpload_data_t;
 typedef struct _PB_RequestState { 
     char dummy_field;
 } PB_RequestState;
 
 typedef struct _PB_Ack { 
     uint32_t nonce; 
+    uint32_t cumulative_nonce; 
+    uint32_t selective_mask; 
+    uint8_t window_size; 
 } PB_Ack;
 
+typedef struct _PB_BaudRateChange { 
+    PB_BaudRateChange_Phase phase; 
+    uint32_t baud_rate; 
+} PB_BaudRateChange;
+
+typedef struct _PB_BaudRateResponse { 
+    PB_BaudRateResponse_Status status; 
+    uint32_t baud_rate; 
+} PB_BaudRateResponse;
+
 typedef struct _PB_Log { 
     char msg[256]; 
 } PB_Log;
 
+typedef struct _PB_ScheduleUpload { 
+    PB_ScheduleUpload_Phase phase; 
+    uint32_t size; 
+    uint32_t offset; 
+    PB_ScheduleUpload_data_t data; 
+    uint32_t crc32; 
+} PB_ScheduleUpload;
+
+typedef struct _PB_ScheduleUploadResponse { 
+    PB_ScheduleUpload_Phase phase; 
+    PB_ScheduleUploadResponse_Status status; 
+    uint32_t next_offset; 
+    uint32_t record_count; 
+} PB_ScheduleUploadResponse;
+
 typedef struct _PB_SplitflapCommand_ModuleCommand { 
     PB_SplitflapCommand_ModuleCommand_Action action; 
     uint8_t param; 
@@ -88,19 +147,29 @@ typedef struct _PB_SupervisorState_PowerChannelState {
     bool on; 
 } PB_SupervisorState_PowerChannelState;
 
+typedef struct _PB_Subscribe { 
+    uint32_t min_interval_millis; 
+    uint32_t heartbeat_interval_millis; 
+    uint8_t module_start; 
+    uint8_t module_count; 
+    uint32_t field_mask; 
+} PB_Subscribe;
+
+typedef struct _PB_WindowConfig { 
+    uint8_t window_size; 
+} PB_WindowConfig;
+
 typedef struct _PB_SplitflapCommand { 
-    pb_size_t modules_count;
-    PB_SplitflapCommand_ModuleCommand modules[255]; 
+    pb_callback_t modules; 
 } PB_SplitflapCommand;
 
 typedef struct _PB_SplitflapConfig { 
-    pb_size_t modules_count;
-    PB_SplitflapConfig_ModuleConfig modules[255]; 
+    pb_callback_t modules; 
 } PB_SplitflapConfig;
 
 typedef struct _PB_SplitflapState { 
-    pb_size_t modules_count;
-    PB_SplitflapState_ModuleState modules[255]; 
+    pb_callback_t modules; 
+    uint8_t module_start; 
 } PB_SplitflapState;
 
 typedef struct _PB_SupervisorState { 
@@ -119,16 +188,23 @@ typedef struct _PB_FromSplitflap {
         PB_Log log;
         PB_Ack ack;
         PB_SupervisorState supervisor_state;
+        PB_BaudRateResponse baud_rate_response;
+        PB_ScheduleUploadResponse schedule_upload_response;
     } payload; 
 } PB_FromSplitflap;
 
 typedef struct _PB_ToSplitflap { 
     uint32_t nonce; 
+    pb_callback_t cb_payload;
     pb_size_t which_payload;
     union {
         PB_SplitflapCommand splitflap_command;
         PB_SplitflapConfig splitflap_config;
         PB_RequestState request_state;
+        PB_WindowConfig window_config;
+        PB_BaudRateChange baud_rate_change;
+        PB_Subscribe subscribe;
+        PB_ScheduleUpload schedule_upload;
     } payload; 
 } PB_ToSplitflap;
 
@@ -138,6 +214,14 @@ typedef struct _PB_ToSplitflap {
 #define _PB_SplitflapState_ModuleState_State_MAX PB_SplitflapState_ModuleState_State_STATE_DISABLED
 #define _PB_SplitflapState_ModuleState_State_ARRAYSIZE ((PB_SplitflapState_ModuleState_State)(PB_SplitflapState_ModuleState_State_STATE_DISABLED+1))
 
+#define _PB_BaudRateResponse_Status_MIN PB_BaudRateResponse_Status_ACCEPTED
+#define _PB_BaudRateResponse_Status_MAX PB_BaudRateResponse_Status_REVERTED
+#define _PB_BaudRateResponse_Status_ARRAYSIZE ((PB_BaudRateResponse_Status)(PB_BaudRateResponse_Status_REVERTED+1))
+
+#define _PB_ScheduleUploadResponse_Status_MIN PB_ScheduleUploadResponse_Status_OK
+#define _PB_ScheduleUploadResponse_Status_MAX PB_ScheduleUploadResponse_Status_FLASH_ERROR
+#define _PB_ScheduleUploadResponse_Status_ARRAYSIZE ((PB_ScheduleUploadResponse_Status)(PB_ScheduleUploadResponse_Status_FLASH_ERROR+1))
+
 #define _PB_SupervisorState_State_MIN PB_SupervisorState_State_UNKNOWN
 #define _PB_SupervisorState_State_MAX PB_SupervisorState_State_FAULT
 #define _PB_SupervisorState_State_ARRAYSIZE ((PB_SupervisorState_State)(PB_SupervisorState_State_FAULT+1))
@@ -150,44 +234,80 @@ typedef struct _PB_ToSplitflap {
 #define _PB_SplitflapCommand_ModuleCommand_Action_MAX PB_SplitflapCommand_ModuleCommand_Action_RESET_AND_HOME
 #define _PB_SplitflapCommand_ModuleCommand_Action_ARRAYSIZE ((PB_SplitflapCommand_ModuleCommand_Action)(PB_SplitflapCommand_ModuleCommand_Action_RESET_AND_HOME+1))
 
+#define _PB_BaudRateChange_Phase_MIN PB_BaudRateChange_Phase_PROPOSE
+#define _PB_BaudRateChange_Phase_MAX PB_BaudRateChange_Phase_CONFIRM
+#define _PB_BaudRateChange_Phase_ARRAYSIZE ((PB_BaudRateChange_Phase)(PB_BaudRateChange_Phase_CONFIRM+1))
+
+#define _PB_ScheduleUpload_Phase_MIN PB_ScheduleUpload_Phase_BEGIN
+#define _PB_ScheduleUpload_Phase_MAX PB_ScheduleUpload_Phase_COMMIT
+#define _PB_ScheduleUpload_Phase_ARRAYSIZE ((PB_ScheduleUpload_Phase)(PB_ScheduleUpload_Phase_COMMIT+1))
+
 
 #ifdef __cplusplus
 extern "C" {
 #endif
 
 /* Initializer values for message structs */
-#define PB_SplitflapState_init_default           {0, {PB_SplitflapState_ModuleState_init_default, PB_SplitflapState_ModuleState_init_default, PB_SplitflapState_ModuleState_init_default, PB_SplitflapState_ModuleState_init_default, PB_SplitflapState_ModuleState_init_default, PB_SplitflapState_ModuleState_init_default, PB_SplitflapState_ModuleState_init_default, PB_SplitflapState_ModuleState_init_default, PB_SplitflapState_ModuleState_init_default, PB_SplitflapState_ModuleState_init_default, PB_SplitflapState_ModuleState_init_default, PB_SplitflapState_ModuleState_init_default, PB_SplitflapState_ModuleState_init_default, PB_SplitflapState_ModuleState_init_default, PB_SplitflapState_ModuleState_init_default, PB_SplitflapState_ModuleState_init_default, PB_SplitflapState_ModuleState_init_default, PB_SplitflapState_ModuleState_init_default, PB_SplitflapState_ModuleState_init_default, PB_SplitflapState_ModuleState_init_default, PB_SplitflapState_ModuleState_init_default, PB_SplitflapState_ModuleState_init_default, PB_SplitflapState_ModuleState_init_default, PB_SplitflapState_ModuleState_init_default, PB_SplitflapState_ModuleState_init_default, PB_SplitflapState_ModuleState_init_default, PB_SplitflapState_ModuleState_init_default, PB_SplitflapState_ModuleState_init_default, PB_SplitflapState_ModuleState_init_default, PB_SplitflapState_ModuleState_init_default, PB_SplitflapState_ModuleState_init_default, PB_SplitflapState_ModuleState_init_default, PB_SplitflapState_ModuleState_init_default, PB_SplitflapState_ModuleState_init_default, PB_SplitflapState_ModuleState_init_default, PB_SplitflapState_ModuleState_init_default, PB_SplitflapState_ModuleState_init_default, PB_SplitflapState_ModuleState_init_default, PB_SplitflapState_ModuleState_init_default, PB_SplitflapState_ModuleState_init_default, PB_SplitflapState_ModuleState_init_default, PB_SplitflapState_ModuleState_init_default, PB_SplitflapState_ModuleState_init_default, PB_SplitflapState_ModuleState_init_default, PB_SplitflapState_ModuleState_init_default, PB_SplitflapState_ModuleState_init_default, PB_SplitflapState_ModuleState_init_default, PB_SplitflapState_ModuleState_init_default, PB_SplitflapState_ModuleState_init_default, PB_SplitflapState_ModuleState_init_default, PB_SplitflapState_ModuleState_init_default, PB_SplitflapState_ModuleState_init_default, PB_SplitflapState_ModuleState_init_default, PB_SplitflapState_ModuleState_init_default, PB_SplitflapState_ModuleState_init_default, PB_SplitflapState_ModuleState_init_default, PB_SplitflapState_ModuleState_init_default, PB_SplitflapState_ModuleState_init_default, PB_SplitflapState_ModuleState_init_default, PB_SplitflapState_ModuleState_init_default, PB_SplitflapState_ModuleState_init_default, PB_SplitflapState_ModuleState_init_default, PB_SplitflapState_ModuleState_init_default, PB_SplitflapState_ModuleState_init_default, PB_SplitflapState_ModuleState_init_default, PB_SplitflapState_ModuleState_init_default, PB_SplitflapState_ModuleState_init_default, PB_SplitflapState_ModuleState_init_default, PB_SplitflapState_ModuleState_init_default, PB_SplitflapState_ModuleState_init_default, PB_SplitflapState_ModuleState_init_default, PB_SplitflapState_ModuleState_init_default, PB_SplitflapState_ModuleState_init_default, PB_SplitflapState_ModuleState_init_default, PB_SplitflapState_ModuleState_init_default, PB_SplitflapState_ModuleState_init_default, PB_SplitflapState_ModuleState_init_default, PB_SplitflapState_ModuleState_init_default, PB_SplitflapState_ModuleState_init_default, PB_SplitflapState_ModuleState_init_default, PB_SplitflapState_ModuleState_init_default, PB_SplitflapState_ModuleState_init_default, PB_SplitflapState_ModuleState_init_default, PB_SplitflapState_ModuleState_init_default, PB_SplitflapState_ModuleState_init_default, PB_SplitflapState_ModuleState_init_default, PB_SplitflapState_ModuleState_init_default, PB_SplitflapState_ModuleState_init_default, PB_SplitflapState_ModuleState_init_default, PB_SplitflapState_ModuleState_init_default, PB_SplitflapState_ModuleState_init_default, PB_SplitflapState_ModuleState_init_default, PB_SplitflapState_ModuleState_init_default, PB_SplitflapState_ModuleState_init_default, PB_SplitflapState_ModuleState_init_default, PB_SplitflapState_ModuleState_init_default, PB_SplitflapState_ModuleState_init_default, PB_SplitflapState_ModuleState_init_default, PB_SplitflapState_ModuleState_init_default, PB_SplitflapState_ModuleState_init_default, PB_SplitflapState_ModuleState_init_default, PB_SplitflapState_ModuleState_init_default, PB_SplitflapState_ModuleState_init_default, PB_SplitflapState_ModuleState_init_default, PB_SplitflapState_ModuleState_init_default, PB_SplitflapState_ModuleState_init_default, PB_SplitflapState_ModuleState_init_default, PB_SplitflapState_ModuleState_init_default, PB_SplitflapState_ModuleState_init_default, PB_SplitflapState_ModuleState_init_default, PB_SplitflapState_ModuleState_init_default, PB_SplitflapState_ModuleState_init_default, PB_SplitflapState_ModuleState_init_default, PB_SplitflapState_ModuleState_init_default, PB_SplitflapState_ModuleState_init_default, PB_SplitflapState_ModuleState_init_default, PB_SplitflapState_ModuleState_init_default, PB_SplitflapState_ModuleState_init_default, PB_SplitflapState_ModuleState_init_default, PB_SplitflapState_ModuleState_init_default, PB_SplitflapState_ModuleState_init_default, PB_SplitflapState_ModuleState_init_default, PB_SplitflapState_ModuleState_init_default, PB_SplitflapState_ModuleState_init_default, PB_SplitflapState_ModuleState_init_default, PB_SplitflapState_ModuleState_init_default, PB_SplitflapState_ModuleState_init_default, PB_SplitflapState_ModuleState_init_default, PB_SplitflapState_ModuleState_init_default, PB_SplitflapState_ModuleState_init_default, PB_SplitflapState_ModuleState_init_default, PB_SplitflapState_ModuleState_init_default, PB_SplitflapState_ModuleState_init_default, PB_SplitflapState_ModuleState_init_default, PB_SplitflapState_ModuleState_init_default, PB_SplitflapState_ModuleState_init_default, PB_SplitflapState_ModuleState_init_default, PB_SplitflapState_ModuleState_init_default, PB_SplitflapState_ModuleState_init_default, PB_SplitflapState_ModuleState_init_default, PB_SplitflapState_ModuleState_init_default, PB_SplitflapState_ModuleState_init_default, PB_SplitflapState_ModuleState_init_default, PB_SplitflapState_ModuleState_init_default, PB_SplitflapState_ModuleState_init_default, PB_SplitflapState_ModuleState_init_default, PB_SplitflapState_ModuleState_init_default, PB_SplitflapState_ModuleState_init_default, PB_SplitflapState_ModuleState_init_default, PB_SplitflapState_ModuleState_init_default, PB_SplitflapState_ModuleState_init_default, PB_SplitflapState_ModuleState_init_default, PB_SplitflapState_ModuleState_init_default, PB_SplitflapState_ModuleState_init_default, PB_SplitflapState_ModuleState_init_default, PB_SplitflapState_ModuleState_init_default, PB_SplitflapState_ModuleState_init_default, PB_SplitflapState_ModuleState_init_default, PB_SplitflapState_ModuleState_init_default, PB_SplitflapState_ModuleState_init_default, PB_SplitflapState_ModuleState_init_default, PB_SplitflapState_ModuleState_init_default, PB_SplitflapState_ModuleState_init_default, PB_SplitflapState_ModuleState_init_default, PB_SplitflapState_ModuleState_init_default, PB_SplitflapState_ModuleState_init_default, PB_SplitflapState_ModuleState_init_default, PB_SplitflapState_ModuleState_init_default, PB_SplitflapState_ModuleState_init_default, PB_SplitflapState_ModuleState_init_default, PB_SplitflapState_ModuleState_init_default, PB_SplitflapState_ModuleState_init_default, PB_SplitflapState_ModuleState_init_default, PB_SplitflapState_ModuleState_init_default, PB_SplitflapState_ModuleState_init_default, PB_SplitflapState_ModuleState_init_default, PB_SplitflapState_ModuleState_init_default, PB_SplitflapState_ModuleState_init_default, PB_SplitflapState_ModuleState_init_default, PB_SplitflapState_ModuleState_init_default, PB_SplitflapState_ModuleState_init_default, PB_SplitflapState_ModuleState_init_default, PB_SplitflapState_ModuleState_init_default, PB_SplitflapState_ModuleState_init_default, PB_SplitflapState_ModuleState_init_default, PB_SplitflapState_ModuleState_init_default, PB_SplitflapState_ModuleState_init_default, PB_SplitflapState_ModuleState_init_default, PB_SplitflapState_ModuleState_init_default, PB_SplitflapState_ModuleState_init_default, PB_SplitflapState_ModuleState_init_default, PB_SplitflapState_ModuleState_init_default, PB_SplitflapState_ModuleState_init_default, PB_SplitflapState_ModuleState_init_default, PB_SplitflapState_ModuleState_init_default, PB_SplitflapState_ModuleState_init_default, PB_SplitflapState_ModuleState_init_default, PB_SplitflapState_ModuleState_init_default, PB_SplitflapState_ModuleState_init_default, PB_SplitflapState_ModuleState_init_default, PB_SplitflapState_ModuleState_init_default, PB_SplitflapState_ModuleState_init_default, PB_SplitflapState_ModuleState_init_default, PB_SplitflapState_ModuleState_init_default, PB_SplitflapState_ModuleState_init_default, PB_SplitflapState_ModuleState_init_default, PB_SplitflapState_ModuleState_init_default, PB_SplitflapState_ModuleState_init_default, PB_SplitflapState_ModuleState_init_default, PB_SplitflapState_ModuleState_init_default, PB_SplitflapState_ModuleState_init_default, PB_SplitflapState_ModuleState_init_default, PB_SplitflapState_ModuleState_init_default, PB_SplitflapState_ModuleState_init_default, PB_SplitflapState_ModuleState_init_default, PB_SplitflapState_ModuleState_init_default, PB_SplitflapState_ModuleState_init_default, PB_SplitflapState_ModuleState_init_default, PB_SplitflapState_ModuleState_init_default, PB_SplitflapState_ModuleState_init_default, PB_SplitflapState_ModuleState_init_default, PB_SplitflapState_ModuleState_init_default, PB_SplitflapState_ModuleState_init_default, PB_SplitflapState_ModuleState_init_default, PB_SplitflapState_ModuleState_init_default, PB_SplitflapState_ModuleState_init_default, PB_SplitflapState_ModuleState_init_default, PB_SplitflapState_ModuleState_init_default, PB_SplitflapState_ModuleState_init_default, PB_SplitflapState_ModuleState_init_default, PB_SplitflapState_ModuleState_init_default, PB_SplitflapState_ModuleState_init_default, PB_SplitflapState_ModuleState_init_default, PB_SplitflapState_ModuleState_init_default, PB_SplitflapState_ModuleState_init_default, PB_SplitflapState_ModuleState_init_default, PB_SplitflapState_ModuleState_init_default, PB_SplitflapState_ModuleState_init_default, PB_SplitflapState_ModuleState_init_default, PB_SplitflapState_ModuleState_init_default, PB_SplitflapState_ModuleState_init_default, PB_SplitflapState_ModuleState_init_default, PB_SplitflapState_ModuleState_init_default, PB_SplitflapState_ModuleState_init_default, PB_SplitflapState_ModuleState_init_default, PB_SplitflapState_ModuleState_init_default, PB_SplitflapState_ModuleState_init_default, PB_SplitflapState_ModuleState_init_default, PB_SplitflapState_ModuleState_init_default, PB_SplitflapState_ModuleState_init_default, PB_SplitflapState_ModuleState_init_default, PB_SplitflapState_ModuleState_init_default, PB_SplitflapState_ModuleState_init_default, PB_SplitflapState_ModuleState_init_default, PB_SplitflapState_ModuleState_init_default}}
+#define PB_SplitflapState_init_default           {{{NULL}, NULL}, 0}
 #define PB_SplitflapState_ModuleState_init_default {_PB_SplitflapState_ModuleState_State_MIN, 0, 0, 0, 0, 0}
 #define PB_Log_init_default                      {""}
-#define PB_Ack_init_default                      {0}
+#define PB_Ack_init_default                      {0, 0, 0, 0}
+#define PB_BaudRateResponse_init_default         {_PB_BaudRateResponse_Status_MIN, 0}
+#define PB_ScheduleUploadResponse_init_default   {_PB_ScheduleUpload_Phase_MIN, _PB_ScheduleUploadResponse_Status_MIN, 0, 0}
 #define PB_SupervisorState_init_default          {0, _PB_SupervisorState_State_MIN, 0, {PB_SupervisorState_PowerChannelState_init_default, PB_SupervisorState_PowerChannelState_init_default, PB_SupervisorState_PowerChannelState_init_default, PB_SupervisorState_PowerChannelState_init_default, PB_SupervisorState_PowerChannelState_init_default}, false, PB_SupervisorState_FaultInfo_init_default}
 #define PB_SupervisorState_PowerChannelState_init_default {0, 0, 0}
 #define PB_SupervisorState_FaultInfo_init_default {_PB_SupervisorState_FaultInfo_FaultType_MIN, "", 0}
 #define PB_FromSplitflap_init_default            {0, {PB_SplitflapState_init_default}}
-#define PB_SplitflapCommand_init_default         {0, {PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default, PB_SplitflapCommand_ModuleCommand_init_default}}
+#define PB_SplitflapCommand_init_default         {{{NULL}, NULL}}
 #define PB_SplitflapCommand_ModuleCommand_init_default {_PB_SplitflapCommand_ModuleCommand_Action_MIN, 0}
-#define PB_SplitflapConfig_init_default          {0, {PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default, PB_SplitflapConfig_ModuleConfig_init_default}}
+#define PB_SplitflapConfig_init_default          {{{NULL}, NULL}}
 #define PB_SplitflapConfig_ModuleConfig_init_default {0, 0, 0}
 #define PB_RequestState_init_default             {0}
-#define PB_ToSplitflap_init_default              {0, 0, {PB_SplitflapCommand_init_default}}
-#define PB_SplitflapState_init_zero              {0, {PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero, PB_SplitflapState_ModuleState_init_zero}}
+#define PB_Subscribe_init_default                {0, 0, 0, 0, 0}
+#define PB_WindowConfig_init_default             {0}
+#define PB_BaudRateChange_init_default           {_PB_BaudRateChange_Phase_MIN, 0}
+#define PB_ScheduleUpload_init_default           {_PB_ScheduleUpload_Phase_MIN, 0, 0, {0, {0}}, 0}
+#define PB_ToSplitflap_init_default              {0, {{NULL}, NULL}, 0, {PB_SplitflapCommand_init_default}}
+#define PB_SplitflapState_init_zero              {{{NULL}, NULL}, 0}
 #define PB_SplitflapState_ModuleState_init_zero  {_PB_SplitflapState_ModuleState_State_MIN, 0, 0, 0, 0, 0}
 #define PB_Log_init_zero                         {""}
-#define PB_Ack_init_zero                         {0}
+#define PB_Ack_init_zero                         {0, 0, 0, 0}
+#define PB_BaudRateResponse_init_zero            {_PB_BaudRateResponse_Status_MIN, 0}
+#define PB_ScheduleUploadResponse_init_zero      {_PB_ScheduleUpload_Phase_MIN, _PB_ScheduleUploadResponse_Status_MIN, 0, 0}
 #define PB_SupervisorState_init_zero             {0, _PB_SupervisorState_State_MIN, 0, {PB_SupervisorState_PowerChannelState_init_zero, PB_SupervisorState_PowerChannelState_init_zero, PB_SupervisorState_PowerChannelState_init_zero, PB_SupervisorState_PowerChannelState_init_zero, PB_SupervisorState_PowerChannelState_init_zero}, false, PB_SupervisorState_FaultInfo_init_zero}
 #define PB_SupervisorState_PowerChannelState_init_zero {0, 0, 0}
 #define PB_SupervisorState_FaultInfo_init_zero   {_PB_SupervisorState_FaultInfo_FaultType_MIN, "", 0}
 #define PB_FromSplitflap_init_zero               {0, {PB_SplitflapState_init_zero}}
-#define PB_SplitflapCommand_init_zero            {0, {PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero, PB_SplitflapCommand_ModuleCommand_init_zero}}
+#define PB_SplitflapCommand_init_zero            {{{NULL}, NULL}}
 #define PB_SplitflapCommand_ModuleCommand_init_zero {_PB_SplitflapCommand_ModuleCommand_Action_MIN, 0}
-#define PB_SplitflapConfig_init_zero             {0, {PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero, PB_SplitflapConfig_ModuleConfig_init_zero}}
+#define PB_SplitflapConfig_init_zero             {{{NULL}, NULL}}
 #define PB_SplitflapConfig_ModuleConfig_init_zero {0, 0, 0}
 #define PB_RequestState_init_zero                {0}
-#define PB_ToSplitflap_init_zero                 {0, 0, {PB_SplitflapCommand_init_zero}}
+#define PB_Subscribe_init_zero                   {0, 0, 0, 0, 0}
+#define PB_WindowConfig_init_zero                {0}
+#define PB_BaudRateChange_init_zero              {_PB_BaudRateChange_Phase_MIN, 0}
+#define PB_ScheduleUpload_init_zero              {_PB_ScheduleUpload_Phase_MIN, 0, 0, {0, {0}}, 0}
+#define PB_ToSplitflap_init_zero                 {0, {{NULL}, NULL}, 0, {PB_SplitflapCommand_init_zero}}
 
 /* Field tags (for use in manual encoding/decoding) */
 #define PB_Ack_nonce_tag                         1
+#define PB_Ack_cumulative_nonce_tag              2
+#define PB_Ack_selective_mask_tag                3
+#define PB_Ack_window_size_tag                   4
+#define PB_BaudRateChange_phase_tag              1
+#define PB_BaudRateChange_baud_rate_tag          2
+#define PB_BaudRateResponse_status_tag           1
+#define PB_BaudRateResponse_baud_rate_tag        2
 #define PB_Log_msg_tag                           1
+#define PB_ScheduleUpload_phase_tag              1
+#define PB_ScheduleUpload_size_tag               2
+#define PB_ScheduleUpload_offset_tag             3
+#define PB_ScheduleUpload_data_tag               4
+#define PB_ScheduleUpload_crc32_tag              5
+#define PB_ScheduleUploadResponse_phase_tag      1
+#define PB_ScheduleUploadResponse_status_tag     2
+#define PB_ScheduleUploadResponse_next_offset_tag 3
+#define PB_ScheduleUploadResponse_record_count_tag 4
 #define PB_SplitflapCommand_ModuleCommand_action_tag 1
 #define PB_SplitflapCommand_ModuleCommand_param_tag 2
 #define PB_SplitflapConfig_ModuleConfig_target_flap_index_tag 1
@@ -205,9 +325,16 @@ extern "C" {
 #define PB_SupervisorState_PowerChannelState_voltage_volts_tag 1
 #define PB_SupervisorState_PowerChannelState_current_amps_tag 2
 #define PB_SupervisorState_PowerChannelState_on_tag 3
+#define PB_Subscribe_min_interval_millis_tag     1
+#define PB_Subscribe_heartbeat_interval_millis_tag 2
+#define PB_Subscribe_module_start_tag            3
+#define PB_Subscribe_module_count_tag            4
+#define PB_Subscribe_field_mask_tag              5
+#define PB_WindowConfig_window_size_tag          1
 #define PB_SplitflapCommand_modules_tag          2
 #define PB_SplitflapConfig_modules_tag           1
 #define PB_SplitflapState_modules_tag            1
+#define PB_SplitflapState_module_start_tag       2
 #define PB_SupervisorState_uptime_millis_tag     1
 #define PB_SupervisorState_state_tag             2
 #define PB_SupervisorState_power_channels_tag    3
@@ -216,15 +343,22 @@ extern "C" {
 #define PB_FromSplitflap_log_tag                 2
 #define PB_FromSplitflap_ack_tag                 3
 #define PB_FromSplitflap_supervisor_state_tag    4
+#define PB_FromSplitflap_baud_rate_response_tag  5
+#define PB_FromSplitflap_schedule_upload_response_tag 6
 #define PB_ToSplitflap_nonce_tag                 1
 #define PB_ToSplitflap_splitflap_command_tag     2
 #define PB_ToSplitflap_splitflap_config_tag      3
 #define PB_ToSplitflap_request_state_tag         4
+#define PB_ToSplitflap_window_config_tag         5
+#define PB_ToSplitflap_baud_rate_change_tag      6
+#define PB_ToSplitflap_subscribe_tag             7
+#define PB_ToSplitflap_schedule_upload_tag       8
 
 /* Struct field encoding specification for nanopb */
 #define PB_SplitflapState_FIELDLIST(X, a) \
-X(a, STATIC,   REPEATED, MESSAGE,  modules,           1)
-#define PB_SplitflapState_CALLBACK NULL
+X(a, CALLBACK, REPEATED, MESSAGE,  modules,           1) \
+X(a, STATIC,   SINGULAR, UINT32,   module_start,      2)
+#define PB_SplitflapState_CALLBACK pb_default_field_callback
 #define PB_SplitflapState_DEFAULT NULL
 #define PB_SplitflapState_modules_MSGTYPE PB_SplitflapState_ModuleState
 
@@ -244,10 +378,27 @@ X(a, STATIC,   SINGULAR, STRING,   msg,               1)
 #define PB_Log_DEFAULT NULL
 
 #define PB_Ack_FIELDLIST(X, a) \
-X(a, STATIC,   SINGULAR, UINT32,   nonce,             1)
+X(a, STATIC,   SINGULAR, UINT32,   nonce,             1) \
+X(a, STATIC,   SINGULAR, UINT32,   cumulative_nonce,   2) \
+X(a, STATIC,   SINGULAR, UINT32,   selective_mask,    3) \
+X(a, STATIC,   SINGULAR, UINT32,   window_size,       4)
 #define PB_Ack_CALLBACK NULL
 #define PB_Ack_DEFAULT NULL
 
+#define PB_BaudRateResponse_FIELDLIST(X, a) \
+X(a, STATIC,   SINGULAR, UENUM,    status,            1) \
+X(a, STATIC,   SINGULAR, UINT32,   baud_rate,         2)
+#define PB_BaudRateResponse_CALLBACK NULL
+#define PB_BaudRateResponse_DEFAULT NULL
+
+#define PB_ScheduleUploadResponse_FIELDLIST(X, a) \
+X(a, STATIC,   SINGULAR, UENUM,    phase,             1) \
+X(a, STATIC,   SINGULAR, UENUM,    status,            2) \
+X(a, STATIC,   SINGULAR, UINT32,   next_offset,       3) \
+X(a, STATIC,   SINGULAR, UINT32,   record_count,      4)
+#define PB_ScheduleUploadResponse_CALLBACK NULL
+#define PB_ScheduleUploadResponse_DEFAULT NULL
+
 #define PB_SupervisorState_FIELDLIST(X, a) \
 X(a, STATIC,   SINGULAR, UINT32,   uptime_millis,     1) \
 X(a, STATIC,   SINGULAR, UENUM,    state,             2) \
@@ -276,17 +427,21 @@ X(a, STATIC,   SINGULAR, UINT32,   ts_millis,         3)
 X(a, STATIC,   ONEOF,    MESSAGE,  (payload,splitflap_state,payload.splitflap_state),   1) \
 X(a, STATIC,   ONEOF,    MESSAGE,  (payload,log,payload.log),   2) \
 X(a, STATIC,   ONEOF,    MESSAGE,  (payload,ack,payload.ack),   3) \
-X(a, STATIC,   ONEOF,    MESSAGE,  (payload,supervisor_state,payload.supervisor_state),   4)
+X(a, STATIC,   ONEOF,    MESSAGE,  (payload,supervisor_state,payload.supervisor_state),   4) \
+X(a, STATIC,   ONEOF,    MESSAGE,  (payload,baud_rate_response,payload.baud_rate_response),   5) \
+X(a, STATIC,   ONEOF,    MESSAGE,  (payload,schedule_upload_response,payload.schedule_upload_response),   6)
 #define PB_FromSplitflap_CALLBACK NULL
 #define PB_FromSplitflap_DEFAULT NULL
 #define PB_FromSplitflap_payload_splitflap_state_MSGTYPE PB_SplitflapState
 #define PB_FromSplitflap_payload_log_MSGTYPE PB_Log
 #define PB_FromSplitflap_payload_ack_MSGTYPE PB_Ack
 #define PB_FromSplitflap_payload_supervisor_state_MSGTYPE PB_SupervisorState
+#define PB_FromSplitflap_payload_baud_rate_response_MSGTYPE PB_BaudRateResponse
+#define PB_FromSplitflap_payload_schedule_upload_response_MSGTYPE PB_ScheduleUploadResponse
 
 #define PB_SplitflapCommand_FIELDLIST(X, a) \
-X(a, STATIC,   REPEATED, MESSAGE,  modules,           2)
-#define PB_SplitflapCommand_CALLBACK NULL
+X(a, CALLBACK, REPEATED, MESSAGE,  modules,           2)
+#define PB_SplitflapCommand_CALLBACK pb_default_field_callback
 #define PB_SplitflapCommand_DEFAULT NULL
 #define PB_SplitflapCommand_modules_MSGTYPE PB_SplitflapCommand_ModuleCommand
 
@@ -297,8 +452,8 @@ X(a, STATIC,   SINGULAR, UINT32,   param,             2)
 #define PB_SplitflapCommand_ModuleCommand_DEFAULT NULL
 
 #define PB_SplitflapConfig_FIELDLIST(X, a) \
-X(a, STATIC,   REPEATED, MESSAGE,  modules,           1)
-#define PB_SplitflapConfig_CALLBACK NULL
+X(a, CALLBACK, REPEATED, MESSAGE,  modules,           1)
+#define PB_SplitflapConfig_CALLBACK pb_default_field_callback
 #define PB_SplitflapConfig_DEFAULT NULL
 #define PB_SplitflapConfig_modules_MSGTYPE PB_SplitflapConfig_ModuleConfig
 
@@ -314,21 +469,60 @@ X(a, STATIC,   SINGULAR, UINT32,   reset_nonce,       3)
 #define PB_RequestState_CALLBACK NULL
 #define PB_RequestState_DEFAULT NULL
 
+#define PB_Subscribe_FIELDLIST(X, a) \
+X(a, STATIC,   SINGULAR, UINT32,   min_interval_millis,   1) \
+X(a, STATIC,   SINGULAR, UINT32,   heartbeat_interval_millis,   2) \
+X(a, STATIC,   SINGULAR, UINT32,   module_start,      3) \
+X(a, STATIC,   SINGULAR, UINT32,   module_count,      4) \
+X(a, STATIC,   SINGULAR, UINT32,   field_mask,        5)
+#define PB_Subscribe_CALLBACK NULL
+#define PB_Subscribe_DEFAULT NULL
+
+#define PB_WindowConfig_FIELDLIST(X, a) \
+X(a, STATIC,   SINGULAR, UINT32,   window_size,       1)
+#define PB_WindowConfig_CALLBACK NULL
+#define PB_WindowConfig_DEFAULT NULL
+
+#define PB_BaudRateChange_FIELDLIST(X, a) \
+X(a, STATIC,   SINGULAR, UENUM,    phase,             1) \
+X(a, STATIC,   SINGULAR, UINT32,   baud_rate,         2)
+#define PB_BaudRateChange_CALLBACK NULL
+#define PB_BaudRateChange_DEFAULT NULL
+
+#define PB_ScheduleUpload_FIELDLIST(X, a) \
+X(a, STATIC,   SINGULAR, UENUM,    phase,             1) \
+X(a, STATIC,   SINGULAR, UINT32,   size,              2) \
+X(a, STATIC,   SINGULAR, UINT32,   offset,            3) \
+X(a, STATIC,   SINGULAR, BYTES,    data,              4) \
+X(a, STATIC,   SINGULAR, UINT32,   crc32,             5)
+#define PB_ScheduleUpload_CALLBACK NULL
+#define PB_ScheduleUpload_DEFAULT NULL
+
 #define PB_ToSplitflap_FIELDLIST(X, a) \
 X(a, STATIC,   SINGULAR, UINT32,   nonce,             1) \
-X(a, STATIC,   ONEOF,    MESSAGE,  (payload,splitflap_command,payload.splitflap_command),   2) \
-X(a, STATIC,   ONEOF,    MESSAGE,  (payload,splitflap_config,payload.splitflap_config),   3) \
-X(a, STATIC,   ONEOF,    MESSAGE,  (payload,request_state,payload.request_state),   4)
+X(a, STATIC,   ONEOF,    MSG_W_CB, (payload,splitflap_command,payload.splitflap_command),   2) \
+X(a, STATIC,   ONEOF,    MSG_W_CB, (payload,splitflap_config,payload.splitflap_config),   3) \
+X(a, STATIC,   ONEOF,    MSG_W_CB, (payload,request_state,payload.request_state),   4) \
+X(a, STATIC,   ONEOF,    MSG_W_CB, (payload,window_config,payload.window_config),   5) \
+X(a, STATIC,   ONEOF,    MSG_W_CB, (payload,baud_rate_change,payload.baud_rate_change),   6) \
+X(a, STATIC,   ONEOF,    MSG_W_CB, (payload,subscribe,payload.subscribe),   7) \
+X(a, STATIC,   ONEOF,    MSG_W_CB, (payload,schedule_upload,payload.schedule_upload),   8)
 #define PB_ToSplitflap_CALLBACK NULL
 #define PB_ToSplitflap_DEFAULT NULL
 #define PB_ToSplitflap_payload_splitflap_command_MSGTYPE PB_SplitflapCommand
 #define PB_ToSplitflap_payload_splitflap_config_MSGTYPE PB_SplitflapConfig
 #define PB_ToSplitflap_payload_request_state_MSGTYPE PB_RequestState
+#define PB_ToSplitflap_payload_window_config_MSGTYPE PB_WindowConfig
+#define PB_ToSplitflap_payload_baud_rate_change_MSGTYPE PB_BaudRateChange
+#define PB_ToSplitflap_payload_subscribe_MSGTYPE PB_Subscribe
+#define PB_ToSplitflap_payload_schedule_upload_MSGTYPE PB_ScheduleUpload
 
 extern const pb_msgdesc_t PB_SplitflapState_msg;
 extern const pb_msgdesc_t PB_SplitflapState_ModuleState_msg;
 extern const pb_msgdesc_t PB_Log_msg;
 extern const pb_msgdesc_t PB_Ack_msg;
+extern const pb_msgdesc_t PB_BaudRateResponse_msg;
+extern const pb_msgdesc_t PB_ScheduleUploadResponse_msg;
 extern const pb_msgdesc_t PB_SupervisorState_msg;
 extern const pb_msgdesc_t PB_SupervisorState_PowerChannelState_msg;
 extern const pb_msgdesc_t PB_SupervisorState_FaultInfo_msg;
@@ -338,6 +532,10 @@ extern const pb_msgdesc_t PB_SplitflapCommand_ModuleCommand_msg;
 extern const pb_msgdesc_t PB_SplitflapConfig_msg;
 extern const pb_msgdesc_t PB_SplitflapConfig_ModuleConfig_msg;
 extern const pb_msgdesc_t PB_RequestState_msg;
+extern const pb_msgdesc_t PB_Subscribe_msg;
+extern const pb_msgdesc_t PB_WindowConfig_msg;
+extern const pb_msgdesc_t PB_BaudRateChange_msg;
+extern const pb_msgdesc_t PB_ScheduleUpload_msg;
 extern const pb_msgdesc_t PB_ToSplitflap_msg;
 
 /* Defines for backwards compatibility with code written before nanopb-0.4.0 */
@@ -345,6 +543,8 @@ extern const pb_msgdesc_t PB_ToSplitflap_msg;
 #define PB_SplitflapState_ModuleState_fields &PB_SplitflapState_ModuleState_msg
 #define PB_Log_fields &PB_Log_msg
 #define PB_Ack_fields &PB_Ack_msg
+#define PB_BaudRateResponse_fields &PB_BaudRateResponse_msg
+#define PB_ScheduleUploadResponse_fields &PB_ScheduleUploadResponse_msg
 #define PB_SupervisorState_fields &PB_SupervisorState_msg
 #define PB_SupervisorState_PowerChannelState_fields &PB_SupervisorState_PowerChannelState_msg
 #define PB_SupervisorState_FaultInfo_fields &PB_SupervisorState_FaultInfo_msg
@@ -354,23 +554,33 @@ extern const pb_msgdesc_t PB_ToSplitflap_msg;
 #define PB_SplitflapConfig_fields &PB_SplitflapConfig_msg
 #define PB_SplitflapConfig_ModuleConfig_fields &PB_SplitflapConfig_ModuleConfig_msg
 #define PB_RequestState_fields &PB_RequestState_msg
+#define PB_Subscribe_fields &PB_Subscribe_msg
+#define PB_WindowConfig_fields &PB_WindowConfig_msg
+#define PB_BaudRateChange_fields &PB_BaudRateChange_msg
+#define PB_ScheduleUpload_fields &PB_ScheduleUpload_msg
 #define PB_ToSplitflap_fields &PB_ToSplitflap_msg
 
 /* Maximum encoded size of messages (where known) */
-#define PB_Ack_size                              6
-#define PB_FromSplitflap_size                    4338
+#define PB_Ack_size                              21
+#define PB_BaudRateChange_size                   8
+#define PB_BaudRateResponse_size                 8
+/* PB_FromSplitflap_size depends on runtime parameters */
 #define PB_Log_size                              258
 #define PB_RequestState_size                     0
+#define PB_ScheduleUploadResponse_size           16
+#define PB_ScheduleUpload_size                   279
 #define PB_SplitflapCommand_ModuleCommand_size   5
-#define PB_SplitflapCommand_size                 1785
+/* PB_SplitflapCommand_size depends on runtime parameters */
 #define PB_SplitflapConfig_ModuleConfig_size     9
-#define PB_SplitflapConfig_size                  2805
+/* PB_SplitflapConfig_size depends on runtime parameters */
 #define PB_SplitflapState_ModuleState_size       15
-#define PB_SplitflapState_size                   4335
+/* PB_SplitflapState_size depends on runtime parameters */
+#define PB_Subscribe_size                        24
 #define PB_SupervisorState_FaultInfo_size        266
 #define PB_SupervisorState_PowerChannelState_size 12
 #define PB_SupervisorState_size                  347
-#define PB_ToSplitflap_size                      2814
+/* PB_ToSplitflap_size depends on runtime parameters */
+#define PB_WindowConfig_size                     3
 
 #ifdef __cplusplus
 } /* extern "C" */
@@ -0,0 +1,188 @@
+/*
+   Copyright 2022 Scott Bezek and the splitflap contributors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+#include "aircraft_json_scanner.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+AircraftJsonScanner::AircraftJsonScanner(AircraftHandler handler) : handler_(handler) {
+    reset();
+}
+
+void AircraftJsonScanner::reset() {
+    lex_state_ = LexState::DEFAULT;
+    error_ = false;
+    object_bits_ = 0;
+    depth_ = 0;
+    expect_key_ = false;
+    aircraft_depth_ = 0;
+    token_length_ = 0;
+    key_[0] = '\0';
+    aircraft_ = {};
+    aircraft_count_ = 0;
+}
+
+void AircraftJsonScanner::consume(const char* data, size_t length) {
+    size_t i = 0;
+    while (i < length && !error_) {
+        char c = data[i];
+        switch (lex_state_) {
+            case LexState::STRING:
+                if (c == '\\') {
+                    lex_state_ = LexState::STRING_ESCAPE;
+                } else if (c == '"') {
+                    lex_state_ = LexState::DEFAULT;
+                    token_[token_length_] = '\0';
+                    if (inObject() && expect_key_) {
+                        memcpy(key_, token_, token_length_ + 1);
+                    } else {
+                        value(true);
+                    }
+                } else if (token_length_ < AIRCRAFT_JSON_MAX_TOKEN_LENGTH) {
+                    token_[token_length_++] = c;
+                }
+                i++;
+                break;
+            case LexState::STRING_ESCAPE:
+                // None of the fields we pick out contain escapes, so just keep the escaped character as-is
+                if (token_length_ < AIRCRAFT_JSON_MAX_TOKEN_LENGTH) {
+                    token_[token_length_++] = c;
+                }
+                lex_state_ = LexState::STRING;
+                i++;
+                break;
+            case LexState::SCALAR:
+                if ((c >= '0' && c <= '9') || (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z')
+                        || c == '-' || c == '+' || c == '.') {
+                    if (token_length_ < AIRCRAFT_JSON_MAX_TOKEN_LENGTH) {
+                        token_[token_length_++] = c;
+                    }
+                    i++;
+                } else {
+                    // End of the scalar; this character is handled as a delimiter
+                    lex_state_ = LexState::DEFAULT;
+                    token_[token_length_] = '\0';
+                    value(false);
+                }
+                break;
+            case LexState::DEFAULT:
+                switch (c) {
+                    case ' ':
+                    case '\t':
+                    case '\r':
+                    case '\n':
+                        break;
+                    case '"':
+                        token_length_ = 0;
+                        lex_state_ = LexState::STRING;
+                        break;
+                    case '{':
+                        push(true);
+                        break;
+                    case '[':
+                        push(false);
+                        break;
+                    case '}':
+                        pop(true);
+                        break;
+                    case ']':
+                        pop(false);
+                        break;
+                    case ':':
+                        expect_key_ = false;
+                        break;
+                    case ',':
+                        expect_key_ = inObject();
+                        break;
+                    default:
+                        token_length_ = 0;
+                        token_[token_length_++] = c;
+                        lex_state_ = LexState::SCALAR;
+                        break;
+                }
+                i++;
+                break;
+        }
+    }
+}
+
+bool AircraftJsonScanner::inObject() const {
+    return depth_ > 0 && (object_bits_ & (1u << (depth_ - 1)));
+}
+
+void AircraftJsonScanner::push(bool object) {
+    if (depth_ >= AIRCRAFT_JSON_MAX_DEPTH) {
+        error_ = true;
+        return;
+    }
+    if (!object && depth_ == 1 && inObject() && strcmp(key_, "aircraft") == 0) {
+        // Entries of the top-level "aircraft" array are one level further in
+        aircraft_depth_ = depth_ + 2;
+    }
+
+    if (object) {
+        object_bits_ |= (1u << depth_);
+    } else {
+        object_bits_ &= ~(1u << depth_);
+    }
+    depth_++;
+    expect_key_ = object;
+
+    if (object && depth_ == aircraft_depth_) {
+        aircraft_ = {};
+    }
+}
+
+void AircraftJsonScanner::pop(bool object) {
+    if (depth_ == 0 || inObject() != object) {
+        error_ = true;
+        return;
+    }
+
+    if (aircraft_depth_ != 0) {
+        if (object && depth_ == aircraft_depth_) {
+            aircraft_count_++;
+            handler_(aircraft_);
+        } else if (!object && depth_ == aircraft_depth_ - 1) {
+            aircraft_depth_ = 0;
+        }
+    }
+    depth_--;
+    expect_key_ = false;
+}
+
+void AircraftJsonScanner::value(bool is_string) {
+    if (depth_ != aircraft_depth_ || !inObject()) {
+        return;
+    }
+
+    if (is_string) {
+        if (strcmp(key_, "hex") == 0) {
+            strncpy(aircraft_.hex, token_, sizeof(aircraft_.hex) - 1);
+        } else if (strcmp(key_, "flight") == 0) {
+            strncpy(aircraft_.flight, token_, sizeof(aircraft_.flight) - 1);
+            aircraft_.has_flight = true;
+        }
+    } else {
+        if (strcmp(key_, "alt_geom") == 0) {
+            aircraft_.alt_geom = strtof(token_, NULL);
+        } else if (strcmp(key_, "lat") == 0) {
+            aircraft_.lat = strtof(token_, NULL);
+        } else if (strcmp(key_, "lon") == 0) {
+            aircraft_.lon = strtof(token_, NULL);
+        }
+    }
+}
@@ -0,0 +1,100 @@
+/*
+   Copyright 2022 Scott Bezek and the splitflap contributors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+#pragma once
+
+#include <functional>
+#include <stddef.h>
+#include <stdint.h>
+
+// Deepest nesting of arrays/objects that can be scanned
+#define AIRCRAFT_JSON_MAX_DEPTH 32
+
+// Longest scalar token (number, string, literal) that's kept; anything longer is truncated
+#define AIRCRAFT_JSON_MAX_TOKEN_LENGTH 31
+
+struct AircraftRecord {
+    // ICAO address; non-ICAO addresses are prefixed with '~'
+    char hex[8];
+    // Callsign as broadcast, including any trailing padding
+    char flight[AIRCRAFT_JSON_MAX_TOKEN_LENGTH + 1];
+    bool has_flight;
+    // 0 if not known
+    float alt_geom;
+    float lat;
+    float lon;
+};
+
+typedef std::function<void(const AircraftRecord& aircraft)> AircraftHandler;
+
+/**
+ * Incremental (SAX-style) scanner for dump1090/readsb's aircraft.json.
+ *
+ * Data can be fed in arbitrary chunks as it arrives. The fields of each entry in the top-level "aircraft"
+ * array are picked out as they're scanned, and the handler is called as soon as each entry is complete, so
+ * memory use is constant regardless of how many aircraft are in the document. Everything else is skipped.
+ */
+class AircraftJsonScanner {
+    public:
+        AircraftJsonScanner(AircraftHandler handler);
+
+        // Prepares to scan a new document
+        void reset();
+
+        void consume(const char* data, size_t length);
+
+        // True if the document was malformed (so far), or nested too deeply
+        bool error() const {
+            return error_;
+        }
+
+        // Number of aircraft entries scanned so far
+        uint32_t aircraftCount() const {
+            return aircraft_count_;
+        }
+
+    private:
+        enum class LexState {
+            DEFAULT,
+            STRING,
+            STRING_ESCAPE,
+            SCALAR,
+        };
+
+        AircraftHandler handler_;
+
+        LexState lex_state_;
+        bool error_;
+
+        // Bit n is set if the container at depth n + 1 is an object (rather than an array)
+        uint32_t object_bits_;
+        uint8_t depth_;
+        bool expect_key_;
+
+        // Depth of the "aircraft" array's entries (0 if not inside it)
+        uint8_t aircraft_depth_;
+
+        char token_[AIRCRAFT_JSON_MAX_TOKEN_LENGTH + 1];
+        uint8_t token_length_;
+        char key_[AIRCRAFT_JSON_MAX_TOKEN_LENGTH + 1];
+
+        AircraftRecord aircraft_;
+        uint32_t aircraft_count_;
+
+        void push(bool object);
+        void pop(bool object);
+        void value(bool is_string);
+        bool inObject() const;
+};
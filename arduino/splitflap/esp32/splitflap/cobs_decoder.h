@@ -0,0 +1,123 @@
+/*
+   Copyright 2022 Scott Bezek and the splitflap contributors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+#pragma once
+
+#include <functional>
+#include <stdint.h>
+#include <string.h>
+
+// Worst-case COBS-encoded size (excluding the 0 delimiter) of a packet of the given size
+#define COBS_MAX_ENCODED_SIZE(size) ((size) + (size) / 254 + 1)
+
+typedef std::function<void(const uint8_t* buffer, size_t size)> CobsPacketHandler;
+
+/**
+ * COBS (Consistent Overhead Byte Stuffing) decoder for 0-delimited packets that works on whole chunks of
+ * received data at a time.
+ *
+ * Received bytes are written directly into the decoder's buffer (see rxBuffer/consume), delimiters are found
+ * with memchr, and each complete frame is decoded in place before being passed to the packet handler, so
+ * there is no per-byte call overhead and no second copy of the packet. Frames whose encoded size exceeds
+ * MAX_ENCODED_SIZE are dropped in their entirety.
+ */
+template <size_t MAX_ENCODED_SIZE>
+class CobsDecoder {
+    public:
+        CobsDecoder(CobsPacketHandler packet_handler) : packet_handler_(packet_handler) {}
+
+        /** Where to write newly received bytes; at most rxBufferSize() of them. */
+        uint8_t* rxBuffer() {
+            return buffer_ + size_;
+        }
+
+        size_t rxBufferSize() {
+            return sizeof(buffer_) - size_;
+        }
+
+        /** Processes count bytes that were written to rxBuffer(), invoking the packet handler for each complete packet. */
+        void consume(size_t count) {
+            uint8_t* frame_start = buffer_;
+            uint8_t* scan_start = buffer_ + size_;
+            uint8_t* end = scan_start + count;
+
+            uint8_t* delimiter;
+            while ((delimiter = (uint8_t*)memchr(scan_start, 0, end - scan_start)) != NULL) {
+                if (discarding_) {
+                    // Tail end of an oversized frame
+                    discarding_ = false;
+                } else if (delimiter > frame_start) {
+                    size_t decoded_size = decode(frame_start, delimiter - frame_start);
+                    if (decoded_size > 0) {
+                        packet_handler_(frame_start, decoded_size);
+                    } else {
+                        invalid_frames_++;
+                    }
+                }
+                frame_start = scan_start = delimiter + 1;
+            }
+
+            if (discarding_) {
+                size_ = 0;
+                return;
+            }
+
+            // Keep the partial frame (if any) at the start of the buffer
+            size_ = end - frame_start;
+            if (size_ == sizeof(buffer_)) {
+                // No delimiter within the max frame size; drop everything up to the next one
+                discarding_ = true;
+                size_ = 0;
+                invalid_frames_++;
+            } else if (frame_start != buffer_ && size_ > 0) {
+                memmove(buffer_, frame_start, size_);
+            }
+        }
+
+        /** Number of frames dropped so far because they were oversized or not valid COBS. */
+        uint32_t invalidFrames() {
+            return invalid_frames_;
+        }
+
+    private:
+        CobsPacketHandler packet_handler_;
+
+        // Room for one byte past the max frame size, to tell when a frame is too large
+        uint8_t buffer_[MAX_ENCODED_SIZE + 1];
+        size_t size_ = 0;
+        bool discarding_ = false;
+        uint32_t invalid_frames_ = 0;
+
+        // Decodes in place (the decoded data is never longer than the encoded data). Returns 0 if invalid.
+        static size_t decode(uint8_t* buffer, size_t size) {
+            size_t read = 0;
+            size_t write = 0;
+            while (read < size) {
+                uint8_t code = buffer[read++];
+                if (read + code - 1 > size) {
+                    return 0;
+                }
+                memmove(buffer + write, buffer + read, code - 1);
+                read += code - 1;
+                write += code - 1;
+
+                // Every block except for full ones and the last one implies a trailing zero
+                if (code != 0xFF && read < size) {
+                    buffer[write++] = 0;
+                }
+            }
+            return write;
+        }
+};
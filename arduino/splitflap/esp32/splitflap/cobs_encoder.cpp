@@ -0,0 +1,50 @@
+/*
+   Copyright 2022 Scott Bezek and the splitflap contributors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+#include "cobs_encoder.h"
+
+CobsEncoder::CobsEncoder(Stream& stream) : stream_(stream) {
+}
+
+void CobsEncoder::begin() {
+    block_size_ = 1;
+}
+
+void CobsEncoder::write(const uint8_t* buffer, size_t size) {
+    for (size_t i = 0; i < size; i++) {
+        if (buffer[i] == 0) {
+            // The zero is implied by the end of the block
+            writeBlock();
+            continue;
+        }
+
+        block_[block_size_++] = buffer[i];
+        if (block_size_ == MAX_BLOCK_DATA + 1) {
+            // Full block (code 0xFF), which does *not* imply a zero after it
+            writeBlock();
+        }
+    }
+}
+
+void CobsEncoder::end() {
+    writeBlock();
+    stream_.write((uint8_t)0);
+}
+
+void CobsEncoder::writeBlock() {
+    block_[0] = block_size_;
+    stream_.write(block_, block_size_);
+    block_size_ = 1;
+}
@@ -0,0 +1,52 @@
+/*
+   Copyright 2022 Scott Bezek and the splitflap contributors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+#pragma once
+
+#include <Arduino.h>
+
+/**
+ * Streaming COBS (Consistent Overhead Byte Stuffing) encoder that writes 0-delimited packets directly
+ * to a Stream.
+ *
+ * Rather than needing the entire packet up front and encoding it into a second full-size buffer, this
+ * only ever holds a single COBS block (at most 254 data bytes) before writing it out, so packets of any
+ * size can be sent with constant memory as they are being produced.
+ */
+class CobsEncoder {
+    public:
+        CobsEncoder(Stream& stream);
+
+        /** Starts a new packet, discarding any partially-encoded data. */
+        void begin();
+
+        /** Appends data to the current packet. */
+        void write(const uint8_t* buffer, size_t size);
+
+        /** Finishes the current packet and writes the packet delimiter. */
+        void end();
+
+    private:
+        // Max number of non-zero data bytes in a single COBS block (code byte 0xFF)
+        static const uint8_t MAX_BLOCK_DATA = 254;
+
+        Stream& stream_;
+
+        // block_[0] is reserved for the code byte, which isn't known until the block is complete
+        uint8_t block_[MAX_BLOCK_DATA + 1];
+        uint8_t block_size_ = 1;
+
+        void writeBlock();
+};
@@ -1,21 +1,65 @@
-/* Simple public domain implementation of the standard CRC32 checksum.
- * Outputs the checksum for each file given as a command line argument.
- * Invalid file names and files that cause errors are silently skipped.
- * The program reads from stdin if it is called with no arguments. */
+/*
+   Copyright 2022 Scott Bezek and the splitflap contributors
 
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
 #include "crc32.h"
 
-static uint32_t crc32_for_byte(uint32_t r) {
-  for(int j = 0; j < 8; ++j)
-    r = (r & 1? 0: (uint32_t)0xEDB88320L) ^ r >> 1;
-  return r ^ (uint32_t)0xFF000000L;
+#if defined(ESP32)
+#include <rom/crc.h>
+#else
+#include "crc32_table.h"
+#endif
+
+#if defined(ESP32)
+
+void crc32(const void *data, size_t n_bytes, uint32_t* crc) {
+    // The ROM implementation is table-driven from mask ROM, so it needs no flash or RAM for tables, and
+    // like zlib it inverts the running value on the way in and out, so calls chain incrementally.
+    *crc = crc32_le(*crc, (const uint8_t*)data, n_bytes);
+}
+
+#else
+
+static inline uint32_t read_le32(const uint8_t* p) {
+    return p[0] | (p[1] << 8) | (p[2] << 16) | ((uint32_t)p[3] << 24);
 }
 
 void crc32(const void *data, size_t n_bytes, uint32_t* crc) {
-  static uint32_t table[0x100];
-  if(!*table)
-    for(size_t i = 0; i < 0x100; ++i)
-      table[i] = crc32_for_byte(i);
-  for(size_t i = 0; i < n_bytes; ++i)
-    *crc = table[(uint8_t)*crc ^ ((uint8_t*)data)[i]] ^ *crc >> 8;
+    const uint8_t* p = (const uint8_t*)data;
+    uint32_t c = ~*crc;
+
+    // Slicing-by-8: fold in 8 bytes per iteration using independent table lookups
+    while (n_bytes >= 8) {
+        uint32_t one = read_le32(p) ^ c;
+        uint32_t two = read_le32(p + 4);
+        c = CRC32::TABLE[7][one & 0xFF]
+          ^ CRC32::TABLE[6][(one >> 8) & 0xFF]
+          ^ CRC32::TABLE[5][(one >> 16) & 0xFF]
+          ^ CRC32::TABLE[4][one >> 24]
+          ^ CRC32::TABLE[3][two & 0xFF]
+          ^ CRC32::TABLE[2][(two >> 8) & 0xFF]
+          ^ CRC32::TABLE[1][(two >> 16) & 0xFF]
+          ^ CRC32::TABLE[0][two >> 24];
+        p += 8;
+        n_bytes -= 8;
+    }
+
+    while (n_bytes--) {
+        c = CRC32::TABLE[0][(c ^ *p++) & 0xFF] ^ (c >> 8);
+    }
+
+    *crc = ~c;
 }
+
+#endif
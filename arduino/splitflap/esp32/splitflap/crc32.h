@@ -1,11 +1,28 @@
-/* Simple public domain implementation of the standard CRC32 checksum.
- * Outputs the checksum for each file given as a command line argument.
- * Invalid file names and files that cause errors are silently skipped.
- * The program reads from stdin if it is called with no arguments. */
+/*
+   Copyright 2022 Scott Bezek and the splitflap contributors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
 #pragma once
 
-#include <stdio.h>
+#include <stddef.h>
 #include <stdint.h>
-#include <stdlib.h>
 
+/**
+ * Updates a standard CRC32 checksum (identical to zlib's crc32) with n_bytes of data.
+ *
+ * Start with *crc = 0. The checksum can be computed incrementally over consecutive chunks of a
+ * message by passing the same crc value to each call, in order; after the last call *crc holds the
+ * checksum of the entire message.
+ */
 void crc32(const void *data, size_t n_bytes, uint32_t* crc);
@@ -35,15 +35,60 @@ DisplayTask::~DisplayTask() {
 static const int32_t X_OFFSET = 10;
 static const int32_t Y_OFFSET = 10;
 
+// Extra pixels that are worth pushing to save a separate transfer (which has to set up a new address window)
+static const int32_t MERGE_SLACK_PIXELS = 64;
+
+static const uint32_t STATS_LOG_INTERVAL_MILLIS = 30000;
+
+// Target frame rate (25fps), and how much of each frame may be spent drawing modules before the rest of
+// the changes are deferred to the next frame
+static const uint32_t FRAME_INTERVAL_MILLIS = 40;
+static const uint32_t FRAME_BUDGET_MICROS = 20000;
+
+static const uint32_t BLINK_PERIOD_MILLIS = 400;
+
+// Characters for the status glyphs that follow the flap glyphs (see GLYPH_PANIC etc.)
+static const char STATUS_GLYPH_CHARS[NUM_GLYPHS - NUM_FLAPS] = {'~', '*', '?', ' '};
+
+static DisplayRect rectUnion(const DisplayRect& a, const DisplayRect& b) {
+    int32_t x = min(a.x, b.x);
+    int32_t y = min(a.y, b.y);
+    return {
+        .x = x,
+        .y = y,
+        .w = max(a.x + a.w, b.x + b.w) - x,
+        .h = max(a.y + a.h, b.y + b.h) - y,
+    };
+}
+
+static int32_t rectArea(const DisplayRect& r) {
+    return r.w * r.h;
+}
+
 void DisplayTask::run() {
     tft_.begin();
     tft_.invertDisplay(1);
     tft_.setRotation(1);
 
-    tft_.setTextFont(0);
-    tft_.setTextColor(0xFFFF, TFT_BLACK);
+    // DMA can't read from PSRAM, so keep the framebuffer in internal RAM
+    spr_.setAttribute(PSRAM_ENABLE, false);
+    spr_.setColorDepth(16);
+    framebuffer_ = (uint16_t*)spr_.createSprite(tft_.width(), tft_.height());
+    if (framebuffer_ != nullptr) {
+        canvas_ = &spr_;
+        dma_enabled_ = tft_.initDMA();
+    } else {
+        // Not enough contiguous internal RAM left (e.g. a build with more features enabled), so draw straight to
+        // the display instead. Updates are slower and may flicker, but everything still works.
+        canvas_ = &tft_;
+        log("Display: no memory for framebuffer, drawing unbuffered");
+    }
+
+    canvas_->setTextFont(0);
+    canvas_->setTextColor(0xFFFF, TFT_BLACK);
 
-    tft_.fillScreen(TFT_BLACK);
+    canvas_->fillRect(0, 0, canvas_->width(), canvas_->height(), TFT_BLACK);
+    markDirty(0, 0, canvas_->width(), canvas_->height());
 
     // Automatically scale display based on DISPLAY_COLUMNS (see display_layouts.h)
     int32_t module_width = 20;
@@ -62,85 +107,54 @@ void DisplayTask::run() {
         module_text_size = 2;
     }
 
-    tft_.fillRect(X_OFFSET, Y_OFFSET, DISPLAY_COLUMNS * (module_width + 1) + 1, rows * (module_height + 1) + 1, 0x2104);
+    canvas_->fillRect(X_OFFSET, Y_OFFSET, DISPLAY_COLUMNS * (module_width + 1) + 1, rows * (module_height + 1) + 1, 0x2104);
 
+    // Resolve the layout once up front, rather than for every module update
     uint8_t module_row, module_col;
-    int32_t module_x, module_y;
+    for (uint8_t i = 0; i < NUM_MODULES; i++) {
+        getLayoutPosition(i, &module_row, &module_col);
+
+        // Add 1 to width/height as a separator line between modules
+        module_rects_[i] = {
+            .x = X_OFFSET + 1 + module_col * (module_width + 1),
+            .y = Y_OFFSET + 1 + module_row * (module_height + 1),
+            .w = module_width,
+            .h = module_height,
+        };
+    }
+    renderGlyphs(module_width, module_height, module_text_size);
+
+    // Changes to the splitflap state or messages wake the task up early (see waitForNextFrame)
+    splitflap_task_.addStateChangeListener(xTaskGetCurrentTaskHandle());
+
     SplitflapState last_state = {};
     String last_messages[countof(messages_)] = {};
+    bool blink = false;
     while(1) {
-        SplitflapState state = splitflap_task_.getState();
-        if (state != last_state) {
-            tft_.setTextSize(module_text_size);
-            for (uint8_t i = 0; i < NUM_MODULES; i++) {
-                SplitflapModuleState& s = state.modules[i];
-                if (s == last_state.modules[i]) {
-                    continue;
-                }
+        uint32_t frame_start_micros = micros();
+        last_frame_millis_ = millis();
 
-                uint16_t background = 0x0000;
-                uint16_t foreground = 0xFFFF;
-
-                bool blink = (millis() / 400) % 2;
-
-                char c;
-                switch (s.state) {
-                    case NORMAL:
-                        c = flaps[s.flap_index];
-                        if (s.moving) {
-                            // use a dimmer color when moving
-                            foreground = 0x6b4d;
-                        }
-
-                        // You can add special-case color handling here if desired:
-                        // if (c == 'w') {
-                        //     c = ' ';
-                        //     background = 0xFFFF;
-                        // } else if (c == 'y') {
-                        //     c = ' ';
-                        //     background = 0xffe0;
-                        // } else if (c == 'o') {
-                        //     c = ' ';
-                        //     background = 0xfd00;
-                        // } else if (c == 'g') {
-                        //     c = ' ';
-                        //     background = 0x46a0;
-                        // } else if (c == 'p') {
-                        //     c = ' ';
-                        //     background = 0xd938;
-                        // }
-                        break;
-                    case PANIC:
-                        c = '~';
-                        background = blink ? 0xD000 : 0;
-                        break;
-                    case STATE_DISABLED:
-                        c = '*';
-                        break;
-                    case LOOK_FOR_HOME:
-                        c = '?';
-                        background = blink ? 0x6018 : 0;
-                        break;
-                    case SENSOR_ERROR:
-                        c = ' ';
-                        background = blink ? 0xD461 : 0;
-                        break;
-                    default:
-                        c = ' ';
-                        break;
-                }
-                getLayoutPosition(i, &module_row, &module_col);
+        bool new_blink = (last_frame_millis_ / BLINK_PERIOD_MILLIS) % 2;
+        bool blink_changed = new_blink != blink;
+        blink = new_blink;
 
-                // Add 1 to width/height as a separator line between modules
-                module_x = X_OFFSET + 1 + module_col * (module_width + 1);
-                module_y = Y_OFFSET + 1 + module_row * (module_height + 1);
-
-                tft_.setTextColor(foreground, background);
-                tft_.fillRect(module_x, module_y, module_width, module_height, background);
-                tft_.setCursor(module_x + 1, module_y + 2);
-                tft_.printf("%c", c);
+        // Modules that don't fit in this frame's budget stay different from last_state, so they're picked
+        // up in the next frame
+        SplitflapState state = splitflap_task_.getState();
+        bool modules_pending = false;
+        bool drawn = false;
+        for (uint8_t i = 0; i < NUM_MODULES; i++) {
+            SplitflapModuleState& s = state.modules[i];
+            if (s == last_state.modules[i] && !(animated_[i] && blink_changed)) {
+                continue;
+            }
+            if (micros() - frame_start_micros > FRAME_BUDGET_MICROS) {
+                modules_pending = true;
+                break;
             }
-            last_state = state;
+            drawModule(i, s, blink);
+            last_state.modules[i] = s;
+            drawn = true;
         }
 
         const int message_height = 10;
@@ -156,21 +170,296 @@ void DisplayTask::run() {
             }
         }
         if (redraw_messages) {
-            tft_.setTextSize(message_text_size);
-            tft_.setTextColor(TFT_WHITE, TFT_BLACK);
-            tft_.fillRect(0, tft_.height() - message_height * countof(messages_), tft_.width(), message_height * countof(messages_), TFT_BLACK);
+            canvas_->setTextSize(message_text_size);
+            canvas_->setTextColor(TFT_WHITE, TFT_BLACK);
+            canvas_->fillRect(0, canvas_->height() - message_height * countof(messages_), canvas_->width(), message_height * countof(messages_), TFT_BLACK);
             for (uint8_t i = 0; i < countof(messages_); i++) {
-                int y = tft_.height() - message_height * (countof(messages_) - i);
-                tft_.drawString(last_messages[i], 2, y);
+                int y = canvas_->height() - message_height * (countof(messages_) - i);
+                canvas_->drawString(last_messages[i], 2, y);
+            }
+            markDirty(0, canvas_->height() - message_height * countof(messages_), canvas_->width(), message_height * countof(messages_));
+            drawn = true;
+        }
+
+        if (drawn) {
+            pushDirtyRects();
+
+            uint32_t frame_micros = micros() - frame_start_micros;
+            stats_frames_++;
+            stats_total_micros_ += frame_micros;
+            stats_max_micros_ = max(stats_max_micros_, frame_micros);
+        }
+
+        if (millis() - stats_last_log_millis_ > STATS_LOG_INTERVAL_MILLIS) {
+            logStats();
+        }
+
+        waitForNextFrame(modules_pending);
+    }
+}
+
+void DisplayTask::waitForNextFrame(bool frame_pending) {
+    uint32_t now = millis();
+    uint32_t wait_millis;
+    if (frame_pending) {
+        wait_millis = 0;
+    } else if (animated_count_ > 0) {
+        // Wake up for the next blink phase
+        wait_millis = BLINK_PERIOD_MILLIS - now % BLINK_PERIOD_MILLIS;
+    } else {
+        // Nothing to animate, so just wait for a change (or for the next stats log)
+        wait_millis = STATS_LOG_INTERVAL_MILLIS;
+    }
+    if (wait_millis > 0) {
+        ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(wait_millis));
+    }
+
+    // Changes that arrive faster than the frame rate are batched into the next frame
+    uint32_t elapsed = millis() - last_frame_millis_;
+    if (elapsed < FRAME_INTERVAL_MILLIS) {
+        delay(FRAME_INTERVAL_MILLIS - elapsed);
+    }
+}
+
+void DisplayTask::drawModule(uint8_t i, const SplitflapModuleState& s, bool blink) {
+    uint16_t background = 0x0000;
+    uint16_t foreground = 0xFFFF;
+
+    uint8_t glyph;
+    switch (s.state) {
+        case NORMAL:
+            glyph = s.flap_index;
+            if (s.moving) {
+                // use a dimmer color when moving
+                foreground = 0x6b4d;
+            }
+
+            // You can add special-case color handling here if desired:
+            // if (flaps[s.flap_index] == 'w') {
+            //     glyph = GLYPH_BLANK;
+            //     background = 0xFFFF;
+            // } else if (flaps[s.flap_index] == 'y') {
+            //     glyph = GLYPH_BLANK;
+            //     background = 0xffe0;
+            // } else if (flaps[s.flap_index] == 'o') {
+            //     glyph = GLYPH_BLANK;
+            //     background = 0xfd00;
+            // } else if (flaps[s.flap_index] == 'g') {
+            //     glyph = GLYPH_BLANK;
+            //     background = 0x46a0;
+            // } else if (flaps[s.flap_index] == 'p') {
+            //     glyph = GLYPH_BLANK;
+            //     background = 0xd938;
+            // }
+            break;
+        case PANIC:
+            glyph = GLYPH_PANIC;
+            background = blink ? 0xD000 : 0;
+            break;
+        case STATE_DISABLED:
+            glyph = GLYPH_DISABLED;
+            break;
+        case LOOK_FOR_HOME:
+            glyph = GLYPH_LOOK_FOR_HOME;
+            background = blink ? 0x6018 : 0;
+            break;
+        case SENSOR_ERROR:
+            glyph = GLYPH_BLANK;
+            background = blink ? 0xD461 : 0;
+            break;
+        default:
+            glyph = GLYPH_BLANK;
+            break;
+    }
+
+    // Status indicators blink, so they need to be redrawn on the blink cadence even when the state doesn't change
+    bool animated = s.state == PANIC || s.state == LOOK_FOR_HOME || s.state == SENSOR_ERROR;
+    if (animated != animated_[i]) {
+        animated_[i] = animated;
+        if (animated) {
+            animated_count_++;
+        } else {
+            animated_count_--;
+        }
+    }
+
+    const DisplayRect& rect = module_rects_[i];
+    drawGlyph(rect, glyph, foreground, background);
+    markDirty(rect.x, rect.y, rect.w, rect.h);
+}
+
+void DisplayTask::renderGlyphs(int32_t width, int32_t height, uint8_t text_size) {
+    assert(width <= GLYPH_MAX_WIDTH && height <= GLYPH_MAX_HEIGHT);
+
+    // Rasterize each character with the GFX font once, keeping just a 1-bit mask so the colors can be
+    // applied when blitting
+    TFT_eSprite glyph_sprite = TFT_eSprite(&tft_);
+    glyph_sprite.setColorDepth(16);
+    void* glyph_buffer = glyph_sprite.createSprite(width, height);
+    assert(glyph_buffer != nullptr);
+    glyph_sprite.setTextFont(0);
+    glyph_sprite.setTextSize(text_size);
+    glyph_sprite.setTextColor(TFT_WHITE, TFT_BLACK);
+
+    for (uint8_t g = 0; g < NUM_GLYPHS; g++) {
+        glyph_sprite.fillSprite(TFT_BLACK);
+        glyph_sprite.setCursor(1, 2);
+        glyph_sprite.printf("%c", g < NUM_FLAPS ? flaps[g] : STATUS_GLYPH_CHARS[g - NUM_FLAPS]);
+
+        uint8_t* mask = glyphs_[g];
+        memset(mask, 0, GLYPH_MAX_BYTES);
+        uint32_t bit = 0;
+        for (int32_t y = 0; y < height; y++) {
+            for (int32_t x = 0; x < width; x++, bit++) {
+                if (glyph_sprite.readPixel(x, y) != TFT_BLACK) {
+                    mask[bit / 8] |= 1 << (bit % 8);
+                }
             }
         }
+    }
+    glyph_sprite.deleteSprite();
+}
 
-        delay(10);
+void DisplayTask::drawGlyph(const DisplayRect& rect, uint8_t glyph, uint16_t foreground, uint16_t background) {
+    // The sprite stores pixels byte-swapped, ready to be sent to the display
+    uint16_t fg = (foreground >> 8) | (foreground << 8);
+    uint16_t bg = (background >> 8) | (background << 8);
+
+    const uint8_t* mask = glyphs_[glyph];
+    if (framebuffer_ == nullptr) {
+        // Unbuffered, so send each row straight to the display (which clips it)
+        uint16_t row[GLYPH_MAX_WIDTH];
+        uint32_t bit = 0;
+        for (int32_t y = 0; y < rect.h; y++) {
+            for (int32_t x = 0; x < rect.w; x++, bit++) {
+                row[x] = (mask[bit / 8] & (1 << (bit % 8))) ? fg : bg;
+            }
+            tft_.pushImage(rect.x, rect.y + y, rect.w, 1, row);
+        }
+        return;
+    }
+
+    int32_t x_end = min(rect.x + rect.w, (int32_t)spr_.width());
+    int32_t y_end = min(rect.y + rect.h, (int32_t)spr_.height());
+    for (int32_t y = rect.y; y < y_end; y++) {
+        uint16_t* out = framebuffer_ + y * spr_.width();
+        uint32_t bit = (y - rect.y) * rect.w;
+        for (int32_t x = rect.x; x < x_end; x++, bit++) {
+            out[x] = (mask[bit / 8] & (1 << (bit % 8))) ? fg : bg;
+        }
+    }
+}
+
+void DisplayTask::markDirty(int32_t x, int32_t y, int32_t w, int32_t h) {
+    if (framebuffer_ == nullptr) {
+        // Already on the display; just count it
+        stats_transfers_++;
+        stats_pixels_ += max(w, (int32_t)0) * max(h, (int32_t)0);
+        return;
+    }
+
+    // Clip to the framebuffer
+    DisplayRect rect = {
+        .x = max(x, (int32_t)0),
+        .y = max(y, (int32_t)0),
+        .w = 0,
+        .h = 0,
+    };
+    rect.w = min(x + w, (int32_t)spr_.width()) - rect.x;
+    rect.h = min(y + h, (int32_t)spr_.height()) - rect.y;
+    if (rect.w <= 0 || rect.h <= 0) {
+        return;
+    }
+
+    // Absorb any existing rects that are (nearly) free to merge with; the merged rect may in turn overlap others
+    uint8_t i = 0;
+    while (i < dirty_rect_count_) {
+        DisplayRect merged = rectUnion(rect, dirty_rects_[i]);
+        if (rectArea(merged) <= rectArea(rect) + rectArea(dirty_rects_[i]) + MERGE_SLACK_PIXELS) {
+            rect = merged;
+            dirty_rects_[i] = dirty_rects_[--dirty_rect_count_];
+            i = 0;
+        } else {
+            i++;
+        }
+    }
+
+    if (dirty_rect_count_ < DISPLAY_MAX_DIRTY_RECTS) {
+        dirty_rects_[dirty_rect_count_++] = rect;
+        return;
+    }
+
+    // Out of slots; merge into whichever rect grows the least
+    uint8_t best = 0;
+    int32_t best_growth = INT32_MAX;
+    for (i = 0; i < dirty_rect_count_; i++) {
+        int32_t growth = rectArea(rectUnion(rect, dirty_rects_[i])) - rectArea(dirty_rects_[i]);
+        if (growth < best_growth) {
+            best = i;
+            best_growth = growth;
+        }
+    }
+    dirty_rects_[best] = rectUnion(rect, dirty_rects_[best]);
+}
+
+void DisplayTask::pushDirtyRects() {
+    tft_.startWrite();
+    for (uint8_t i = 0; i < dirty_rect_count_; i++) {
+        const DisplayRect& r = dirty_rects_[i];
+        if (dma_enabled_ && r.w == spr_.width()) {
+            // Full-width rows are contiguous in the framebuffer, so they go out in a single DMA transfer
+            tft_.pushImageDMA(r.x, r.y, r.w, r.h, framebuffer_ + r.y * r.w);
+        } else {
+            if (dma_enabled_) {
+                tft_.dmaWait();
+            }
+            spr_.pushSprite(r.x, r.y, r.x, r.y, r.w, r.h);
+        }
+        stats_transfers_++;
+        stats_pixels_ += rectArea(r);
+    }
+    if (dma_enabled_) {
+        // The framebuffer can't be drawn to again until the transfers have finished
+        tft_.dmaWait();
+    }
+    tft_.endWrite();
+    dirty_rect_count_ = 0;
+}
+
+void DisplayTask::logStats() {
+    if (stats_frames_ > 0) {
+        char buf[200];
+        snprintf(buf, sizeof(buf), "Display: %u frames, avg %uus, max %uus, %u transfers, %u pixels",
+            stats_frames_, stats_total_micros_ / stats_frames_, stats_max_micros_, stats_transfers_, stats_pixels_);
+        log(buf);
+    }
+    stats_frames_ = 0;
+    stats_total_micros_ = 0;
+    stats_max_micros_ = 0;
+    stats_transfers_ = 0;
+    stats_pixels_ = 0;
+    stats_last_log_millis_ = millis();
+}
+
+void DisplayTask::setLogger(Logger* logger) {
+    logger_ = logger;
+}
+
+void DisplayTask::log(const char* msg) {
+    if (logger_ != nullptr) {
+        logger_->log(msg);
     }
 }
 
 void DisplayTask::setMessage(uint8_t i, String message) {
-    SemaphoreGuard lock(semaphore_);
-    assert(i < countof(messages_));
-    messages_[i] = message;
+    {
+        SemaphoreGuard lock(semaphore_);
+        assert(i < countof(messages_));
+        messages_[i] = message;
+    }
+
+    TaskHandle_t handle = getHandle();
+    if (handle != NULL) {
+        xTaskNotifyGive(handle);
+    }
 }
@@ -18,9 +18,32 @@
 #include <Arduino.h>
 #include <TFT_eSPI.h>
 
+#include "../core/logger.h"
 #include "../core/splitflap_task.h"
 #include "../core/task.h"
 
+// Max number of separate regions pushed to the display per frame; beyond this, regions get merged
+#define DISPLAY_MAX_DIRTY_RECTS 4
+
+// Glyph indexes 0..NUM_FLAPS-1 are the flap characters, followed by the module status indicators
+#define GLYPH_PANIC (NUM_FLAPS)
+#define GLYPH_DISABLED (NUM_FLAPS + 1)
+#define GLYPH_LOOK_FOR_HOME (NUM_FLAPS + 2)
+#define GLYPH_BLANK (NUM_FLAPS + 3)
+#define NUM_GLYPHS (NUM_FLAPS + 4)
+
+// 1 bit per pixel, for the largest module size (20x26)
+#define GLYPH_MAX_WIDTH 20
+#define GLYPH_MAX_HEIGHT 26
+#define GLYPH_MAX_BYTES ((GLYPH_MAX_WIDTH * GLYPH_MAX_HEIGHT + 7) / 8)
+
+struct DisplayRect {
+    int32_t x;
+    int32_t y;
+    int32_t w;
+    int32_t h;
+};
+
 class DisplayTask : public Task<DisplayTask> {
     friend class Task<DisplayTask>; // Allow base Task to invoke protected run()
 
@@ -29,6 +52,7 @@ class DisplayTask : public Task<DisplayTask> {
         ~DisplayTask();
 
         void setMessage(uint8_t i, String message);
+        void setLogger(Logger* logger);
 
     protected:
         void run();
@@ -39,5 +63,46 @@ class DisplayTask : public Task<DisplayTask> {
 
         TFT_eSPI tft_ = TFT_eSPI();
 
+        // Everything is drawn into this framebuffer first, and only the regions that changed are pushed out
+        TFT_eSprite spr_ = TFT_eSprite(&tft_);
+        uint16_t* framebuffer_ = nullptr;
+        bool dma_enabled_ = false;
+
+        // What to draw on: the framebuffer sprite, or the display itself if there wasn't enough memory for it
+        TFT_eSPI* canvas_ = &spr_;
+
+        // Position of each module in the framebuffer, resolved once from the layout (see display_layouts.h)
+        DisplayRect module_rects_[NUM_MODULES] = {};
+
+        // Pre-rendered coverage mask for each glyph, at the current module size
+        uint8_t glyphs_[NUM_GLYPHS][GLYPH_MAX_BYTES] = {};
+
+        // Modules currently showing a blinking status indicator
+        bool animated_[NUM_MODULES] = {};
+        uint16_t animated_count_ = 0;
+        uint32_t last_frame_millis_ = 0;
+
+        DisplayRect dirty_rects_[DISPLAY_MAX_DIRTY_RECTS] = {};
+        uint8_t dirty_rect_count_ = 0;
+
+        // Redraw cost, accumulated between stats log messages
+        uint32_t stats_frames_ = 0;
+        uint32_t stats_total_micros_ = 0;
+        uint32_t stats_max_micros_ = 0;
+        uint32_t stats_transfers_ = 0;
+        uint32_t stats_pixels_ = 0;
+        uint32_t stats_last_log_millis_ = 0;
+
         String messages_[3] = {};
+
+        Logger* logger_ = nullptr;
+
+        void waitForNextFrame(bool frame_pending);
+        void drawModule(uint8_t i, const SplitflapModuleState& s, bool blink);
+        void renderGlyphs(int32_t width, int32_t height, uint8_t text_size);
+        void drawGlyph(const DisplayRect& rect, uint8_t glyph, uint16_t foreground, uint16_t background);
+        void markDirty(int32_t x, int32_t y, int32_t w, int32_t h);
+        void pushDirtyRects();
+        void logStats();
+        void log(const char* msg);
 };
@@ -20,8 +20,15 @@
 #include <Regexp.h>
 
 #include "../core/arduino_json.h"
+#include "crc32.h"
 #include "geo_distance.h"
 
+// Override with a build flag to point at a local stand-in server for testing, e.g.
+// software/chainlink/route_api_standin.py
+#ifndef ROUTE_API_URL
+#define ROUTE_API_URL "https://api.adsbdb.com/v0/callsign/"
+#endif
+
 // 68 Duncan St Maroubra
 #define CURRENT_LAT -33.9429
 #define CURRENT_LNG 151.2562
@@ -32,60 +39,209 @@
 #define LOW_ALT_FT 1000
 #define LOW_MAX_DISTANCE_KM 1
 
-FlightDataProvider::FlightDataProvider(DisplayTask& display_task, Logger& logger) :
+static const GeoOrigin HOME(CURRENT_LAT, CURRENT_LNG, MAX_DISTANCE_KM);
+
+#if ADSB_SBS
+// Override with build flags to point at a local replay server for testing (see software/chainlink/sbs_replay.py)
+#ifndef SBS_HOST
+#define SBS_HOST "raspberrypi"
+#endif
+#ifndef SBS_PORT
+#define SBS_PORT 30003
+#endif
+
+// The aircraft table is kept up to date in the background, so this only checks whether anything nearby changed
+#define REQUEST_INTERVAL_MILLIS 500
+#else
+// Fetch aircraft data every 5 seconds
+#define REQUEST_INTERVAL_MILLIS (5 * 1000)
+#endif
+
+// Long enough for the aircraft fetch and most route lookups
+#define REFRESH_DEADLINE_MILLIS (8 * 1000)
+
+// Shown unless there's a timed message
+#define PRIORITY 1
+
+// Route cache hit rates only change meaningfully over many lookups
+#define ROUTE_CACHE_STATS_LOG_INTERVAL_MILLIS (10 * 60 * 1000)
+
+FlightDataProvider::FlightDataProvider(DisplayTask& display_task, HttpFetcher& http_fetcher, Logger& logger,
+        const uint8_t task_core) :
     display_task_(display_task),
-    logger_(logger) {
+    http_fetcher_(http_fetcher),
+    logger_(logger),
+    completions_(xQueueCreate(2, sizeof(HttpFetch*))),
+    aircraft_scanner_([this](const AircraftRecord& aircraft) { considerAircraft(aircraft); })
+#if ADSB_SBS
+    , sbs_feed_(SBS_HOST, SBS_PORT, [](const AircraftRecord& aircraft) {
+        return HOME.distanceWithin(aircraft.lat, aircraft.lon) >= 0;
+    }, logger, task_core)
+#endif
+{
+    assert(completions_ != NULL);
+    aircraft_fetch_.url = "http://raspberrypi:8080/data/aircraft.json";
+
+    // The nearby aircraft often don't change between requests, in which case there's no need to pick a flight and
+    // look up its route again. Servers that support validators can say so with a 304; otherwise the candidates'
+    // checksum (candidates_crc_) is compared after the scan.
+    aircraft_fetch_.conditional = true;
+
+    // aircraft.json is scanned as it streams in (on the fetch worker), keeping only the best candidate so far,
+    // so memory use doesn't depend on how many aircraft there are
+    aircraft_fetch_.body_handler = [this](const uint8_t* data, size_t length) {
+        aircraft_scanner_.consume((const char*)data, length);
+    };
 }
 
-FetchResult FlightDataProvider::fetchData()
+FlightDataProvider::~FlightDataProvider() {
+    vQueueDelete(completions_);
+}
+
+const char* FlightDataProvider::name() const
+{
+    return "Flights";
+}
+
+MessageProviderSchedule FlightDataProvider::schedule() const
 {
-    uint32_t start = millis();
-    HTTPClient http;
+    return {
+        .refresh_interval_millis = REQUEST_INTERVAL_MILLIS,
+        .deadline_millis = REFRESH_DEADLINE_MILLIS,
+        .priority = PRIORITY,
+    };
+}
 
-    // Construct the http request
-    http.begin("http://raspberrypi:8080/data/aircraft.json");
-    http.useHTTP10(true);
+void FlightDataProvider::startRefresh()
+{
+#if ADSB_SBS
+    if (!sbs_feed_started_)
+    {
+        // Refreshes only start once WiFi is connected
+        sbs_feed_.begin();
+        sbs_feed_started_ = true;
+    }
+#else
+    if (aircraft_fetch_pending_)
+    {
+        // A previous refresh's fetch is running late; its result is used instead
+        return;
+    }
 
-    // Send the request as a GET
     log_d("Sending adsb request");
-    int http_code = http.GET();
+    aircraft_scanner_.reset();
+    nearest_dist_ = 10000;
+    nearest_callsign_ = String();
+    nearest_hex_ = String();
+    candidates_crc_ = 0;
+    aircraft_fetch_pending_ = http_fetcher_.submit(&aircraft_fetch_, completions_);
+#endif
+}
 
-    log_d("Finished request in %lu millis.", millis() - start);
-    if (http_code > 0)
+FetchResult FlightDataProvider::fetchData()
+{
+    // Handle at most one completed fetch per call; any other stays queued until the next call
+    HttpFetch* fetch;
+    if (xQueueReceive(completions_, &fetch, 0) == pdTRUE)
     {
-        log_d("Response code: %d Data length: %d", http_code, http.getSize());
+        if (fetch == &aircraft_fetch_)
+        {
+            aircraft_fetch_pending_ = false;
+            return handleAircraftResponse();
+        }
+        route_fetch_pending_ = false;
+        return handleRouteResponse();
+    }
 
-        // The filter: it contains "true" for each value we want to keep
-        StaticJsonDocument<200> filter;
-        filter["aircraft"][0]["hex"] = true;
-        filter["aircraft"][0]["flight"] = true;
-        filter["aircraft"][0]["alt_geom"] = true;
-        filter["aircraft"][0]["lat"] = true;
-        filter["aircraft"][0]["lon"] = true;
+#if ADSB_SBS
+    // Only re-rank when a nearby aircraft has changed
+    if (sbs_feed_.takeNearbyChanged())
+    {
+        return handleSbsUpdate();
+    }
+    if (route_fetch_pending_)
+    {
+        return FetchResult::PENDING;
+    }
+    return sbs_feed_.connected() ? FetchResult::NO_CHANGE : FetchResult::ERROR;
+#else
+    if (!aircraft_fetch_pending_ && !route_fetch_pending_)
+    {
+        // Nothing in flight, so the aircraft fetch couldn't be submitted
+        return FetchResult::ERROR;
+    }
+    return FetchResult::PENDING;
+#endif
+}
 
-        // Parse response
-        DynamicJsonDocument doc(2048);
-        DeserializationError err = deserializeJson(doc, http.getStream(), DeserializationOption::Filter(filter));
+FetchResult FlightDataProvider::handleAircraftResponse()
+{
+    int http_code = aircraft_fetch_.status;
+    log_d("Finished request in %u millis.", aircraft_fetch_.elapsed_millis);
+    if (http_code > 0)
+    {
+        log_d("Response code: %d", http_code);
 
-        if (err)
+        if (aircraft_scanner_.error())
         {
-            http.end();
-            log_d("Error parsing response! %s", err.c_str());
+            log_d("Error parsing response!");
+            // Don't let an identical response be skipped next time
+            aircraft_fetch_.forgetPreviousResponse();
+            has_processed_candidates_crc_ = false;
             return FetchResult::ERROR;
         }
 
-        FetchResult result = handleData(doc);
-        http.end();
-        return result;
+        // A 304 response has no body, so nothing was scanned
+        if (!aircraft_fetch_.unchanged)
+        {
+            aircraft_count_ = aircraft_scanner_.aircraftCount();
+        }
+        if (aircraft_fetch_.unchanged
+            || (has_processed_candidates_crc_ && candidates_crc_ == processed_candidates_crc_))
+        {
+            // Same candidates as the last response, so the messages are still up to date
+            log_d("Aircraft data unchanged");
+            unchanged_hits_++;
+            showStatus();
+            return FetchResult::NO_CHANGE;
+        }
+        unchanged_misses_++;
+        processed_candidates_crc_ = candidates_crc_;
+        has_processed_candidates_crc_ = true;
+        showStatus();
+
+        return handleData();
     }
     else
     {
-        log_d("Error on HTTP request (%d): %s", http_code, http.errorToString(http_code).c_str());
-        http.end();
+        log_d("Error on HTTP request (%d): %s", http_code, HTTPClient::errorToString(http_code).c_str());
         return FetchResult::ERROR;
     }
 }
 
+#if ADSB_SBS
+FetchResult FlightDataProvider::handleSbsUpdate()
+{
+    nearest_dist_ = 10000;
+    nearest_callsign_ = String();
+    nearest_hex_ = String();
+    sbs_feed_.forEach([this](const AircraftRecord& aircraft) { considerAircraft(aircraft); });
+    aircraft_count_ = sbs_feed_.size();
+    showStatus();
+    return handleData();
+}
+#endif
+
+// Origin and destination airport codes side by side, e.g. "SYDMEL"
+static FlapMessage routeMessage(const char* origin, const char* destination)
+{
+    FlapMessage message;
+    size_t origin_length = strlen(origin);
+    message.write(0, origin, origin_length);
+    message.write(origin_length, destination, strlen(destination));
+    return message;
+}
+
 static bool isCommercialPlane(String callsign)
 {
     MatchState ms;
@@ -106,72 +262,81 @@ static bool isBetterFlight(double current_distance, String current_callsign, dou
     return candidate_distance < current_distance;
 }
 
-FetchResult FlightDataProvider::handleData(DynamicJsonDocument json)
+void FlightDataProvider::considerAircraft(const AircraftRecord& aircraft)
 {
-    char buf[200];
-
-    // Show the data fetch time on the LCD
-    time_t now;
-    time(&now);
-    strftime(buf, sizeof(buf), "Data: %Y-%m-%d %H:%M:%S", localtime(&now));
-    display_task_.setMessage(0, String(buf));
+    if (!aircraft.has_flight)
+    {
+        log_d("Plane %s has no flight number.", aircraft.hex);
+        return;
+    }
 
-    // Extract data from the json response. You could use ArduinoJson, but I find json11 to be much
-    // easier to use albeit not optimized for a microcontroller.
+    const char* callsign = aircraft.flight;
+    float dist = HOME.distanceWithin(aircraft.lat, aircraft.lon);
+    float alt = aircraft.alt_geom;
 
-    // Extract data:
-    JsonArray aircrafts = json["aircraft"].as<JsonArray>();
+    if (dist < 0)
+    {
+        log_d("Plane %s too far away.", callsign);
+        return;
+    }
 
-    double nearest_dist = 10000;
-    String nearest_callsign;
-    String nearest_hex;
+    if (alt > MAX_ALT_FT)
+    {
+        log_d("Plane %s too high %fft.", callsign, alt);
+        return;
+    }
 
-    display_task_.setMessage(2, String("Num planes: ") + String(aircrafts.size(), 10));
-    for (JsonObject aircraft : aircrafts)
+    if (alt < LOW_ALT_FT && dist > LOW_MAX_DISTANCE_KM)
     {
-        String hex = aircraft["hex"];
-        if (!aircraft["flight"])
-        {
-            log_d("Plane %s has no flight number.", hex.c_str());
-            continue;
-        }
+        log_d("Plane %s flying low at %fft and too far away %fkm.", callsign, alt, dist);
+        return;
+    }
 
-        String callsign = aircraft["flight"];
+    // Everything the choice of flight depends on, terminators included so adjacent fields can't run together
+    crc32(aircraft.hex, strlen(aircraft.hex) + 1, &candidates_crc_);
+    crc32(callsign, strlen(callsign) + 1, &candidates_crc_);
+    crc32(&aircraft.lat, sizeof(aircraft.lat), &candidates_crc_);
+    crc32(&aircraft.lon, sizeof(aircraft.lon), &candidates_crc_);
+    crc32(&aircraft.alt_geom, sizeof(aircraft.alt_geom), &candidates_crc_);
 
-        double lon = aircraft["lon"];
-        double lat = aircraft["lat"];
-        double dist = great_circle_distance(CURRENT_LAT, CURRENT_LNG, lat, lon);
-        double alt = aircraft["alt_geom"];
+    if (isBetterFlight(nearest_dist_, nearest_callsign_, dist, callsign))
+    {
+        nearest_dist_ = dist;
+        nearest_callsign_ = callsign;
+        nearest_hex_ = aircraft.hex;
+    }
+}
 
-        if (dist > MAX_DISTANCE_KM)
-        {
-            log_d("Plane %s too far away %fkm.", callsign.c_str(), dist);
-            continue;
-        }
+void FlightDataProvider::showStatus()
+{
+    char buf[200];
 
-        if (alt > MAX_ALT_FT)
-        {
-            log_d("Plane %s too high %fft.", callsign.c_str(), alt);
-            continue;
-        }
+    // Show the data fetch time on the LCD
+    time_t now;
+    time(&now);
+    strftime(buf, sizeof(buf), "Data: %Y-%m-%d %H:%M:%S", localtime(&now));
+    display_task_.setMessage(0, String(buf));
 
-        if (alt < LOW_ALT_FT && dist > LOW_MAX_DISTANCE_KM)
-        {
-            log_d("Plane %s flying low at %fft and too far away %fkm.", callsign.c_str(), alt, dist);
-            continue;
-        }
+#if ADSB_SBS
+    snprintf(buf, sizeof(buf), "Num planes: %u  SBS %s", aircraft_count_,
+        sbs_feed_.connected() ? "connected" : "disconnected");
+#else
+    snprintf(buf, sizeof(buf), "Num planes: %u  Unchanged: %u hit %u miss", aircraft_count_, unchanged_hits_, unchanged_misses_);
+#endif
+    display_task_.setMessage(2, String(buf));
+}
 
-        if (isBetterFlight(nearest_dist, nearest_callsign, dist, callsign))
-        {
-            nearest_dist = dist;
-            nearest_callsign = callsign;
-            nearest_hex = hex;
-        }
-    }
+FetchResult FlightDataProvider::handleData()
+{
+    double nearest_dist = nearest_dist_;
+    String nearest_callsign = nearest_callsign_;
+    String nearest_hex = nearest_hex_;
 
     if (nearest_dist > MAX_DISTANCE_KM)
     {
         log_d("No nearby planes");
+        // Ignore any route lookup that's still in flight
+        current_callsign = String();
         if (messages_.empty()) {
             return FetchResult::NO_CHANGE;
         } else {
@@ -188,29 +353,74 @@ FetchResult FlightDataProvider::handleData(DynamicJsonDocument json)
         return FetchResult::NO_CHANGE;
     }
     current_callsign = nearest_callsign;
-
-    messages_.clear();
-    setMessages(nearest_callsign);
-    return FetchResult::UPDATE;
+    return requestRoute(nearest_callsign);
 }
 
-void FlightDataProvider::setMessages(String callsign)
+FetchResult FlightDataProvider::requestRoute(String callsign)
 {
-    uint32_t start = millis();
-    HTTPClient http;
+    const RouteCacheEntry* cached = route_cache_.lookup(callsign);
+    if (millis() - route_cache_stats_log_millis_ > ROUTE_CACHE_STATS_LOG_INTERVAL_MILLIS)
+    {
+        logRouteCacheStats();
+    }
+    if (cached != nullptr)
+    {
+        log_d("Cached flight route for callsign %s", callsign.c_str());
+        messages_.clear();
+        if (cached->has_route)
+        {
+            messages_.push_back(FlapMessage(cached->callsign_iata));
+            messages_.push_back(routeMessage(cached->origin, cached->destination));
+        }
+        else
+        {
+            messages_.push_back(FlapMessage(callsign.c_str()));
+        }
+        return FetchResult::UPDATE;
+    }
 
-    // Construct the http request
-    http.begin("https://api.adsbdb.com/v0/callsign/" + callsign);
-    http.useHTTP10(true);
+    if (route_fetch_pending_)
+    {
+        // The route for current_callsign is requested once the one in flight completes
+        return FetchResult::PENDING;
+    }
 
-    // Send the request as a GET
     log_d("Sending route request");
-    int http_code = http.GET();
+    route_callsign_ = callsign;
+    route_fetch_.url = ROUTE_API_URL + callsign;
+    route_fetch_pending_ = http_fetcher_.submit(&route_fetch_, completions_);
+    if (!route_fetch_pending_)
+    {
+        log_d("Too many requests outstanding, showing callsign without route");
+        messages_.clear();
+        messages_.push_back(FlapMessage(callsign.c_str()));
+        return FetchResult::UPDATE;
+    }
+    return FetchResult::PENDING;
+}
 
-    log_d("Finished request in %lu millis.", millis() - start);
+FetchResult FlightDataProvider::handleRouteResponse()
+{
+    String callsign = route_callsign_;
+    if (callsign != current_callsign)
+    {
+        // The nearest plane changed while this was in flight
+        route_fetch_.body = String();
+        if (!current_callsign)
+        {
+            // No nearby plane any more; its messages were already cleared
+            return FetchResult::NO_CHANGE;
+        }
+        return requestRoute(current_callsign);
+    }
+
+    messages_.clear();
+
+    int http_code = route_fetch_.status;
+    log_d("Finished request in %u millis.", route_fetch_.elapsed_millis);
     if (http_code > 0)
     {
-        log_d("Response code: %d Data length: %d", http_code, http.getSize());
+        log_d("Response code: %d Data length: %d", http_code, route_fetch_.body.length());
 
         // The filter: it contains "true" for each value we want to keep
         StaticJsonDocument<200> filter;
@@ -220,41 +430,61 @@ void FlightDataProvider::setMessages(String callsign)
 
         // Parse response
         DynamicJsonDocument doc(2048);
-        DeserializationError err = deserializeJson(doc, http.getStream(), DeserializationOption::Filter(filter));
+        DeserializationError err = deserializeJson(doc, route_fetch_.body, DeserializationOption::Filter(filter));
+        route_fetch_.body = String();
 
         if (err)
         {
-            http.end();
             log_d("Error parsing response! %s", err.c_str());
-            return;
+            return FetchResult::UPDATE;
         }
 
         if (!doc["response"]["flightroute"])
         {
             log_d("No flight route for callsign %s", callsign.c_str());
-            messages_.push_back(callsign);
-            return;
+            if (http_code == 200 || http_code == 404)
+            {
+                // A definite answer rather than a server problem, so don't ask again for a while
+                route_cache_.insertNegative(callsign);
+            }
+            messages_.push_back(FlapMessage(callsign.c_str()));
+            return FetchResult::UPDATE;
         }
 
         String callsign_iata = doc["response"]["flightroute"]["callsign_iata"];
-        messages_.push_back(callsign_iata ? callsign_iata : callsign);
+        if (!callsign_iata)
+        {
+            callsign_iata = callsign;
+        }
+        messages_.push_back(FlapMessage(callsign_iata.c_str()));
 
         String origin = doc["response"]["flightroute"]["origin"]["iata_code"];
         String destination = doc["response"]["flightroute"]["destination"]["iata_code"];
+        route_cache_.insert(callsign, callsign_iata, origin, destination);
 
         log_d("Flight route for callsign %s is %s%s", callsign.c_str(), origin.c_str(), destination.c_str());
 
-        http.end();
-        messages_.push_back(origin + destination);
+        messages_.push_back(routeMessage(origin.c_str(), destination.c_str()));
     }
     else
     {
-        log_d("Error on HTTP request (%d): %s", http_code, http.errorToString(http_code).c_str());
-        http.end();
-        return;
+        log_d("Error on HTTP request (%d): %s", http_code, HTTPClient::errorToString(http_code).c_str());
     }
+    return FetchResult::UPDATE;
+}
+
+void FlightDataProvider::logRouteCacheStats()
+{
+    const RouteCacheStats& stats = route_cache_.getStats();
+    uint32_t lookups = stats.hits + stats.negative_hits + stats.misses;
+    char buf[200];
+    snprintf(buf, sizeof(buf), "Route cache: %u/%u hits (%u%%, %u negative), %u evictions",
+        stats.hits + stats.negative_hits, lookups, (stats.hits + stats.negative_hits) * 100 / lookups,
+        stats.negative_hits, stats.evictions);
+    logger_.log(buf);
+    route_cache_stats_log_millis_ = millis();
 }
 
-const std::vector<String>& FlightDataProvider::getMessages() {
+const FlapMessageList& FlightDataProvider::getMessages() {
     return messages_;
 }
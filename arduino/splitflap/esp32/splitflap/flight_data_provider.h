@@ -20,22 +20,81 @@
 
 #include "../core/arduino_json.h"
 #include "../core/logger.h"
+#include "aircraft_json_scanner.h"
 #include "display_task.h"
+#include "http_fetcher.h"
 #include "message_provider.h"
+#include "route_cache.h"
+#include "sbs_feed.h"
+
+// Set to true (e.g. with -DADSB_SBS=true) to follow dump1090's SBS-1 output (port 30003) instead of polling
+// aircraft.json
+#ifndef ADSB_SBS
+#define ADSB_SBS false
+#endif
 
 class FlightDataProvider : public MessageProvider {
     public:
-        FlightDataProvider(DisplayTask& display_task, Logger& logger);
+        FlightDataProvider(DisplayTask& display_task, HttpFetcher& http_fetcher, Logger& logger, const uint8_t task_core);
+        ~FlightDataProvider();
+        const char* name() const override;
+        MessageProviderSchedule schedule() const override;
+        void startRefresh() override;
         FetchResult fetchData() override;
-        const std::vector<String>& getMessages() override;
+        const FlapMessageList& getMessages() override;
 
     private:
-        FetchResult handleData(DynamicJsonDocument json);
-        void setMessages(String callsign);
+        FetchResult handleAircraftResponse();
+#if ADSB_SBS
+        FetchResult handleSbsUpdate();
+#endif
+        void considerAircraft(const AircraftRecord& aircraft);
+        FetchResult handleData();
+        void showStatus();
+        FetchResult requestRoute(String callsign);
+        FetchResult handleRouteResponse();
+        void logRouteCacheStats();
 
         DisplayTask& display_task_;
+        HttpFetcher& http_fetcher_;
         Logger& logger_;
 
-        std::vector<String> messages_;
+        // Fetches run in the background and are received from completions_ once they're done
+        QueueHandle_t completions_;
+        HttpFetch aircraft_fetch_;
+        HttpFetch route_fetch_;
+        bool aircraft_fetch_pending_ = false;
+        bool route_fetch_pending_ = false;
+        String route_callsign_;
+        RouteCache route_cache_;
+        uint32_t route_cache_stats_log_millis_ = 0;
+
+        // Best candidate found so far while scanning aircraft.json. Only touched by the fetch worker while the
+        // aircraft fetch is pending.
+        AircraftJsonScanner aircraft_scanner_;
+        double nearest_dist_ = 10000;
+        String nearest_callsign_;
+        String nearest_hex_;
+        // Checksum of what was kept from each aircraft that passed the filters. aircraft.json itself changes on
+        // every poll ("now", "messages"), so this is what tells whether a response is worth processing again.
+        uint32_t candidates_crc_ = 0;
+
+#if ADSB_SBS
+        // Aircraft table kept up to date from the SBS stream, replacing the aircraft.json fetch
+        SbsFeed sbs_feed_;
+        bool sbs_feed_started_ = false;
+#endif
+
+        // Aircraft fetches whose response was the same as the previous one (hits), so it wasn't processed again,
+        // and those that had to be processed (misses)
+        uint32_t unchanged_hits_ = 0;
+        uint32_t unchanged_misses_ = 0;
+        // candidates_crc_ of the last response that was processed
+        uint32_t processed_candidates_crc_ = 0;
+        bool has_processed_candidates_crc_ = false;
+        // From the last response that was processed
+        uint32_t aircraft_count_ = 0;
+
+        FlapMessageList messages_;
         String current_callsign;
 };
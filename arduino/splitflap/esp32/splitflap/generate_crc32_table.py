@@ -0,0 +1,134 @@
+#!/usr/bin/env python3
+#   Copyright 2022 Scott Bezek and the splitflap contributors
+#
+#   Licensed under the Apache License, Version 2.0 (the "License");
+#   you may not use this file except in compliance with the License.
+#   You may obtain a copy of the License at
+#
+#       http://www.apache.org/licenses/LICENSE-2.0
+#
+#   Unless required by applicable law or agreed to in writing, software
+#   distributed under the License is distributed on an "AS IS" BASIS,
+#   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+#   See the License for the specific language governing permissions and
+#   limitations under the License.
+
+import os
+import random
+import subprocess
+import zlib
+
+# Reflected polynomial of the standard (zlib/IEEE 802.3) CRC32
+POLYNOMIAL = 0xEDB88320
+NUM_SLICES = 8
+
+_TEMPLATE = """/*
+   Copyright 2022 Scott Bezek and the splitflap contributors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+// NOTE: THIS FILE IS AUTOGENERATED! DO NOT MODIFY!
+// To update, run `{script_path}`
+
+#pragma once
+
+#include <stdint.h>
+
+namespace CRC32 {{
+    // Slicing-by-{num_slices} lookup tables for the standard (zlib) CRC32. TABLE[0] is the classic
+    // byte-at-a-time table; TABLE[k] advances a byte's contribution by k additional bytes.
+    const uint32_t TABLE[{num_slices}][256] = {{
+{tables}
+    }};
+}}
+"""
+
+
+def get_git_root():
+    try:
+        return subprocess.check_output(
+            ['git', 'rev-parse', '--show-toplevel'],
+            cwd=os.path.dirname(os.path.abspath(__file__)),
+        ).decode('utf-8').strip()
+    except Exception:
+        raise RuntimeError("Could not read git directory path. Make sure you have git installed and you're working with a git clone of the repository.")
+
+
+def generate_tables():
+    tables = [[0] * 256 for _ in range(NUM_SLICES)]
+    for i in range(256):
+        crc = i
+        for _ in range(8):
+            crc = (crc >> 1) ^ (POLYNOMIAL if crc & 1 else 0)
+        tables[0][i] = crc
+    for k in range(1, NUM_SLICES):
+        for i in range(256):
+            previous = tables[k - 1][i]
+            tables[k][i] = (previous >> 8) ^ tables[0][previous & 0xFF]
+    return tables
+
+
+def slicing_crc32(tables, data, crc=0):
+    """Reference implementation of the firmware's slicing-by-8 algorithm, used to validate the tables."""
+    crc ^= 0xFFFFFFFF
+    i = 0
+    while len(data) - i >= NUM_SLICES:
+        one = crc ^ int.from_bytes(data[i:i + 4], 'little')
+        two = int.from_bytes(data[i + 4:i + 8], 'little')
+        crc = tables[7][one & 0xFF] ^ tables[6][(one >> 8) & 0xFF] ^ tables[5][(one >> 16) & 0xFF] ^ tables[4][one >> 24] \
+            ^ tables[3][two & 0xFF] ^ tables[2][(two >> 8) & 0xFF] ^ tables[1][(two >> 16) & 0xFF] ^ tables[0][two >> 24]
+        i += NUM_SLICES
+    for b in data[i:]:
+        crc = tables[0][(crc ^ b) & 0xFF] ^ (crc >> 8)
+    return crc ^ 0xFFFFFFFF
+
+
+def validate(tables):
+    rng = random.Random(0)
+    for length in list(range(0, 64)) + [255, 1000, 4096]:
+        data = bytes(rng.getrandbits(8) for _ in range(length))
+        assert slicing_crc32(tables, data) == zlib.crc32(data), f'Mismatch against zlib for {length} bytes'
+
+        # Incremental updates must chain the same way zlib's do
+        split = rng.randint(0, length)
+        assert slicing_crc32(tables, data[split:], slicing_crc32(tables, data[:split])) == zlib.crc32(data), \
+            f'Incremental mismatch against zlib for {length} bytes split at {split}'
+
+
+def run(output_file_path):
+    tables = generate_tables()
+    validate(tables)
+
+    formatted_tables = []
+    for table in tables:
+        rows = []
+        for row_start in range(0, 256, 8):
+            rows.append('            ' + ', '.join(f'0x{x:08x}' for x in table[row_start:row_start + 8]) + ',')
+        formatted_tables.append('        {\n' + '\n'.join(rows) + '\n        },')
+
+    git_root = get_git_root()
+    script_path = os.path.relpath(os.path.abspath(__file__), os.path.abspath(git_root))
+    with open(output_file_path, 'wb') as f:
+        f.write(_TEMPLATE.format(
+            num_slices=NUM_SLICES,
+            tables='\n'.join(formatted_tables),
+            script_path=script_path,
+        ).encode('utf-8'))
+
+
+if __name__ == '__main__':
+    output_file_path = os.path.join(os.path.dirname(__file__), 'crc32_table.h')
+    run(
+        output_file_path,
+    )
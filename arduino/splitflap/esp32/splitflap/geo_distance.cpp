@@ -18,6 +18,15 @@ using namespace std;
 
 static const double earth_radius_km = 6371.0;
 
+static const float earth_radius_km_f = 6371.0f;
+static const float deg2rad_f = (float)(M_PI / 180.0);
+
+// Length of a degree of latitude
+static const float km_per_degree = earth_radius_km_f * deg2rad_f;
+
+// Allowance for the error of the equirectangular approximation before rejecting a position outright
+static const float equirectangular_margin = 1.01f;
+
 double deg2rad(double deg)
 {
     return (deg * M_PI / 180.0);
@@ -42,3 +51,57 @@ double great_circle_distance(double latitude1, double longitude1, double latitud
 
     return earth_radius_km * d_sigma;
 }
+
+GeoOrigin::GeoOrigin(float latitude, float longitude, float max_distance_km) :
+    latitude_(latitude),
+    longitude_(longitude),
+    cos_latitude_(cosf(latitude * deg2rad_f)),
+    max_distance_km_(max_distance_km)
+{
+    max_d_lat_ = max_distance_km / km_per_degree;
+
+    // Meridians converge towards the poles, so size the box for its edge furthest from the equator
+    float max_abs_lat = fabsf(latitude) + max_d_lat_;
+    max_d_lon_ = max_abs_lat >= 90 ? 180 : max_d_lat_ / cosf(max_abs_lat * deg2rad_f);
+}
+
+float GeoOrigin::distanceWithin(float latitude, float longitude) const
+{
+    float d_lat = latitude - latitude_;
+    float d_lon = longitude - longitude_;
+    if (d_lon > 180)
+    {
+        d_lon -= 360;
+    }
+    else if (d_lon < -180)
+    {
+        d_lon += 360;
+    }
+
+    // Bounding box
+    if (fabsf(d_lat) > max_d_lat_ || fabsf(d_lon) > max_d_lon_)
+    {
+        return -1;
+    }
+
+    // Equirectangular approximation, using the home latitude for the meridian convergence. Not when the range
+    // reaches a pole, as positions on the far side of it are much closer than the approximation makes out.
+    float d_lat_rad = d_lat * deg2rad_f;
+    float d_lon_rad = d_lon * deg2rad_f;
+    if (max_d_lon_ < 180)
+    {
+        float x = d_lon_rad * cos_latitude_;
+        float approx = earth_radius_km_f * sqrtf(x * x + d_lat_rad * d_lat_rad);
+        if (approx > max_distance_km_ * equirectangular_margin)
+        {
+            return -1;
+        }
+    }
+
+    // Haversine
+    float sin_d_lat = sinf(d_lat_rad / 2);
+    float sin_d_lon = sinf(d_lon_rad / 2);
+    float a = sin_d_lat * sin_d_lat + cos_latitude_ * cosf(latitude * deg2rad_f) * sin_d_lon * sin_d_lon;
+    float distance = 2 * earth_radius_km_f * asinf(sqrtf(a));
+    return distance > max_distance_km_ ? -1 : distance;
+}
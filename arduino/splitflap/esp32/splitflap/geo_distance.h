@@ -1,8 +1,35 @@
-/* Simple public domain implementation of the standard CRC32 checksum.
- * Outputs the checksum for each file given as a command line argument.
- * Invalid file names and files that cause errors are silently skipped.
- * The program reads from stdin if it is called with no arguments. */
+/*
+ * Great-circle distance computational forumlas
+ *
+ * https://en.wikipedia.org/wiki/Great-circle_distance
+ */
 #pragma once
 
 double great_circle_distance(double latitude1, double longitude1, double latitude2,
-                             double longitude2);
\ No newline at end of file
+                             double longitude2);
+
+/**
+ * Fast "is it within range, and how far" checks against a fixed home position.
+ *
+ * Uses single-precision floats only, since the ESP32's FPU doesn't do doubles. Most positions are rejected by
+ * a lat/lon bounding box, then by an equirectangular approximation (accurate to well under 1% at the few km
+ * ranges this is meant for), and only the survivors get a full haversine distance.
+ */
+class GeoOrigin
+{
+public:
+    GeoOrigin(float latitude, float longitude, float max_distance_km);
+
+    // Returns the distance in km, or a negative value if it's further than max_distance_km
+    float distanceWithin(float latitude, float longitude) const;
+
+private:
+    float latitude_;
+    float longitude_;
+    float cos_latitude_;
+    float max_distance_km_;
+
+    // Half-size of the bounding box, in degrees
+    float max_d_lat_;
+    float max_d_lon_;
+};
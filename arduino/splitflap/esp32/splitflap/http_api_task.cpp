@@ -0,0 +1,464 @@
+/*
+   Copyright 2022 Scott Bezek and the splitflap contributors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+#if HTTP_API
+#include "http_api_task.h"
+
+// Longest wait for a request while connections that send requests are open. Incoming data doesn't wake the task, so
+// this bounds the added latency.
+#define HTTP_API_POLL_INTERVAL_MILLIS 5
+
+// Longest wait otherwise (state changes wake the task for event streams), which bounds how long a new connection
+// waits to be accepted
+#define HTTP_API_IDLE_POLL_INTERVAL_MILLIS 100
+
+// Connections that are idle (or stuck part way through a request) for this long are closed to free the slot
+#define HTTP_API_IDLE_TIMEOUT_MILLIS (10 * 1000)
+
+// Event streams get a comment this often, so proxies and clients don't time them out
+#define HTTP_API_KEEPALIVE_INTERVAL_MILLIS (15 * 1000)
+
+#define HTTP_API_STATS_INTERVAL_MILLIS (60 * 1000)
+
+static const char* statusText(uint16_t status) {
+    switch (status) {
+        case 200:
+            return "OK";
+        case 202:
+            return "Accepted";
+        case 204:
+            return "No Content";
+        case 400:
+            return "Bad Request";
+        case 404:
+            return "Not Found";
+        case 405:
+            return "Method Not Allowed";
+        case 413:
+            return "Payload Too Large";
+        case 503:
+            return "Service Unavailable";
+        default:
+            return "";
+    }
+}
+
+static const char* moduleStateName(State state) {
+    switch (state) {
+        case NORMAL:
+            return "normal";
+        case LOOK_FOR_HOME:
+            return "look_for_home";
+        case SENSOR_ERROR:
+            return "sensor_error";
+        case PANIC:
+            return "panic";
+        case STATE_DISABLED:
+            return "disabled";
+        default:
+            return "";
+    }
+}
+
+HttpApiTask::HttpApiTask(SplitflapTask& splitflap_task, WiFiManager& wifi_manager, Logger& logger, const uint8_t task_core) :
+        Task("HTTP API", 4096, 1, task_core),
+        splitflap_task_(splitflap_task),
+        wifi_manager_(wifi_manager),
+        logger_(logger),
+        server_(HTTP_API_PORT, HTTP_API_MAX_CONNECTIONS) {
+}
+
+void HttpApiTask::run() {
+    wifi_manager_.waitForConnection();
+
+    // The listening socket isn't tied to an address, so it carries on working when WiFi reconnects
+    server_.begin();
+    server_.setNoDelay(true);
+
+    // State changes wake the task up early to update event streams
+    splitflap_task_.addStateChangeListener(xTaskGetCurrentTaskHandle());
+
+    char buf[200];
+    snprintf(buf, sizeof(buf), "HTTP API listening on %s:%u", WiFi.localIP().toString().c_str(), HTTP_API_PORT);
+    logger_.log(buf);
+
+    last_stats_millis_ = millis();
+    while (1) {
+        accept();
+        for (uint8_t i = 0; i < HTTP_API_MAX_CONNECTIONS; i++) {
+            if (connections_[i].active) {
+                service(connections_[i]);
+            }
+        }
+        broadcastState();
+
+        uint32_t now = millis();
+        if (now - last_keepalive_millis_ > HTTP_API_KEEPALIVE_INTERVAL_MILLIS) {
+            for (uint8_t i = 0; i < HTTP_API_MAX_CONNECTIONS; i++) {
+                if (connections_[i].active && connections_[i].streaming
+                        && connections_[i].client.print(": keepalive\n\n") == 0) {
+                    close(connections_[i]);
+                }
+            }
+            last_keepalive_millis_ = now;
+        }
+        if (now - last_stats_millis_ > HTTP_API_STATS_INTERVAL_MILLIS) {
+            logStats();
+        }
+
+        uint32_t poll_interval_millis = activeConnections() > activeStreams()
+            ? HTTP_API_POLL_INTERVAL_MILLIS : HTTP_API_IDLE_POLL_INTERVAL_MILLIS;
+        ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(poll_interval_millis));
+    }
+}
+
+void HttpApiTask::accept() {
+    WiFiClient client = server_.available();
+    if (!client) {
+        return;
+    }
+
+    for (uint8_t i = 0; i < HTTP_API_MAX_CONNECTIONS; i++) {
+        Connection& connection = connections_[i];
+        if (!connection.active) {
+            connection.active = true;
+            connection.streaming = false;
+            connection.client = client;
+            connection.client.setNoDelay(true);
+            connection.parser.reset();
+            connection.last_activity_millis = millis();
+            return;
+        }
+    }
+
+    log_d("No free HTTP API connections");
+    client.print("HTTP/1.1 503 Service Unavailable\r\nContent-Length: 0\r\nConnection: close\r\n\r\n");
+    client.stop();
+}
+
+void HttpApiTask::service(Connection& connection) {
+    if (!connection.client.connected()) {
+        close(connection);
+        return;
+    }
+
+    uint32_t now = millis();
+    if (connection.streaming) {
+        // Nothing more is expected from the client
+        while (connection.client.available() > 0) {
+            connection.client.read();
+        }
+        return;
+    }
+
+    int available = connection.client.available();
+    if (available <= 0) {
+        if (now - connection.last_activity_millis > HTTP_API_IDLE_TIMEOUT_MILLIS) {
+            close(connection);
+        }
+        return;
+    }
+    connection.last_activity_millis = now;
+
+    char data[256];
+    int length = connection.client.read((uint8_t*)data, min(available, (int)sizeof(data)));
+    int offset = 0;
+    while (offset < length) {
+        size_t used;
+        HttpParseResult result = connection.parser.consume(data + offset, length - offset, &used);
+        offset += used;
+        switch (result) {
+            case HttpParseResult::INCOMPLETE:
+                break;
+            case HttpParseResult::COMPLETE:
+                request_count_++;
+                handleRequest(connection);
+                if (!connection.active || connection.streaming) {
+                    return;
+                }
+                connection.parser.reset();
+                break;
+            case HttpParseResult::ERROR:
+                respond(connection, 400, "Malformed or unsupported request\n");
+                close(connection);
+                return;
+            case HttpParseResult::TOO_LARGE:
+                respond(connection, 413, "Request too large\n");
+                close(connection);
+                return;
+        }
+    }
+}
+
+void HttpApiTask::handleRequest(Connection& connection) {
+    const HttpRequestParser& request = connection.parser;
+    const char* method = request.method();
+    const char* path = request.path();
+    bool get = strcmp(method, "GET") == 0;
+    bool post = strcmp(method, "POST") == 0;
+
+    if (strcmp(method, "OPTIONS") == 0) {
+        // CORS preflight, so the API can be used from a browser page
+        respond(connection, 204);
+    } else if (strcmp(path, "/state") == 0) {
+        if (!get) {
+            respond(connection, 405, "Use GET\n");
+            return;
+        }
+        SplitflapState state = splitflap_task_.getState();
+        JsonWriter writer(json_buffer_, sizeof(json_buffer_));
+        writeState(writer, state, nullptr);
+        respond(connection, 200, writer.buffer(), writer.length(), "application/json");
+    } else if (strcmp(path, "/events") == 0) {
+        if (!get) {
+            respond(connection, 405, "Use GET\n");
+            return;
+        }
+        startStream(connection);
+    } else if (strcmp(path, "/text") == 0) {
+        if (!post) {
+            respond(connection, 405, "Use POST\n");
+            return;
+        }
+        handleText(connection);
+    } else if (strcmp(path, "/flaps") == 0) {
+        if (!post) {
+            respond(connection, 405, "Use POST\n");
+            return;
+        }
+        handleFlaps(connection);
+    } else if (strcmp(path, "/reset") == 0) {
+        if (!post) {
+            respond(connection, 405, "Use POST\n");
+            return;
+        }
+        splitflap_task_.resetAll();
+        command_count_++;
+        respond(connection, 202);
+    } else {
+        respond(connection, 404, "Not found\n");
+    }
+}
+
+void HttpApiTask::handleText(Connection& connection) {
+    const HttpRequestParser& request = connection.parser;
+
+    FlapAlignment alignment = FlapAlignment::LEFT;
+    char param[16];
+    if (request.queryParam("align", param, sizeof(param))) {
+        if (strcmp(param, "left") == 0) {
+            alignment = FlapAlignment::LEFT;
+        } else if (strcmp(param, "center") == 0) {
+            alignment = FlapAlignment::CENTER;
+        } else if (strcmp(param, "right") == 0) {
+            alignment = FlapAlignment::RIGHT;
+        } else if (strcmp(param, "justify") == 0) {
+            alignment = FlapAlignment::JUSTIFY;
+        } else {
+            respond(connection, 400, "align must be left, center, right or justify\n");
+            return;
+        }
+    }
+    bool force = request.queryParam("force", param, sizeof(param)) && strcmp(param, "0") != 0;
+
+    // Ignore the trailing newline that e.g. `echo ... | curl --data-binary @-` sends
+    size_t length = request.bodyLength();
+    while (length > 0 && (request.body()[length - 1] == '\n' || request.body()[length - 1] == '\r')) {
+        length--;
+    }
+
+    splitflap_task_.showMessage(FlapMessage(request.body(), length, alignment), force);
+    command_count_++;
+    respond(connection, 202);
+}
+
+void HttpApiTask::handleFlaps(Connection& connection) {
+    const HttpRequestParser& request = connection.parser;
+    FlapMessage message = FlapMessage::unchanged();
+
+    const char* field = request.body();
+    uint16_t module = 0;
+    while (*field != '\0' && *field != '\r' && *field != '\n') {
+        if (module == NUM_MODULES) {
+            respond(connection, 400, "More flap indexes than modules\n");
+            return;
+        }
+        if (*field != ',') {
+            char* end;
+            long flap_index = strtol(field, &end, 10);
+            if (end == field || flap_index < 0 || flap_index >= NUM_FLAPS
+                    || (*end != ',' && *end != '\0' && *end != '\r' && *end != '\n')) {
+                char buf[64];
+                snprintf(buf, sizeof(buf), "Bad flap index for module %u (0 to %u)\n", module, NUM_FLAPS - 1);
+                respond(connection, 400, buf);
+                return;
+            }
+            message.set(module, flap_index);
+            field = end;
+        }
+        module++;
+        if (*field == ',') {
+            field++;
+        }
+    }
+
+    splitflap_task_.showMessage(message, false);
+    command_count_++;
+    respond(connection, 202);
+}
+
+void HttpApiTask::startStream(Connection& connection) {
+    if (activeStreams() > 0) {
+        // Bring the existing streams up to date first, so the new one can start from the same state
+        broadcastState();
+    } else {
+        // Not kept up to date while there are no streams
+        streamed_state_ = splitflap_task_.getState();
+    }
+
+    if (connection.client.print(
+            "HTTP/1.1 200 OK\r\n"
+            "Content-Type: text/event-stream\r\n"
+            "Cache-Control: no-cache\r\n"
+            "Access-Control-Allow-Origin: *\r\n"
+            "\r\n") == 0) {
+        close(connection);
+        return;
+    }
+    connection.streaming = true;
+
+    JsonWriter writer(json_buffer_, sizeof(json_buffer_));
+    writeState(writer, streamed_state_, nullptr);
+    if (!sendEvent(connection, writer)) {
+        close(connection);
+    }
+}
+
+void HttpApiTask::broadcastState() {
+    // Copying the state locks SplitflapTask's mutex, so don't bother when nobody's listening
+    if (activeStreams() == 0) {
+        return;
+    }
+    SplitflapState state = splitflap_task_.getState();
+    if (state == streamed_state_) {
+        return;
+    }
+
+    JsonWriter writer(json_buffer_, sizeof(json_buffer_));
+    writeState(writer, state, &streamed_state_);
+    for (uint8_t i = 0; i < HTTP_API_MAX_CONNECTIONS; i++) {
+        if (connections_[i].active && connections_[i].streaming && !sendEvent(connections_[i], writer)) {
+            close(connections_[i]);
+        }
+    }
+    streamed_state_ = state;
+}
+
+void HttpApiTask::writeState(JsonWriter& writer, SplitflapState& state, SplitflapState* previous) {
+    writer.raw("{\"mode\":").string(state.mode == SplitflapMode::MODE_SENSOR_TEST ? "sensor_test" : "run")
+        .raw(",\"modules\":[");
+    bool first = true;
+    for (uint8_t i = 0; i < NUM_MODULES; i++) {
+        SplitflapModuleState& module = state.modules[i];
+        if (previous != nullptr && module == previous->modules[i]) {
+            continue;
+        }
+        if (!first) {
+            writer.raw(',');
+        }
+        first = false;
+        writer.raw("{\"module\":").number(i)
+            .raw(",\"state\":").string(moduleStateName(module.state))
+            .raw(",\"flap\":").string(flaps[module.flap_index])
+            .raw(",\"index\":").number(module.flap_index)
+            .raw(",\"moving\":").raw(module.moving ? "true" : "false")
+            .raw(",\"count_missed_home\":").number(module.count_missed_home)
+            .raw(",\"count_unexpected_home\":").number(module.count_unexpected_home)
+            .raw('}');
+    }
+    writer.raw("]}");
+    assert(!writer.overflowed());
+}
+
+bool HttpApiTask::sendEvent(Connection& connection, const JsonWriter& writer) {
+    WiFiClient& client = connection.client;
+    return client.print("event: state\ndata: ") > 0
+        && client.write((const uint8_t*)writer.buffer(), writer.length()) == writer.length()
+        && client.print("\n\n") > 0;
+}
+
+void HttpApiTask::respond(Connection& connection, uint16_t status, const char* body) {
+    respond(connection, status, body, strlen(body), "text/plain");
+}
+
+void HttpApiTask::respond(Connection& connection, uint16_t status, const char* body, size_t body_length,
+        const char* content_type) {
+    char header[256];
+    bool keep_alive = connection.parser.keepAlive();
+    int header_length = snprintf(header, sizeof(header),
+        "HTTP/1.1 %u %s\r\n"
+        "Content-Type: %s\r\n"
+        "Content-Length: %u\r\n"
+        "Access-Control-Allow-Origin: *\r\n"
+        "Access-Control-Allow-Methods: GET, POST, OPTIONS\r\n"
+        "Access-Control-Allow-Headers: Content-Type\r\n"
+        "Connection: %s\r\n"
+        "\r\n",
+        status, statusText(status), content_type, (unsigned)body_length, keep_alive ? "keep-alive" : "close");
+
+    WiFiClient& client = connection.client;
+    if (client.write((const uint8_t*)header, header_length) != (size_t)header_length
+            || (body_length > 0 && client.write((const uint8_t*)body, body_length) != body_length)
+            || !keep_alive) {
+        close(connection);
+    }
+}
+
+void HttpApiTask::close(Connection& connection) {
+    connection.client.stop();
+    connection.active = false;
+    connection.streaming = false;
+}
+
+uint8_t HttpApiTask::activeConnections() const {
+    uint8_t count = 0;
+    for (uint8_t i = 0; i < HTTP_API_MAX_CONNECTIONS; i++) {
+        count += connections_[i].active;
+    }
+    return count;
+}
+
+uint8_t HttpApiTask::activeStreams() const {
+    uint8_t count = 0;
+    for (uint8_t i = 0; i < HTTP_API_MAX_CONNECTIONS; i++) {
+        count += connections_[i].active && connections_[i].streaming;
+    }
+    return count;
+}
+
+void HttpApiTask::logStats() {
+    uint32_t now = millis();
+    uint8_t streams = activeStreams();
+    if (request_count_ > 0) {
+        char buf[200];
+        snprintf(buf, sizeof(buf), "HTTP API: %u requests (%u commands) in %us, %u event streams", request_count_,
+            command_count_, (now - last_stats_millis_) / 1000, streams);
+        logger_.log(buf);
+    }
+    request_count_ = 0;
+    command_count_ = 0;
+    last_stats_millis_ = now;
+}
+#endif
@@ -0,0 +1,111 @@
+/*
+   Copyright 2022 Scott Bezek and the splitflap contributors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+#pragma once
+
+#include <Arduino.h>
+#include <WiFi.h>
+
+#include "../core/logger.h"
+#include "../core/splitflap_task.h"
+#include "../core/task.h"
+
+#include "http_request_parser.h"
+#include "json_writer.h"
+#include "wifi_manager.h"
+
+#ifndef HTTP_API_PORT
+#define HTTP_API_PORT 80
+#endif
+
+// Most clients (including event streams) connected at once
+#define HTTP_API_MAX_CONNECTIONS 4
+
+// Enough for every module in a state response
+#define HTTP_API_JSON_BUFFER_SIZE (NUM_MODULES * 136 + 64)
+
+/**
+ * Small HTTP server for controlling the display from the LAN, without a round trip through an MQTT broker:
+ *
+ *   GET  /state    Current state of every module, as JSON
+ *   GET  /events   Server-Sent Events stream of the state: all modules at first, then only those that changed
+ *   POST /text     Shows the body as text. Optional ?align=left|center|right|justify and ?force (full rotation)
+ *   POST /flaps    Moves modules to raw flap indexes, given as a comma separated body; empty entries are left as
+ *                  they are (e.g. "0,,12" moves the first and third modules)
+ *   POST /reset    Resets and re-homes every module
+ *
+ * Commands go on SplitflapTask's queue like those from MQTT or serial, and are answered (202) as soon as they're
+ * queued; watch /events to see them take effect. Connections are kept alive, so commands can be sent back to back
+ * without reconnecting. software/chainlink/http_api_benchmark.py measures throughput and latency.
+ */
+class HttpApiTask : public Task<HttpApiTask> {
+    friend class Task<HttpApiTask>; // Allow base Task to invoke protected run()
+
+    public:
+        HttpApiTask(SplitflapTask& splitflap_task, WiFiManager& wifi_manager, Logger& logger, const uint8_t task_core);
+
+    protected:
+        void run();
+
+    private:
+        struct Connection {
+            bool active;
+            // Switched to an event stream, so no more requests are read
+            bool streaming;
+            WiFiClient client;
+            HttpRequestParser parser;
+            uint32_t last_activity_millis;
+        };
+
+        SplitflapTask& splitflap_task_;
+        WiFiManager& wifi_manager_;
+        Logger& logger_;
+        WiFiServer server_;
+
+        Connection connections_[HTTP_API_MAX_CONNECTIONS] = {};
+
+        // Last state sent to event streams, which changes are relative to. Only kept up to date while there are
+        // streams.
+        SplitflapState streamed_state_ = {};
+        uint32_t last_keepalive_millis_ = 0;
+
+        char json_buffer_[HTTP_API_JSON_BUFFER_SIZE];
+
+        // Since the last stats log
+        uint32_t request_count_ = 0;
+        uint32_t command_count_ = 0;
+        uint32_t last_stats_millis_ = 0;
+
+        void accept();
+        void service(Connection& connection);
+        void handleRequest(Connection& connection);
+        void handleText(Connection& connection);
+        void handleFlaps(Connection& connection);
+        void startStream(Connection& connection);
+
+        // Sends changes since streamed_state_ to every event stream
+        void broadcastState();
+        // Writes the modules that differ from previous (or all of them if previous is null)
+        void writeState(JsonWriter& writer, SplitflapState& state, SplitflapState* previous);
+        bool sendEvent(Connection& connection, const JsonWriter& writer);
+
+        void respond(Connection& connection, uint16_t status, const char* body = "");
+        void respond(Connection& connection, uint16_t status, const char* body, size_t body_length,
+            const char* content_type);
+        void close(Connection& connection);
+        uint8_t activeConnections() const;
+        uint8_t activeStreams() const;
+        void logStats();
+};
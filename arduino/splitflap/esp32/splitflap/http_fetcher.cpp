@@ -0,0 +1,288 @@
+/*
+   Copyright 2022 Scott Bezek and the splitflap contributors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+#include "http_fetcher.h"
+
+#include <WiFiClientSecure.h>
+
+// Response headers kept for conditional fetches
+static const char* VALIDATOR_HEADERS[] = {"ETag", "Last-Modified"};
+
+// Passes data written to it on to an HttpBodyHandler
+class HttpBodyStream : public Stream {
+    public:
+        HttpBodyStream(const HttpBodyHandler& handler) : handler_(handler) {}
+
+        size_t write(uint8_t c) override {
+            handler_(&c, 1);
+            return 1;
+        }
+
+        size_t write(const uint8_t* buffer, size_t size) override {
+            handler_(buffer, size);
+            return size;
+        }
+
+        int available() override {
+            return 0;
+        }
+
+        int read() override {
+            return -1;
+        }
+
+        int peek() override {
+            return -1;
+        }
+
+        void flush() override {}
+
+    private:
+        const HttpBodyHandler& handler_;
+};
+
+// Parses "http[s]://host[:port]/path" into its connection parameters
+static bool parseUrl(const String& url, String& host, uint16_t& port, bool& secure) {
+    int host_start;
+    if (url.startsWith("https://")) {
+        secure = true;
+        port = 443;
+        host_start = 8;
+    } else if (url.startsWith("http://")) {
+        secure = false;
+        port = 80;
+        host_start = 7;
+    } else {
+        return false;
+    }
+
+    int host_end = url.indexOf('/', host_start);
+    if (host_end < 0) {
+        host_end = url.length();
+    }
+    int port_start = url.indexOf(':', host_start);
+    if (port_start >= 0 && port_start < host_end) {
+        port = url.substring(port_start + 1, host_end).toInt();
+        host_end = port_start;
+    }
+    host = url.substring(host_start, host_end);
+    return host.length() > 0 && port > 0;
+}
+
+HttpFetchWorker::HttpFetchWorker(QueueHandle_t request_queue, const uint8_t task_core) :
+        Task("HttpFetch", 8192, 1, task_core),
+        request_queue_(request_queue) {
+}
+
+HttpFetchWorker::~HttpFetchWorker() {
+    for (uint8_t i = 0; i < HTTP_MAX_CONNECTIONS_PER_WORKER; i++) {
+        closeConnection(connections_[i]);
+    }
+}
+
+void HttpFetchWorker::run() {
+    HttpFetch* fetch;
+    while (1) {
+        if (xQueueReceive(request_queue_, &fetch, pdMS_TO_TICKS(1000)) == pdTRUE) {
+            perform(*fetch);
+            assert(xQueueSendToBack(fetch->completion_queue_, &fetch, portMAX_DELAY) == pdTRUE);
+        }
+        closeIdleConnections();
+    }
+}
+
+void HttpFetchWorker::perform(HttpFetch& fetch) {
+    uint32_t start = millis();
+    fetch.status = 0;
+    fetch.body = String();
+    fetch.unchanged = false;
+
+    String host;
+    uint16_t port;
+    bool secure;
+    if (!parseUrl(fetch.url, host, port, secure)) {
+        log_d("Invalid URL %s", fetch.url.c_str());
+        fetch.status = HTTPC_ERROR_CONNECTION_REFUSED;
+        return;
+    }
+
+    HttpConnection* connection = getConnection(host, port, secure);
+    HTTPClient& http = *connection->http;
+    http.setReuse(true);
+    http.setConnectTimeout(fetch.timeout_millis);
+    http.setTimeout(min(fetch.timeout_millis, (uint32_t)UINT16_MAX));
+
+    if (!http.begin(*connection->client, fetch.url)) {
+        fetch.status = HTTPC_ERROR_CONNECTION_REFUSED;
+    } else {
+        if (fetch.conditional) {
+            // begin() clears any headers from the previous request on this connection
+            http.collectHeaders(VALIDATOR_HEADERS, sizeof(VALIDATOR_HEADERS) / sizeof(VALIDATOR_HEADERS[0]));
+            if (fetch.etag_.length() > 0) {
+                http.addHeader("If-None-Match", fetch.etag_);
+            }
+            if (fetch.last_modified_.length() > 0) {
+                http.addHeader("If-Modified-Since", fetch.last_modified_);
+            }
+        }
+
+        fetch.status = http.GET();
+        if (fetch.status == HTTP_CODE_NOT_MODIFIED) {
+            // There's no body to read
+            fetch.unchanged = fetch.conditional;
+        } else if (fetch.status > 0) {
+            readBody(fetch, *connection);
+        }
+        if (fetch.conditional) {
+            updateValidators(fetch, http);
+        }
+        // Leaves the connection open if the server allows keep-alive
+        http.end();
+    }
+
+    if (fetch.status < 0) {
+        // Don't try to reuse a connection in an unknown state
+        closeConnection(*connection);
+    }
+
+    connection->last_used_millis = millis();
+    fetch.elapsed_millis = millis() - start;
+    log_d("GET %s: %d in %u millis", fetch.url.c_str(), fetch.status, fetch.elapsed_millis);
+}
+
+void HttpFetchWorker::readBody(HttpFetch& fetch, HttpConnection& connection) {
+    HTTPClient& http = *connection.http;
+    if (fetch.body_handler) {
+        // writeToStream() also handles chunked responses
+        HttpBodyStream stream(fetch.body_handler);
+        int result = http.writeToStream(&stream);
+        if (result < 0) {
+            fetch.status = result;
+        }
+        return;
+    }
+
+    int size = http.getSize();
+    if (size > 0 && (size_t)size > fetch.max_body_size) {
+        // Too large to buffer; closing the connection is cheaper than reading and discarding it
+        fetch.status = HTTPC_ERROR_TOO_LESS_RAM;
+        connection.client->stop();
+        return;
+    }
+    // getString() also handles chunked responses, which HTTP/1.1 servers may send
+    fetch.body = http.getString();
+    if (fetch.body.length() > fetch.max_body_size) {
+        fetch.status = HTTPC_ERROR_TOO_LESS_RAM;
+        fetch.body = String();
+        return;
+    }
+}
+
+void HttpFetchWorker::updateValidators(HttpFetch& fetch, HTTPClient& http) {
+    if (fetch.status == HTTP_CODE_NOT_MODIFIED) {
+        // Still describes the previous response
+        return;
+    }
+    if (fetch.status != HTTP_CODE_OK) {
+        // Nothing usable was received, so the next response can't be compared against it
+        fetch.forgetPreviousResponse();
+        return;
+    }
+
+    fetch.etag_ = http.header("ETag");
+    fetch.last_modified_ = http.header("Last-Modified");
+}
+
+HttpConnection* HttpFetchWorker::getConnection(const String& host, uint16_t port, bool secure) {
+    HttpConnection* least_recently_used = &connections_[0];
+    for (uint8_t i = 0; i < HTTP_MAX_CONNECTIONS_PER_WORKER; i++) {
+        HttpConnection& connection = connections_[i];
+        if (connection.client != nullptr && connection.port == port && connection.secure == secure
+                && connection.host == host) {
+            return &connection;
+        }
+        if (connection.client == nullptr) {
+            least_recently_used = &connection;
+        } else if (least_recently_used->client != nullptr
+                && connection.last_used_millis < least_recently_used->last_used_millis) {
+            least_recently_used = &connection;
+        }
+    }
+
+    HttpConnection& connection = *least_recently_used;
+    closeConnection(connection);
+    if (secure) {
+        WiFiClientSecure* client = new WiFiClientSecure();
+        // Matches HTTPClient's behavior when given an https URL without a CA certificate
+        client->setInsecure();
+        connection.client = client;
+    } else {
+        connection.client = new WiFiClient();
+    }
+    connection.http = new HTTPClient();
+    connection.host = host;
+    connection.port = port;
+    connection.secure = secure;
+    connection.last_used_millis = millis();
+    return &connection;
+}
+
+void HttpFetchWorker::closeConnection(HttpConnection& connection) {
+    if (connection.client != nullptr) {
+        connection.client->stop();
+        delete connection.http;
+        delete connection.client;
+        connection.http = nullptr;
+        connection.client = nullptr;
+    }
+}
+
+void HttpFetchWorker::closeIdleConnections() {
+    uint32_t now = millis();
+    for (uint8_t i = 0; i < HTTP_MAX_CONNECTIONS_PER_WORKER; i++) {
+        HttpConnection& connection = connections_[i];
+        if (connection.client != nullptr && now - connection.last_used_millis > HTTP_CONNECTION_IDLE_MILLIS) {
+            log_d("Closing idle connection to %s", connection.host.c_str());
+            closeConnection(connection);
+        }
+    }
+}
+
+
+HttpFetcher::HttpFetcher(const uint8_t task_core) :
+        request_queue_(xQueueCreate(HTTP_FETCH_QUEUE_LENGTH, sizeof(HttpFetch*))) {
+    assert(request_queue_ != NULL);
+    for (uint8_t i = 0; i < HTTP_FETCH_WORKERS; i++) {
+        workers_[i] = new HttpFetchWorker(request_queue_, task_core);
+    }
+}
+
+HttpFetcher::~HttpFetcher() {
+    for (uint8_t i = 0; i < HTTP_FETCH_WORKERS; i++) {
+        delete workers_[i];
+    }
+    vQueueDelete(request_queue_);
+}
+
+void HttpFetcher::begin() {
+    for (uint8_t i = 0; i < HTTP_FETCH_WORKERS; i++) {
+        workers_[i]->begin();
+    }
+}
+
+bool HttpFetcher::submit(HttpFetch* fetch, QueueHandle_t completion_queue) {
+    fetch->completion_queue_ = completion_queue;
+    return xQueueSendToBack(request_queue_, &fetch, 0) == pdTRUE;
+}
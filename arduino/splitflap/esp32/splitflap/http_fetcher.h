@@ -0,0 +1,145 @@
+/*
+   Copyright 2022 Scott Bezek and the splitflap contributors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+#pragma once
+
+#include <functional>
+
+#include <Arduino.h>
+#include <HTTPClient.h>
+#include <WiFi.h>
+
+#include "../core/task.h"
+
+// Number of requests that can be in progress at once (each worker has its own task and connections)
+#define HTTP_FETCH_WORKERS 2
+
+// Max number of requests queued up for the workers
+#define HTTP_FETCH_QUEUE_LENGTH 4
+
+// Connections each worker keeps open for reuse; the least recently used one is closed to make room
+#define HTTP_MAX_CONNECTIONS_PER_WORKER 2
+
+// Kept-alive connections that haven't been used in this long are closed
+#define HTTP_CONNECTION_IDLE_MILLIS (60 * 1000)
+
+#define HTTP_DEFAULT_TIMEOUT_MILLIS (5 * 1000)
+#define HTTP_DEFAULT_MAX_BODY_SIZE (16 * 1024)
+
+class HttpFetcher;
+class HttpFetchWorker;
+
+typedef std::function<void(const uint8_t* data, size_t length)> HttpBodyHandler;
+
+/**
+ * A single GET request and, once it has completed, its response.
+ *
+ * The fetch is owned by whoever submits it, and must not be touched (or destroyed) from when it's submitted
+ * until it has been received from the completion queue.
+ */
+struct HttpFetch {
+    // Request
+    String url;
+    uint32_t timeout_millis = HTTP_DEFAULT_TIMEOUT_MILLIS;
+    size_t max_body_size = HTTP_DEFAULT_MAX_BODY_SIZE;
+
+    // If set, the body is passed to this in chunks as it's received (on a worker task) rather than being
+    // buffered into body; max_body_size doesn't apply
+    HttpBodyHandler body_handler;
+
+    // If set, each request tells the server which response was last received (via its ETag/Last-Modified
+    // validators, if it sent them), so it can respond 304 Not Modified without a body
+    bool conditional = false;
+
+    // Response: an HTTP status code, or a negative HTTPC_ERROR_* code if the request failed
+    int status = 0;
+    String body;
+    uint32_t elapsed_millis = 0;
+
+    // Conditional fetches only: true if the server responded 304 Not Modified, i.e. the previous successful
+    // response still applies
+    bool unchanged = false;
+
+    // Makes the next request unconditional, e.g. if the previous response couldn't be used
+    void forgetPreviousResponse() {
+        etag_ = String();
+        last_modified_ = String();
+    }
+
+    private:
+        friend class HttpFetcher;
+        friend class HttpFetchWorker;
+        QueueHandle_t completion_queue_ = NULL;
+
+        // From the previous successful response, for conditional fetches
+        String etag_;
+        String last_modified_;
+};
+
+struct HttpConnection {
+    String host;
+    uint16_t port;
+    bool secure;
+    // Both are null when the slot is unused. HTTPClient holds on to the client, so they're freed together.
+    WiFiClient* client;
+    HTTPClient* http;
+    uint32_t last_used_millis;
+};
+
+class HttpFetchWorker : public Task<HttpFetchWorker> {
+    friend class Task<HttpFetchWorker>; // Allow base Task to invoke protected run()
+
+    public:
+        HttpFetchWorker(QueueHandle_t request_queue, const uint8_t task_core);
+        ~HttpFetchWorker();
+
+    protected:
+        void run();
+
+    private:
+        const QueueHandle_t request_queue_;
+
+        HttpConnection connections_[HTTP_MAX_CONNECTIONS_PER_WORKER] = {};
+
+        void perform(HttpFetch& fetch);
+        void readBody(HttpFetch& fetch, HttpConnection& connection);
+        void updateValidators(HttpFetch& fetch, HTTPClient& http);
+        HttpConnection* getConnection(const String& host, uint16_t port, bool secure);
+        void closeConnection(HttpConnection& connection);
+        void closeIdleConnections();
+};
+
+/**
+ * Performs HTTP GET requests in the background, so callers never block on the network.
+ *
+ * Requests are picked up by a small pool of worker tasks, each of which keeps connections open (HTTP
+ * keep-alive) so repeated requests to the same host skip the TCP and TLS handshakes. Completed fetches are
+ * sent to the completion queue given to submit(), which is a FreeRTOS queue of HttpFetch*.
+ */
+class HttpFetcher {
+    public:
+        HttpFetcher(const uint8_t task_core);
+        ~HttpFetcher();
+
+        // Starts the worker tasks; call once the network is up
+        void begin();
+
+        // Queues the fetch. Returns false if too many requests are already outstanding.
+        bool submit(HttpFetch* fetch, QueueHandle_t completion_queue);
+
+    private:
+        const QueueHandle_t request_queue_;
+        HttpFetchWorker* workers_[HTTP_FETCH_WORKERS];
+};
@@ -0,0 +1,175 @@
+/*
+   Copyright 2022 Scott Bezek and the splitflap contributors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+#include "http_request_parser.h"
+
+#include <stdlib.h>
+#include <string.h>
+#include <strings.h>
+
+static const char HEADER_END[] = "\r\n\r\n";
+#define HEADER_END_LENGTH 4
+
+HttpRequestParser::HttpRequestParser() {
+    reset();
+}
+
+void HttpRequestParser::reset() {
+    length_ = 0;
+    headers_complete_ = false;
+    header_length_ = 0;
+    content_length_ = 0;
+    keep_alive_ = true;
+    method_ = "";
+    path_ = "";
+    query_ = "";
+    buffer_[0] = '\0';
+}
+
+HttpParseResult HttpRequestParser::consume(const char* data, size_t length, size_t* used) {
+    size_t i = 0;
+    HttpParseResult result = HttpParseResult::INCOMPLETE;
+    while (i < length && result == HttpParseResult::INCOMPLETE) {
+        if (length_ == HTTP_MAX_REQUEST_LENGTH) {
+            result = HttpParseResult::TOO_LARGE;
+            break;
+        }
+        buffer_[length_++] = data[i++];
+
+        if (!headers_complete_) {
+            if (length_ < HEADER_END_LENGTH
+                    || memcmp(buffer_ + length_ - HEADER_END_LENGTH, HEADER_END, HEADER_END_LENGTH) != 0) {
+                continue;
+            }
+            headers_complete_ = true;
+            header_length_ = length_;
+            if (!parseHeaders()) {
+                result = HttpParseResult::ERROR;
+            } else if (content_length_ > HTTP_MAX_REQUEST_LENGTH - header_length_) {
+                result = HttpParseResult::TOO_LARGE;
+            }
+        }
+        if (headers_complete_ && result == HttpParseResult::INCOMPLETE
+                && length_ - header_length_ == content_length_) {
+            buffer_[length_] = '\0';
+            result = HttpParseResult::COMPLETE;
+        }
+    }
+    *used = i;
+    return result;
+}
+
+bool HttpRequestParser::parseHeaders() {
+    // Split the headers into lines in place (the body follows, so it's left alone)
+    buffer_[header_length_ - 2] = '\0';
+    char* line = buffer_;
+    char* line_end = strstr(line, "\r\n");
+    if (line_end == nullptr) {
+        return false;
+    }
+    *line_end = '\0';
+
+    // Request line: METHOD SP target SP version
+    char* target = strchr(line, ' ');
+    if (target == nullptr) {
+        return false;
+    }
+    *target++ = '\0';
+    char* version = strchr(target, ' ');
+    if (version == nullptr) {
+        return false;
+    }
+    *version++ = '\0';
+    if (strncmp(version, "HTTP/1.", 7) != 0) {
+        return false;
+    }
+    // Connections are only persistent by default from HTTP/1.1
+    keep_alive_ = strcmp(version, "HTTP/1.0") != 0;
+
+    method_ = line;
+    path_ = target;
+    char* query = strchr(target, '?');
+    if (query != nullptr) {
+        *query++ = '\0';
+        query_ = query;
+    }
+
+    line = line_end + 2;
+    while (*line != '\0') {
+        line_end = strstr(line, "\r\n");
+        if (line_end != nullptr) {
+            *line_end = '\0';
+        }
+
+        char* value = strchr(line, ':');
+        if (value == nullptr) {
+            return false;
+        }
+        *value++ = '\0';
+        while (*value == ' ' || *value == '\t') {
+            value++;
+        }
+
+        if (strcasecmp(line, "Content-Length") == 0) {
+            char* end;
+            long content_length = strtol(value, &end, 10);
+            if (end == value || content_length < 0) {
+                return false;
+            }
+            content_length_ = content_length;
+        } else if (strcasecmp(line, "Transfer-Encoding") == 0) {
+            // Chunked bodies aren't supported
+            return false;
+        } else if (strcasecmp(line, "Connection") == 0) {
+            if (strcasecmp(value, "close") == 0) {
+                keep_alive_ = false;
+            } else if (strcasecmp(value, "keep-alive") == 0) {
+                keep_alive_ = true;
+            }
+        }
+
+        if (line_end == nullptr) {
+            break;
+        }
+        line = line_end + 2;
+    }
+    return true;
+}
+
+bool HttpRequestParser::queryParam(const char* name, char* value, size_t size) const {
+    size_t name_length = strlen(name);
+    const char* param = query_;
+    while (*param != '\0') {
+        const char* end = strchr(param, '&');
+        if (end == nullptr) {
+            end = param + strlen(param);
+        }
+
+        if (strncmp(param, name, name_length) == 0
+                && (param + name_length == end || param[name_length] == '=')) {
+            const char* start = param + name_length == end ? end : param + name_length + 1;
+            size_t length = end - start;
+            if (length >= size) {
+                length = size - 1;
+            }
+            memcpy(value, start, length);
+            value[length] = '\0';
+            return true;
+        }
+
+        param = *end == '&' ? end + 1 : end;
+    }
+    return false;
+}
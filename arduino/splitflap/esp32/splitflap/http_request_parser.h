@@ -0,0 +1,97 @@
+/*
+   Copyright 2022 Scott Bezek and the splitflap contributors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+// Longest request (headers and body) that's accepted. Browsers send a few hundred bytes of headers; the longest
+// body needed is a /flaps command for every module.
+#define HTTP_MAX_REQUEST_LENGTH 1024
+
+enum class HttpParseResult {
+    // More data is needed
+    INCOMPLETE,
+    COMPLETE,
+    // Malformed, or uses something that isn't supported (e.g. chunked bodies)
+    ERROR,
+    // Longer than HTTP_MAX_REQUEST_LENGTH
+    TOO_LARGE,
+};
+
+/**
+ * Incremental parser for HTTP/1.x requests, for a small embedded server.
+ *
+ * Data can be fed in arbitrary chunks as it arrives. The request is kept in a fixed-size buffer and split in place,
+ * so nothing is allocated. Only the request line, Content-Length and Connection headers are interpreted.
+ */
+class HttpRequestParser {
+    public:
+        HttpRequestParser();
+
+        // Prepares for the next request on the connection
+        void reset();
+
+        // Feeds data, stopping at the end of the request (any further data belongs to the next one). used is set to
+        // the number of bytes consumed. Once COMPLETE, the accessors below are valid until reset().
+        HttpParseResult consume(const char* data, size_t length, size_t* used);
+
+        // True if part of a request has been received
+        bool inProgress() const {
+            return length_ > 0;
+        }
+
+        const char* method() const {
+            return method_;
+        }
+
+        // Target without the query string
+        const char* path() const {
+            return path_;
+        }
+
+        // Copies the value of a query string parameter (not URL-decoded) into value, returning false if it's not
+        // present
+        bool queryParam(const char* name, char* value, size_t size) const;
+
+        // The body, nul-terminated
+        const char* body() const {
+            return buffer_ + header_length_;
+        }
+
+        size_t bodyLength() const {
+            return content_length_;
+        }
+
+        // False if the client asked for the connection to be closed after this request
+        bool keepAlive() const {
+            return keep_alive_;
+        }
+
+    private:
+        char buffer_[HTTP_MAX_REQUEST_LENGTH + 1];
+        size_t length_;
+        bool headers_complete_;
+        size_t header_length_;
+        size_t content_length_;
+        bool keep_alive_;
+
+        const char* method_;
+        const char* path_;
+        const char* query_;
+
+        bool parseHeaders();
+};
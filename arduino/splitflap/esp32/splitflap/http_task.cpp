@@ -25,8 +25,11 @@
 #include "secrets.h"
 #include "timed_message_provider.h"
 
-// Update data every 5 seconds
-#define REQUEST_INTERVAL_MILLIS (5 * 1000)
+// Providers fetch in the background, so they're polled often to pick up results promptly
+#define POLL_INTERVAL_MILLIS 100
+
+// Refresh the WiFi status on the display every second
+#define WIFI_STATUS_INTERVAL_MILLIS 1000
 
 // Cycle the message that's showing more frequently, every 15 seconds
 #define MESSAGE_CYCLE_INTERVAL_MILLIS (15 * 1000)
@@ -34,37 +37,48 @@
 // Don't show stale data if it's been too long since successful data load
 #define STALE_TIME_MILLIS (20 * 1000)
 
+// Stop timing a message change that hasn't finished after this long (e.g. a
+// module is homing or has failed)
+#define TRANSITION_TIMEOUT_MILLIS (10 * 1000)
+
 // Timezone for local time strings; this is Australia/Sydney. See
 // https://github.com/nayarsystems/posix_tz_db/blob/master/zones.csv
 #define TIMEZONE "AEST-10AEDT,M10.1.0,M4.1.0/3"
 
+// True if every module has stopped at the message's flap (or is left as it is)
+static bool isShowing(const FlapMessage& message, const SplitflapState& state) {
+  for (uint8_t i = 0; i < NUM_MODULES; i++) {
+    uint8_t target = message[i];
+    if (state.modules[i].moving ||
+        (target != FLAP_INDEX_NONE && state.modules[i].flap_index != target)) {
+      return false;
+    }
+  }
+  return true;
+}
+
 HTTPTask::HTTPTask(SplitflapTask& splitflap_task, DisplayTask& display_task,
-                   WiFiManager& wifi_manager, Logger& logger,
-                   const uint8_t task_core)
+                   WiFiManager& wifi_manager, ScheduleStore& schedule_store,
+                   Logger& logger, const uint8_t task_core)
     : Task("HTTP", 8192, 1, task_core),
       splitflap_task_(splitflap_task),
       display_task_(display_task),
       wifi_manager_(wifi_manager),
-      logger_(logger) {
-  message_providers_.push_back(new TimedMessageProvider(display_task, logger));
-  message_providers_.push_back(new FlightDataProvider(display_task, logger));
-}
-
-HTTPTask::~HTTPTask() {
-  for (MessageProvider* provider : message_providers_) {
-    delete provider;
-  }
+      logger_(logger),
+      http_fetcher_(task_core),
+      scheduler_(logger),
+      planner_(splitflap_task) {
+  scheduler_.addProvider(
+      new TimedMessageProvider(display_task, logger, schedule_store));
+  scheduler_.addProvider(
+      new FlightDataProvider(display_task, http_fetcher_, logger, task_core));
 }
 
 void HTTPTask::run() {
-  char buf[max(NUM_MODULES + 1, 200)];
-
-  if (!wifi_manager_.connect()) {
-    // Loop forever, we can't do anything without WiFi
-    while (1) {
-      delay(1000);
-    }
-  }
+  // WiFiManager reconnects in the background; requests made while it's down
+  // just fail until it's back
+  wifi_manager_.waitForConnection();
+  http_fetcher_.begin();
 
   bool stale = false;
   while (1) {
@@ -72,30 +86,17 @@ void HTTPTask::run() {
 
     bool update = false;
 
-    // a. Fetch data
-    if (http_last_request_time_ == 0 ||
-        now_millis - http_last_request_time_ > REQUEST_INTERVAL_MILLIS) {
-      for (MessageProvider* provider : message_providers_) {
-        FetchResult fetchResult = provider->fetchData();
-        http_last_request_time_ = millis();
-
-        if (!provider->getMessages().empty()) {
-          if (fetchResult == FetchResult::UPDATE) {
-            messages_ = provider->getMessages();
-            http_last_success_time_ = millis();
-            stale = false;
-            update = true;
-            current_message_index_ = 0;
-          } else if (fetchResult == FetchResult::NO_CHANGE) {
-            http_last_success_time_ = millis();
-            stale = false;
-            update = false;
-          }
-          // This provider is active, so we don't want to fall back to the next
-          // one
-          break;
-        }
+    // a. Refresh providers that are due (they never block on the network), and
+    // pick up the messages of the highest priority one with fresh data
+    bool changed = scheduler_.poll();
+    if (scheduler_.hasSelection()) {
+      if (changed || stale) {
+        messages_ = scheduler_.getMessages();
+        update = true;
+        planner_.reset();
       }
+      http_last_success_time_ = millis();
+      stale = false;
     }
 
     // b. Stale data check
@@ -103,60 +104,122 @@ void HTTPTask::run() {
         millis() - http_last_success_time_ > STALE_TIME_MILLIS) {
       stale = true;
       messages_.clear();
-      messages_.push_back("      ");
+      messages_.push_back(FlapMessage());
       update = true;
-      current_message_index_ = 0;  // Point to the blank message
+      planner_.reset();
     }
 
     if (update || now_millis - last_message_change_time_ >
                       MESSAGE_CYCLE_INTERVAL_MILLIS) {
-      if (current_message_index_ >= messages_.size()) {
-        current_message_index_ = 0;
-      }
-
       if (messages_.size() > 0) {
-        String message = messages_[current_message_index_];
-
-        log_d("Cycling to next message: %s", message.c_str());
-
-        // Pad message for display
-        size_t len = strlcpy(buf, message.c_str(), sizeof(buf));
-        memset(buf + len, ' ', sizeof(buf) - len);
+        uint32_t predicted_millis;
+        SplitflapState state = splitflap_task_.getState();
+        uint8_t index = planner_.next(messages_, state, &predicted_millis);
+        const FlapMessage& message = messages_[index];
+
+        char text[NUM_MODULES + 1];
+        message.toText(text, sizeof(text));
+        log_d("Cycling to next message: %s", text);
+
+        splitflap_task_.showMessage(message, false);
+        // Whether or not the messages changed: after a short drop (or with
+        // only timed messages) they're the same as before it. The blank
+        // message shown for stale data doesn't count.
+        if (!stale) {
+          logFirstMessage();
+        }
 
-        splitflap_task_.showString(buf, NUM_MODULES, false);
+        // Nothing to time if the message is already showing (e.g. a cycle
+        // with a single message)
+        transition_pending_ =
+            predicted_millis > 0 && !isShowing(message, state);
+        transition_message_ = message;
+        transition_start_millis_ = millis();
+        transition_predicted_millis_ = predicted_millis;
       }
 
-      current_message_index_++;
       last_message_change_time_ = millis();
     }
 
-    String wifi_status;
-    switch (WiFi.status()) {
-      case WL_IDLE_STATUS:
-        wifi_status = "Idle";
-        break;
-      case WL_NO_SSID_AVAIL:
-        wifi_status = "No SSID";
-        break;
-      case WL_CONNECTED:
-        wifi_status = String(WiFi.SSID()) + " " + WiFi.localIP().toString();
-        break;
-      case WL_CONNECT_FAILED:
-        wifi_status = "Connection failed";
-        break;
-      case WL_CONNECTION_LOST:
-        wifi_status = "Connection lost";
-        break;
-      case WL_DISCONNECTED:
-        wifi_status = "Disconnected";
-        break;
-      default:
-        wifi_status = "Unknown";
-        break;
+    if (millis() - last_wifi_status_time_ > WIFI_STATUS_INTERVAL_MILLIS) {
+      String wifi_status;
+      switch (WiFi.status()) {
+        case WL_IDLE_STATUS:
+          wifi_status = "Idle";
+          break;
+        case WL_NO_SSID_AVAIL:
+          wifi_status = "No SSID";
+          break;
+        case WL_CONNECTED:
+          wifi_status = String(WiFi.SSID()) + " " + WiFi.localIP().toString();
+          break;
+        case WL_CONNECT_FAILED:
+          wifi_status = "Connection failed";
+          break;
+        case WL_CONNECTION_LOST:
+          wifi_status = "Connection lost";
+          break;
+        case WL_DISCONNECTED:
+          wifi_status = "Disconnected";
+          break;
+        default:
+          wifi_status = "Unknown";
+          break;
+      }
+      display_task_.setMessage(1, String("Wifi: ") + wifi_status);
+      last_wifi_status_time_ = millis();
     }
-    display_task_.setMessage(1, String("Wifi: ") + wifi_status);
 
-    delay(1000);
+    checkTransition();
+
+    delay(POLL_INTERVAL_MILLIS);
+  }
+}
+
+void HTTPTask::logFirstMessage() {
+  // Only the first message shown after each (re)connection is of interest
+  uint32_t connection_count = wifi_manager_.connectionCount();
+  if (connection_count == 0 || connection_count == logged_connection_count_) {
+    return;
+  }
+  logged_connection_count_ = connection_count;
+
+  char buf[200];
+  uint32_t now = millis();
+  if (connection_count == 1) {
+    snprintf(buf, sizeof(buf),
+             "First message shown %ums after boot (%ums after WiFi connected)",
+             now, now - wifi_manager_.connectedMillis());
+  } else {
+    snprintf(buf, sizeof(buf),
+             "First message shown %ums after WiFi reconnected",
+             now - wifi_manager_.connectedMillis());
+  }
+  logger_.log(buf);
+}
+
+void HTTPTask::checkTransition() {
+  if (!transition_pending_) {
+    return;
+  }
+
+  // Only checked every POLL_INTERVAL_MILLIS, so the actual time is rounded up
+  // to that
+  uint32_t elapsed_millis = millis() - transition_start_millis_;
+
+  char buf[200];
+  if (isShowing(transition_message_, splitflap_task_.getState())) {
+    snprintf(buf, sizeof(buf),
+             "Message change took %ums (predicted %ums)", elapsed_millis,
+             transition_predicted_millis_);
+  } else if (elapsed_millis > TRANSITION_TIMEOUT_MILLIS) {
+    snprintf(buf, sizeof(buf),
+             "Message change didn't finish within %ums (predicted %ums)",
+             TRANSITION_TIMEOUT_MILLIS, transition_predicted_millis_);
+  } else {
+    return;
   }
+  logger_.log(buf);
+  transition_pending_ = false;
 }
 #endif
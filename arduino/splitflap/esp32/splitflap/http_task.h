@@ -24,15 +24,17 @@
 #include "../core/task.h"
 
 #include "display_task.h"
+#include "http_fetcher.h"
 #include "wifi_manager.h"
-#include "message_provider.h"
+#include "message_provider_scheduler.h"
+#include "rotation_planner.h"
+#include "schedule_store.h"
 
 class HTTPTask : public Task<HTTPTask> {
     friend class Task<HTTPTask>; // Allow base Task to invoke protected run()
 
     public:
-        HTTPTask(SplitflapTask& splitflap_task, DisplayTask& display_task, WiFiManager& wifi_manager, Logger& logger, const uint8_t task_core);
-        ~HTTPTask();
+        HTTPTask(SplitflapTask& splitflap_task, DisplayTask& display_task, WiFiManager& wifi_manager, ScheduleStore& schedule_store, Logger& logger, const uint8_t task_core);
 
     protected:
         void run();
@@ -43,12 +45,25 @@ class HTTPTask : public Task<HTTPTask> {
         WiFiManager& wifi_manager_;
         Logger& logger_;
 
-        std::vector<MessageProvider*> message_providers_;
+        HttpFetcher http_fetcher_;
+        MessageProviderScheduler scheduler_;
 
-        uint32_t http_last_request_time_ = 0;
         uint32_t http_last_success_time_ = 0;
+        uint32_t last_wifi_status_time_ = 0;
 
-        std::vector<String> messages_ = {};
-        uint8_t current_message_index_ = 0;
+        FlapMessageList messages_;
+        RotationPlanner planner_;
         uint32_t last_message_change_time_ = 0;
+
+        // Message change that's being timed, to compare with the planner's estimate
+        bool transition_pending_ = false;
+        FlapMessage transition_message_;
+        uint32_t transition_start_millis_ = 0;
+        uint32_t transition_predicted_millis_ = 0;
+
+        // Connection (see WiFiManager::connectionCount()) that time-to-first-message was last logged for
+        uint32_t logged_connection_count_ = 0;
+
+        void logFirstMessage();
+        void checkTransition();
 };
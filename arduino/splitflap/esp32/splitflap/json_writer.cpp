@@ -0,0 +1,102 @@
+/*
+   Copyright 2022 Scott Bezek and the splitflap contributors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+#include <string.h>
+
+#include "json_writer.h"
+
+static const char HEX_DIGITS[] = "0123456789abcdef";
+
+JsonWriter::JsonWriter(char* buffer, size_t size) : buffer_(buffer), size_(size) {
+}
+
+JsonWriter& JsonWriter::raw(const char* text) {
+    append(text, strlen(text));
+    return *this;
+}
+
+JsonWriter& JsonWriter::raw(char c) {
+    append(&c, 1);
+    return *this;
+}
+
+JsonWriter& JsonWriter::string(const char* value, size_t max_length) {
+    raw('"');
+    for (size_t i = 0; i < max_length && value[i] != '\0'; i++) {
+        appendEscaped(value[i]);
+    }
+    raw('"');
+    return *this;
+}
+
+JsonWriter& JsonWriter::string(char value) {
+    raw('"');
+    appendEscaped(value);
+    raw('"');
+    return *this;
+}
+
+JsonWriter& JsonWriter::number(int32_t value) {
+    // Format backwards from the least significant digit
+    char digits[11];
+    size_t start = sizeof(digits);
+    uint32_t magnitude = value < 0 ? -(uint32_t)value : value;
+    do {
+        digits[--start] = '0' + magnitude % 10;
+        magnitude /= 10;
+    } while (magnitude > 0);
+    if (value < 0) {
+        raw('-');
+    }
+    append(digits + start, sizeof(digits) - start);
+    return *this;
+}
+
+void JsonWriter::append(const char* data, size_t length) {
+    if (overflowed_ || length > size_ - length_) {
+        overflowed_ = true;
+        return;
+    }
+    memcpy(buffer_ + length_, data, length);
+    length_ += length;
+}
+
+void JsonWriter::appendEscaped(char c) {
+    switch (c) {
+        case '"':
+            raw("\\\"");
+            break;
+        case '\\':
+            raw("\\\\");
+            break;
+        case '\n':
+            raw("\\n");
+            break;
+        case '\r':
+            raw("\\r");
+            break;
+        case '\t':
+            raw("\\t");
+            break;
+        default:
+            if ((uint8_t)c < 0x20) {
+                char escaped[] = {'\\', 'u', '0', '0', HEX_DIGITS[(c >> 4) & 0xF], HEX_DIGITS[c & 0xF]};
+                append(escaped, sizeof(escaped));
+            } else {
+                append(&c, 1);
+            }
+            break;
+    }
+}
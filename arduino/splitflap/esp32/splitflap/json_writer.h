@@ -0,0 +1,67 @@
+/*
+   Copyright 2022 Scott Bezek and the splitflap contributors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+#pragma once
+
+#include <stdint.h>
+#include <stddef.h>
+
+// Worst-case length of a JSON string value (including quotes) for an input of the given length, where every
+// character needs a \u00XX escape
+#define JSON_MAX_STRING_LENGTH(length) ((length) * 6 + 2)
+
+/**
+ * Minimal JSON formatter that writes into a fixed, caller-provided buffer, so a complete line of output can
+ * be built without any heap allocation and then written to a stream in a single call.
+ *
+ * There's no notion of nesting: callers write the structural characters themselves with raw(). Output that
+ * doesn't fit in the buffer is dropped (see overflowed()), but the buffer is never written past its end.
+ */
+class JsonWriter {
+    public:
+        JsonWriter(char* buffer, size_t size);
+
+        /** Appends text verbatim. */
+        JsonWriter& raw(const char* text);
+        JsonWriter& raw(char c);
+
+        /** Appends a quoted, escaped string value, truncated to at most max_length characters of input. */
+        JsonWriter& string(const char* value, size_t max_length = SIZE_MAX);
+        JsonWriter& string(char value);
+
+        /** Appends an integer value. */
+        JsonWriter& number(int32_t value);
+
+        const char* buffer() const {
+            return buffer_;
+        }
+
+        size_t length() const {
+            return length_;
+        }
+
+        bool overflowed() const {
+            return overflowed_;
+        }
+
+    private:
+        char* buffer_;
+        size_t size_;
+        size_t length_ = 0;
+        bool overflowed_ = false;
+
+        void append(const char* data, size_t length);
+        void appendEscaped(char c);
+};
@@ -22,10 +22,12 @@
 
 #include "../core/splitflap_task.h"
 #include "display_task.h"
+#include "schedule_store.h"
 #include "serial_task.h"
 
 SplitflapTask splitflapTask(1, LedMode::AUTO);
 SerialTask serialTask(splitflapTask, 0);
+ScheduleStore scheduleStore;
 
 #if ENABLE_DISPLAY
 DisplayTask displayTask(splitflapTask, 0);
@@ -36,9 +38,9 @@ DisplayTask displayTask(splitflapTask, 0);
 BaseSupervisorTask baseSupervisorTask(splitflapTask, serialTask, 0);
 #endif
 
-#if MQTT || HTTP
+#if MQTT || HTTP || HTTP_API
 #include "wifi_manager.h"
-WiFiManager wifiManager(displayTask, serialTask);
+WiFiManager wifiManager(displayTask, serialTask, 0);
 #endif
 
 #if MQTT
@@ -48,18 +50,31 @@ MQTTTask mqttTask(splitflapTask, wifiManager, serialTask, 0);
 
 #if HTTP
 #include "http_task.h"
-HTTPTask httpTask(splitflapTask, displayTask, wifiManager, serialTask, 0);
+HTTPTask httpTask(splitflapTask, displayTask, wifiManager, scheduleStore, serialTask, 0);
+#endif
+
+#if HTTP_API
+#include "http_api_task.h"
+HttpApiTask httpApiTask(splitflapTask, wifiManager, serialTask, 0);
 #endif
 
 void setup() {
+  scheduleStore.setLogger(&serialTask);
+  scheduleStore.begin();
+  serialTask.setScheduleStore(&scheduleStore);
   serialTask.begin();
 
   splitflapTask.begin();
 
   #if ENABLE_DISPLAY
+  displayTask.setLogger(&serialTask);
   displayTask.begin();
   #endif
 
+  #if MQTT || HTTP || HTTP_API
+  wifiManager.begin();
+  #endif
+
   #if MQTT
   mqttTask.begin();
   #endif
@@ -68,6 +83,10 @@ void setup() {
   httpTask.begin();
   #endif
 
+  #if HTTP_API
+  httpApiTask.begin();
+  #endif
+
   #ifdef CHAINLINK_BASE
   baseSupervisorTask.begin();
   #endif
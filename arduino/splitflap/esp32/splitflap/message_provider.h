@@ -15,19 +15,45 @@
 */
 #pragma once
 
-#include <vector>
 #include <Arduino.h>
 
+#include "../core/flap_message.h"
+
 enum class FetchResult
 {
     ERROR,
     NO_CHANGE,
     UPDATE,
+    // Still waiting for data to be fetched in the background
+    PENDING,
+};
+
+// How a provider is scheduled by MessageProviderScheduler
+struct MessageProviderSchedule
+{
+    // How often to start a refresh
+    uint32_t refresh_interval_millis;
+
+    // A refresh that's still PENDING after this long is counted as timed out, and the provider's messages are no
+    // longer considered fresh (until the refresh does complete)
+    uint32_t deadline_millis;
+
+    // Among providers with fresh messages, the highest priority one is shown
+    uint8_t priority;
 };
 
 class MessageProvider {
 public:
     virtual ~MessageProvider() = default;
+
+    virtual const char* name() const = 0;
+    virtual MessageProviderSchedule schedule() const = 0;
+
+    // Starts refreshing the provider's data; must not block (see HttpFetcher for fetching in the background)
+    virtual void startRefresh() {}
+
+    // Called frequently while a refresh is in progress (beginning right after startRefresh()) to collect its result,
+    // so must not block. Returns PENDING until the refresh is done.
     virtual FetchResult fetchData() = 0;
-    virtual const std::vector<String>& getMessages() = 0;
+    virtual const FlapMessageList& getMessages() = 0;
 };
@@ -0,0 +1,124 @@
+/*
+   Copyright 2022 Scott Bezek and the splitflap contributors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+#include "message_provider_scheduler.h"
+
+MessageProviderScheduler::MessageProviderScheduler(Logger& logger)
+    : logger_(logger) {}
+
+MessageProviderScheduler::~MessageProviderScheduler() {
+  for (ProviderState& state : providers_) {
+    delete state.provider;
+  }
+}
+
+void MessageProviderScheduler::addProvider(MessageProvider* provider) {
+  ProviderState state = {};
+  state.provider = provider;
+  state.schedule = provider->schedule();
+
+  // Keep providers_ sorted by priority; equal priorities keep the order they
+  // were added in
+  auto it = providers_.begin();
+  while (it != providers_.end() &&
+         it->schedule.priority >= state.schedule.priority) {
+    it++;
+  }
+  providers_.insert(it, state);
+  selected_ = -1;
+}
+
+bool MessageProviderScheduler::poll() {
+  uint32_t now = millis();
+  for (ProviderState& state : providers_) {
+    refresh(state, now);
+  }
+
+  int selected = -1;
+  for (size_t i = 0; i < providers_.size(); i++) {
+    if (isFresh(providers_[i], now) &&
+        !providers_[i].provider->getMessages().empty()) {
+      selected = i;
+      break;
+    }
+  }
+
+  bool changed = selected != selected_ ||
+                 (selected >= 0 && providers_[selected].updated);
+  if (selected != selected_) {
+    log_d("Showing messages from %s",
+          selected >= 0 ? providers_[selected].provider->name() : "(none)");
+  }
+  selected_ = selected;
+  return changed;
+}
+
+void MessageProviderScheduler::refresh(ProviderState& state, uint32_t now) {
+  state.updated = false;
+
+  if (!state.refreshing &&
+      (state.refresh_count == 0 || now - state.refresh_start_millis >=
+                                       state.schedule.refresh_interval_millis)) {
+    state.provider->startRefresh();
+    state.refreshing = true;
+    state.timed_out = false;
+    state.refresh_start_millis = now;
+    state.refresh_count++;
+  }
+  if (!state.refreshing) {
+    return;
+  }
+
+  switch (state.provider->fetchData()) {
+    case FetchResult::PENDING:
+      if (!state.timed_out &&
+          now - state.refresh_start_millis > state.schedule.deadline_millis) {
+        // Keep collecting the result, which is used whenever it does arrive
+        state.timed_out = true;
+        state.timeout_count++;
+        char buf[200];
+        snprintf(buf, sizeof(buf),
+                 "%s refresh timed out after %ums (%u of %u refreshes)",
+                 state.provider->name(), state.schedule.deadline_millis,
+                 state.timeout_count, state.refresh_count);
+        logger_.log(buf);
+      }
+      return;
+    case FetchResult::ERROR:
+      state.error_count++;
+      log_d("%s refresh failed (%u of %u refreshes)", state.provider->name(),
+            state.error_count, state.refresh_count);
+      break;
+    case FetchResult::NO_CHANGE:
+      state.last_success_millis = now;
+      break;
+    case FetchResult::UPDATE:
+      state.last_success_millis = now;
+      state.updated = true;
+      break;
+  }
+  state.refreshing = false;
+  state.timed_out = false;
+}
+
+bool MessageProviderScheduler::isFresh(const ProviderState& state,
+                                       uint32_t now) const {
+  if (state.last_success_millis == 0 || state.timed_out) {
+    return false;
+  }
+  return now - state.last_success_millis <=
+         state.schedule.refresh_interval_millis +
+             state.schedule.deadline_millis;
+}
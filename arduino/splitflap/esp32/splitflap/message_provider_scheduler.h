@@ -0,0 +1,79 @@
+/*
+   Copyright 2022 Scott Bezek and the splitflap contributors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+#pragma once
+
+#include <vector>
+#include <Arduino.h>
+
+#include "../core/logger.h"
+#include "message_provider.h"
+
+/**
+ * Refreshes each MessageProvider on its own schedule, and picks which provider's messages to show.
+ *
+ * Refreshes overlap freely, since providers do their slow work in the background (e.g. on the HttpFetcher's
+ * workers), so a slow provider never holds up the others. The messages shown are those of the highest priority
+ * provider whose messages are fresh (its last refresh succeeded within refresh_interval_millis + deadline_millis) and
+ * non-empty.
+ */
+class MessageProviderScheduler {
+    public:
+        MessageProviderScheduler(Logger& logger);
+        ~MessageProviderScheduler();
+
+        // Takes ownership of the provider
+        void addProvider(MessageProvider* provider);
+
+        // Starts refreshes that are due and collects results. Returns true if the selected messages changed.
+        bool poll();
+
+        // True if some provider currently has fresh messages
+        bool hasSelection() const {
+            return selected_ >= 0;
+        }
+
+        // Messages of the selected provider; only valid if hasSelection()
+        const FlapMessageList& getMessages() const {
+            return providers_[selected_].provider->getMessages();
+        }
+
+    private:
+        struct ProviderState {
+            MessageProvider* provider;
+            MessageProviderSchedule schedule;
+
+            bool refreshing;
+            bool timed_out;
+            uint32_t refresh_start_millis;
+            // 0 if no refresh has succeeded yet
+            uint32_t last_success_millis;
+            // Whether the last poll() got an UPDATE
+            bool updated;
+
+            uint32_t refresh_count;
+            uint32_t timeout_count;
+            uint32_t error_count;
+        };
+
+        Logger& logger_;
+        // Highest priority first
+        std::vector<ProviderState> providers_;
+        // Index into providers_, or -1
+        int selected_ = -1;
+
+        void refresh(ProviderState& state, uint32_t now);
+        bool isFresh(const ProviderState& state, uint32_t now) const;
+};
@@ -50,17 +50,12 @@ void MQTTTask::connectMQTT() {
 }
 
 void MQTTTask::run() {
-    if (!wifi_manager_.connect()) {
-        // Loop forever, we can't do anything without WiFi
-        while(1) {
-            delay(1000);
-        }
-    }
+    wifi_manager_.waitForConnection();
     connectMQTT();
 
     while(1) {
         long now = millis();
-        if (!mqtt_client_.connected() && (now - mqtt_last_connect_time_) > 5000) {
+        if (!mqtt_client_.connected() && wifi_manager_.isConnected() && (now - mqtt_last_connect_time_) > 5000) {
             logger_.log("Reconnecting MQTT");
             mqtt_last_connect_time_ = now;
             connectMQTT();
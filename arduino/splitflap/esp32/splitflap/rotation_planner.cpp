@@ -0,0 +1,106 @@
+/*
+   Copyright 2022 Scott Bezek and the splitflap contributors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+#include "rotation_planner.h"
+
+#include <algorithm>
+
+// Where modules will be after showing message, starting from positions
+static void applyMessage(uint8_t positions[NUM_MODULES],
+                         const FlapMessage& message) {
+  for (uint8_t i = 0; i < NUM_MODULES; i++) {
+    if (message[i] != FLAP_INDEX_NONE) {
+      positions[i] = message[i];
+    }
+  }
+}
+
+RotationPlanner::RotationPlanner(SplitflapTask& splitflap_task)
+    : splitflap_task_(splitflap_task) {}
+
+void RotationPlanner::reset() {
+  round_size_ = 0;
+  round_position_ = 0;
+  last_index_ = -1;
+}
+
+uint8_t RotationPlanner::next(const FlapMessageList& messages,
+                              const SplitflapState& state,
+                              uint32_t* predicted_millis) {
+  assert(!messages.empty());
+
+  uint8_t positions[NUM_MODULES];
+  for (uint8_t i = 0; i < NUM_MODULES; i++) {
+    positions[i] = state.modules[i].flap_index;
+  }
+
+  if (round_position_ >= round_size_ || round_size_ != messages.size()) {
+    planRound(messages, positions);
+  }
+
+  uint8_t index = order_[round_position_++];
+  last_index_ = index;
+  *predicted_millis = estimateTransitionMillis(positions, messages[index]);
+  return index;
+}
+
+uint32_t RotationPlanner::estimateTransitionMillis(
+    const uint8_t from[NUM_MODULES], const FlapMessage& message) const {
+  // Modules move at the same time, so this is the slowest module's time
+  uint8_t max_delta = 0;
+  for (uint8_t i = 0; i < NUM_MODULES; i++) {
+    // Modules already showing the right flap aren't moved (see
+    // SplitflapTask::showMessage())
+    if (message[i] == FLAP_INDEX_NONE || message[i] == from[i]) {
+      continue;
+    }
+    uint8_t delta = (message[i] + NUM_FLAPS - from[i]) % NUM_FLAPS;
+    max_delta = max(max_delta, delta);
+  }
+  return splitflap_task_.estimateMoveMillis(max_delta);
+}
+
+void RotationPlanner::planRound(const FlapMessageList& messages,
+                                const uint8_t positions[NUM_MODULES]) {
+  uint8_t count = messages.size();
+  uint8_t order[MAX_FLAP_MESSAGES];
+  for (uint8_t i = 0; i < count; i++) {
+    order[i] = i;
+  }
+
+  // There are at most MAX_FLAP_MESSAGES! orders, so try them all
+  uint32_t best_millis = UINT32_MAX;
+  do {
+    if (count > 1 && order[0] == last_index_) {
+      continue;
+    }
+    uint8_t round_positions[NUM_MODULES];
+    memcpy(round_positions, positions, sizeof(round_positions));
+    uint32_t total_millis = 0;
+    for (uint8_t i = 0; i < count; i++) {
+      total_millis +=
+          estimateTransitionMillis(round_positions, messages[order[i]]);
+      applyMessage(round_positions, messages[order[i]]);
+    }
+    if (total_millis < best_millis) {
+      best_millis = total_millis;
+      memcpy(order_, order, count);
+    }
+  } while (std::next_permutation(order, order + count));
+
+  round_size_ = count;
+  round_position_ = 0;
+  log_d("Planned %u messages, estimated %ums moving", count, best_millis);
+}
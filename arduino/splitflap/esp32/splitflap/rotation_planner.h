@@ -0,0 +1,56 @@
+/*
+   Copyright 2022 Scott Bezek and the splitflap contributors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+#pragma once
+
+#include <Arduino.h>
+
+#include "../core/flap_message.h"
+#include "../core/splitflap_task.h"
+
+/**
+ * Picks the order in which a list of messages is cycled through, to cut down on the time spent moving.
+ *
+ * Modules only turn forward, so the time to change message depends on how far round each module has to go (up to a
+ * full revolution), and a change takes as long as the slowest module. Messages are shown in rounds, each showing every
+ * message once, so none are starved; within a round the planner picks the order with the least total estimated
+ * moving time, starting from where the modules are. A round doesn't start with the message that ended the previous
+ * one, so no message is shown twice in a row.
+ */
+class RotationPlanner {
+    public:
+        RotationPlanner(SplitflapTask& splitflap_task);
+
+        // Forgets the current round, e.g. when the list of messages changes
+        void reset();
+
+        // Returns the index of the next message to show, and its estimated transition time from the current positions
+        uint8_t next(const FlapMessageList& messages, const SplitflapState& state, uint32_t* predicted_millis);
+
+        // Estimated time to show message, with modules starting from the given flap indexes
+        uint32_t estimateTransitionMillis(const uint8_t from[NUM_MODULES], const FlapMessage& message) const;
+
+    private:
+        SplitflapTask& splitflap_task_;
+
+        // Message indexes in the order they're shown in the current round
+        uint8_t order_[MAX_FLAP_MESSAGES];
+        uint8_t round_size_ = 0;
+        uint8_t round_position_ = 0;
+        // Last message shown, or -1
+        int last_index_ = -1;
+
+        void planRound(const FlapMessageList& messages, const uint8_t positions[NUM_MODULES]);
+};
@@ -0,0 +1,143 @@
+/*
+   Copyright 2022 Scott Bezek and the splitflap contributors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+#include "route_cache.h"
+
+#include <Preferences.h>
+#include <time.h>
+
+static const char* NVS_NAMESPACE = "route_cache";
+static const char* NVS_KEY_VERSION = "version";
+static const char* NVS_KEY_ENTRIES = "entries";
+
+// Bump when RouteCacheEntry changes, so entries saved by older firmware are discarded
+static const uint8_t NVS_VERSION = 1;
+
+// Before SNTP has set the clock, time() counts up from 0; anything earlier than this isn't a real time
+static const time_t MIN_VALID_TIME = 1640995200; // 2022-01-01
+
+// dump1090 pads callsigns with trailing spaces
+static String normalizeCallsign(const String& callsign) {
+    String normalized = callsign;
+    normalized.trim();
+    return normalized;
+}
+
+const RouteCacheEntry* RouteCache::lookup(const String& callsign) {
+    if (!loaded_) {
+        load();
+    }
+
+    String key = normalizeCallsign(callsign);
+    time_t now = time(nullptr);
+    for (uint8_t i = 0; i < ROUTE_CACHE_SIZE; i++) {
+        RouteCacheEntry& entry = entries_[i];
+        if (entry.last_used == 0 || key != entry.callsign) {
+            continue;
+        }
+
+        // Without a valid clock, trust whatever was cached until the time is known
+        uint32_t ttl = entry.has_route ? ROUTE_CACHE_TTL_SECONDS : ROUTE_CACHE_NEGATIVE_TTL_SECONDS;
+        if (now >= MIN_VALID_TIME && (uint32_t)now - entry.fetched_time > ttl) {
+            entry.last_used = 0;
+            break;
+        }
+
+        entry.last_used = ++use_counter_;
+        if (entry.has_route) {
+            stats_.hits++;
+        } else {
+            stats_.negative_hits++;
+        }
+        return &entry;
+    }
+    stats_.misses++;
+    return nullptr;
+}
+
+void RouteCache::insert(const String& callsign, const String& callsign_iata, const String& origin, const String& destination) {
+    RouteCacheEntry& entry = allocate(callsign);
+    strlcpy(entry.callsign_iata, callsign_iata.c_str(), sizeof(entry.callsign_iata));
+    strlcpy(entry.origin, origin.c_str(), sizeof(entry.origin));
+    strlcpy(entry.destination, destination.c_str(), sizeof(entry.destination));
+    entry.has_route = true;
+    save();
+}
+
+void RouteCache::insertNegative(const String& callsign) {
+    RouteCacheEntry& entry = allocate(callsign);
+    entry.has_route = false;
+    save();
+}
+
+RouteCacheEntry& RouteCache::allocate(const String& callsign) {
+    if (!loaded_) {
+        load();
+    }
+
+    String key = normalizeCallsign(callsign);
+
+    // Reuse the entry for this callsign if there is one, otherwise the least recently used (or an empty) slot
+    RouteCacheEntry* slot = &entries_[0];
+    for (uint8_t i = 0; i < ROUTE_CACHE_SIZE; i++) {
+        RouteCacheEntry& entry = entries_[i];
+        if (entry.last_used != 0 && key == entry.callsign) {
+            slot = &entry;
+            break;
+        }
+        if (entry.last_used < slot->last_used) {
+            slot = &entry;
+        }
+    }
+    if (slot->last_used != 0 && key != slot->callsign) {
+        stats_.evictions++;
+    }
+
+    *slot = {};
+    strlcpy(slot->callsign, key.c_str(), sizeof(slot->callsign));
+    time_t now = time(nullptr);
+    slot->fetched_time = now >= MIN_VALID_TIME ? now : 0;
+    slot->last_used = ++use_counter_;
+    return *slot;
+}
+
+void RouteCache::load() {
+    loaded_ = true;
+
+    Preferences preferences;
+    if (!preferences.begin(NVS_NAMESPACE, true)) {
+        return;
+    }
+    if (preferences.getUChar(NVS_KEY_VERSION, 0) == NVS_VERSION
+            && preferences.getBytesLength(NVS_KEY_ENTRIES) == sizeof(entries_)) {
+        preferences.getBytes(NVS_KEY_ENTRIES, entries_, sizeof(entries_));
+        for (uint8_t i = 0; i < ROUTE_CACHE_SIZE; i++) {
+            use_counter_ = max(use_counter_, entries_[i].last_used);
+        }
+        log_d("Loaded route cache");
+    }
+    preferences.end();
+}
+
+void RouteCache::save() {
+    Preferences preferences;
+    if (!preferences.begin(NVS_NAMESPACE, false)) {
+        log_d("Failed to open route cache for writing");
+        return;
+    }
+    preferences.putUChar(NVS_KEY_VERSION, NVS_VERSION);
+    preferences.putBytes(NVS_KEY_ENTRIES, entries_, sizeof(entries_));
+    preferences.end();
+}
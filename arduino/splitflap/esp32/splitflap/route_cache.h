@@ -0,0 +1,83 @@
+/*
+   Copyright 2022 Scott Bezek and the splitflap contributors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+#pragma once
+
+#include <Arduino.h>
+
+// Number of callsigns to remember; the least recently used one is evicted to make room
+#define ROUTE_CACHE_SIZE 32
+
+// How long a route is trusted for. Airlines rarely change the route flown under a callsign.
+#define ROUTE_CACHE_TTL_SECONDS (7 * 24 * 60 * 60)
+
+// How long to remember that a callsign has no known route
+#define ROUTE_CACHE_NEGATIVE_TTL_SECONDS (24 * 60 * 60)
+
+// ICAO callsigns are at most 8 characters; airport codes are stored as IATA (3) or ICAO (4) codes
+#define ROUTE_CALLSIGN_MAX_LENGTH 8
+#define ROUTE_AIRPORT_CODE_MAX_LENGTH 4
+
+struct RouteCacheEntry {
+    char callsign[ROUTE_CALLSIGN_MAX_LENGTH + 1];
+    char callsign_iata[ROUTE_CALLSIGN_MAX_LENGTH + 1];
+    char origin[ROUTE_AIRPORT_CODE_MAX_LENGTH + 1];
+    char destination[ROUTE_AIRPORT_CODE_MAX_LENGTH + 1];
+
+    // False for a cached "no flightroute" response
+    bool has_route;
+
+    // Wall clock time of the lookup, so entries expire across reboots
+    uint32_t fetched_time;
+
+    // Value of the use counter at the last hit, for LRU eviction; 0 if the slot is empty
+    uint32_t last_used;
+};
+
+struct RouteCacheStats {
+    uint32_t hits;
+    uint32_t negative_hits;
+    uint32_t misses;
+    uint32_t evictions;
+};
+
+/**
+ * LRU cache of callsign -> route lookups, persisted to NVS so that it survives reboots.
+ *
+ * Entries are written to flash when they're added (i.e. on a miss), not on every hit, to limit flash wear;
+ * the LRU order of hits since the last write is only kept in RAM.
+ */
+class RouteCache {
+    public:
+        // Returns the entry for the callsign (which may be a negative entry), or nullptr if there's no fresh entry
+        const RouteCacheEntry* lookup(const String& callsign);
+
+        void insert(const String& callsign, const String& callsign_iata, const String& origin, const String& destination);
+        void insertNegative(const String& callsign);
+
+        const RouteCacheStats& getStats() const {
+            return stats_;
+        }
+
+    private:
+        RouteCacheEntry entries_[ROUTE_CACHE_SIZE] = {};
+        uint32_t use_counter_ = 0;
+        bool loaded_ = false;
+        RouteCacheStats stats_ = {};
+
+        RouteCacheEntry& allocate(const String& callsign);
+        void load();
+        void save();
+};
@@ -0,0 +1,188 @@
+/*
+   Copyright 2022 Scott Bezek and the splitflap contributors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+#include "sbs_aircraft_table.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+// Fields of an SBS-1 "MSG" line that are used. Each message type only fills in some of them; the rest are empty.
+#define SBS_FIELD_MESSAGE_TYPE 0
+#define SBS_FIELD_HEX 4
+#define SBS_FIELD_CALLSIGN 10
+#define SBS_FIELD_ALTITUDE 11
+#define SBS_FIELD_LATITUDE 14
+#define SBS_FIELD_LONGITUDE 15
+#define SBS_FIELD_COUNT 16
+
+SbsAircraftTable::SbsAircraftTable(AircraftFilter is_nearby) : is_nearby_(is_nearby) {
+    reset();
+}
+
+void SbsAircraftTable::reset() {
+    count_ = 0;
+    nearby_changed_ = true;
+    stats_ = {};
+    line_length_ = 0;
+    line_overflow_ = false;
+}
+
+void SbsAircraftTable::consume(const char* data, size_t length, uint32_t now_millis) {
+    for (size_t i = 0; i < length; i++) {
+        char c = data[i];
+        if (c == '\n') {
+            if (line_overflow_) {
+                stats_.bad_lines++;
+            } else {
+                line_[line_length_] = '\0';
+                parseLine(now_millis);
+            }
+            line_length_ = 0;
+            line_overflow_ = false;
+        } else if (c == '\r') {
+            // Lines end with \r\n
+        } else if (line_length_ < SBS_MAX_LINE_LENGTH) {
+            line_[line_length_++] = c;
+        } else {
+            line_overflow_ = true;
+        }
+    }
+}
+
+void SbsAircraftTable::parseLine(uint32_t now_millis) {
+    if (line_length_ == 0) {
+        return;
+    }
+    stats_.lines++;
+
+    // Split into fields in place
+    const char* fields[SBS_FIELD_COUNT] = {};
+    uint8_t field_count = 0;
+    char* field = line_;
+    while (field != nullptr && field_count < SBS_FIELD_COUNT) {
+        char* comma = strchr(field, ',');
+        if (comma != nullptr) {
+            *comma = '\0';
+        }
+        fields[field_count++] = field;
+        field = comma == nullptr ? nullptr : comma + 1;
+    }
+
+    if (strcmp(fields[SBS_FIELD_MESSAGE_TYPE], "MSG") != 0) {
+        // Other record types (SEL, ID, AIR, STA, CLK) aren't needed
+        return;
+    }
+    if (field_count < SBS_FIELD_COUNT) {
+        stats_.bad_lines++;
+        return;
+    }
+
+    const char* hex = fields[SBS_FIELD_HEX];
+    if (hex[0] == '\0' || strlen(hex) >= sizeof(AircraftRecord::hex)) {
+        stats_.bad_lines++;
+        return;
+    }
+
+    Entry* entry = findOrAdd(hex, now_millis);
+    AircraftRecord& record = entry->record;
+    bool was_nearby = entry->nearby;
+    bool changed = false;
+
+    const char* callsign = fields[SBS_FIELD_CALLSIGN];
+    if (callsign[0] != '\0' && (!record.has_flight || strcmp(record.flight, callsign) != 0)) {
+        strncpy(record.flight, callsign, sizeof(record.flight) - 1);
+        record.flight[sizeof(record.flight) - 1] = '\0';
+        record.has_flight = true;
+        changed = true;
+    }
+    if (fields[SBS_FIELD_ALTITUDE][0] != '\0') {
+        float alt = strtof(fields[SBS_FIELD_ALTITUDE], nullptr);
+        changed |= alt != record.alt_geom;
+        record.alt_geom = alt;
+    }
+    if (fields[SBS_FIELD_LATITUDE][0] != '\0' && fields[SBS_FIELD_LONGITUDE][0] != '\0') {
+        record.lat = strtof(fields[SBS_FIELD_LATITUDE], nullptr);
+        record.lon = strtof(fields[SBS_FIELD_LONGITUDE], nullptr);
+        entry->has_position = true;
+        changed = true;
+    }
+
+    if (changed && entry->has_position) {
+        entry->nearby = is_nearby_(record);
+        if (entry->nearby || was_nearby) {
+            nearby_changed_ = true;
+        }
+    }
+}
+
+SbsAircraftTable::Entry* SbsAircraftTable::findOrAdd(const char* hex, uint32_t now_millis) {
+    for (uint32_t i = 0; i < count_; i++) {
+        if (strcmp(entries_[i].record.hex, hex) == 0) {
+            entries_[i].last_seen_millis = now_millis;
+            return &entries_[i];
+        }
+    }
+
+    if (count_ == SBS_MAX_AIRCRAFT) {
+        uint32_t least_recent = 0;
+        for (uint32_t i = 1; i < count_; i++) {
+            if (now_millis - entries_[i].last_seen_millis > now_millis - entries_[least_recent].last_seen_millis) {
+                least_recent = i;
+            }
+        }
+        remove(least_recent);
+        stats_.evictions++;
+    }
+
+    Entry& entry = entries_[count_++];
+    entry = {};
+    strcpy(entry.record.hex, hex);
+    entry.last_seen_millis = now_millis;
+    return &entry;
+}
+
+void SbsAircraftTable::expire(uint32_t now_millis) {
+    uint32_t i = 0;
+    while (i < count_) {
+        if (now_millis - entries_[i].last_seen_millis > SBS_AIRCRAFT_TIMEOUT_MILLIS) {
+            remove(i);
+        } else {
+            i++;
+        }
+    }
+}
+
+void SbsAircraftTable::remove(uint32_t index) {
+    if (entries_[index].nearby) {
+        nearby_changed_ = true;
+    }
+    // Order doesn't matter, so fill the gap with the last entry
+    entries_[index] = entries_[count_ - 1];
+    count_--;
+}
+
+bool SbsAircraftTable::takeNearbyChanged() {
+    bool changed = nearby_changed_;
+    nearby_changed_ = false;
+    return changed;
+}
+
+void SbsAircraftTable::forEach(AircraftHandler handler) const {
+    for (uint32_t i = 0; i < count_; i++) {
+        if (entries_[i].has_position) {
+            handler(entries_[i].record);
+        }
+    }
+}
@@ -0,0 +1,100 @@
+/*
+   Copyright 2022 Scott Bezek and the splitflap contributors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+#pragma once
+
+#include <functional>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "aircraft_json_scanner.h"
+
+// Most aircraft tracked at once; the least recently heard one is dropped to make room
+#define SBS_MAX_AIRCRAFT 64
+
+// Aircraft that haven't been heard from in this long are dropped
+#define SBS_AIRCRAFT_TIMEOUT_MILLIS (60 * 1000)
+
+// SBS-1 lines are normally around 100 characters; longer ones are ignored
+#define SBS_MAX_LINE_LENGTH 160
+
+typedef std::function<bool(const AircraftRecord& aircraft)> AircraftFilter;
+
+struct SbsTableStats {
+    uint32_t lines;
+    uint32_t bad_lines;
+    uint32_t evictions;
+};
+
+/**
+ * Table of aircraft, kept up to date from the SBS-1 ("BaseStation") text output of dump1090/readsb (port 30003).
+ *
+ * Each line of the stream updates a single aircraft, so the table is updated incrementally rather than being rebuilt
+ * from a snapshot. Data can be fed in arbitrary chunks as it arrives. The table has a fixed size, so memory use
+ * doesn't depend on how much traffic there is.
+ *
+ * The is_nearby filter is applied whenever an aircraft's position changes, so that users only need to look at the
+ * table again (see takeNearbyChanged()) when something changed for an aircraft they might be interested in.
+ */
+class SbsAircraftTable {
+    public:
+        SbsAircraftTable(AircraftFilter is_nearby);
+
+        void reset();
+
+        // Feeds stream data received at now_millis
+        void consume(const char* data, size_t length, uint32_t now_millis);
+
+        // Drops aircraft that haven't been heard from in SBS_AIRCRAFT_TIMEOUT_MILLIS
+        void expire(uint32_t now_millis);
+
+        // Returns true, and clears the flag, if a nearby aircraft has moved, appeared, gone or changed callsign since
+        // the last call
+        bool takeNearbyChanged();
+
+        // Calls handler for each aircraft with a known position
+        void forEach(AircraftHandler handler) const;
+
+        uint32_t size() const {
+            return count_;
+        }
+
+        const SbsTableStats& getStats() const {
+            return stats_;
+        }
+
+    private:
+        struct Entry {
+            AircraftRecord record;
+            bool has_position;
+            bool nearby;
+            uint32_t last_seen_millis;
+        };
+
+        AircraftFilter is_nearby_;
+
+        Entry entries_[SBS_MAX_AIRCRAFT];
+        uint32_t count_;
+        bool nearby_changed_;
+        SbsTableStats stats_;
+
+        char line_[SBS_MAX_LINE_LENGTH + 1];
+        uint16_t line_length_;
+        bool line_overflow_;
+
+        void parseLine(uint32_t now_millis);
+        Entry* findOrAdd(const char* hex, uint32_t now_millis);
+        void remove(uint32_t index);
+};
@@ -0,0 +1,114 @@
+/*
+   Copyright 2022 Scott Bezek and the splitflap contributors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+#include "sbs_feed.h"
+
+#include "../core/semaphore_guard.h"
+
+#define SBS_CONNECT_TIMEOUT_MILLIS (5 * 1000)
+#define SBS_RECONNECT_DELAY_MILLIS (5 * 1000)
+
+// dump1090 sends nothing while there's no traffic, so only give up on the connection after a long silence
+#define SBS_IDLE_TIMEOUT_MILLIS (5 * 60 * 1000)
+
+#define SBS_EXPIRE_INTERVAL_MILLIS 1000
+
+SbsFeed::SbsFeed(const char* host, uint16_t port, AircraftFilter is_nearby, Logger& logger, const uint8_t task_core) :
+        Task("SBS", 4096, 1, task_core),
+        host_(host),
+        port_(port),
+        logger_(logger),
+        semaphore_(xSemaphoreCreateMutex()),
+        table_(is_nearby) {
+    assert(semaphore_ != NULL);
+    xSemaphoreGive(semaphore_);
+}
+
+SbsFeed::~SbsFeed() {
+    vSemaphoreDelete(semaphore_);
+}
+
+void SbsFeed::run() {
+    WiFiClient client;
+    char buf[200];
+    while (1) {
+        if (WiFi.status() != WL_CONNECTED || !client.connect(host_, port_, SBS_CONNECT_TIMEOUT_MILLIS)) {
+            delay(SBS_RECONNECT_DELAY_MILLIS);
+            continue;
+        }
+
+        snprintf(buf, sizeof(buf), "Connected to SBS feed at %s:%u", host_, port_);
+        logger_.log(buf);
+        connected_ = true;
+        receive(client);
+        connected_ = false;
+        client.stop();
+
+        {
+            SemaphoreGuard lock(semaphore_);
+            const SbsTableStats& stats = table_.getStats();
+            snprintf(buf, sizeof(buf), "SBS feed disconnected after %u lines (%u bad), %u evictions", stats.lines,
+                stats.bad_lines, stats.evictions);
+            // Start afresh when reconnected, rather than showing aircraft that may have gone
+            table_.reset();
+        }
+        logger_.log(buf);
+        delay(SBS_RECONNECT_DELAY_MILLIS);
+    }
+}
+
+void SbsFeed::receive(WiFiClient& client) {
+    uint8_t data[256];
+    uint32_t last_data_millis = millis();
+    uint32_t last_expire_millis = millis();
+    while (client.connected()) {
+        uint32_t now = millis();
+        int available = client.available();
+        if (available > 0) {
+            int length = client.read(data, min(available, (int)sizeof(data)));
+            if (length > 0) {
+                SemaphoreGuard lock(semaphore_);
+                table_.consume((const char*)data, length, now);
+                last_data_millis = now;
+            }
+        } else if (now - last_data_millis > SBS_IDLE_TIMEOUT_MILLIS) {
+            logger_.log("SBS feed idle; reconnecting");
+            return;
+        } else {
+            delay(10);
+        }
+
+        if (now - last_expire_millis > SBS_EXPIRE_INTERVAL_MILLIS) {
+            SemaphoreGuard lock(semaphore_);
+            table_.expire(now);
+            last_expire_millis = now;
+        }
+    }
+}
+
+bool SbsFeed::takeNearbyChanged() {
+    SemaphoreGuard lock(semaphore_);
+    return table_.takeNearbyChanged();
+}
+
+void SbsFeed::forEach(AircraftHandler handler) {
+    SemaphoreGuard lock(semaphore_);
+    table_.forEach(handler);
+}
+
+uint32_t SbsFeed::size() {
+    SemaphoreGuard lock(semaphore_);
+    return table_.size();
+}
@@ -0,0 +1,64 @@
+/*
+   Copyright 2022 Scott Bezek and the splitflap contributors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+#pragma once
+
+#include <Arduino.h>
+#include <WiFi.h>
+
+#include "../core/logger.h"
+#include "../core/task.h"
+#include "sbs_aircraft_table.h"
+
+/**
+ * Follows an SBS-1 stream (e.g. dump1090's port 30003) in the background, keeping an SbsAircraftTable up to date.
+ * Reconnects whenever the connection is lost.
+ */
+class SbsFeed : public Task<SbsFeed> {
+    friend class Task<SbsFeed>; // Allow base Task to invoke protected run()
+
+    public:
+        SbsFeed(const char* host, uint16_t port, AircraftFilter is_nearby, Logger& logger, const uint8_t task_core);
+        ~SbsFeed();
+
+        bool connected() const {
+            return connected_;
+        }
+
+        // See SbsAircraftTable::takeNearbyChanged()
+        bool takeNearbyChanged();
+
+        // Calls handler for each aircraft with a known position; the table is locked meanwhile, so don't block
+        void forEach(AircraftHandler handler);
+
+        // Number of aircraft in the table
+        uint32_t size();
+
+    protected:
+        void run();
+
+    private:
+        const char* host_;
+        const uint16_t port_;
+        Logger& logger_;
+        SemaphoreHandle_t semaphore_;
+
+        // Protected by semaphore_
+        SbsAircraftTable table_;
+
+        volatile bool connected_ = false;
+
+        void receive(WiFiClient& client);
+};
@@ -0,0 +1,207 @@
+/*
+   Copyright 2022 Scott Bezek and the splitflap contributors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+#include "schedule_store.h"
+
+#include "../core/semaphore_guard.h"
+
+#include "crc32.h"
+
+ScheduleStore::ScheduleStore() : semaphore_(xSemaphoreCreateMutex()) {
+    assert(semaphore_ != NULL);
+    xSemaphoreGive(semaphore_);
+}
+
+void ScheduleStore::setLogger(Logger* logger) {
+    logger_ = logger;
+}
+
+void ScheduleStore::log(const char* msg) {
+    if (logger_ != nullptr) {
+        logger_->log(msg);
+    }
+}
+
+void ScheduleStore::begin() {
+    partition_ = esp_partition_find_first(ESP_PARTITION_TYPE_DATA, SCHEDULE_PARTITION_SUBTYPE, SCHEDULE_PARTITION_LABEL);
+    if (partition_ == nullptr) {
+        log("No schedule partition; using the built-in schedule");
+        return;
+    }
+
+    // The whole partition stays mapped. Flash writes through esp_partition_* flush the cache for mapped regions, so
+    // uploaded data can be read back through the mapping.
+    const void* base;
+    esp_err_t err = esp_partition_mmap(partition_, 0, partition_->size, SPI_FLASH_MMAP_DATA, &base, &mmap_handle_);
+    if (err != ESP_OK) {
+        char buf[200];
+        snprintf(buf, sizeof(buf), "Failed to map schedule partition: %d", err);
+        log(buf);
+        partition_ = nullptr;
+        return;
+    }
+    base_ = (const uint8_t*)base;
+
+    SemaphoreGuard lock(semaphore_);
+    if (!load()) {
+        log("No valid schedule in flash; using the built-in schedule");
+    }
+}
+
+bool ScheduleStore::load() {
+    const ScheduleHeader* header = (const ScheduleHeader*)base_;
+    if (header->magic != SCHEDULE_MAGIC
+            || header->version != SCHEDULE_FORMAT_VERSION
+            || header->record_size != sizeof(SpecialMessage)
+            || header->record_count > (partition_->size - sizeof(ScheduleHeader)) / sizeof(SpecialMessage)) {
+        return false;
+    }
+
+    const SpecialMessage* records = (const SpecialMessage*)(base_ + sizeof(ScheduleHeader));
+    uint32_t count = header->record_count;
+    uint32_t crc = 0;
+    crc32(records, count * sizeof(SpecialMessage), &crc);
+    if (crc != header->records_crc32) {
+        log("Schedule in flash is corrupt");
+        return false;
+    }
+
+    // Lookups rely on the same invariants that are checked at compile time for the built-in schedule
+    for (uint32_t i = 0; i < count; i++) {
+        if (records[i].message[SPECIAL_MESSAGE_MAX_LENGTH] != '\0'
+                || (i + 1 < count && (uint64_t)records[i].start_time + records[i].duration_seconds > records[i + 1].start_time)) {
+            char buf[200];
+            snprintf(buf, sizeof(buf), "Schedule in flash is invalid at record %u", i);
+            log(buf);
+            return false;
+        }
+    }
+
+    records_ = records;
+    record_count_ = count;
+    generation_++;
+
+    char buf[200];
+    snprintf(buf, sizeof(buf), "Loaded schedule with %u entries", count);
+    log(buf);
+    return true;
+}
+
+void ScheduleStore::unload() {
+    records_ = nullptr;
+    record_count_ = 0;
+    generation_++;
+}
+
+ScheduleUploadStatus ScheduleStore::beginUpload(uint32_t size) {
+    if (partition_ == nullptr) {
+        return ScheduleUploadStatus::NO_PARTITION;
+    }
+    if (size > partition_->size) {
+        return ScheduleUploadStatus::TOO_LARGE;
+    }
+    if (size < sizeof(ScheduleHeader)) {
+        return ScheduleUploadStatus::INVALID_SCHEDULE;
+    }
+
+    {
+        SemaphoreGuard lock(semaphore_);
+        unload();
+    }
+
+    uploading_ = true;
+    upload_size_ = size;
+    upload_offset_ = 0;
+    erased_end_ = 0;
+
+    // Erase the old header right away, so an abandoned upload never leaves a partially overwritten schedule that
+    // looks valid
+    ScheduleUploadStatus status = eraseThrough(1);
+    if (status != ScheduleUploadStatus::OK) {
+        uploading_ = false;
+    }
+    return status;
+}
+
+ScheduleUploadStatus ScheduleStore::writeUploadChunk(uint32_t offset, const uint8_t* data, size_t length) {
+    if (!uploading_) {
+        return ScheduleUploadStatus::NOT_STARTED;
+    }
+    if (offset != upload_offset_) {
+        return ScheduleUploadStatus::BAD_OFFSET;
+    }
+    if (length > upload_size_ - offset) {
+        return ScheduleUploadStatus::TOO_LARGE;
+    }
+
+    // Readers don't touch the partition while an upload is in progress (records_ is null), so no lock is needed
+    ScheduleUploadStatus status = eraseThrough(offset + length);
+    if (status == ScheduleUploadStatus::OK && esp_partition_write(partition_, offset, data, length) != ESP_OK) {
+        status = ScheduleUploadStatus::FLASH_ERROR;
+    }
+    if (status != ScheduleUploadStatus::OK) {
+        uploading_ = false;
+        return status;
+    }
+    upload_offset_ += length;
+    return ScheduleUploadStatus::OK;
+}
+
+ScheduleUploadStatus ScheduleStore::commitUpload(uint32_t crc) {
+    if (!uploading_) {
+        return ScheduleUploadStatus::NOT_STARTED;
+    }
+    if (upload_offset_ != upload_size_) {
+        return ScheduleUploadStatus::INCOMPLETE;
+    }
+    uploading_ = false;
+
+    // Checksum what actually ended up in flash, so bad writes are caught too
+    uint32_t actual_crc = 0;
+    crc32(base_, upload_size_, &actual_crc);
+    if (actual_crc != crc) {
+        char buf[200];
+        snprintf(buf, sizeof(buf), "Schedule upload CRC mismatch. Expected %08x but got %08x.", crc, actual_crc);
+        log(buf);
+        esp_partition_erase_range(partition_, 0, SPI_FLASH_SEC_SIZE);
+        return ScheduleUploadStatus::CRC_MISMATCH;
+    }
+
+    SemaphoreGuard lock(semaphore_);
+    if (!load()) {
+        esp_partition_erase_range(partition_, 0, SPI_FLASH_SEC_SIZE);
+        return ScheduleUploadStatus::INVALID_SCHEDULE;
+    }
+    return ScheduleUploadStatus::OK;
+}
+
+ScheduleUploadStatus ScheduleStore::eraseThrough(uint32_t end) {
+    // Sectors are erased as the upload reaches them, so no single call blocks for long
+    while (erased_end_ < end) {
+        if (esp_partition_erase_range(partition_, erased_end_, SPI_FLASH_SEC_SIZE) != ESP_OK) {
+            return ScheduleUploadStatus::FLASH_ERROR;
+        }
+        erased_end_ += SPI_FLASH_SEC_SIZE;
+    }
+    return ScheduleUploadStatus::OK;
+}
+
+ScheduleStore::Lock::Lock(ScheduleStore& store) : store_(store) {
+    xSemaphoreTake(store_.semaphore_, portMAX_DELAY);
+}
+
+ScheduleStore::Lock::~Lock() {
+    xSemaphoreGive(store_.semaphore_);
+}
@@ -0,0 +1,146 @@
+/*
+   Copyright 2022 Scott Bezek and the splitflap contributors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+#pragma once
+
+#include <Arduino.h>
+#include <esp_partition.h>
+
+#include "../core/logger.h"
+
+#define SPECIAL_MESSAGE_MAX_LENGTH 11
+
+// Fixed-size so that the schedule can be a constexpr table, which the compiler keeps in flash rather than copying
+// into RAM at startup. This is also the record format of schedule images (see ScheduleHeader), which are read
+// in place from flash.
+struct SpecialMessage {
+    uint32_t start_time;
+    uint32_t duration_seconds;
+    char message[SPECIAL_MESSAGE_MAX_LENGTH + 1];
+};
+static_assert(sizeof(SpecialMessage) == 20, "SpecialMessage layout must match the schedule image format");
+
+// Data partition (see partitions.csv) holding an uploaded schedule image
+#define SCHEDULE_PARTITION_LABEL "schedule"
+#define SCHEDULE_PARTITION_SUBTYPE ((esp_partition_subtype_t)0x40)
+
+// "SFSC", little-endian
+#define SCHEDULE_MAGIC 0x43534653
+#define SCHEDULE_FORMAT_VERSION 1
+
+/**
+ * Start of a schedule image, which is followed by record_count SpecialMessage records sorted by start_time.
+ * All values are little-endian. Images are built by software/chainlink/schedule.py.
+ */
+struct ScheduleHeader {
+    uint32_t magic;
+    uint16_t version;
+    // sizeof(SpecialMessage), so that the format can be extended
+    uint16_t record_size;
+    uint32_t record_count;
+    // CRC32 of the records
+    uint32_t records_crc32;
+};
+static_assert(sizeof(ScheduleHeader) == 16, "ScheduleHeader layout must match the schedule image format");
+
+// Keep in sync with PB_ScheduleUploadResponse_Status!
+enum class ScheduleUploadStatus {
+    OK,
+    NO_PARTITION,
+    TOO_LARGE,
+    NOT_STARTED,
+    BAD_OFFSET,
+    INCOMPLETE,
+    CRC_MISMATCH,
+    INVALID_SCHEDULE,
+    FLASH_ERROR,
+};
+
+/**
+ * Schedule of timed messages stored in the schedule flash partition.
+ *
+ * The partition is memory-mapped rather than read into RAM, so RAM use doesn't depend on the size of the
+ * schedule. Images are uploaded in chunks (see PB_ScheduleUpload) and written straight to flash; each flash sector
+ * is erased just before it's first written so that no single call blocks for long. The image is only used once
+ * its CRC and contents have been verified.
+ *
+ * Uploads and readers may be in different tasks; readers must hold a Lock while using the records.
+ */
+class ScheduleStore {
+    public:
+        ScheduleStore();
+
+        // Finds and maps the partition, and loads the schedule in it if there's a valid one
+        void begin();
+
+        void setLogger(Logger* logger);
+
+        class Lock {
+            public:
+                Lock(ScheduleStore& store);
+                ~Lock();
+                Lock(Lock const&)=delete;
+                Lock& operator=(Lock const&)=delete;
+
+                // Records of the current schedule, or nullptr if there isn't a valid one
+                const SpecialMessage* records() const {
+                    return store_.records_;
+                }
+
+                uint32_t recordCount() const {
+                    return store_.record_count_;
+                }
+
+                // Changes whenever the schedule is replaced (or invalidated by an upload starting)
+                uint32_t generation() const {
+                    return store_.generation_;
+                }
+
+            private:
+                ScheduleStore& store_;
+        };
+
+        ScheduleUploadStatus beginUpload(uint32_t size);
+        ScheduleUploadStatus writeUploadChunk(uint32_t offset, const uint8_t* data, size_t length);
+        ScheduleUploadStatus commitUpload(uint32_t crc);
+
+        // Bytes of the current upload received so far
+        uint32_t uploadOffset() const {
+            return upload_offset_;
+        }
+
+    private:
+        SemaphoreHandle_t semaphore_;
+        Logger* logger_ = nullptr;
+
+        const esp_partition_t* partition_ = nullptr;
+        spi_flash_mmap_handle_t mmap_handle_ = 0;
+        const uint8_t* base_ = nullptr;
+
+        const SpecialMessage* records_ = nullptr;
+        uint32_t record_count_ = 0;
+        uint32_t generation_ = 0;
+
+        bool uploading_ = false;
+        uint32_t upload_size_ = 0;
+        uint32_t upload_offset_ = 0;
+        // Flash beyond this offset hasn't been erased yet for the current upload
+        uint32_t erased_end_ = 0;
+
+        bool load();
+        void unload();
+        ScheduleUploadStatus eraseThrough(uint32_t end);
+        void log(const char* msg);
+};
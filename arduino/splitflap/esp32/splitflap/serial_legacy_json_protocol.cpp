@@ -14,13 +14,9 @@
    limitations under the License.
 */
 
-#include "json11.hpp"
-
 #include "serial_legacy_json_protocol.h"
 #include "../proto_gen/splitflap.pb.h"
 
-using namespace json11;
-
 void SerialLegacyJsonProtocol::handleState(const SplitflapState& old_state, const SplitflapState& new_state) {
     bool all_stopped = true;
     for (uint8_t i = 0; i < NUM_MODULES; i++) {
@@ -35,11 +31,9 @@ void SerialLegacyJsonProtocol::handleState(const SplitflapState& old_state, cons
 }
 
 void SerialLegacyJsonProtocol::log(const char* msg) {
-    Json body = Json::object {
-            {"type", "log"},
-            {"msg", std::string(msg)},
-    };
-    stream_.println(body.dump().c_str());
+    JsonWriter writer(line_buffer_, sizeof(line_buffer_));
+    writer.raw("{\"msg\": ").string(msg, LEGACY_LOG_MAX_MSG_LENGTH).raw(", \"type\": \"log\"}\r\n");
+    stream_.write((const uint8_t*)writer.buffer(), writer.length());
 }
 
 void SerialLegacyJsonProtocol::loop() {
@@ -53,62 +47,71 @@ void SerialLegacyJsonProtocol::loop() {
         }
     }
 
-    while (stream_.available() > 0) {
-        int b = stream_.read();
-        if (b == 0) {
-            if (protocol_change_callback_) {
-                protocol_change_callback_(SERIAL_PROTOCOL_PROTO);
+    uint8_t buffer[64];
+    size_t count;
+    while ((count = stream_.readInto(buffer, sizeof(buffer))) > 0) {
+        for (size_t i = 0; i < count; i++) {
+            if (buffer[i] == 0) {
+                // Switch to the proto protocol. The rest of this chunk (if any) is dropped, which is fine since the
+                // proto transport retransmits anything that goes unacknowledged.
+                if (protocol_change_callback_) {
+                    protocol_change_callback_(SERIAL_PROTOCOL_PROTO);
+                }
+                return;
             }
-            break;
+            handleByte(buffer[i]);
         }
-        if (b == '%') {
-            bool new_sensor_test_state = latest_state_.mode != SplitflapMode::MODE_SENSOR_TEST;
-            splitflap_task_.setSensorTest(new_sensor_test_state);
-            stream_.print("{\"type\":\"sensor_test\", \"enabled\":");
-            stream_.print(new_sensor_test_state ? "true" : "false");
-            stream_.print("}\n");
-        } else if (latest_state_.mode == SplitflapMode::MODE_RUN) {
-            switch (b) {
-                case '@':
-                    splitflap_task_.resetAll();
-                    break;
-                case '#':
-                    stream_.print("{\"type\":\"no_op\"}\n");
-                    stream_.flush();
-                    break;
-                case '=':
-                    recv_count_ = 0;
-                    break;
-                case '\n':
-                    pending_move_response_ = true;
-                    stream_.printf("{\"type\":\"move_echo\", \"dest\":\"");
-                    stream_.flush();
-                    for (uint8_t i = 0; i < recv_count_; i++) {
-                        stream_.write(recv_buffer_[i]);
-                    }
-                    stream_.printf("\"}\n");
-                    stream_.flush();
-                    splitflap_task_.showString(recv_buffer_, recv_count_);
-                    break;
-                case '+':
-                    if (recv_count_ == 1) {
-                        for (uint8_t i = 1; i < NUM_MODULES; i++) {
-                            recv_buffer_[i] = recv_buffer_[0];
-                        }
-                        splitflap_task_.showString(recv_buffer_, NUM_MODULES);
-                    }
-                    break;
-                case '\r':
-                    // Ignore
-                    break;
-                default:
-                    if (recv_count_ > NUM_MODULES - 1) {
-                        break;
+    }
+}
+
+void SerialLegacyJsonProtocol::handleByte(uint8_t b) {
+    if (b == '%') {
+        bool new_sensor_test_state = latest_state_.mode != SplitflapMode::MODE_SENSOR_TEST;
+        splitflap_task_.setSensorTest(new_sensor_test_state);
+        stream_.print("{\"type\":\"sensor_test\", \"enabled\":");
+        stream_.print(new_sensor_test_state ? "true" : "false");
+        stream_.print("}\n");
+    } else if (latest_state_.mode == SplitflapMode::MODE_RUN) {
+        switch (b) {
+            case '@':
+                splitflap_task_.resetAll();
+                break;
+            case '#':
+                stream_.print("{\"type\":\"no_op\"}\n");
+                stream_.flush();
+                break;
+            case '=':
+                recv_count_ = 0;
+                break;
+            case '\n':
+                pending_move_response_ = true;
+                stream_.printf("{\"type\":\"move_echo\", \"dest\":\"");
+                stream_.flush();
+                for (uint8_t i = 0; i < recv_count_; i++) {
+                    stream_.write(recv_buffer_[i]);
+                }
+                stream_.printf("\"}\n");
+                stream_.flush();
+                splitflap_task_.showString(recv_buffer_, recv_count_);
+                break;
+            case '+':
+                if (recv_count_ == 1) {
+                    for (uint8_t i = 1; i < NUM_MODULES; i++) {
+                        recv_buffer_[i] = recv_buffer_[0];
                     }
-                    recv_buffer_[recv_count_] = b;
-                    recv_count_++;
+                    splitflap_task_.showString(recv_buffer_, NUM_MODULES);
+                }
+                break;
+            case '\r':
+                // Ignore
+                break;
+            default:
+                if (recv_count_ > NUM_MODULES - 1) {
                     break;
-            }
+                }
+                recv_buffer_[recv_count_] = b;
+                recv_count_++;
+                break;
         }
     }
 }
@@ -127,37 +130,41 @@ void SerialLegacyJsonProtocol::init() {
 }
 
 void SerialLegacyJsonProtocol::dumpStatus(const SplitflapState& state) {
-    stream_.print("{\"type\":\"status\", \"modules\":[");
+    JsonWriter writer(line_buffer_, sizeof(line_buffer_));
+    writer.raw("{\"type\":\"status\", \"modules\":[");
     for (uint8_t i = 0; i < NUM_MODULES; i++) {
-        stream_.print("{\"state\":\"");
+        writer.raw("{\"state\":");
         switch (state.modules[i].state) {
             case NORMAL:
-                stream_.print("normal");
+                writer.string("normal");
                 break;
             case LOOK_FOR_HOME:
-                stream_.print("look_for_home");
+                writer.string("look_for_home");
                 break;
             case SENSOR_ERROR:
-                stream_.print("sensor_error");
+                writer.string("sensor_error");
                 break;
             case PANIC:
-                stream_.print("panic");
+                writer.string("panic");
                 break;
             case STATE_DISABLED:
-                stream_.print("disabled");
+                writer.string("disabled");
+                break;
+            default:
+                writer.string("");
                 break;
         }
-        stream_.print("\", \"flap\":\"");
-        stream_.write(flaps[state.modules[i].flap_index]);
-        stream_.print("\", \"count_missed_home\":");
-        stream_.print(state.modules[i].count_missed_home);
-        stream_.print(", \"count_unexpected_home\":");
-        stream_.print(state.modules[i].count_unexpected_home);
-        stream_.print("}");
+        writer.raw(", \"flap\":").string(flaps[state.modules[i].flap_index])
+            .raw(", \"count_missed_home\":").number(state.modules[i].count_missed_home)
+            .raw(", \"count_unexpected_home\":").number(state.modules[i].count_unexpected_home)
+            .raw('}');
         if (i < NUM_MODULES - 1) {
-            stream_.print(", ");
+            writer.raw(", ");
         }
     }
-    stream_.print("]}\n");
+    writer.raw("]}\n");
+    assert(!writer.overflowed());
+
+    stream_.write((const uint8_t*)writer.buffer(), writer.length());
     stream_.flush();
 }
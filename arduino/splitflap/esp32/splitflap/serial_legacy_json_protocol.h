@@ -15,12 +15,22 @@
 */
 #pragma once
 
+#include "json_writer.h"
 #include "serial_protocol.h"
+#include "../core/chunked_stream.h"
 #include "../proto_gen/splitflap.pb.h"
 
+// Longest log message that is output; anything beyond that is truncated
+#define LEGACY_LOG_MAX_MSG_LENGTH 255
+
+// Upper bounds on the length of a formatted log/status line. A module's status entry (with the longest state
+// name, an escaped flap character, max counts and the separator) is at most 96 characters.
+#define LEGACY_LOG_MAX_LINE_LENGTH (JSON_MAX_STRING_LENGTH(LEGACY_LOG_MAX_MSG_LENGTH) + 32)
+#define LEGACY_STATUS_MAX_LINE_LENGTH (NUM_MODULES * 96 + 32)
+
 class SerialLegacyJsonProtocol : public SerialProtocol {
     public:
-        SerialLegacyJsonProtocol(SplitflapTask& splitflap_task, Stream& stream) : SerialProtocol(splitflap_task), stream_(stream) {}
+        SerialLegacyJsonProtocol(SplitflapTask& splitflap_task, ChunkedStream& stream) : SerialProtocol(splitflap_task), stream_(stream) {}
         ~SerialLegacyJsonProtocol(){}
         void log(const char* msg) override;
         void loop() override;
@@ -30,12 +40,16 @@ class SerialLegacyJsonProtocol : public SerialProtocol {
         void init();
     
     private:
-        Stream& stream_;
+        ChunkedStream& stream_;
         SplitflapState latest_state_ = {};
         uint8_t recv_count_ = 0;
         char recv_buffer_[NUM_MODULES] = {};
         bool pending_move_response_ = false;
         uint32_t last_sensor_print_millis_ = 0;
 
+        // Complete lines of output are formatted here and then written to the stream in a single call
+        char line_buffer_[LEGACY_STATUS_MAX_LINE_LENGTH > LEGACY_LOG_MAX_LINE_LENGTH ? LEGACY_STATUS_MAX_LINE_LENGTH : LEGACY_LOG_MAX_LINE_LENGTH];
+
+        void handleByte(uint8_t b);
         void dumpStatus(const SplitflapState& state);
 };
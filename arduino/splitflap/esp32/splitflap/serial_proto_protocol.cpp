@@ -21,24 +21,58 @@
 #include "pb_decode.h"
 #include "serial_proto_protocol.h"
 
-static SerialProtoProtocol* singleton_for_packet_serial = 0;
+static const uint16_t DEFAULT_MIN_STATE_INTERVAL_MILLIS = 250;
+static const uint16_t DEFAULT_HEARTBEAT_INTERVAL_MILLIS = 5000;
 
-static const uint16_t MIN_STATE_INTERVAL_MILLIS = 250;
-static const uint16_t PERIODIC_STATE_INTERVAL_MILLIS = 5000;
+// PB_Subscribe field_mask bits for each SplitflapState.ModuleState field
+#define FIELD_BIT(tag) (1 << ((tag) - 1))
+static const uint32_t FIELD_STATE = FIELD_BIT(PB_SplitflapState_ModuleState_state_tag);
+static const uint32_t FIELD_FLAP_INDEX = FIELD_BIT(PB_SplitflapState_ModuleState_flap_index_tag);
+static const uint32_t FIELD_MOVING = FIELD_BIT(PB_SplitflapState_ModuleState_moving_tag);
+static const uint32_t FIELD_HOME_STATE = FIELD_BIT(PB_SplitflapState_ModuleState_home_state_tag);
+static const uint32_t FIELD_COUNT_UNEXPECTED_HOME = FIELD_BIT(PB_SplitflapState_ModuleState_count_unexpected_home_tag);
+static const uint32_t FIELD_COUNT_MISSED_HOME = FIELD_BIT(PB_SplitflapState_ModuleState_count_missed_home_tag);
+static const uint32_t ALL_FIELDS = FIELD_STATE | FIELD_FLAP_INDEX | FIELD_MOVING | FIELD_HOME_STATE
+                                    | FIELD_COUNT_UNEXPECTED_HOME | FIELD_COUNT_MISSED_HOME;
 
-SerialProtoProtocol::SerialProtoProtocol(SplitflapTask& splitflap_task, Stream& stream) :
-        SerialProtocol(splitflap_task),
-        stream_(stream) {
-    packet_serial_.setStream(&stream);
+static const uint32_t MIN_BAUD_RATE = 9600;
+static const uint32_t MAX_BAUD_RATE = 5000000;
+static const uint16_t BAUD_RATE_CONFIRM_TIMEOUT_MILLIS = 2000;
+
+// Number of corrupt packets in a row at a negotiated baud rate after which we assume a new client is trying to
+// connect at the default rate (e.g. after the previous client exited without restoring it)
+static const uint8_t MAX_CONSECUTIVE_BAD_PACKETS = 5;
+
+// Source for decoding a received packet, which accumulates the CRC32 of the bytes as they're consumed
+// by the decoder so the payload only needs to be traversed once.
+struct CrcBufferSource {
+    const uint8_t* buffer;
+    uint32_t crc;
+};
+
+static bool pbIstreamCallback(pb_istream_t* stream, uint8_t* buf, size_t count) {
+    CrcBufferSource* source = (CrcBufferSource*)stream->state;
+    memcpy(buf, source->buffer, count);
+    crc32(source->buffer, count, &source->crc);
+    source->buffer += count;
+    return true;
+}
 
-    // Note: not threadsafe or instance safe!! but PacketSerial requires a legacy function pointer, so we can't
-    // use a member, std::function, or lambda with captures
-    assert(singleton_for_packet_serial == 0);
-    singleton_for_packet_serial = this;
+SerialProtoProtocol::SerialProtoProtocol(SplitflapTask& splitflap_task, ChunkedStream& stream) :
+        SerialProtocol(splitflap_task),
+        stream_(stream),
+        cobs_encoder_(stream),
+        cobs_decoder_([this](const uint8_t* buffer, size_t size) {
+            handlePacket(buffer, size);
+        }) {
+    init();
+}
 
-    packet_serial_.setPacketHandler([](const uint8_t* buffer, size_t size) {
-        singleton_for_packet_serial->handlePacket(buffer, size);
-    });
+void SerialProtoProtocol::init() {
+    // Nothing from before the switch to this protocol applies to whoever is on the other end now
+    resetTransport(0, 0);
+    PB_Subscribe default_subscription = {};
+    subscribe(default_subscription);
 }
 
 void SerialProtoProtocol::handleState(const SplitflapState& old_state, const SplitflapState& new_state) {
@@ -48,7 +82,17 @@ void SerialProtoProtocol::handleState(const SplitflapState& old_state, const Spl
 void SerialProtoProtocol::ack(uint32_t nonce) {
     pb_tx_buffer_ = {};
     pb_tx_buffer_.which_payload = PB_FromSplitflap_ack_tag;
-    pb_tx_buffer_.payload.ack.nonce = nonce;
+    PB_Ack& ack = pb_tx_buffer_.payload.ack;
+    ack.nonce = nonce;
+    if (window_size_ > 0) {
+        ack.window_size = window_size_;
+        ack.cumulative_nonce = cumulative_nonce_;
+        for (uint8_t i = 0; i < window_size_; i++) {
+            if (window_[(cumulative_nonce_ + 1 + i) % PROTO_MAX_WINDOW_SIZE].received) {
+                ack.selective_mask |= (1 << i);
+            }
+        }
+    }
     sendPbTxBuffer();
 }
 
@@ -69,30 +113,27 @@ void SerialProtoProtocol::sendSupervisorState(PB_SupervisorState& supervisor_sta
 }
 
 void SerialProtoProtocol::loop() {
+    size_t count;
     do {
-        packet_serial_.update();
-    } while (stream_.available());
+        count = stream_.readInto(cobs_decoder_.rxBuffer(), cobs_decoder_.rxBufferSize());
+        cobs_decoder_.consume(count);
+    } while (count > 0);
+
+    updateBaudRate();
 
     // Rate limit state change transmissions
-    bool state_changed = latest_state_ != last_sent_state_ && millis() - last_sent_state_millis_ >= MIN_STATE_INTERVAL_MILLIS;
+    bool state_changed = millis() - last_sent_state_millis_ >= min_state_interval_millis_ && subscribedStateChanged();
 
     // Send state periodically or when forced, regardless of rate limit for state changes
-    bool force_send_state = state_requested_ || millis() - last_sent_state_millis_ > PERIODIC_STATE_INTERVAL_MILLIS;
+    bool force_send_state = state_requested_ || millis() - last_sent_state_millis_ > heartbeat_interval_millis_;
     if (state_changed || force_send_state) {
         state_requested_ = false;
         pb_tx_buffer_ = {};
         pb_tx_buffer_.which_payload = PB_FromSplitflap_splitflap_state_tag;
-        pb_tx_buffer_.payload.splitflap_state.modules_count = NUM_MODULES;
-        for (uint8_t i = 0; i < NUM_MODULES; i++) {
-            pb_tx_buffer_.payload.splitflap_state.modules[i] = {
-                .state = (PB_SplitflapState_ModuleState_State) latest_state_.modules[i].state,
-                .flap_index = latest_state_.modules[i].flap_index,
-                .moving = latest_state_.modules[i].moving,
-                .home_state = latest_state_.modules[i].home_state,
-                .count_unexpected_home = latest_state_.modules[i].count_unexpected_home,
-                .count_missed_home = latest_state_.modules[i].count_missed_home,
-            };
-        }
+        PB_SplitflapState& state = pb_tx_buffer_.payload.splitflap_state;
+        state.module_start = subscribed_module_start_;
+        state.modules.funcs.encode = &pbEncodeModuleStates;
+        state.modules.arg = this;
 
         sendPbTxBuffer();
 
@@ -105,112 +146,465 @@ void SerialProtoProtocol::handlePacket(const uint8_t* buffer, size_t size) {
     if (size <= 4) {
         // Too small, ignore bad packet
         log("Small packet");
+        handleBadPacket();
         return;
     }
 
-    // Compute and append little-endian CRC32
-    uint32_t expected_crc = 0;
-    crc32(buffer, size - 4, &expected_crc);
-
     uint32_t provided_crc = buffer[size - 4]
                          | (buffer[size - 3] << 8)
                          | (buffer[size - 2] << 16)
                          | (buffer[size - 1] << 24);
 
-    if (expected_crc != provided_crc) {
+    // Decode and checksum in a single pass; the decoded message isn't used until the CRC is verified
+    CrcBufferSource source = {
+        .buffer = buffer,
+        .crc = 0,
+    };
+    pb_istream_t stream = {&pbIstreamCallback, &source, size - 4};
+    pb_rx_buffer_.cb_payload.funcs.decode = &pbPayloadCallback;
+    pb_rx_buffer_.cb_payload.arg = this;
+    bool decoded = pb_decode(&stream, PB_ToSplitflap_fields, &pb_rx_buffer_);
+
+    if (!decoded) {
+        // Decoding stopped early, so finish checksumming to distinguish corruption from a bad message
+        source.crc = 0;
+        crc32(buffer, size - 4, &source.crc);
+    }
+
+    if (source.crc != provided_crc) {
         char buf[200];
-        snprintf(buf, sizeof(buf), "Bad CRC (%u byte packet). Expected %08x but got %08x.", size - 4, expected_crc, provided_crc);
+        snprintf(buf, sizeof(buf), "Bad CRC (%u byte packet). Expected %08x but got %08x.", size - 4, source.crc, provided_crc);
         log(buf);
+        handleBadPacket();
         return;
     }
 
-    pb_istream_t stream = pb_istream_from_buffer(buffer, size - 4);
-    if (!pb_decode(&stream, PB_ToSplitflap_fields, &pb_rx_buffer_)) {
+    if (!decoded) {
         char buf[200];
         snprintf(buf, sizeof(buf), "Decoding failed: %s", PB_GET_ERROR(&stream));
         log(buf);
         return;
     }
 
+    consecutive_bad_packets_ = 0;
+
+    uint32_t nonce = pb_rx_buffer_.nonce;
+
+    if (pb_rx_buffer_.which_payload == PB_ToSplitflap_window_config_tag) {
+        // (Re)start the transport, using this message's nonce as the base of the window. This is how every client
+        // session starts, so the previous client's subscription (whose module range and field mask the new client
+        // would otherwise misread) is dropped too.
+        resetTransport(nonce, pb_rx_buffer_.payload.window_config.window_size);
+        PB_Subscribe default_subscription = {};
+        subscribe(default_subscription);
+        ack(nonce);
+        return;
+    }
+
+    if (window_size_ > 0) {
+        // A compliant windowed client never sends a nonce outside of this range (including retries of
+        // already-delivered messages), so anything else must be a new stop-and-wait client.
+        int32_t offset = (int32_t)(nonce - cumulative_nonce_);
+        if (offset > -window_size_ && offset <= window_size_) {
+            handleWindowedPacket(nonce, offset);
+            return;
+        }
+        log("Nonce outside of window; reverting to stop-and-wait transport");
+        window_size_ = 0;
+    }
+
     // Always ACK immediately
-    ack(pb_rx_buffer_.nonce);
-    if (pb_rx_buffer_.nonce == last_nonce_) {
+    ack(nonce);
+    if (nonce == last_nonce_) {
         // Ignore any extraneous retries
         char buf[200];
-        snprintf(buf, sizeof(buf), "Already handled nonce %u", pb_rx_buffer_.nonce);
+        snprintf(buf, sizeof(buf), "Already handled nonce %u", nonce);
         log(buf);
         return;
     }
-    last_nonce_ = pb_rx_buffer_.nonce;
-    
-    switch (pb_rx_buffer_.which_payload) {
-        case PB_ToSplitflap_splitflap_command_tag: {
-            PB_SplitflapCommand command = pb_rx_buffer_.payload.splitflap_command;
-            Command c = {};
-            c.command_type = CommandType::MODULES;
-            for (uint8_t i = 0; i < min((int)command.modules_count, NUM_MODULES); i++) {
-                switch (command.modules[i].action) {
-                    case PB_SplitflapCommand_ModuleCommand_Action_NO_OP:
-                        c.data.module_command[i] = QCMD_NO_OP;
-                        break;
-                    case PB_SplitflapCommand_ModuleCommand_Action_RESET_AND_HOME:
-                        c.data.module_command[i] = QCMD_RESET_AND_HOME;
-                        break;
-                    case PB_SplitflapCommand_ModuleCommand_Action_GO_TO_FLAP:
-                        if (command.modules[i].param <= 255 - QCMD_FLAP) {
-                            c.data.module_command[i] = QCMD_FLAP + command.modules[i].param;
-                        }
-                        break;
-                    default:
-                        // Ignore unknown action
-                        break;
-                }
+    last_nonce_ = nonce;
+
+    if (pb_rx_buffer_.which_payload == PB_ToSplitflap_schedule_upload_tag) {
+        handleScheduleUpload(pb_rx_buffer_.payload.schedule_upload);
+        return;
+    }
+    PendingMessage message;
+    decodePayload(message);
+    dispatch(message);
+}
+
+void SerialProtoProtocol::resetTransport(uint32_t nonce, uint8_t window_size) {
+    // A window of 1 is no different from stop-and-wait, which doesn't need any of the window bookkeeping
+    window_size_ = window_size > 1 ? min(window_size, (uint8_t)PROTO_MAX_WINDOW_SIZE) : 0;
+    cumulative_nonce_ = nonce;
+    last_nonce_ = nonce;
+    for (uint8_t i = 0; i < PROTO_MAX_WINDOW_SIZE; i++) {
+        window_[i].received = false;
+    }
+}
+
+void SerialProtoProtocol::handleWindowedPacket(uint32_t nonce, int32_t offset) {
+    if (offset > 0) {
+        PendingMessage& slot = window_[nonce % PROTO_MAX_WINDOW_SIZE];
+        if (pb_rx_buffer_.which_payload == PB_ToSplitflap_schedule_upload_tag) {
+            if (offset > 1) {
+                // Too large to hold until the missing message before it is retried, so drop it without an ack and
+                // let the client retry it too. This only costs anything after a lost packet.
+                return;
             }
-            splitflap_task_.postRawCommand(c);
-            break;
+            cumulative_nonce_++;
+            handleScheduleUpload(pb_rx_buffer_.payload.schedule_upload);
+        } else if (!slot.received) {
+            decodePayload(slot);
+            slot.received = true;
         }
-        case PB_ToSplitflap_splitflap_config_tag: {
-            PB_SplitflapConfig config = pb_rx_buffer_.payload.splitflap_config;
-            Command c = {};
-            c.command_type = CommandType::CONFIG;
-            for (uint8_t i = 0; i < min((int)config.modules_count, NUM_MODULES); i++) {
-                ModuleConfig& module_config = c.data.module_configs.config[i];
-                module_config.target_flap_index = config.modules[i].target_flap_index;
-                module_config.movement_nonce = config.modules[i].movement_nonce;
-                module_config.reset_nonce = config.modules[i].reset_nonce;
-            }
-            splitflap_task_.postRawCommand(c);
-            break;
+
+        // Deliver everything that is now contiguous, in order
+        while (window_[(cumulative_nonce_ + 1) % PROTO_MAX_WINDOW_SIZE].received) {
+            cumulative_nonce_++;
+            PendingMessage& next = window_[cumulative_nonce_ % PROTO_MAX_WINDOW_SIZE];
+            next.received = false;
+            dispatch(next);
         }
+    }
+
+    // Duplicates (whose earlier ack was presumably lost) are acked again, but not re-delivered
+    ack(nonce);
+}
+
+void SerialProtoProtocol::decodePayload(PendingMessage& message) {
+    message.which_payload = pb_rx_buffer_.which_payload;
+    switch (pb_rx_buffer_.which_payload) {
+        case PB_ToSplitflap_splitflap_command_tag:
+        case PB_ToSplitflap_splitflap_config_tag:
+            // Already decoded by pbPayloadCallback and friends
+            message.command = rx_command_;
+            break;
+        case PB_ToSplitflap_baud_rate_change_tag:
+            message.baud_rate_change = pb_rx_buffer_.payload.baud_rate_change;
+            break;
+        case PB_ToSplitflap_subscribe_tag:
+            message.subscribe = pb_rx_buffer_.payload.subscribe;
+            break;
+        default:
+            // No additional data to hold on to
+            break;
+    }
+}
+
+void SerialProtoProtocol::dispatch(const PendingMessage& message) {
+    switch (message.which_payload) {
+        case PB_ToSplitflap_splitflap_command_tag:
+        case PB_ToSplitflap_splitflap_config_tag:
+            splitflap_task_.postRawCommand(message.command);
+            break;
         case PB_ToSplitflap_request_state_tag:
             state_requested_ = true;
             break;
+        case PB_ToSplitflap_baud_rate_change_tag:
+            handleBaudRateChange(message.baud_rate_change);
+            break;
+        case PB_ToSplitflap_subscribe_tag:
+            subscribe(message.subscribe);
+            break;
+        default: {
+            char buf[200];
+            snprintf(buf, sizeof(buf), "Unknown ToSplitflap type: %d", message.which_payload);
+            log(buf);
+            return;
+        }
+    }
+}
+
+void SerialProtoProtocol::subscribe(const PB_Subscribe& subscription) {
+    min_state_interval_millis_ = subscription.min_interval_millis > 0 ? subscription.min_interval_millis : DEFAULT_MIN_STATE_INTERVAL_MILLIS;
+    heartbeat_interval_millis_ = subscription.heartbeat_interval_millis > 0 ? subscription.heartbeat_interval_millis : DEFAULT_HEARTBEAT_INTERVAL_MILLIS;
+
+    subscribed_module_start_ = min((int)subscription.module_start, NUM_MODULES);
+    uint8_t remaining_modules = NUM_MODULES - subscribed_module_start_;
+    subscribed_module_count_ = subscription.module_count > 0 ? min(subscription.module_count, remaining_modules) : remaining_modules;
+
+    subscribed_field_mask_ = subscription.field_mask != 0 ? subscription.field_mask & ALL_FIELDS : ALL_FIELDS;
+
+    // Send a state message matching the new subscription right away
+    state_requested_ = true;
+}
+
+bool SerialProtoProtocol::subscribedStateChanged() {
+    if (latest_state_.mode != last_sent_state_.mode) {
+        return true;
+    }
+    const uint32_t mask = subscribed_field_mask_;
+    for (uint8_t i = subscribed_module_start_; i < subscribed_module_start_ + subscribed_module_count_; i++) {
+        const SplitflapModuleState& latest = latest_state_.modules[i];
+        const SplitflapModuleState& sent = last_sent_state_.modules[i];
+        if (((mask & FIELD_STATE) && latest.state != sent.state)
+                || ((mask & FIELD_FLAP_INDEX) && latest.flap_index != sent.flap_index)
+                || ((mask & FIELD_MOVING) && latest.moving != sent.moving)
+                || ((mask & FIELD_HOME_STATE) && latest.home_state != sent.home_state)
+                || ((mask & FIELD_COUNT_UNEXPECTED_HOME) && latest.count_unexpected_home != sent.count_unexpected_home)
+                || ((mask & FIELD_COUNT_MISSED_HOME) && latest.count_missed_home != sent.count_missed_home)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+void SerialProtoProtocol::handleBaudRateChange(const PB_BaudRateChange& baud_rate_change) {
+    char buf[200];
+    switch (baud_rate_change.phase) {
+        case PB_BaudRateChange_Phase_PROPOSE:
+            if (!baud_rate_change_callback_ || pending_baud_rate_ != 0 || previous_baud_rate_ != 0
+                    || baud_rate_change.baud_rate < MIN_BAUD_RATE || baud_rate_change.baud_rate > MAX_BAUD_RATE) {
+                snprintf(buf, sizeof(buf), "Rejecting baud rate %u", baud_rate_change.baud_rate);
+                log(buf);
+                sendBaudRateResponse(PB_BaudRateResponse_Status_REJECTED, baud_rate_change.baud_rate);
+                return;
+            }
+
+            // The switch itself is deferred to loop(), since the ack for this message may not have been sent yet
+            pending_baud_rate_ = baud_rate_change.baud_rate;
+            sendBaudRateResponse(PB_BaudRateResponse_Status_ACCEPTED, pending_baud_rate_);
+            break;
+        case PB_BaudRateChange_Phase_CONFIRM:
+            if (previous_baud_rate_ == 0 || baud_rate_change.baud_rate != baud_rate_) {
+                // Most likely a client retrying a confirmation that arrived after we had already reverted
+                snprintf(buf, sizeof(buf), "Ignoring unexpected confirmation of baud rate %u", baud_rate_change.baud_rate);
+                log(buf);
+                return;
+            }
+            previous_baud_rate_ = 0;
+            sendBaudRateResponse(PB_BaudRateResponse_Status_CONFIRMED, baud_rate_);
+            break;
+        default:
+            snprintf(buf, sizeof(buf), "Unknown baud rate change phase: %d", baud_rate_change.phase);
+            log(buf);
+            break;
+    }
+}
+
+void SerialProtoProtocol::updateBaudRate() {
+    if (pending_baud_rate_ != 0) {
+        previous_baud_rate_ = baud_rate_;
+        setBaudRate(pending_baud_rate_);
+        pending_baud_rate_ = 0;
+        baud_rate_changed_millis_ = millis();
+    } else if (previous_baud_rate_ != 0 && millis() - baud_rate_changed_millis_ > BAUD_RATE_CONFIRM_TIMEOUT_MILLIS) {
+        // The client never made it to the new rate (or the link can't handle it), so go back to what worked
+        setBaudRate(previous_baud_rate_);
+        previous_baud_rate_ = 0;
+        sendBaudRateResponse(PB_BaudRateResponse_Status_REVERTED, baud_rate_);
+    }
+}
+
+void SerialProtoProtocol::setBaudRate(uint32_t baud_rate) {
+    baud_rate_change_callback_(baud_rate);
+    baud_rate_ = baud_rate;
+    consecutive_bad_packets_ = 0;
+}
+
+void SerialProtoProtocol::sendBaudRateResponse(PB_BaudRateResponse_Status status, uint32_t baud_rate) {
+    pb_tx_buffer_ = {};
+    pb_tx_buffer_.which_payload = PB_FromSplitflap_baud_rate_response_tag;
+    pb_tx_buffer_.payload.baud_rate_response.status = status;
+    pb_tx_buffer_.payload.baud_rate_response.baud_rate = baud_rate;
+    sendPbTxBuffer();
+}
+
+void SerialProtoProtocol::handleBadPacket() {
+    if (baud_rate_ == MONITOR_SPEED || previous_baud_rate_ != 0) {
+        return;
+    }
+    consecutive_bad_packets_++;
+    if (consecutive_bad_packets_ >= MAX_CONSECUTIVE_BAD_PACKETS) {
+        setBaudRate(MONITOR_SPEED);
+        log("Too many corrupt packets; restored default baud rate");
+    }
+}
+
+void SerialProtoProtocol::handleScheduleUpload(const PB_ScheduleUpload& upload) {
+    if (schedule_store_ == nullptr) {
+        sendScheduleUploadResponse(upload.phase, ScheduleUploadStatus::NO_PARTITION, 0);
+        return;
+    }
+
+    ScheduleUploadStatus status;
+    uint32_t record_count = 0;
+    switch (upload.phase) {
+        case PB_ScheduleUpload_Phase_BEGIN:
+            status = schedule_store_->beginUpload(upload.size);
+            break;
+        case PB_ScheduleUpload_Phase_DATA:
+            status = schedule_store_->writeUploadChunk(upload.offset, upload.data.bytes, upload.data.size);
+            if (status == ScheduleUploadStatus::OK) {
+                // The ack is enough; only failures are reported for each chunk
+                return;
+            }
+            break;
+        case PB_ScheduleUpload_Phase_COMMIT:
+            status = schedule_store_->commitUpload(upload.crc32);
+            if (status == ScheduleUploadStatus::OK) {
+                ScheduleStore::Lock lock(*schedule_store_);
+                record_count = lock.recordCount();
+            }
+            break;
         default: {
             char buf[200];
-            snprintf(buf, sizeof(buf), "Unknown ToSplitflap type: %d", pb_rx_buffer_.which_payload);
+            snprintf(buf, sizeof(buf), "Unknown schedule upload phase: %d", upload.phase);
             log(buf);
             return;
         }
     }
+    sendScheduleUploadResponse(upload.phase, status, record_count);
+}
+
+void SerialProtoProtocol::sendScheduleUploadResponse(PB_ScheduleUpload_Phase phase, ScheduleUploadStatus status, uint32_t record_count) {
+    pb_tx_buffer_ = {};
+    pb_tx_buffer_.which_payload = PB_FromSplitflap_schedule_upload_response_tag;
+    PB_ScheduleUploadResponse& response = pb_tx_buffer_.payload.schedule_upload_response;
+    response.phase = phase;
+    response.status = (PB_ScheduleUploadResponse_Status) status;
+    response.next_offset = schedule_store_ != nullptr ? schedule_store_->uploadOffset() : 0;
+    response.record_count = record_count;
+    sendPbTxBuffer();
+}
+
+bool SerialProtoProtocol::pbPayloadCallback(pb_istream_t* stream, const pb_field_t* field, void** arg) {
+    // Called by nanopb when it's about to decode the ToSplitflap payload
+    SerialProtoProtocol* protocol = (SerialProtoProtocol*)*arg;
+    protocol->rx_command_ = {};
+    protocol->rx_module_count_ = 0;
+    switch (field->tag) {
+        case PB_ToSplitflap_splitflap_command_tag: {
+            protocol->rx_command_.command_type = CommandType::MODULES;
+            PB_SplitflapCommand* command = (PB_SplitflapCommand*)field->pData;
+            command->modules.funcs.decode = &pbDecodeModuleCommand;
+            command->modules.arg = protocol;
+            break;
+        }
+        case PB_ToSplitflap_splitflap_config_tag: {
+            protocol->rx_command_.command_type = CommandType::CONFIG;
+            PB_SplitflapConfig* config = (PB_SplitflapConfig*)field->pData;
+            config->modules.funcs.decode = &pbDecodeModuleConfig;
+            config->modules.arg = protocol;
+            break;
+        }
+        default:
+            break;
+    }
+    return true;
+}
+
+bool SerialProtoProtocol::pbDecodeModuleCommand(pb_istream_t* stream, const pb_field_t* field, void** arg) {
+    SerialProtoProtocol* protocol = (SerialProtoProtocol*)*arg;
+    PB_SplitflapCommand_ModuleCommand module = {};
+    if (!pb_decode(stream, PB_SplitflapCommand_ModuleCommand_fields, &module)) {
+        return false;
+    }
+    if (protocol->rx_module_count_ >= NUM_MODULES) {
+        // Ignore commands for modules we don't have
+        return true;
+    }
+
+    uint8_t& module_command = protocol->rx_command_.data.module_command[protocol->rx_module_count_++];
+    switch (module.action) {
+        case PB_SplitflapCommand_ModuleCommand_Action_NO_OP:
+            module_command = QCMD_NO_OP;
+            break;
+        case PB_SplitflapCommand_ModuleCommand_Action_RESET_AND_HOME:
+            module_command = QCMD_RESET_AND_HOME;
+            break;
+        case PB_SplitflapCommand_ModuleCommand_Action_GO_TO_FLAP:
+            if (module.param <= 255 - QCMD_FLAP) {
+                module_command = QCMD_FLAP + module.param;
+            }
+            break;
+        default:
+            // Ignore unknown action
+            break;
+    }
+    return true;
+}
+
+bool SerialProtoProtocol::pbDecodeModuleConfig(pb_istream_t* stream, const pb_field_t* field, void** arg) {
+    SerialProtoProtocol* protocol = (SerialProtoProtocol*)*arg;
+    PB_SplitflapConfig_ModuleConfig module = {};
+    if (!pb_decode(stream, PB_SplitflapConfig_ModuleConfig_fields, &module)) {
+        return false;
+    }
+    if (protocol->rx_module_count_ >= NUM_MODULES) {
+        // Ignore configs for modules we don't have
+        return true;
+    }
+
+    ModuleConfig& module_config = protocol->rx_command_.data.module_configs.config[protocol->rx_module_count_++];
+    module_config.target_flap_index = module.target_flap_index;
+    module_config.movement_nonce = module.movement_nonce;
+    module_config.reset_nonce = module.reset_nonce;
+    return true;
+}
+
+bool SerialProtoProtocol::pbEncodeModuleStates(pb_ostream_t* stream, const pb_field_t* field, void* const* arg) {
+    const SerialProtoProtocol* protocol = (const SerialProtoProtocol*)*arg;
+
+    // Fields that aren't subscribed to are left at their defaults, so they're omitted from the encoded message
+    const uint32_t mask = protocol->subscribed_field_mask_;
+    for (uint8_t i = 0; i < protocol->subscribed_module_count_; i++) {
+        const SplitflapModuleState& module = protocol->latest_state_.modules[protocol->subscribed_module_start_ + i];
+        PB_SplitflapState_ModuleState out = {};
+        if (mask & FIELD_STATE) {
+            out.state = (PB_SplitflapState_ModuleState_State) module.state;
+        }
+        if (mask & FIELD_FLAP_INDEX) {
+            out.flap_index = module.flap_index;
+        }
+        if (mask & FIELD_MOVING) {
+            out.moving = module.moving;
+        }
+        if (mask & FIELD_HOME_STATE) {
+            out.home_state = module.home_state;
+        }
+        if (mask & FIELD_COUNT_UNEXPECTED_HOME) {
+            out.count_unexpected_home = module.count_unexpected_home;
+        }
+        if (mask & FIELD_COUNT_MISSED_HOME) {
+            out.count_missed_home = module.count_missed_home;
+        }
+
+        if (!pb_encode_tag_for_field(stream, field) || !pb_encode_submessage(stream, PB_SplitflapState_ModuleState_fields, &out)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool SerialProtoProtocol::pbOstreamCallback(pb_ostream_t* stream, const uint8_t* buf, size_t count) {
+    SerialProtoProtocol* protocol = (SerialProtoProtocol*)stream->state;
+    crc32(buf, count, &protocol->tx_crc_);
+    protocol->cobs_encoder_.write(buf, count);
+    return true;
 }
 
 void SerialProtoProtocol::sendPbTxBuffer() {
-    // Encode protobuf message to byte buffer
-    pb_ostream_t stream = pb_ostream_from_buffer(tx_buffer_, sizeof(tx_buffer_));
+    // Encode protobuf message straight into the COBS packet, computing the CRC32 along the way
+    tx_crc_ = 0;
+    cobs_encoder_.begin();
+    pb_ostream_t stream = {&pbOstreamCallback, this, SIZE_MAX, 0};
     if (!pb_encode(&stream, PB_FromSplitflap_fields, &pb_tx_buffer_)) {
+        // Terminate the partial packet so the receiver discards it
+        cobs_encoder_.end();
         stream_.println(stream.errmsg);
         stream_.flush();
         assert(false);
     }
 
-    // Compute and append little-endian CRC32
-    uint32_t crc = 0;
-    crc32(tx_buffer_, stream.bytes_written, &crc);
-    tx_buffer_[stream.bytes_written + 0] = (crc >> 0)  & 0xFF;
-    tx_buffer_[stream.bytes_written + 1] = (crc >> 8)  & 0xFF;
-    tx_buffer_[stream.bytes_written + 2] = (crc >> 16) & 0xFF;
-    tx_buffer_[stream.bytes_written + 3] = (crc >> 24) & 0xFF;
-
-    // Encode and send proto+CRC as a COBS packet
-    packet_serial_.send(tx_buffer_, stream.bytes_written + 4);
+    // Append little-endian CRC32 and finish the packet
+    uint8_t crc_buffer[4] = {
+        (uint8_t)((tx_crc_ >> 0)  & 0xFF),
+        (uint8_t)((tx_crc_ >> 8)  & 0xFF),
+        (uint8_t)((tx_crc_ >> 16) & 0xFF),
+        (uint8_t)((tx_crc_ >> 24) & 0xFF),
+    };
+    cobs_encoder_.write(crc_buffer, sizeof(crc_buffer));
+    cobs_encoder_.end();
 }
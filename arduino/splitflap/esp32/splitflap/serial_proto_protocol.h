@@ -15,40 +15,133 @@
 */
 #pragma once
 
-#include "PacketSerial.h"
+#include "pb.h"
 
+#include "cobs_decoder.h"
+#include "cobs_encoder.h"
+#include "schedule_store.h"
 #include "serial_protocol.h"
+#include "../core/chunked_stream.h"
 #include "../proto_gen/splitflap.pb.h"
 
+// Max number of unacknowledged messages a client may have in flight (see PB_WindowConfig)
+#define PROTO_MAX_WINDOW_SIZE 8
+
+// Largest ToSplitflap packet (including CRC) that can be received: the largest payload, which is either a
+// SplitflapConfig with an entry for every module or a ScheduleUpload chunk, plus the nonce and message headers
+#define PROTO_MAX_CONFIG_PAYLOAD_SIZE (NUM_MODULES * (PB_SplitflapConfig_ModuleConfig_size + 2))
+#define PROTO_MAX_RX_PACKET_SIZE ((PROTO_MAX_CONFIG_PAYLOAD_SIZE > PB_ScheduleUpload_size \
+                                    ? PROTO_MAX_CONFIG_PAYLOAD_SIZE : PB_ScheduleUpload_size) + 24)
+
+typedef std::function<void(uint32_t)> BaudRateChangeCallback;
+
 class SerialProtoProtocol : public SerialProtocol {
     public:
-        SerialProtoProtocol(SplitflapTask& splitflap_task, Stream& stream);
+        SerialProtoProtocol(SplitflapTask& splitflap_task, ChunkedStream& stream);
         ~SerialProtoProtocol() {}
         void log(const char* msg) override;
         void loop() override;
         void handleState(const SplitflapState& old_state, const SplitflapState& new_state) override;
         void sendSupervisorState(PB_SupervisorState& supervisor_state) override;
 
+        // Resets the transport and subscription when switching to this protocol, as a new client may be on the other end
         void init();
+
+        void setBaudRateChangeCallback(BaudRateChangeCallback cb) {
+            baud_rate_change_callback_ = cb;
+        }
+
+        void setScheduleStore(ScheduleStore* schedule_store) {
+            schedule_store_ = schedule_store;
+        }
     
     private:
-        Stream& stream_;
+        ChunkedStream& stream_;
         PB_FromSplitflap pb_tx_buffer_;
         PB_ToSplitflap pb_rx_buffer_;
 
-        uint8_t tx_buffer_[PB_FromSplitflap_size + 4]; // Max message size + CRC32
+        // Outgoing messages are encoded, checksummed, and COBS-framed in a single pass directly to the stream
+        CobsEncoder cobs_encoder_;
+        uint32_t tx_crc_;
+
+        // Incoming packets are read in chunks and decoded in place, then checksummed while being decoded
+        CobsDecoder<COBS_MAX_ENCODED_SIZE(PROTO_MAX_RX_PACKET_SIZE)> cobs_decoder_;
 
-        PacketSerial_<COBS, 0, (PB_ToSplitflap_size + 4) * 2 + 10> packet_serial_;
+        // Module commands/configs are decoded straight into this by nanopb callbacks (see pbPayloadCallback), so
+        // nothing in the protocol is sized for the proto's 255 module limit
+        Command rx_command_;
+        uint8_t rx_module_count_;
 
+        // Received message, reduced to what's needed to act on it once it can be delivered in order. Schedule upload
+        // chunks are several times larger than anything else, so they're never held in the window (see
+        // handleWindowedPacket).
+        struct PendingMessage {
+            bool received;
+            pb_size_t which_payload;
+            union {
+                Command command;
+                PB_BaudRateChange baud_rate_change;
+                PB_Subscribe subscribe;
+            };
+        };
+
+        // Stop-and-wait transport state
         uint32_t last_nonce_;
 
+        // Sliding window transport state; a window_size_ of 0 means the stop-and-wait transport is in use
+        uint8_t window_size_ = 0;
+        uint32_t cumulative_nonce_ = 0;
+        // Each entry can hold a full Command, so unlike the rest of the protocol this is still O(NUM_MODULES):
+        // about PROTO_MAX_WINDOW_SIZE * 3 bytes per module (e.g. 224 bytes for 6 modules, 2656 for 108)
+        PendingMessage window_[PROTO_MAX_WINDOW_SIZE] = {};
+
         SplitflapState latest_state_ = {};
         SplitflapState last_sent_state_ = {};
         uint32_t last_sent_state_millis_ = 0;
 
         bool state_requested_;
 
+        // State subscription (see PB_Subscribe)
+        uint32_t min_state_interval_millis_;
+        uint32_t heartbeat_interval_millis_;
+        uint8_t subscribed_module_start_;
+        uint8_t subscribed_module_count_;
+        uint32_t subscribed_field_mask_;
+
+        // Baud rate change handshake state (see PB_BaudRateChange)
+        BaudRateChangeCallback baud_rate_change_callback_;
+        uint32_t baud_rate_ = MONITOR_SPEED;
+        // Accepted proposal, applied from loop() once the response and ack have been sent at the current rate
+        uint32_t pending_baud_rate_ = 0;
+        // Rate to revert to if the current rate isn't confirmed in time, or 0 if not awaiting confirmation
+        uint32_t previous_baud_rate_ = 0;
+        uint32_t baud_rate_changed_millis_ = 0;
+        // Corrupt packets received in a row, used to detect a client that's still at the default rate
+        uint8_t consecutive_bad_packets_ = 0;
+
+        // Destination of schedule uploads (see PB_ScheduleUpload), or nullptr if they aren't supported
+        ScheduleStore* schedule_store_ = nullptr;
+
         void sendPbTxBuffer();
         void handlePacket(const uint8_t* buffer, size_t size);
+        void resetTransport(uint32_t nonce, uint8_t window_size);
+        void handleWindowedPacket(uint32_t nonce, int32_t offset);
+        void decodePayload(PendingMessage& message);
+        void dispatch(const PendingMessage& message);
         void ack(uint32_t nonce);
+        void subscribe(const PB_Subscribe& subscription);
+        bool subscribedStateChanged();
+        void handleBaudRateChange(const PB_BaudRateChange& baud_rate_change);
+        void updateBaudRate();
+        void setBaudRate(uint32_t baud_rate);
+        void sendBaudRateResponse(PB_BaudRateResponse_Status status, uint32_t baud_rate);
+        void handleBadPacket();
+        void handleScheduleUpload(const PB_ScheduleUpload& upload);
+        void sendScheduleUploadResponse(PB_ScheduleUpload_Phase phase, ScheduleUploadStatus status, uint32_t record_count);
+
+        static bool pbOstreamCallback(pb_ostream_t* stream, const uint8_t* buf, size_t count);
+        static bool pbPayloadCallback(pb_istream_t* stream, const pb_field_t* field, void** arg);
+        static bool pbDecodeModuleCommand(pb_istream_t* stream, const pb_field_t* field, void** arg);
+        static bool pbDecodeModuleConfig(pb_istream_t* stream, const pb_field_t* field, void** arg);
+        static bool pbEncodeModuleStates(pb_ostream_t* stream, const pb_field_t* field, void* const* arg);
 };
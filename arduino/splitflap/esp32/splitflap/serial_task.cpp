@@ -44,6 +44,7 @@ void SerialTask::run() {
                 current_protocol = &legacy_protocol_;
                 break;
             case SERIAL_PROTOCOL_PROTO:
+                proto_protocol_.init();
                 current_protocol = &proto_protocol_;
                 break;
             default:
@@ -54,6 +55,9 @@ void SerialTask::run() {
 
     legacy_protocol_.setProtocolChangeCallback(protocol_change_callback);
     proto_protocol_.setProtocolChangeCallback(protocol_change_callback);
+    proto_protocol_.setBaudRateChangeCallback([this] (uint32_t baud_rate) {
+        stream_.setBaudRate(baud_rate);
+    });
 
     splitflap_task_.setLogger(this);
 
@@ -93,4 +97,8 @@ void SerialTask::log(const char* msg) {
 void SerialTask::sendSupervisorState(PB_SupervisorState& supervisor_state) {
     // Only queue the latest supervisor state
     xQueueOverwrite(supervisor_state_queue_, &supervisor_state);
-}
\ No newline at end of file
+}
+
+void SerialTask::setScheduleStore(ScheduleStore* schedule_store) {
+    proto_protocol_.setScheduleStore(schedule_store);
+}
@@ -35,6 +35,9 @@ class SerialTask : public Task<SerialTask>, public Logger {
 
         void sendSupervisorState(PB_SupervisorState& supervisor_state);
 
+        // Enables schedule uploads over the proto protocol; must be called before begin()
+        void setScheduleStore(ScheduleStore* schedule_store);
+
     protected:
         void run();
 
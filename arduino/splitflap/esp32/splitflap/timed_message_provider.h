@@ -20,22 +20,35 @@
 #include "../core/logger.h"
 #include "display_task.h"
 #include "message_provider.h"
-
-struct SpecialMessage {
-  time_t start_time;
-  int duration_seconds;
-  const std::vector<String> messages;
-};
+#include "schedule_store.h"
 
 class TimedMessageProvider : public MessageProvider {
  public:
-  TimedMessageProvider(DisplayTask& display_task, Logger& logger);
+  TimedMessageProvider(DisplayTask& display_task, Logger& logger,
+                       ScheduleStore& schedule_store);
+  const char* name() const override;
+  MessageProviderSchedule schedule() const override;
   FetchResult fetchData() override;
-  const std::vector<String>& getMessages() override;
+  const FlapMessageList& getMessages() override;
 
  private:
   DisplayTask& display_task_;
   Logger& logger_;
+  ScheduleStore& schedule_store_;
+
+  FlapMessageList current_messages_;
+
+  // Index of the last schedule entry that started at or before the previous
+  // fetch, or -1 if that was before the first entry. Time normally only moves
+  // forward, so this usually only needs to be checked or advanced by one.
+  int cursor_ = -1;
+
+  // Entry currently being shown, or -1
+  int current_index_ = -1;
+
+  // Generation of the uploaded schedule that cursor_ and current_index_
+  // refer to (see ScheduleStore::Lock::generation())
+  uint32_t schedule_generation_ = 0;
 
-  std::vector<String> current_messages_;
+  int findEntry(const SpecialMessage* entries, int count, uint32_t now);
 };
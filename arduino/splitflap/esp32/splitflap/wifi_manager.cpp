@@ -16,62 +16,214 @@
 #include "wifi_manager.h"
 #include "secrets.h"
 
+#include <Preferences.h>
 #include <lwip/apps/sntp.h>
 #include <time.h>
 
 // How long to wait for a WiFi connection before trying the next network
 #define WIFI_TIMEOUT_MILLIS 15000
 
-WiFiManager::WiFiManager(DisplayTask& display_task, Logger& logger) :
+// Connecting to a known access point and channel skips the scan, so it's given less time before falling back
+#define WIFI_CACHED_TIMEOUT_MILLIS 5000
+
+// Wait before trying all the networks again
+#define WIFI_RETRY_DELAY_MILLIS 30000
+
+#define WIFI_POLL_INTERVAL_MILLIS 100
+
+#define WIFI_CONNECTED_BIT BIT0
+
+// Before SNTP has set the clock, time() counts up from 0; anything earlier than this isn't a real time
+#define MIN_VALID_TIME 1625099485
+
+static const char* NVS_NAMESPACE = "wifi";
+static const char* NVS_KEY_SSID = "ssid";
+static const char* NVS_KEY_BSSID = "bssid";
+static const char* NVS_KEY_CHANNEL = "channel";
+
+// lwIP keeps the pointer, so this needs to stay around
+static char SNTP_SERVER[] = "time.nist.gov";
+
+WiFiManager::WiFiManager(DisplayTask& display_task, Logger& logger, const uint8_t task_core) :
+    Task("WiFi", 4096, 1, task_core),
     display_task_(display_task),
-    logger_(logger) {
+    logger_(logger),
+    event_group_(xEventGroupCreate()) {
+    assert(event_group_ != NULL);
 }
 
-bool WiFiManager::connect() {
-    char buf[256];
+WiFiManager::~WiFiManager() {
+    vEventGroupDelete(event_group_);
+}
+
+bool WiFiManager::waitForConnection(TickType_t timeout) {
+    EventBits_t bits = xEventGroupWaitBits(event_group_, WIFI_CONNECTED_BIT, pdFALSE, pdTRUE, timeout);
+    return (bits & WIFI_CONNECTED_BIT) != 0;
+}
+
+bool WiFiManager::isConnected() {
+    return (xEventGroupGetBits(event_group_) & WIFI_CONNECTED_BIT) != 0;
+}
 
-    for (const auto& config : wifi_configs) {
+void WiFiManager::run() {
+    // Reconnects are handled here, with the cached network tried first
+    WiFi.mode(WIFI_STA);
+    WiFi.setAutoReconnect(false);
+    loadCache();
+
+    while (1) {
+        uint32_t now = millis();
+        switch (state_) {
+            case State::START_ATTEMPT:
+                startAttempt();
+                break;
+            case State::CONNECTING:
+                if (WiFi.status() == WL_CONNECTED) {
+                    onConnected();
+                } else if (now - state_start_millis_
+                        > (attempt_ < 0 ? WIFI_CACHED_TIMEOUT_MILLIS : WIFI_TIMEOUT_MILLIS)) {
+                    log_d("Connection timed out.");
+                    WiFi.disconnect();
+                    attempt_++;
+                    state_ = State::START_ATTEMPT;
+                }
+                break;
+            case State::CONNECTED:
+                if (WiFi.status() != WL_CONNECTED) {
+                    onDisconnected();
+                }
+                break;
+            case State::RETRY_WAIT:
+                if (now - state_start_millis_ > WIFI_RETRY_DELAY_MILLIS) {
+                    attempt_ = -1;
+                    state_ = State::START_ATTEMPT;
+                }
+                break;
+        }
+
+        if (sntp_started_ && !time_synced_) {
+            checkTime();
+        }
+        delay(WIFI_POLL_INTERVAL_MILLIS);
+    }
+}
+
+void WiFiManager::startAttempt() {
+    if (attempt_ < 0 && !cache_.valid) {
+        attempt_ = 0;
+    }
+    if (attempt_ >= (int)wifi_configs.size()) {
+        logger_.log("Could not connect to any WiFi network.");
+        display_task_.setMessage(1, "No WiFi connection.");
+        state_ = State::RETRY_WAIT;
+        state_start_millis_ = millis();
+        return;
+    }
+
+    if (attempt_ < 0) {
+        const wifi_config& config = wifi_configs[cache_.config_index];
+        log_d("Trying to connect to %s on channel %u", config.ssid, cache_.channel);
+        display_task_.setMessage(1, "Connecting to " + String(config.ssid));
+        WiFi.begin(config.ssid, config.password, cache_.channel, cache_.bssid);
+    } else {
+        const wifi_config& config = wifi_configs[attempt_];
         log_d("Trying to connect to %s", config.ssid);
         display_task_.setMessage(1, "Connecting to " + String(config.ssid));
         WiFi.begin(config.ssid, config.password);
+    }
+    state_ = State::CONNECTING;
+    state_start_millis_ = millis();
+}
 
-        unsigned long start = millis();
-        while (WiFi.status() != WL_CONNECTED) {
-            if (millis() - start > WIFI_TIMEOUT_MILLIS) {
-                log_d("Connection timed out.");
-                break;
-            }
-            delay(1000);
-            log_d("Waiting for connection...");
-        }
+void WiFiManager::onConnected() {
+    char buf[256];
+    uint32_t now = millis();
+    uint8_t config_index = attempt_ < 0 ? cache_.config_index : attempt_;
+    const char* ssid = wifi_configs[config_index].ssid;
+
+    if (connection_count_ == 0) {
+        snprintf(buf, sizeof(buf), "Connected to network %s %ums after boot (%s)", ssid, now,
+            attempt_ < 0 ? "cached access point" : "scanned");
+    } else {
+        snprintf(buf, sizeof(buf), "Reconnected to network %s after %ums offline (%s)", ssid,
+            now - disconnected_millis_, attempt_ < 0 ? "cached access point" : "scanned");
+    }
+    logger_.log(buf);
+    display_task_.setMessage(1, "Connected to " + String(ssid));
+
+    CachedNetwork network = {};
+    network.valid = true;
+    network.config_index = config_index;
+    memcpy(network.bssid, WiFi.BSSID(), sizeof(network.bssid));
+    network.channel = WiFi.channel();
+    if (memcmp(&network, &cache_, sizeof(network)) != 0) {
+        cache_ = network;
+        saveCache();
+    }
+
+    if (!sntp_started_) {
+        // Syncs in the background; checkTime() notices once it has
+        sntp_setoperatingmode(SNTP_OPMODE_POLL);
+        sntp_setservername(0, SNTP_SERVER);
+        sntp_init();
+        sntp_started_ = true;
+    }
 
-        if (WiFi.status() == WL_CONNECTED) {
-            snprintf(buf, sizeof(buf), "Connected to network %s", config.ssid);
-            logger_.log(buf);
-            display_task_.setMessage(1, "Connected to " + String(config.ssid));
-
-            // Sync SNTP
-            sntp_setoperatingmode(SNTP_OPMODE_POLL);
-            char server[] = "time.nist.gov";
-            sntp_setservername(0, server);
-            sntp_init();
-
-            log_d("Waiting for NTP time sync...");
-            snprintf(buf, sizeof(buf), "Syncing NTP time via %s...", server);
-            display_task_.setMessage(1, String(buf));
-            time_t now;
-            while (time(&now), now < 1625099485) {
-                delay(1000);
-            }
-
-            strftime(buf, sizeof(buf), "Got time: %Y-%m-%d %H:%M:%S", localtime(&now));
-            logger_.log(buf);
-
-            return true;
+    connected_millis_ = now;
+    connection_count_++;
+    state_ = State::CONNECTED;
+    xEventGroupSetBits(event_group_, WIFI_CONNECTED_BIT);
+}
+
+void WiFiManager::onDisconnected() {
+    xEventGroupClearBits(event_group_, WIFI_CONNECTED_BIT);
+    disconnected_millis_ = millis();
+    logger_.log("WiFi connection lost");
+    WiFi.disconnect();
+    attempt_ = -1;
+    state_ = State::START_ATTEMPT;
+}
+
+void WiFiManager::checkTime() {
+    time_t now;
+    time(&now);
+    if (now < MIN_VALID_TIME) {
+        return;
+    }
+    time_synced_ = true;
+
+    char buf[256];
+    strftime(buf, sizeof(buf), "Got time: %Y-%m-%d %H:%M:%S", localtime(&now));
+    logger_.log(buf);
+}
+
+void WiFiManager::loadCache() {
+    Preferences preferences;
+    if (!preferences.begin(NVS_NAMESPACE, true)) {
+        return;
+    }
+    // Stored by SSID rather than index, in case secrets.h has changed since
+    String ssid = preferences.getString(NVS_KEY_SSID);
+    for (uint8_t i = 0; i < wifi_configs.size(); i++) {
+        if (ssid == wifi_configs[i].ssid
+                && preferences.getBytes(NVS_KEY_BSSID, cache_.bssid, sizeof(cache_.bssid)) == sizeof(cache_.bssid)) {
+            cache_.config_index = i;
+            cache_.channel = preferences.getUChar(NVS_KEY_CHANNEL, 0);
+            cache_.valid = true;
+            break;
         }
     }
+    preferences.end();
+}
 
-    logger_.log("Could not connect to any WiFi network.");
-    display_task_.setMessage(1, "No WiFi connection.");
-    return false;
+void WiFiManager::saveCache() {
+    Preferences preferences;
+    if (!preferences.begin(NVS_NAMESPACE, false)) {
+        log_d("Failed to open WiFi cache for writing");
+        return;
+    }
+    preferences.putString(NVS_KEY_SSID, wifi_configs[cache_.config_index].ssid);
+    preferences.putBytes(NVS_KEY_BSSID, cache_.bssid, sizeof(cache_.bssid));
+    preferences.putUChar(NVS_KEY_CHANNEL, cache_.channel);
+    preferences.end();
 }
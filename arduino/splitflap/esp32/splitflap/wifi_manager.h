@@ -18,14 +18,77 @@
 #include <WiFi.h>
 
 #include "../core/logger.h"
+#include "../core/task.h"
 #include "display_task.h"
 
-class WiFiManager {
+/**
+ * Connects to WiFi (trying each network in secrets.h in turn), and reconnects whenever the connection drops, in its
+ * own task.
+ *
+ * The access point (BSSID) and channel of the last successful connection are saved to NVS, and tried first (which
+ * skips the scan) both at boot and after a drop. SNTP is started on the first connection and syncs in the
+ * background. Other tasks wait for a connection with waitForConnection() rather than connecting themselves.
+ */
+class WiFiManager : public Task<WiFiManager> {
+  friend class Task<WiFiManager>; // Allow base Task to invoke protected run()
+
  public:
-  WiFiManager(DisplayTask& display_task, Logger& logger);
-  bool connect();
+  WiFiManager(DisplayTask& display_task, Logger& logger, const uint8_t task_core);
+  ~WiFiManager();
+
+  // Blocks until WiFi is connected, or the timeout passes. Returns true if connected.
+  bool waitForConnection(TickType_t timeout = portMAX_DELAY);
+
+  bool isConnected();
+
+  // Incremented on every connection, so dependents can tell when the connection has been re-established
+  uint32_t connectionCount() const {
+    return connection_count_;
+  }
+
+  // millis() when the current (or last) connection was made
+  uint32_t connectedMillis() const {
+    return connected_millis_;
+  }
+
+ protected:
+  void run();
 
  private:
+  enum class State {
+    START_ATTEMPT,
+    CONNECTING,
+    CONNECTED,
+    RETRY_WAIT,
+  };
+
+  // Last successful connection, tried before scanning
+  struct CachedNetwork {
+    bool valid;
+    uint8_t config_index;
+    uint8_t bssid[6];
+    uint8_t channel;
+  };
+
   DisplayTask& display_task_;
   Logger& logger_;
+  EventGroupHandle_t event_group_;
+
+  State state_ = State::START_ATTEMPT;
+  CachedNetwork cache_ = {};
+  // Index into wifi_configs of the network being tried, or -1 for the cached network
+  int attempt_ = -1;
+  uint32_t state_start_millis_ = 0;
+  uint32_t disconnected_millis_ = 0;
+  volatile uint32_t connection_count_ = 0;
+  volatile uint32_t connected_millis_ = 0;
+  bool sntp_started_ = false;
+  bool time_synced_ = false;
+
+  void startAttempt();
+  void onConnected();
+  void onDisconnected();
+  void checkTime();
+  void loadCache();
+  void saveCache();
 };
@@ -0,0 +1,123 @@
+/*
+   Copyright 2022 Scott Bezek and the splitflap contributors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+#include <Arduino.h>
+
+static uint32_t fake_millis = 0;
+static time_t fake_time_base = 1656633600; // 2022-07-01
+
+#ifndef __THROW
+#define __THROW
+#endif
+
+#if defined(__GLIBC__) && (__GLIBC__ < 2 || (__GLIBC__ == 2 && __GLIBC_MINOR__ < 38))
+size_t strlcpy(char* dst, const char* src, size_t size) {
+    size_t length = strlen(src);
+    if (size > 0) {
+        size_t copied = min(length, size - 1);
+        memcpy(dst, src, copied);
+        dst[copied] = '\0';
+    }
+    return length;
+}
+#endif
+
+uint32_t millis() {
+    return fake_millis;
+}
+
+uint32_t micros() {
+    return fake_millis * 1000;
+}
+
+void delay(uint32_t ms) {
+    fake_millis += ms;
+}
+
+void advanceMillis(uint32_t ms) {
+    fake_millis += ms;
+}
+
+void setFakeTime(time_t now) {
+    fake_time_base = now - fake_millis / 1000;
+}
+
+// Takes the place of the C library's time() (which glibc declares __THROW)
+time_t time(time_t* now) __THROW {
+    time_t fake_now = fake_time_base + fake_millis / 1000;
+    if (now != nullptr) {
+        *now = fake_now;
+    }
+    return fake_now;
+}
+
+BaseType_t xTaskCreatePinnedToCore(TaskFunction_t task, const char* name, uint32_t stack_depth, void* params,
+        UBaseType_t priority, TaskHandle_t* handle, BaseType_t core_id) {
+    // Tests drive everything from the main thread
+    return pdFALSE;
+}
+
+SemaphoreHandle_t xSemaphoreCreateMutex() {
+    static int mutex;
+    return &mutex;
+}
+
+BaseType_t xSemaphoreTake(SemaphoreHandle_t semaphore, TickType_t ticks_to_wait) {
+    return pdTRUE;
+}
+
+BaseType_t xSemaphoreGive(SemaphoreHandle_t semaphore) {
+    return pdTRUE;
+}
+
+size_t Print::write(const uint8_t* buffer, size_t size) {
+    size_t written = 0;
+    while (size--) {
+        written += write(*buffer++);
+    }
+    return written;
+}
+
+size_t Print::print(int value) {
+    return printf("%d", value);
+}
+
+size_t Print::print(unsigned int value) {
+    return printf("%u", value);
+}
+
+size_t Print::print(long value) {
+    return printf("%ld", value);
+}
+
+size_t Print::print(unsigned long value) {
+    return printf("%lu", value);
+}
+
+size_t Print::println() {
+    return write("\r\n");
+}
+
+size_t Print::printf(const char* format, ...) {
+    char buf[256];
+    va_list args;
+    va_start(args, format);
+    int length = vsnprintf(buf, sizeof(buf), format, args);
+    va_end(args);
+    if (length < 0) {
+        return 0;
+    }
+    return write((const uint8_t*)buf, min((size_t)length, sizeof(buf) - 1));
+}
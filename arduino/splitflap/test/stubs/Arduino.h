@@ -0,0 +1,118 @@
+/*
+   Copyright 2022 Scott Bezek and the splitflap contributors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+#pragma once
+
+/**
+ * Stand-in for the parts of the ESP32 Arduino core (and the FreeRTOS headers it pulls in) that the firmware code
+ * built in the native test environment uses. Only meant for single-threaded tests: tasks are never started and
+ * semaphores are always available.
+ */
+
+#include <algorithm>
+#include <assert.h>
+#include <math.h>
+#include <stdarg.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "WString.h"
+
+using std::max;
+using std::min;
+
+#if defined(__GLIBC__) && (__GLIBC__ < 2 || (__GLIBC__ == 2 && __GLIBC_MINOR__ < 38))
+size_t strlcpy(char* dst, const char* src, size_t size);
+#endif
+
+// Time only moves when a test advances it, so timeouts and rate limits are deterministic. Benchmarks that need
+// wall clock time should use std::chrono instead.
+uint32_t millis();
+uint32_t micros();
+void delay(uint32_t ms);
+void advanceMillis(uint32_t ms);
+
+// time() follows the fake clock too, counting on from the wall clock time set here (by default, a time in 2022 as
+// if SNTP had set the clock)
+void setFakeTime(time_t now);
+
+// Core debug logging, compiled out as it is with the default CORE_DEBUG_LEVEL
+#define log_d(format, ...)
+
+// FreeRTOS
+typedef int BaseType_t;
+typedef unsigned int UBaseType_t;
+typedef uint32_t TickType_t;
+typedef void* TaskHandle_t;
+typedef void* QueueHandle_t;
+typedef void* SemaphoreHandle_t;
+typedef void (*TaskFunction_t)(void*);
+
+#define pdFALSE 0
+#define pdTRUE 1
+#define pdPASS pdTRUE
+#define portMAX_DELAY ((TickType_t)0xFFFFFFFF)
+#define tskNO_AFFINITY 0x7FFFFFFF
+
+BaseType_t xTaskCreatePinnedToCore(TaskFunction_t task, const char* name, uint32_t stack_depth, void* params,
+    UBaseType_t priority, TaskHandle_t* handle, BaseType_t core_id);
+SemaphoreHandle_t xSemaphoreCreateMutex();
+BaseType_t xSemaphoreTake(SemaphoreHandle_t semaphore, TickType_t ticks_to_wait);
+BaseType_t xSemaphoreGive(SemaphoreHandle_t semaphore);
+
+class Print {
+    public:
+        virtual ~Print() {}
+
+        virtual size_t write(uint8_t b) = 0;
+        virtual size_t write(const uint8_t* buffer, size_t size);
+        size_t write(const char* str) {
+            return write((const uint8_t*)str, strlen(str));
+        }
+        size_t write(char c) {
+            return write((uint8_t)c);
+        }
+
+        size_t print(const char* str) {
+            return write(str);
+        }
+        size_t print(char c) {
+            return write(c);
+        }
+        size_t print(int value);
+        size_t print(unsigned int value);
+        size_t print(long value);
+        size_t print(unsigned long value);
+
+        size_t println();
+        size_t println(const char* str) {
+            return print(str) + println();
+        }
+
+        size_t printf(const char* format, ...) __attribute__((format(printf, 2, 3)));
+
+        virtual void flush() {}
+};
+
+class Stream : public Print {
+    public:
+        virtual int available() = 0;
+        virtual int read() = 0;
+        virtual int peek() = 0;
+};
@@ -0,0 +1,87 @@
+/*
+   Copyright 2022 Scott Bezek and the splitflap contributors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+#include "Preferences.h"
+
+#include <map>
+#include <string.h>
+#include <vector>
+
+// namespace -> key -> value
+static std::map<std::string, std::map<std::string, std::vector<uint8_t>>> fake_nvs;
+static uint32_t write_count = 0;
+
+void fakePreferencesClear() {
+    fake_nvs.clear();
+    write_count = 0;
+}
+
+uint32_t fakePreferencesWriteCount() {
+    return write_count;
+}
+
+bool Preferences::begin(const char* name, bool read_only) {
+    if (open_ || (read_only && fake_nvs.count(name) == 0)) {
+        return false;
+    }
+    namespace_ = name;
+    read_only_ = read_only;
+    open_ = true;
+    if (!read_only) {
+        fake_nvs[namespace_];
+    }
+    return true;
+}
+
+void Preferences::end() {
+    open_ = false;
+}
+
+uint8_t Preferences::getUChar(const char* key, uint8_t default_value) {
+    uint8_t value;
+    return getBytesLength(key) == sizeof(value) && getBytes(key, &value, sizeof(value)) ? value : default_value;
+}
+
+size_t Preferences::putUChar(const char* key, uint8_t value) {
+    return putBytes(key, &value, sizeof(value));
+}
+
+size_t Preferences::getBytesLength(const char* key) {
+    if (!open_) {
+        return 0;
+    }
+    auto& values = fake_nvs[namespace_];
+    auto it = values.find(key);
+    return it == values.end() ? 0 : it->second.size();
+}
+
+size_t Preferences::getBytes(const char* key, void* buffer, size_t max_length) {
+    size_t length = getBytesLength(key);
+    if (length == 0 || length > max_length) {
+        return 0;
+    }
+    memcpy(buffer, fake_nvs[namespace_][key].data(), length);
+    return length;
+}
+
+size_t Preferences::putBytes(const char* key, const void* value, size_t length) {
+    if (!open_ || read_only_) {
+        return 0;
+    }
+    const uint8_t* bytes = (const uint8_t*)value;
+    fake_nvs[namespace_][key].assign(bytes, bytes + length);
+    write_count++;
+    return length;
+}
@@ -0,0 +1,50 @@
+/*
+   Copyright 2022 Scott Bezek and the splitflap contributors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+#pragma once
+
+/**
+ * Stand-in for the ESP32 Preferences library, backed by an in-memory NVS that outlives any one Preferences instance
+ * (so firmware state can be "rebooted" by constructing it again) until fakePreferencesClear(), for the native test
+ * environment.
+ */
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string>
+
+class Preferences {
+    public:
+        // Like NVS, opening a namespace that doesn't exist yet read-only fails
+        bool begin(const char* name, bool read_only = false);
+        void end();
+
+        uint8_t getUChar(const char* key, uint8_t default_value = 0);
+        size_t putUChar(const char* key, uint8_t value);
+
+        size_t getBytesLength(const char* key);
+        size_t getBytes(const char* key, void* buffer, size_t max_length);
+        size_t putBytes(const char* key, const void* value, size_t length);
+
+    private:
+        std::string namespace_;
+        bool open_ = false;
+        bool read_only_ = false;
+};
+
+// Erases every namespace
+void fakePreferencesClear();
+// Number of put* calls since fakePreferencesClear
+uint32_t fakePreferencesWriteCount();
@@ -0,0 +1,69 @@
+/*
+   Copyright 2022 Scott Bezek and the splitflap contributors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+#pragma once
+
+/**
+ * Stand-in for the Arduino String class, backed by std::string. Only has what the firmware code built in the native
+ * test environment uses.
+ */
+
+#include <string>
+
+class String {
+    public:
+        String() {}
+        String(const char* str) : value_(str == nullptr ? "" : str) {}
+
+        const char* c_str() const {
+            return value_.c_str();
+        }
+
+        unsigned int length() const {
+            return value_.length();
+        }
+
+        // Removes leading and trailing whitespace
+        void trim() {
+            const char* whitespace = " \t\r\n\f\v";
+            size_t start = value_.find_first_not_of(whitespace);
+            if (start == std::string::npos) {
+                value_.clear();
+                return;
+            }
+            value_ = value_.substr(start, value_.find_last_not_of(whitespace) - start + 1);
+        }
+
+        String& operator+=(const String& other) {
+            value_ += other.value_;
+            return *this;
+        }
+
+        bool operator==(const String& other) const {
+            return value_ == other.value_;
+        }
+        bool operator==(const char* other) const {
+            return value_ == (other == nullptr ? "" : other);
+        }
+        bool operator!=(const String& other) const {
+            return !(*this == other);
+        }
+        bool operator!=(const char* other) const {
+            return !(*this == other);
+        }
+
+    private:
+        std::string value_;
+};
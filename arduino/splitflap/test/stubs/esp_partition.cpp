@@ -0,0 +1,89 @@
+/*
+   Copyright 2022 Scott Bezek and the splitflap contributors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+#include "esp_partition.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+static esp_partition_t fake_partition = {};
+static uint8_t* fake_flash = nullptr;
+static uint32_t write_count = 0;
+static uint32_t bytes_written = 0;
+
+void fakePartitionInit(uint32_t size) {
+    free(fake_flash);
+    fake_flash = nullptr;
+    fake_partition = {};
+    write_count = 0;
+    bytes_written = 0;
+    if (size > 0) {
+        fake_flash = (uint8_t*)malloc(size);
+        memset(fake_flash, 0xFF, size);
+        fake_partition.type = ESP_PARTITION_TYPE_DATA;
+        fake_partition.size = size;
+    }
+}
+
+uint32_t fakePartitionWriteCount() {
+    return write_count;
+}
+
+uint32_t fakePartitionBytesWritten() {
+    return bytes_written;
+}
+
+const esp_partition_t* esp_partition_find_first(esp_partition_type_t type, esp_partition_subtype_t subtype, const char* label) {
+    if (fake_flash == nullptr || type != ESP_PARTITION_TYPE_DATA) {
+        return nullptr;
+    }
+    fake_partition.subtype = subtype;
+    strncpy(fake_partition.label, label, sizeof(fake_partition.label) - 1);
+    return &fake_partition;
+}
+
+esp_err_t esp_partition_mmap(const esp_partition_t* partition, size_t offset, size_t size, spi_flash_mmap_memory_t memory,
+        const void** out_ptr, spi_flash_mmap_handle_t* out_handle) {
+    if (offset + size > partition->size) {
+        return ESP_ERR_INVALID_SIZE;
+    }
+    *out_ptr = fake_flash + offset;
+    *out_handle = 1;
+    return ESP_OK;
+}
+
+esp_err_t esp_partition_write(const esp_partition_t* partition, size_t dst_offset, const void* src, size_t size) {
+    if (dst_offset + size > partition->size) {
+        return ESP_ERR_INVALID_SIZE;
+    }
+    const uint8_t* data = (const uint8_t*)src;
+    for (size_t i = 0; i < size; i++) {
+        fake_flash[dst_offset + i] &= data[i];
+    }
+    write_count++;
+    bytes_written += size;
+    return ESP_OK;
+}
+
+esp_err_t esp_partition_erase_range(const esp_partition_t* partition, size_t offset, size_t size) {
+    if (offset % SPI_FLASH_SEC_SIZE != 0 || size % SPI_FLASH_SEC_SIZE != 0) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    if (offset + size > partition->size) {
+        return ESP_ERR_INVALID_SIZE;
+    }
+    memset(fake_flash + offset, 0xFF, size);
+    return ESP_OK;
+}
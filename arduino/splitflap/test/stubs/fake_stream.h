@@ -0,0 +1,123 @@
+/*
+   Copyright 2022 Scott Bezek and the splitflap contributors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+#pragma once
+
+#include <Arduino.h>
+
+#include "../../esp32/core/chunked_stream.h"
+
+#define FAKE_STREAM_BUFFER_SIZE 16384
+
+/**
+ * In-memory ChunkedStream for running the serial protocols off-device. Bytes injected with receive() are handed to
+ * the protocol at most chunk_size at a time (like reads from the UART driver), and everything the protocol writes is
+ * collected until taken with takeOutput(). Fixed-size buffers, so it never allocates.
+ */
+class FakeStream : public ChunkedStream {
+    public:
+        FakeStream(size_t chunk_size = 256) : chunk_size_(chunk_size) {}
+
+        using Print::write;
+
+        // Makes data available to be read by the protocol
+        void receive(const uint8_t* data, size_t size) {
+            if (rx_start_ > 0 && rx_end_ + size > sizeof(rx_buffer_)) {
+                memmove(rx_buffer_, rx_buffer_ + rx_start_, rx_end_ - rx_start_);
+                rx_end_ -= rx_start_;
+                rx_start_ = 0;
+            }
+            assert(rx_end_ + size <= sizeof(rx_buffer_));
+            memcpy(rx_buffer_ + rx_end_, data, size);
+            rx_end_ += size;
+        }
+
+        // Copies up to size bytes written by the protocol into buffer (removing them from the stream), returning how
+        // many there were. With a null buffer they're just discarded.
+        size_t takeOutput(uint8_t* buffer, size_t size) {
+            size_t count = min(size, tx_size_);
+            if (buffer != nullptr) {
+                memcpy(buffer, tx_buffer_, count);
+            }
+            memmove(tx_buffer_, tx_buffer_ + count, tx_size_ - count);
+            tx_size_ -= count;
+            return count;
+        }
+
+        size_t outputSize() const {
+            return tx_size_;
+        }
+
+        // Totals since construction
+        uint64_t bytesRead() const {
+            return bytes_read_;
+        }
+
+        uint64_t bytesWritten() const {
+            return bytes_written_;
+        }
+
+        // ChunkedStream methods
+        size_t readInto(uint8_t* buffer, size_t size) override {
+            size_t count = min(min(size, chunk_size_), rx_end_ - rx_start_);
+            memcpy(buffer, rx_buffer_ + rx_start_, count);
+            rx_start_ += count;
+            bytes_read_ += count;
+            return count;
+        }
+
+        // Stream methods
+        int available() override {
+            return rx_end_ - rx_start_;
+        }
+
+        int read() override {
+            if (rx_start_ == rx_end_) {
+                return -1;
+            }
+            bytes_read_++;
+            return rx_buffer_[rx_start_++];
+        }
+
+        int peek() override {
+            return rx_start_ == rx_end_ ? -1 : rx_buffer_[rx_start_];
+        }
+
+        // Print methods
+        size_t write(uint8_t b) override {
+            return write(&b, 1);
+        }
+
+        size_t write(const uint8_t* buffer, size_t size) override {
+            assert(tx_size_ + size <= sizeof(tx_buffer_));
+            memcpy(tx_buffer_ + tx_size_, buffer, size);
+            tx_size_ += size;
+            bytes_written_ += size;
+            return size;
+        }
+
+    private:
+        const size_t chunk_size_;
+
+        uint8_t rx_buffer_[FAKE_STREAM_BUFFER_SIZE];
+        size_t rx_start_ = 0;
+        size_t rx_end_ = 0;
+
+        uint8_t tx_buffer_[FAKE_STREAM_BUFFER_SIZE];
+        size_t tx_size_ = 0;
+
+        uint64_t bytes_read_ = 0;
+        uint64_t bytes_written_ = 0;
+};
@@ -0,0 +1,87 @@
+/*
+   Copyright 2022 Scott Bezek and the splitflap contributors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+#include "proto_client.h"
+
+#include "pb_decode.h"
+#include "pb_encode.h"
+
+#include "../../esp32/splitflap/cobs_encoder.h"
+#include "../../esp32/splitflap/crc32.h"
+
+// Largest FromSplitflap frame the client accepts (state messages for every module are the largest)
+#define MAX_FROM_SPLITFLAP_FRAME_SIZE 4096
+
+size_t frameToSplitflap(const PB_ToSplitflap& message, uint8_t* buffer) {
+    uint8_t payload[PROTO_MAX_RX_PACKET_SIZE];
+    pb_ostream_t pb_stream = pb_ostream_from_buffer(payload, sizeof(payload) - 4);
+    if (!pb_encode(&pb_stream, PB_ToSplitflap_fields, &message)) {
+        return 0;
+    }
+
+    uint32_t crc = 0;
+    crc32(payload, pb_stream.bytes_written, &crc);
+    for (uint8_t i = 0; i < 4; i++) {
+        payload[pb_stream.bytes_written + i] = (crc >> (8 * i)) & 0xFF;
+    }
+
+    FakeStream framed;
+    CobsEncoder encoder(framed);
+    encoder.begin();
+    encoder.write(payload, pb_stream.bytes_written + 4);
+    encoder.end();
+    return framed.takeOutput(buffer, MAX_FRAMED_PACKET_SIZE);
+}
+
+bool sendToSplitflap(FakeStream& stream, const PB_ToSplitflap& message) {
+    uint8_t buffer[MAX_FRAMED_PACKET_SIZE];
+    size_t size = frameToSplitflap(message, buffer);
+    if (size == 0) {
+        return false;
+    }
+    stream.receive(buffer, size);
+    return true;
+}
+
+bool receiveFromSplitflap(FakeStream& stream, PB_FromSplitflap& message) {
+    bool decoded = false;
+    CobsDecoder<MAX_FROM_SPLITFLAP_FRAME_SIZE> decoder([&](const uint8_t* buffer, size_t size) {
+        if (size <= 4) {
+            return;
+        }
+        uint32_t provided_crc = buffer[size - 4]
+                             | (buffer[size - 3] << 8)
+                             | (buffer[size - 2] << 16)
+                             | (buffer[size - 1] << 24);
+        uint32_t crc = 0;
+        crc32(buffer, size - 4, &crc);
+        if (crc != provided_crc) {
+            return;
+        }
+
+        // Repeated fields (module states) are callbacks that are left unset, so they're skipped
+        message = {};
+        pb_istream_t pb_stream = pb_istream_from_buffer(buffer, size - 4);
+        decoded = pb_decode(&pb_stream, PB_FromSplitflap_fields, &message);
+    });
+
+    // A byte at a time, so nothing past the first valid packet is consumed
+    uint8_t b;
+    while (!decoded && stream.takeOutput(&b, 1) == 1) {
+        *decoder.rxBuffer() = b;
+        decoder.consume(1);
+    }
+    return decoded;
+}
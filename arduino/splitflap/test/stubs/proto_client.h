@@ -0,0 +1,40 @@
+/*
+   Copyright 2022 Scott Bezek and the splitflap contributors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+#pragma once
+
+#include "../../esp32/splitflap/cobs_decoder.h"
+#include "../../esp32/splitflap/serial_proto_protocol.h"
+
+#include "fake_stream.h"
+
+/**
+ * The client end of SerialProtoProtocol for tests, framing and unframing messages the way the Python and JS clients
+ * do (protobuf + CRC32 + COBS).
+ */
+
+#define MAX_FRAMED_PACKET_SIZE (COBS_MAX_ENCODED_SIZE(PROTO_MAX_RX_PACKET_SIZE) + 1)
+
+// Frames a ToSplitflap message into buffer, which must have room for MAX_FRAMED_PACKET_SIZE bytes. Returns the
+// framed size (including the delimiter), or 0 if the message couldn't be encoded.
+size_t frameToSplitflap(const PB_ToSplitflap& message, uint8_t* buffer);
+
+// Frames a ToSplitflap message and makes it available for the protocol to read from stream. Returns false if the
+// message couldn't be encoded.
+bool sendToSplitflap(FakeStream& stream, const PB_ToSplitflap& message);
+
+// Decodes the next FromSplitflap message the protocol wrote to stream, skipping anything that isn't a valid
+// packet. Returns false if there aren't any more.
+bool receiveFromSplitflap(FakeStream& stream, PB_FromSplitflap& message);
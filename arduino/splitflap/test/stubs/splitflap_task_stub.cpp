@@ -0,0 +1,82 @@
+/*
+   Copyright 2022 Scott Bezek and the splitflap contributors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+#include "splitflap_task_stub.h"
+
+SplitflapTaskStubCalls splitflap_task_stub_calls = {};
+
+void resetSplitflapTaskStub() {
+    splitflap_task_stub_calls = {};
+}
+
+SplitflapTask::SplitflapTask(const uint8_t task_core, const LedMode led_mode) : Task("Splitflap", 2048, 1, task_core), led_mode_(led_mode), state_semaphore_(xSemaphoreCreateMutex()) {
+    queue_ = nullptr;
+    logger_ = nullptr;
+    state_cache_ = {};
+
+    // Roughly what the real task estimates, so anything ordering by move time still sees distances matter
+    for (uint8_t i = 0; i <= NUM_FLAPS; i++) {
+        move_millis_[i] = i == 0 ? 0 : 100 + i * 45;
+    }
+}
+
+SplitflapTask::~SplitflapTask() {}
+
+void SplitflapTask::run() {}
+
+void SplitflapTask::log(const char* msg) {
+    if (logger_ != nullptr) {
+        logger_->log(msg);
+    }
+}
+
+void SplitflapTask::showMessage(const FlapMessage& message, bool force_full_rotation) {
+    splitflap_task_stub_calls.show_count++;
+}
+
+void SplitflapTask::showString(const char* str, uint8_t length, bool force_full_rotation) {
+    splitflap_task_stub_calls.show_count++;
+    size_t count = min((size_t)length, (size_t)NUM_MODULES);
+    memcpy(splitflap_task_stub_calls.last_string, str, count);
+    splitflap_task_stub_calls.last_string[count] = '\0';
+}
+
+void SplitflapTask::resetAll() {
+    splitflap_task_stub_calls.reset_count++;
+}
+
+void SplitflapTask::disableAll() {}
+
+void SplitflapTask::setLed(const uint8_t id, const bool on) {}
+
+void SplitflapTask::setSensorTest(bool sensor_test) {
+    splitflap_task_stub_calls.sensor_test_count++;
+    splitflap_task_stub_calls.sensor_test = sensor_test;
+}
+
+SplitflapState SplitflapTask::getState() {
+    return state_cache_;
+}
+
+void SplitflapTask::addStateChangeListener(TaskHandle_t task) {}
+
+void SplitflapTask::setLogger(Logger* logger) {
+    logger_ = logger;
+}
+
+void SplitflapTask::postRawCommand(Command command) {
+    splitflap_task_stub_calls.raw_command_count++;
+    splitflap_task_stub_calls.last_raw_command = command;
+}
@@ -0,0 +1,38 @@
+/*
+   Copyright 2022 Scott Bezek and the splitflap contributors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+#pragma once
+
+#include "../../esp32/core/splitflap_task.h"
+
+/**
+ * In the native test environment SplitflapTask is replaced by a stub (splitflap_task_stub.cpp) that has no modules
+ * or queue; it just records what it was asked to do here, for tests to check.
+ */
+struct SplitflapTaskStubCalls {
+    uint32_t raw_command_count;
+    Command last_raw_command;
+
+    uint32_t show_count;
+    char last_string[NUM_MODULES + 1];
+
+    uint32_t reset_count;
+    uint32_t sensor_test_count;
+    bool sensor_test;
+};
+
+extern SplitflapTaskStubCalls splitflap_task_stub_calls;
+
+void resetSplitflapTaskStub();
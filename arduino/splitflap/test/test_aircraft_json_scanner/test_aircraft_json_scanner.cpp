@@ -0,0 +1,166 @@
+/*
+   Copyright 2022 Scott Bezek and the splitflap contributors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+#include <Arduino.h>
+#include <unity.h>
+#include <vector>
+
+#include "../../esp32/splitflap/aircraft_json_scanner.h"
+
+// Trimmed down from a real readsb aircraft.json, with the kinds of fields (nested arrays and objects, escapes, fields
+// missing from some entries) that have to be skipped
+static const char* DOCUMENT = R"({ "now" : 1656633600.1,
+  "messages" : 123456,
+  "aircraft" : [
+    {"hex":"7c6b2d","type":"adsb_icao","flight":"QFA1    ","alt_baro":3000,"alt_geom":3125,"gs":210.5,
+     "lat":-33.942900,"lon":151.256200,"nic":8,"mlat":[],"tisb":["lat","lon"],"seen":0.1,"rssi":-12.3},
+    {"hex":"~2b1f0a","type":"tisb_other","alt_geom":-25,"lat":-33.95,"lon":151.18,
+     "acas_ra":{"lat":1.0,"flight":"NESTED"},"mlat":["alt_geom"]},
+    {"hex":"7c4a2b","flight":"JST\"501\\","lat":-34.1,"lon":151.0e0}
+  ],
+  "other" : [{"hex":"000000","flight":"IGNORED"}]
+}
+)";
+
+static std::vector<AircraftRecord> scanned;
+
+static void collect(const AircraftRecord& aircraft) {
+    scanned.push_back(aircraft);
+}
+
+static void assertDocumentScanned(const AircraftJsonScanner& scanner) {
+    TEST_ASSERT_FALSE(scanner.error());
+    TEST_ASSERT_EQUAL_UINT32(3, scanner.aircraftCount());
+    TEST_ASSERT_EQUAL_UINT32(3, scanned.size());
+
+    TEST_ASSERT_EQUAL_STRING("7c6b2d", scanned[0].hex);
+    TEST_ASSERT_TRUE(scanned[0].has_flight);
+    TEST_ASSERT_EQUAL_STRING("QFA1    ", scanned[0].flight);
+    TEST_ASSERT_EQUAL_FLOAT(3125, scanned[0].alt_geom);
+    TEST_ASSERT_EQUAL_FLOAT(-33.9429, scanned[0].lat);
+    TEST_ASSERT_EQUAL_FLOAT(151.2562, scanned[0].lon);
+
+    TEST_ASSERT_EQUAL_STRING("~2b1f0a", scanned[1].hex);
+    TEST_ASSERT_FALSE(scanned[1].has_flight);
+    TEST_ASSERT_EQUAL_STRING("", scanned[1].flight);
+    TEST_ASSERT_EQUAL_FLOAT(-25, scanned[1].alt_geom);
+    TEST_ASSERT_EQUAL_FLOAT(-33.95, scanned[1].lat);
+    TEST_ASSERT_EQUAL_FLOAT(151.18, scanned[1].lon);
+
+    TEST_ASSERT_EQUAL_STRING("7c4a2b", scanned[2].hex);
+    TEST_ASSERT_EQUAL_STRING("JST\"501\\", scanned[2].flight);
+    TEST_ASSERT_EQUAL_FLOAT(0, scanned[2].alt_geom);
+    TEST_ASSERT_EQUAL_FLOAT(-34.1, scanned[2].lat);
+    TEST_ASSERT_EQUAL_FLOAT(151.0, scanned[2].lon);
+}
+
+static void test_whole_document() {
+    scanned.clear();
+    AircraftJsonScanner scanner(collect);
+    scanner.consume(DOCUMENT, strlen(DOCUMENT));
+    assertDocumentScanned(scanner);
+}
+
+static void test_any_chunking() {
+    size_t length = strlen(DOCUMENT);
+    AircraftJsonScanner scanner(collect);
+
+    // Split in two at every position (including mid-token)...
+    for (size_t split = 0; split <= length; split++) {
+        scanned.clear();
+        scanner.reset();
+        scanner.consume(DOCUMENT, split);
+        scanner.consume(DOCUMENT + split, length - split);
+        assertDocumentScanned(scanner);
+    }
+
+    // ...and a byte at a time
+    scanned.clear();
+    scanner.reset();
+    for (size_t i = 0; i < length; i++) {
+        scanner.consume(DOCUMENT + i, 1);
+    }
+    assertDocumentScanned(scanner);
+}
+
+static void test_handler_called_as_entries_complete() {
+    scanned.clear();
+    AircraftJsonScanner scanner(collect);
+    const char* partial = strstr(DOCUMENT, "{\"hex\":\"~2b1f0a\"");
+    scanner.consume(DOCUMENT, partial - DOCUMENT);
+    TEST_ASSERT_EQUAL_UINT32(1, scanned.size());
+    TEST_ASSERT_EQUAL_STRING("7c6b2d", scanned[0].hex);
+}
+
+static void test_long_values_truncated() {
+    scanned.clear();
+    AircraftJsonScanner scanner(collect);
+    const char* document = R"({"aircraft":[{"hex":"0123456789abcdef","flight":"ABCDEFGHIJKLMNOPQRSTUVWXYZ0123456789",)"
+                           R"("lat":-33.942900000000000000000000000000000001}]})";
+    scanner.consume(document, strlen(document));
+    TEST_ASSERT_FALSE(scanner.error());
+    TEST_ASSERT_EQUAL_UINT32(1, scanned.size());
+    TEST_ASSERT_EQUAL_STRING("0123456", scanned[0].hex);
+    TEST_ASSERT_EQUAL_STRING("ABCDEFGHIJKLMNOPQRSTUVWXYZ01234", scanned[0].flight);
+    TEST_ASSERT_EQUAL_FLOAT(-33.9429, scanned[0].lat);
+}
+
+static void test_errors() {
+    scanned.clear();
+    AircraftJsonScanner scanner(collect);
+    const char* mismatched = R"({"aircraft":[{"hex":"7c6b2d"]})";
+    scanner.consume(mismatched, strlen(mismatched));
+    TEST_ASSERT_TRUE(scanner.error());
+    TEST_ASSERT_EQUAL_UINT32(0, scanned.size());
+
+    scanner.reset();
+    const char* unopened = "}";
+    scanner.consume(unopened, strlen(unopened));
+    TEST_ASSERT_TRUE(scanner.error());
+
+    scanner.reset();
+    char deep[AIRCRAFT_JSON_MAX_DEPTH + 2] = {};
+    memset(deep, '[', AIRCRAFT_JSON_MAX_DEPTH);
+    scanner.consume(deep, strlen(deep));
+    TEST_ASSERT_FALSE(scanner.error());
+    scanner.consume("[", 1);
+    TEST_ASSERT_TRUE(scanner.error());
+
+    // Usable again after a reset
+    scanner.reset();
+    scanner.consume(DOCUMENT, strlen(DOCUMENT));
+    assertDocumentScanned(scanner);
+}
+
+static void test_no_aircraft() {
+    scanned.clear();
+    AircraftJsonScanner scanner(collect);
+    const char* document = R"({"now":1656633600.1,"aircraft":[],"messages":1})";
+    scanner.consume(document, strlen(document));
+    TEST_ASSERT_FALSE(scanner.error());
+    TEST_ASSERT_EQUAL_UINT32(0, scanner.aircraftCount());
+    TEST_ASSERT_EQUAL_UINT32(0, scanned.size());
+}
+
+int main(int argc, char** argv) {
+    UNITY_BEGIN();
+    RUN_TEST(test_whole_document);
+    RUN_TEST(test_any_chunking);
+    RUN_TEST(test_handler_called_as_entries_complete);
+    RUN_TEST(test_long_values_truncated);
+    RUN_TEST(test_errors);
+    RUN_TEST(test_no_aircraft);
+    return UNITY_END();
+}
@@ -0,0 +1,89 @@
+/*
+   Copyright 2022 Scott Bezek and the splitflap contributors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+#include <Arduino.h>
+#include <unity.h>
+
+#include "../../esp32/splitflap/crc32.h"
+
+// Bit-at-a-time reference (zlib's polynomial, reflected)
+static uint32_t referenceCrc32(const uint8_t* data, size_t size) {
+    uint32_t crc = 0xFFFFFFFF;
+    for (size_t i = 0; i < size; i++) {
+        crc ^= data[i];
+        for (uint8_t bit = 0; bit < 8; bit++) {
+            crc = (crc >> 1) ^ (0xEDB88320 & -(crc & 1));
+        }
+    }
+    return ~crc;
+}
+
+static void fillPseudoRandom(uint8_t* buffer, size_t size) {
+    uint32_t x = 12345;
+    for (size_t i = 0; i < size; i++) {
+        x = x * 1103515245 + 12345;
+        buffer[i] = x >> 16;
+    }
+}
+
+static void test_known_values() {
+    uint32_t crc = 0;
+    crc32("", 0, &crc);
+    TEST_ASSERT_EQUAL_HEX32(0, crc);
+
+    crc = 0;
+    crc32("123456789", 9, &crc);
+    TEST_ASSERT_EQUAL_HEX32(0xCBF43926, crc);
+
+    crc = 0;
+    crc32("The quick brown fox jumps over the lazy dog", 43, &crc);
+    TEST_ASSERT_EQUAL_HEX32(0x414FA339, crc);
+}
+
+static void test_matches_reference() {
+    // Every length and alignment around the 8-byte slicing boundaries
+    uint8_t buffer[300];
+    fillPseudoRandom(buffer, sizeof(buffer));
+    for (size_t offset = 0; offset < 8; offset++) {
+        for (size_t size = 0; size + offset <= sizeof(buffer); size++) {
+            uint32_t crc = 0;
+            crc32(buffer + offset, size, &crc);
+            TEST_ASSERT_EQUAL_HEX32(referenceCrc32(buffer + offset, size), crc);
+        }
+    }
+}
+
+static void test_incremental() {
+    uint8_t buffer[1000];
+    fillPseudoRandom(buffer, sizeof(buffer));
+    uint32_t expected = referenceCrc32(buffer, sizeof(buffer));
+
+    // Uneven chunks, as the protocol code checksums data as it's encoded/decoded
+    for (size_t chunk = 1; chunk < 40; chunk++) {
+        uint32_t crc = 0;
+        for (size_t i = 0; i < sizeof(buffer); i += chunk) {
+            crc32(buffer + i, min(chunk, sizeof(buffer) - i), &crc);
+        }
+        TEST_ASSERT_EQUAL_HEX32(expected, crc);
+    }
+}
+
+int main(int argc, char** argv) {
+    UNITY_BEGIN();
+    RUN_TEST(test_known_values);
+    RUN_TEST(test_matches_reference);
+    RUN_TEST(test_incremental);
+    return UNITY_END();
+}
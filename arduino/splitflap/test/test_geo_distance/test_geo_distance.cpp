@@ -0,0 +1,170 @@
+/*
+   Copyright 2022 Scott Bezek and the splitflap contributors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+/**
+ * Checks GeoOrigin's single-precision range checks against the double-precision great_circle_distance(), and
+ * compares their speed on the host:
+ *
+ *   pio test -e native -f test_geo_distance -v
+ */
+#include <chrono>
+
+#include <Arduino.h>
+#include <unity.h>
+
+#include "../../esp32/splitflap/geo_distance.h"
+
+#define MAX_DISTANCE_KM 2.5f
+
+// Distances are compared to within this, which is a few ULPs of a float latitude/longitude
+#define TOLERANCE_KM 0.005
+
+// Positions closer to the boundary than this could go either way
+#define BOUNDARY_MARGIN_KM 0.01
+
+#define BENCHMARK_POSITIONS 1000000
+
+struct Home {
+    const char* name;
+    float latitude;
+    float longitude;
+};
+
+static const Home HOMES[] = {
+    {"Maroubra", -33.9429f, 151.2562f},
+    {"equator", 0.0f, 0.0f},
+    {"Helsinki", 60.1699f, 24.9384f},
+    {"Longyearbyen", 78.2232f, 15.6267f},
+    {"date line", -17.0f, 179.999f},
+    {"date line (west)", 52.0f, -179.999f},
+};
+
+static uint32_t random_state = 12345;
+
+// Uniform in [-1, 1)
+static float randomUnit() {
+    random_state = random_state * 1103515245 + 12345;
+    return (int32_t)(random_state >> 1) / (float)0x40000000 - 1;
+}
+
+static float wrapLongitude(float longitude) {
+    if (longitude >= 180) {
+        return longitude - 360;
+    }
+    if (longitude < -180) {
+        return longitude + 360;
+    }
+    return longitude;
+}
+
+// Fills positions with random points up to range_km (roughly) from home
+static void randomPositions(const Home& home, float range_km, float* latitudes, float* longitudes, size_t count) {
+    float d_lat = range_km / 111.2f;
+    float d_lon = d_lat / cosf(home.latitude * (float)M_PI / 180);
+    for (size_t i = 0; i < count; i++) {
+        latitudes[i] = home.latitude + d_lat * randomUnit();
+        longitudes[i] = wrapLongitude(home.longitude + d_lon * randomUnit());
+    }
+}
+
+static void test_matches_great_circle_distance() {
+    const size_t count = 20000;
+    static float latitudes[count];
+    static float longitudes[count];
+    for (const Home& home : HOMES) {
+        GeoOrigin origin(home.latitude, home.longitude, MAX_DISTANCE_KM);
+        randomPositions(home, 2 * MAX_DISTANCE_KM, latitudes, longitudes, count);
+
+        uint32_t within = 0;
+        double max_error = 0;
+        for (size_t i = 0; i < count; i++) {
+            double expected = great_circle_distance(home.latitude, home.longitude, latitudes[i], longitudes[i]);
+            float distance = origin.distanceWithin(latitudes[i], longitudes[i]);
+            if (expected < MAX_DISTANCE_KM - BOUNDARY_MARGIN_KM) {
+                TEST_ASSERT_TRUE(distance >= 0);
+                TEST_ASSERT_DOUBLE_WITHIN(TOLERANCE_KM, expected, distance);
+                max_error = max(max_error, fabs(distance - expected));
+                within++;
+            } else if (expected > MAX_DISTANCE_KM + BOUNDARY_MARGIN_KM) {
+                TEST_ASSERT_TRUE(distance < 0);
+            }
+        }
+        printf("%-18s %5u of %u within range, max error %.2f m\n", home.name, within, (unsigned)count,
+            max_error * 1000);
+
+        // About pi/16 of them
+        TEST_ASSERT_GREATER_THAN(count / 8, within);
+    }
+}
+
+static void test_far_away() {
+    GeoOrigin origin(HOMES[0].latitude, HOMES[0].longitude, MAX_DISTANCE_KM);
+    TEST_ASSERT_TRUE(origin.distanceWithin(51.47f, -0.4543f) < 0);
+    TEST_ASSERT_TRUE(origin.distanceWithin(-HOMES[0].latitude, HOMES[0].longitude) < 0);
+    TEST_ASSERT_TRUE(origin.distanceWithin(HOMES[0].latitude, HOMES[0].longitude - 180) < 0);
+
+    // Near a pole, the bounding box covers every longitude
+    GeoOrigin polar(89.99f, 0, MAX_DISTANCE_KM);
+    float distance = polar.distanceWithin(89.99f, 180);
+    TEST_ASSERT_TRUE(distance >= 0);
+    TEST_ASSERT_DOUBLE_WITHIN(TOLERANCE_KM, great_circle_distance(89.99f, 0, 89.99f, 180), distance);
+}
+
+typedef std::chrono::steady_clock Clock;
+
+static void test_benchmark() {
+    static float latitudes[BENCHMARK_POSITIONS];
+    static float longitudes[BENCHMARK_POSITIONS];
+    const Home& home = HOMES[0];
+    GeoOrigin origin(home.latitude, home.longitude, MAX_DISTANCE_KM);
+
+    // Like a receiver's aircraft.json, almost everything is well out of range: within ~300km
+    randomPositions(home, 300, latitudes, longitudes, BENCHMARK_POSITIONS);
+
+    uint32_t geo_origin_within = 0;
+    Clock::time_point start = Clock::now();
+    for (size_t i = 0; i < BENCHMARK_POSITIONS; i++) {
+        if (origin.distanceWithin(latitudes[i], longitudes[i]) >= 0) {
+            geo_origin_within++;
+        }
+    }
+    double geo_origin_seconds = std::chrono::duration<double>(Clock::now() - start).count();
+
+    uint32_t great_circle_within = 0;
+    start = Clock::now();
+    for (size_t i = 0; i < BENCHMARK_POSITIONS; i++) {
+        if (great_circle_distance(home.latitude, home.longitude, latitudes[i], longitudes[i]) <= MAX_DISTANCE_KM) {
+            great_circle_within++;
+        }
+    }
+    double great_circle_seconds = std::chrono::duration<double>(Clock::now() - start).count();
+
+    printf("GeoOrigin::distanceWithin  %6.1f ns/position (%u within range)\n",
+        geo_origin_seconds * 1e9 / BENCHMARK_POSITIONS, geo_origin_within);
+    printf("great_circle_distance      %6.1f ns/position (%u within range)\n",
+        great_circle_seconds * 1e9 / BENCHMARK_POSITIONS, great_circle_within);
+
+    TEST_ASSERT_UINT32_WITHIN(2, great_circle_within, geo_origin_within);
+    TEST_ASSERT_TRUE(geo_origin_seconds < great_circle_seconds);
+}
+
+int main(int argc, char** argv) {
+    UNITY_BEGIN();
+    RUN_TEST(test_matches_great_circle_distance);
+    RUN_TEST(test_far_away);
+    RUN_TEST(test_benchmark);
+    return UNITY_END();
+}
@@ -0,0 +1,270 @@
+/*
+   Copyright 2022 Scott Bezek and the splitflap contributors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+#include <Arduino.h>
+#include <unity.h>
+#include <algorithm>
+#include <string>
+
+#include "../../esp32/splitflap/http_request_parser.h"
+
+// Feeds data in chunks of at most chunk_size bytes (as a connection might deliver it), stopping once the parser
+// does. used is set to the total consumed.
+static HttpParseResult feed(HttpRequestParser& parser, const std::string& data, size_t chunk_size, size_t* used) {
+    HttpParseResult result = HttpParseResult::INCOMPLETE;
+    size_t offset = 0;
+    while (offset < data.size() && result == HttpParseResult::INCOMPLETE) {
+        size_t length = std::min(chunk_size, data.size() - offset);
+        size_t chunk_used;
+        result = parser.consume(data.data() + offset, length, &chunk_used);
+        offset += chunk_used;
+    }
+    *used = offset;
+    return result;
+}
+
+static HttpParseResult parse(HttpRequestParser& parser, const std::string& data) {
+    size_t used;
+    parser.reset();
+    return feed(parser, data, data.size(), &used);
+}
+
+static void test_get() {
+    HttpRequestParser parser;
+    TEST_ASSERT_FALSE(parser.inProgress());
+
+    std::string request = "GET /state HTTP/1.1\r\nHost: splitflap\r\nAccept: */*\r\n\r\n";
+    size_t used;
+    TEST_ASSERT_TRUE(HttpParseResult::COMPLETE == feed(parser, request, request.size(), &used));
+    TEST_ASSERT_EQUAL(request.size(), used);
+    TEST_ASSERT_EQUAL_STRING("GET", parser.method());
+    TEST_ASSERT_EQUAL_STRING("/state", parser.path());
+    TEST_ASSERT_EQUAL(0, parser.bodyLength());
+    TEST_ASSERT_EQUAL_STRING("", parser.body());
+    TEST_ASSERT_TRUE(parser.keepAlive());
+    TEST_ASSERT_TRUE(parser.inProgress());
+
+    parser.reset();
+    TEST_ASSERT_FALSE(parser.inProgress());
+}
+
+static void test_split_delivery() {
+    // Every chunk size, including one byte at a time, which splits the header terminator and the body
+    std::string request = "POST /text?align=right HTTP/1.1\r\nContent-Length: 11\r\nContent-Type: text/plain\r\n\r\nhello world";
+    for (size_t chunk_size = 1; chunk_size <= request.size(); chunk_size++) {
+        HttpRequestParser parser;
+        size_t used;
+        TEST_ASSERT_TRUE(HttpParseResult::INCOMPLETE
+            == feed(parser, request.substr(0, request.size() - 1), chunk_size, &used));
+        TEST_ASSERT_EQUAL(request.size() - 1, used);
+        TEST_ASSERT_TRUE(parser.inProgress());
+
+        size_t last_used;
+        TEST_ASSERT_TRUE(HttpParseResult::COMPLETE == parser.consume(request.data() + used, 1, &last_used));
+        TEST_ASSERT_EQUAL(1, last_used);
+        TEST_ASSERT_EQUAL_STRING("POST", parser.method());
+        TEST_ASSERT_EQUAL_STRING("/text", parser.path());
+        TEST_ASSERT_EQUAL(11, parser.bodyLength());
+        TEST_ASSERT_EQUAL_STRING("hello world", parser.body());
+    }
+}
+
+static void test_chunked_delivery_of_pipelined_requests() {
+    // Chunks that straddle the two requests: the parser stops at the end of the first, leaving the rest unused
+    std::string first = "POST /flaps HTTP/1.1\r\nContent-Length: 5\r\n\r\n0,,12";
+    std::string second = "GET /state HTTP/1.1\r\n\r\n";
+    std::string data = first + second;
+    for (size_t chunk_size = 1; chunk_size <= data.size(); chunk_size++) {
+        HttpRequestParser parser;
+        size_t used;
+        TEST_ASSERT_TRUE(HttpParseResult::COMPLETE == feed(parser, data, chunk_size, &used));
+        TEST_ASSERT_EQUAL(first.size(), used);
+        TEST_ASSERT_EQUAL_STRING("/flaps", parser.path());
+        TEST_ASSERT_EQUAL_STRING("0,,12", parser.body());
+
+        parser.reset();
+        size_t second_used;
+        TEST_ASSERT_TRUE(HttpParseResult::COMPLETE == feed(parser, data.substr(used), chunk_size, &second_used));
+        TEST_ASSERT_EQUAL(second.size(), second_used);
+        TEST_ASSERT_EQUAL_STRING("GET", parser.method());
+        TEST_ASSERT_EQUAL_STRING("/state", parser.path());
+        TEST_ASSERT_EQUAL(0, parser.bodyLength());
+    }
+}
+
+static void test_pipelined_requests() {
+    std::string requests[] = {
+        "POST /reset HTTP/1.1\r\nContent-Length: 0\r\n\r\n",
+        "POST /text HTTP/1.1\r\nContent-Length: 2\r\n\r\nhi",
+        "GET /state HTTP/1.1\r\nConnection: close\r\n\r\n",
+    };
+    std::string data = requests[0] + requests[1] + requests[2];
+
+    HttpRequestParser parser;
+    size_t offset = 0;
+    for (const std::string& request : requests) {
+        parser.reset();
+        size_t used;
+        TEST_ASSERT_TRUE(HttpParseResult::COMPLETE
+            == parser.consume(data.data() + offset, data.size() - offset, &used));
+        TEST_ASSERT_EQUAL(request.size(), used);
+        offset += used;
+    }
+    TEST_ASSERT_EQUAL(data.size(), offset);
+    TEST_ASSERT_EQUAL_STRING("/state", parser.path());
+    TEST_ASSERT_FALSE(parser.keepAlive());
+}
+
+static void test_content_length_bounds() {
+    HttpRequestParser parser;
+    std::string headers = "POST /text HTTP/1.1\r\nContent-Length: ";
+
+    // A body that exactly fills the buffer
+    std::string header_end = "\r\n\r\n";
+    size_t header_length = headers.size() + 3 + header_end.size();
+    size_t max_body_length = HTTP_MAX_REQUEST_LENGTH - header_length;
+    std::string request = headers + std::to_string(max_body_length) + header_end + std::string(max_body_length, 'a');
+    TEST_ASSERT_EQUAL(HTTP_MAX_REQUEST_LENGTH, request.size());
+    TEST_ASSERT_TRUE(HttpParseResult::COMPLETE == parse(parser, request));
+    TEST_ASSERT_EQUAL(max_body_length, parser.bodyLength());
+    TEST_ASSERT_EQUAL(max_body_length, strlen(parser.body()));
+
+    // One byte more is rejected as soon as the headers are in, without waiting for the body
+    parser.reset();
+    std::string too_long_headers = headers + std::to_string(max_body_length + 1) + header_end;
+    size_t used;
+    TEST_ASSERT_TRUE(HttpParseResult::TOO_LARGE == feed(parser, too_long_headers, 1, &used));
+    TEST_ASSERT_EQUAL(too_long_headers.size(), used);
+
+    // As are lengths that don't fit in the buffer at all
+    TEST_ASSERT_TRUE(HttpParseResult::TOO_LARGE == parse(parser, headers + "4294967296" + header_end));
+
+    // Headers that never end
+    std::string endless = "GET /state HTTP/1.1\r\nX-Padding: " + std::string(HTTP_MAX_REQUEST_LENGTH, 'x');
+    parser.reset();
+    TEST_ASSERT_TRUE(HttpParseResult::TOO_LARGE == feed(parser, endless, 100, &used));
+    TEST_ASSERT_EQUAL(HTTP_MAX_REQUEST_LENGTH, used);
+
+    // Malformed lengths
+    TEST_ASSERT_TRUE(HttpParseResult::ERROR == parse(parser, headers + "-1" + header_end));
+    TEST_ASSERT_TRUE(HttpParseResult::ERROR == parse(parser, headers + "abc" + header_end));
+    TEST_ASSERT_TRUE(HttpParseResult::ERROR == parse(parser, headers + header_end));
+
+    // Header names are case-insensitive, and whitespace before the value is skipped
+    TEST_ASSERT_TRUE(HttpParseResult::COMPLETE == parse(parser, "POST /text HTTP/1.1\r\ncontent-length:\t 3\r\n\r\nabc"));
+    TEST_ASSERT_EQUAL_STRING("abc", parser.body());
+}
+
+static void test_transfer_encoding_rejected() {
+    HttpRequestParser parser;
+    TEST_ASSERT_TRUE(HttpParseResult::ERROR
+        == parse(parser, "POST /text HTTP/1.1\r\nTransfer-Encoding: chunked\r\n\r\n5\r\nhello\r\n0\r\n\r\n"));
+    TEST_ASSERT_TRUE(HttpParseResult::ERROR
+        == parse(parser, "POST /text HTTP/1.1\r\ntransfer-encoding: identity\r\nContent-Length: 2\r\n\r\nhi"));
+}
+
+static void test_keep_alive() {
+    HttpRequestParser parser;
+
+    // Persistent by default from HTTP/1.1 only
+    TEST_ASSERT_TRUE(HttpParseResult::COMPLETE == parse(parser, "GET /state HTTP/1.1\r\n\r\n"));
+    TEST_ASSERT_TRUE(parser.keepAlive());
+    TEST_ASSERT_TRUE(HttpParseResult::COMPLETE == parse(parser, "GET /state HTTP/1.0\r\n\r\n"));
+    TEST_ASSERT_FALSE(parser.keepAlive());
+
+    // Unless the client says otherwise
+    TEST_ASSERT_TRUE(HttpParseResult::COMPLETE == parse(parser, "GET /state HTTP/1.1\r\nConnection: close\r\n\r\n"));
+    TEST_ASSERT_FALSE(parser.keepAlive());
+    TEST_ASSERT_TRUE(HttpParseResult::COMPLETE == parse(parser, "GET /state HTTP/1.0\r\nConnection: Keep-Alive\r\n\r\n"));
+    TEST_ASSERT_TRUE(parser.keepAlive());
+    TEST_ASSERT_TRUE(HttpParseResult::COMPLETE == parse(parser, "GET /state HTTP/1.1\r\nCONNECTION: Close\r\n\r\n"));
+    TEST_ASSERT_FALSE(parser.keepAlive());
+
+    // Other values (e.g. Upgrade) leave the default
+    TEST_ASSERT_TRUE(HttpParseResult::COMPLETE == parse(parser, "GET /state HTTP/1.0\r\nConnection: Upgrade\r\n\r\n"));
+    TEST_ASSERT_FALSE(parser.keepAlive());
+
+    // reset() goes back to the default for the next request
+    parser.reset();
+    TEST_ASSERT_TRUE(parser.keepAlive());
+}
+
+static void test_malformed_requests() {
+    HttpRequestParser parser;
+    TEST_ASSERT_TRUE(HttpParseResult::ERROR == parse(parser, "GET\r\n\r\n"));
+    TEST_ASSERT_TRUE(HttpParseResult::ERROR == parse(parser, "GET /state\r\n\r\n"));
+    TEST_ASSERT_TRUE(HttpParseResult::ERROR == parse(parser, "GET /state HTTP/2.0\r\n\r\n"));
+    TEST_ASSERT_TRUE(HttpParseResult::ERROR == parse(parser, "GET /state HTTP/1.1\r\nNo colon\r\n\r\n"));
+}
+
+static void test_query_params() {
+    HttpRequestParser parser;
+    TEST_ASSERT_TRUE(HttpParseResult::COMPLETE
+        == parse(parser, "POST /text?align=center&force&empty=&alignment=left&a%20b=c+d HTTP/1.1\r\n\r\n"));
+    TEST_ASSERT_EQUAL_STRING("/text", parser.path());
+
+    char value[16];
+    TEST_ASSERT_TRUE(parser.queryParam("align", value, sizeof(value)));
+    TEST_ASSERT_EQUAL_STRING("center", value);
+    TEST_ASSERT_TRUE(parser.queryParam("alignment", value, sizeof(value)));
+    TEST_ASSERT_EQUAL_STRING("left", value);
+
+    // Present without a value, or with an empty one
+    strcpy(value, "x");
+    TEST_ASSERT_TRUE(parser.queryParam("force", value, sizeof(value)));
+    TEST_ASSERT_EQUAL_STRING("", value);
+    strcpy(value, "x");
+    TEST_ASSERT_TRUE(parser.queryParam("empty", value, sizeof(value)));
+    TEST_ASSERT_EQUAL_STRING("", value);
+
+    // Names must match exactly, not as a prefix
+    TEST_ASSERT_FALSE(parser.queryParam("alig", value, sizeof(value)));
+    TEST_ASSERT_FALSE(parser.queryParam("forced", value, sizeof(value)));
+    TEST_ASSERT_FALSE(parser.queryParam("missing", value, sizeof(value)));
+
+    // Not URL-decoded
+    TEST_ASSERT_TRUE(parser.queryParam("a%20b", value, sizeof(value)));
+    TEST_ASSERT_EQUAL_STRING("c+d", value);
+
+    // Truncated to fit
+    char small[4];
+    TEST_ASSERT_TRUE(parser.queryParam("align", small, sizeof(small)));
+    TEST_ASSERT_EQUAL_STRING("cen", small);
+
+    // No query string, or an empty one
+    TEST_ASSERT_TRUE(HttpParseResult::COMPLETE == parse(parser, "POST /text HTTP/1.1\r\n\r\n"));
+    TEST_ASSERT_FALSE(parser.queryParam("align", value, sizeof(value)));
+    TEST_ASSERT_TRUE(HttpParseResult::COMPLETE == parse(parser, "POST /text? HTTP/1.1\r\n\r\n"));
+    TEST_ASSERT_EQUAL_STRING("/text", parser.path());
+    TEST_ASSERT_FALSE(parser.queryParam("align", value, sizeof(value)));
+
+    // Empty parameters are skipped over
+    TEST_ASSERT_TRUE(HttpParseResult::COMPLETE == parse(parser, "POST /text?&&force HTTP/1.1\r\n\r\n"));
+    TEST_ASSERT_TRUE(parser.queryParam("force", value, sizeof(value)));
+}
+
+int main(int argc, char **argv) {
+    UNITY_BEGIN();
+    RUN_TEST(test_get);
+    RUN_TEST(test_split_delivery);
+    RUN_TEST(test_chunked_delivery_of_pipelined_requests);
+    RUN_TEST(test_pipelined_requests);
+    RUN_TEST(test_content_length_bounds);
+    RUN_TEST(test_transfer_encoding_rejected);
+    RUN_TEST(test_keep_alive);
+    RUN_TEST(test_malformed_requests);
+    RUN_TEST(test_query_params);
+    return UNITY_END();
+}
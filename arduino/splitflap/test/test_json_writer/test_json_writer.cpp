@@ -0,0 +1,108 @@
+/*
+   Copyright 2022 Scott Bezek and the splitflap contributors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+#include <Arduino.h>
+#include <unity.h>
+#include <string>
+
+#include "../../esp32/splitflap/json_writer.h"
+
+static std::string output(const JsonWriter& writer) {
+    return std::string(writer.buffer(), writer.length());
+}
+
+static void test_raw_and_numbers() {
+    char buffer[100];
+    JsonWriter writer(buffer, sizeof(buffer));
+    writer.raw('[').number(0).raw(',').number(7).raw(',').number(-1).raw(',').number(INT32_MAX).raw(',')
+        .number(INT32_MIN).raw("]");
+    TEST_ASSERT_FALSE(writer.overflowed());
+    TEST_ASSERT_EQUAL_STRING("[0,7,-1,2147483647,-2147483648]", output(writer).c_str());
+}
+
+static void test_string_escaping() {
+    char buffer[100];
+    JsonWriter writer(buffer, sizeof(buffer));
+    writer.string("a \"quoted\" \\path\\\n\r\t\x01\x1f\x7f ok");
+    TEST_ASSERT_FALSE(writer.overflowed());
+    TEST_ASSERT_EQUAL_STRING("\"a \\\"quoted\\\" \\\\path\\\\\\n\\r\\t\\u0001\\u001f\x7f ok\"", output(writer).c_str());
+
+    // Bytes >= 0x80 (e.g. UTF-8) pass through
+    JsonWriter utf8(buffer, sizeof(buffer));
+    utf8.string("caf\xc3\xa9");
+    TEST_ASSERT_EQUAL_STRING("\"caf\xc3\xa9\"", output(utf8).c_str());
+
+    JsonWriter chars(buffer, sizeof(buffer));
+    chars.string('a').raw(',').string('"').raw(',').string('\0');
+    TEST_ASSERT_EQUAL_STRING("\"a\",\"\\\"\",\"\\u0000\"", output(chars).c_str());
+}
+
+static void test_string_truncation() {
+    char buffer[100];
+    JsonWriter writer(buffer, sizeof(buffer));
+    writer.string("hello world", 5).raw(',').string("hi", 5).raw(',').string("\"\"\"\"", 2);
+    TEST_ASSERT_EQUAL_STRING("\"hello\",\"hi\",\"\\\"\\\"\"", output(writer).c_str());
+}
+
+static void test_worst_case_string_length() {
+    char value[33] = {};
+    memset(value, 0x01, sizeof(value) - 1);
+    char buffer[JSON_MAX_STRING_LENGTH(sizeof(value) - 1)];
+    JsonWriter writer(buffer, sizeof(buffer));
+    writer.string(value);
+    TEST_ASSERT_FALSE(writer.overflowed());
+    TEST_ASSERT_EQUAL_UINT32(sizeof(buffer), writer.length());
+}
+
+static void test_overflow() {
+    // The writer is given 10 bytes of a larger buffer, to check nothing is written past them
+    char buffer[16];
+    memset(buffer, 'x', sizeof(buffer));
+    JsonWriter writer(buffer, 10);
+    writer.raw("12345678");
+    TEST_ASSERT_FALSE(writer.overflowed());
+
+    // Whatever doesn't fit is dropped entirely, as is anything after it (even if it would have fit)
+    writer.raw("abc");
+    TEST_ASSERT_TRUE(writer.overflowed());
+    writer.raw('9').number(1).string("");
+    TEST_ASSERT_TRUE(writer.overflowed());
+    TEST_ASSERT_EQUAL_STRING("12345678", output(writer).c_str());
+    for (size_t i = 8; i < sizeof(buffer); i++) {
+        TEST_ASSERT_EQUAL_UINT8('x', buffer[i]);
+    }
+
+    // Exactly full is fine
+    JsonWriter full(buffer, 10);
+    full.raw("12345678").number(90);
+    TEST_ASSERT_FALSE(full.overflowed());
+    TEST_ASSERT_EQUAL_STRING("1234567890", output(full).c_str());
+
+    // An escape sequence that only partly fits is dropped whole
+    JsonWriter escape(buffer, 10);
+    escape.raw("1234").string("\x01");
+    TEST_ASSERT_TRUE(escape.overflowed());
+    TEST_ASSERT_EQUAL_STRING("1234\"", output(escape).c_str());
+}
+
+int main(int argc, char** argv) {
+    UNITY_BEGIN();
+    RUN_TEST(test_raw_and_numbers);
+    RUN_TEST(test_string_escaping);
+    RUN_TEST(test_string_truncation);
+    RUN_TEST(test_worst_case_string_length);
+    RUN_TEST(test_overflow);
+    return UNITY_END();
+}
@@ -0,0 +1,192 @@
+/*
+   Copyright 2022 Scott Bezek and the splitflap contributors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+#include <Arduino.h>
+#include <Preferences.h>
+#include <unity.h>
+
+#include "../../esp32/splitflap/route_cache.h"
+
+#define SECONDS_PER_DAY (24 * 60 * 60)
+
+static const time_t START_TIME = 1656633600; // 2022-07-01
+
+static void reset() {
+    fakePreferencesClear();
+    setFakeTime(START_TIME);
+}
+
+static void advanceSeconds(uint32_t seconds) {
+    advanceMillis(seconds * 1000);
+}
+
+static void test_hit_and_miss() {
+    reset();
+    RouteCache cache;
+
+    TEST_ASSERT_NULL(cache.lookup("QFA1"));
+    cache.insert("QFA1", "QF1", "SYD", "LHR");
+
+    // dump1090 pads callsigns
+    const RouteCacheEntry* entry = cache.lookup("QFA1    ");
+    TEST_ASSERT_NOT_NULL(entry);
+    TEST_ASSERT_TRUE(entry->has_route);
+    TEST_ASSERT_EQUAL_STRING("QFA1", entry->callsign);
+    TEST_ASSERT_EQUAL_STRING("QF1", entry->callsign_iata);
+    TEST_ASSERT_EQUAL_STRING("SYD", entry->origin);
+    TEST_ASSERT_EQUAL_STRING("LHR", entry->destination);
+
+    TEST_ASSERT_NULL(cache.lookup("QFA2"));
+
+    const RouteCacheStats& stats = cache.getStats();
+    TEST_ASSERT_EQUAL_UINT32(1, stats.hits);
+    TEST_ASSERT_EQUAL_UINT32(0, stats.negative_hits);
+    TEST_ASSERT_EQUAL_UINT32(2, stats.misses);
+    TEST_ASSERT_EQUAL_UINT32(0, stats.evictions);
+}
+
+static void test_negative_entries() {
+    reset();
+    RouteCache cache;
+
+    cache.insertNegative("N12345");
+    const RouteCacheEntry* entry = cache.lookup("N12345");
+    TEST_ASSERT_NOT_NULL(entry);
+    TEST_ASSERT_FALSE(entry->has_route);
+    TEST_ASSERT_EQUAL_UINT32(1, cache.getStats().negative_hits);
+    TEST_ASSERT_EQUAL_UINT32(0, cache.getStats().hits);
+
+    // A route found later replaces the negative entry
+    cache.insert("N12345", "", "SFO", "LAX");
+    entry = cache.lookup("N12345");
+    TEST_ASSERT_NOT_NULL(entry);
+    TEST_ASSERT_TRUE(entry->has_route);
+    TEST_ASSERT_EQUAL_STRING("SFO", entry->origin);
+}
+
+static void test_expiry() {
+    reset();
+    RouteCache cache;
+    cache.insert("QFA1", "QF1", "SYD", "LHR");
+    cache.insertNegative("N12345");
+
+    advanceSeconds(ROUTE_CACHE_NEGATIVE_TTL_SECONDS);
+    TEST_ASSERT_NOT_NULL(cache.lookup("N12345"));
+    advanceSeconds(1);
+    TEST_ASSERT_NULL(cache.lookup("N12345"));
+    TEST_ASSERT_NOT_NULL(cache.lookup("QFA1"));
+
+    advanceSeconds(ROUTE_CACHE_TTL_SECONDS - ROUTE_CACHE_NEGATIVE_TTL_SECONDS);
+    TEST_ASSERT_NULL(cache.lookup("QFA1"));
+}
+
+static void test_clock_not_set() {
+    reset();
+    // Before SNTP, time() counts up from boot
+    setFakeTime(60);
+    RouteCache cache;
+    cache.insert("QFA1", "QF1", "SYD", "LHR");
+
+    // Trusted however long it takes for the clock to be set...
+    advanceSeconds(ROUTE_CACHE_TTL_SECONDS + 1);
+    TEST_ASSERT_NOT_NULL(cache.lookup("QFA1"));
+
+    // ...but then it's impossible to know how old it is, so it's looked up again
+    setFakeTime(START_TIME);
+    TEST_ASSERT_NULL(cache.lookup("QFA1"));
+}
+
+static void test_lru_eviction() {
+    reset();
+    RouteCache cache;
+    char callsign[ROUTE_CALLSIGN_MAX_LENGTH + 1];
+    for (uint8_t i = 0; i < ROUTE_CACHE_SIZE; i++) {
+        snprintf(callsign, sizeof(callsign), "TST%u", i);
+        cache.insert(callsign, "", "AAA", "BBB");
+    }
+    TEST_ASSERT_EQUAL_UINT32(0, cache.getStats().evictions);
+
+    // TST0 is the oldest insert, but a hit makes TST1 the least recently used
+    TEST_ASSERT_NOT_NULL(cache.lookup("TST0"));
+    cache.insert("NEW1", "", "CCC", "DDD");
+    TEST_ASSERT_EQUAL_UINT32(1, cache.getStats().evictions);
+    TEST_ASSERT_NULL(cache.lookup("TST1"));
+    TEST_ASSERT_NOT_NULL(cache.lookup("TST0"));
+    TEST_ASSERT_NOT_NULL(cache.lookup("NEW1"));
+
+    // Updating an entry that's already cached doesn't evict anything
+    cache.insert("TST2", "", "EEE", "FFF");
+    TEST_ASSERT_EQUAL_UINT32(1, cache.getStats().evictions);
+    for (uint8_t i = 2; i < ROUTE_CACHE_SIZE; i++) {
+        snprintf(callsign, sizeof(callsign), "TST%u", i);
+        TEST_ASSERT_NOT_NULL(cache.lookup(callsign));
+    }
+}
+
+static void test_persists_across_reboots() {
+    reset();
+    {
+        RouteCache cache;
+        cache.insert("QFA1", "QF1", "SYD", "LHR");
+        cache.insertNegative("N12345");
+    }
+    TEST_ASSERT_EQUAL_UINT32(4, fakePreferencesWriteCount());
+
+    RouteCache cache;
+    const RouteCacheEntry* entry = cache.lookup("QFA1");
+    TEST_ASSERT_NOT_NULL(entry);
+    TEST_ASSERT_EQUAL_STRING("LHR", entry->destination);
+    entry = cache.lookup("N12345");
+    TEST_ASSERT_NOT_NULL(entry);
+    TEST_ASSERT_FALSE(entry->has_route);
+
+    // Hits aren't written to flash
+    TEST_ASSERT_EQUAL_UINT32(4, fakePreferencesWriteCount());
+
+    // Expiry uses the wall clock, so it carries on across reboots
+    advanceSeconds(ROUTE_CACHE_NEGATIVE_TTL_SECONDS + 1);
+    RouteCache rebooted;
+    TEST_ASSERT_NOT_NULL(rebooted.lookup("QFA1"));
+    TEST_ASSERT_NULL(rebooted.lookup("N12345"));
+}
+
+static void test_ignores_other_versions() {
+    reset();
+    {
+        RouteCache cache;
+        cache.insert("QFA1", "QF1", "SYD", "LHR");
+    }
+
+    // As saved by firmware with a different RouteCacheEntry layout
+    Preferences preferences;
+    preferences.begin("route_cache", false);
+    preferences.putUChar("version", 0);
+    preferences.end();
+
+    RouteCache cache;
+    TEST_ASSERT_NULL(cache.lookup("QFA1"));
+}
+
+int main(int argc, char** argv) {
+    UNITY_BEGIN();
+    RUN_TEST(test_hit_and_miss);
+    RUN_TEST(test_negative_entries);
+    RUN_TEST(test_expiry);
+    RUN_TEST(test_clock_not_set);
+    RUN_TEST(test_lru_eviction);
+    RUN_TEST(test_persists_across_reboots);
+    RUN_TEST(test_ignores_other_versions);
+    return UNITY_END();
+}
@@ -0,0 +1,228 @@
+/*
+   Copyright 2022 Scott Bezek and the splitflap contributors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+#include <Arduino.h>
+#include <unity.h>
+#include <string>
+
+#include "../../esp32/splitflap/sbs_aircraft_table.h"
+
+// Anything north of this latitude counts as nearby
+#define NEARBY_LATITUDE -34.0f
+
+static bool isNearby(const AircraftRecord& aircraft) {
+    return aircraft.lat > NEARBY_LATITUDE;
+}
+
+// An SBS-1 MSG line, as sent by dump1090 (only the fields the table uses are filled in)
+static std::string msg(uint8_t transmission_type, const char* hex, const char* callsign, const char* altitude,
+        const char* lat, const char* lon) {
+    char line[200];
+    snprintf(line, sizeof(line), "MSG,%u,1,1,%s,1,2022/07/01,10:00:00.000,2022/07/01,10:00:00.000,%s,%s,,,%s,%s,,,0,0,0,0\r\n",
+        transmission_type, hex, callsign, altitude, lat, lon);
+    return line;
+}
+
+static void feed(SbsAircraftTable& table, const std::string& data, uint32_t now_millis) {
+    table.consume(data.c_str(), data.length(), now_millis);
+}
+
+// Finds hex in the table (among aircraft with a position), copying it to aircraft. Returns false if it isn't there.
+static bool find(const SbsAircraftTable& table, const char* hex, AircraftRecord& aircraft) {
+    bool found = false;
+    table.forEach([&](const AircraftRecord& record) {
+        if (strcmp(record.hex, hex) == 0) {
+            aircraft = record;
+            found = true;
+        }
+    });
+    return found;
+}
+
+static void test_updates_from_messages() {
+    SbsAircraftTable table(isNearby);
+    AircraftRecord aircraft;
+
+    // Identification, then altitude, without a position yet
+    feed(table, msg(1, "7C6B2D", "QFA1    ", "", "", ""), 0);
+    feed(table, msg(5, "7C6B2D", "", "3000", "", ""), 0);
+    TEST_ASSERT_EQUAL_UINT32(1, table.size());
+    TEST_ASSERT_FALSE(find(table, "7C6B2D", aircraft));
+
+    feed(table, msg(3, "7C6B2D", "", "3025", "-33.94290", "151.25620"), 0);
+    TEST_ASSERT_TRUE(find(table, "7C6B2D", aircraft));
+    TEST_ASSERT_TRUE(aircraft.has_flight);
+    TEST_ASSERT_EQUAL_STRING("QFA1    ", aircraft.flight);
+    TEST_ASSERT_EQUAL_FLOAT(3025, aircraft.alt_geom);
+    TEST_ASSERT_EQUAL_FLOAT(-33.9429, aircraft.lat);
+    TEST_ASSERT_EQUAL_FLOAT(151.2562, aircraft.lon);
+
+    // Empty fields leave what's known alone
+    feed(table, msg(4, "7C6B2D", "", "", "", ""), 0);
+    TEST_ASSERT_TRUE(find(table, "7C6B2D", aircraft));
+    TEST_ASSERT_EQUAL_STRING("QFA1    ", aircraft.flight);
+    TEST_ASSERT_EQUAL_FLOAT(3025, aircraft.alt_geom);
+
+    feed(table, msg(3, "7C4A2B", "", "8000", "-34.1", "151.0"), 0);
+    TEST_ASSERT_EQUAL_UINT32(2, table.size());
+    TEST_ASSERT_TRUE(find(table, "7C4A2B", aircraft));
+    TEST_ASSERT_FALSE(aircraft.has_flight);
+
+    TEST_ASSERT_EQUAL_UINT32(5, table.getStats().lines);
+    TEST_ASSERT_EQUAL_UINT32(0, table.getStats().bad_lines);
+}
+
+static void test_any_chunking() {
+    std::string data = msg(1, "7C6B2D", "QFA1", "", "", "") + msg(3, "7C6B2D", "", "3025", "-33.9429", "151.2562")
+        + "STA,,1,1,7C4A2B,1,2022/07/01,10:00:00.000,2022/07/01,10:00:00.000,RM\r\n"
+        + msg(3, "7C4A2B", "", "8000", "-34.1", "151.0");
+    AircraftRecord aircraft;
+
+    for (size_t split = 0; split <= data.length(); split++) {
+        SbsAircraftTable table(isNearby);
+        feed(table, data.substr(0, split), 0);
+        feed(table, data.substr(split), 0);
+        TEST_ASSERT_EQUAL_UINT32(4, table.getStats().lines);
+        TEST_ASSERT_EQUAL_UINT32(0, table.getStats().bad_lines);
+        TEST_ASSERT_EQUAL_UINT32(2, table.size());
+        TEST_ASSERT_TRUE(find(table, "7C6B2D", aircraft));
+        TEST_ASSERT_EQUAL_STRING("QFA1", aircraft.flight);
+        TEST_ASSERT_EQUAL_FLOAT(-33.9429, aircraft.lat);
+        TEST_ASSERT_TRUE(find(table, "7C4A2B", aircraft));
+        TEST_ASSERT_EQUAL_FLOAT(151.0, aircraft.lon);
+    }
+}
+
+static void test_bad_lines() {
+    SbsAircraftTable table(isNearby);
+
+    // Too few fields, no hex, a hex that's too long, and a line that's too long (then a good line)
+    feed(table, "MSG,3,1,1,7C6B2D,1\r\n", 0);
+    feed(table, msg(3, "", "", "", "-33.9", "151.2"), 0);
+    feed(table, msg(3, "7C6B2D7C6B2D", "", "", "-33.9", "151.2"), 0);
+    feed(table, std::string(SBS_MAX_LINE_LENGTH + 1, 'x') + "\r\n", 0);
+    feed(table, msg(3, "7C6B2D", "", "", "-33.9", "151.2"), 0);
+    TEST_ASSERT_EQUAL_UINT32(4, table.getStats().bad_lines);
+    TEST_ASSERT_EQUAL_UINT32(1, table.size());
+
+    // Other record types and blank lines are skipped, but not errors
+    feed(table, "AIR,,1,1,7C4A2B,1,2022/07/01,10:00:00.000,2022/07/01,10:00:00.000\r\n\r\n", 0);
+    TEST_ASSERT_EQUAL_UINT32(4, table.getStats().bad_lines);
+    TEST_ASSERT_EQUAL_UINT32(1, table.size());
+}
+
+static void test_nearby_changes() {
+    SbsAircraftTable table(isNearby);
+    TEST_ASSERT_TRUE(table.takeNearbyChanged());
+    TEST_ASSERT_FALSE(table.takeNearbyChanged());
+
+    // Aircraft that aren't nearby can come and go without anything to look at
+    feed(table, msg(3, "7C4A2B", "", "8000", "-34.5", "151.0"), 0);
+    feed(table, msg(3, "7C4A2B", "", "8000", "-34.4", "151.0"), 0);
+    feed(table, msg(1, "7C4A2B", "JST501", "", "", ""), 0);
+    TEST_ASSERT_FALSE(table.takeNearbyChanged());
+
+    // Appearing nearby, moving and changing callsign while nearby, and leaving are all changes
+    feed(table, msg(3, "7C4A2B", "", "8000", "-33.9", "151.0"), 0);
+    TEST_ASSERT_TRUE(table.takeNearbyChanged());
+    feed(table, msg(3, "7C4A2B", "", "7000", "-33.8", "151.0"), 0);
+    TEST_ASSERT_TRUE(table.takeNearbyChanged());
+    feed(table, msg(1, "7C4A2B", "JST501", "", "", ""), 0);
+    TEST_ASSERT_FALSE(table.takeNearbyChanged());
+    feed(table, msg(1, "7C4A2B", "JST502", "", "", ""), 0);
+    TEST_ASSERT_TRUE(table.takeNearbyChanged());
+    feed(table, msg(3, "7C4A2B", "", "7000", "-34.2", "151.0"), 0);
+    TEST_ASSERT_TRUE(table.takeNearbyChanged());
+    feed(table, msg(3, "7C4A2B", "", "7000", "-34.3", "151.0"), 0);
+    TEST_ASSERT_FALSE(table.takeNearbyChanged());
+
+    // As is a nearby aircraft timing out
+    feed(table, msg(3, "7C6B2D", "", "3000", "-33.9", "151.2"), 1000);
+    TEST_ASSERT_TRUE(table.takeNearbyChanged());
+    table.expire(1000 + SBS_AIRCRAFT_TIMEOUT_MILLIS);
+    TEST_ASSERT_FALSE(table.takeNearbyChanged());
+    TEST_ASSERT_EQUAL_UINT32(1, table.size());
+    table.expire(1001 + SBS_AIRCRAFT_TIMEOUT_MILLIS);
+    TEST_ASSERT_TRUE(table.takeNearbyChanged());
+    TEST_ASSERT_EQUAL_UINT32(0, table.size());
+}
+
+static void test_expiry() {
+    SbsAircraftTable table(isNearby);
+    AircraftRecord aircraft;
+    feed(table, msg(3, "7C6B2D", "", "3000", "-34.5", "151.2"), 0);
+    feed(table, msg(3, "7C4A2B", "", "3000", "-34.5", "151.0"), 0);
+
+    // Any message counts as hearing from the aircraft
+    feed(table, msg(7, "7C6B2D", "", "", "", ""), SBS_AIRCRAFT_TIMEOUT_MILLIS);
+    table.expire(SBS_AIRCRAFT_TIMEOUT_MILLIS + 1);
+    TEST_ASSERT_EQUAL_UINT32(1, table.size());
+    TEST_ASSERT_TRUE(find(table, "7C6B2D", aircraft));
+    TEST_ASSERT_FALSE(find(table, "7C4A2B", aircraft));
+
+    // millis() wrapping around doesn't expire anything early
+    SbsAircraftTable wrapping(isNearby);
+    feed(wrapping, msg(3, "7C6B2D", "", "3000", "-34.5", "151.2"), 0xFFFFF000);
+    wrapping.expire(1000);
+    TEST_ASSERT_EQUAL_UINT32(1, wrapping.size());
+}
+
+static void test_evicts_least_recently_heard() {
+    SbsAircraftTable table(isNearby);
+    AircraftRecord aircraft;
+    char hex[8];
+    for (uint32_t i = 0; i < SBS_MAX_AIRCRAFT; i++) {
+        snprintf(hex, sizeof(hex), "%06X", i);
+        feed(table, msg(3, hex, "", "3000", "-34.5", "151.2"), i);
+    }
+    TEST_ASSERT_EQUAL_UINT32(SBS_MAX_AIRCRAFT, table.size());
+
+    // 000000 was heard from first, but is heard from again, so 000001 is the one to go
+    feed(table, msg(7, "000000", "", "", "", ""), SBS_MAX_AIRCRAFT);
+    feed(table, msg(3, "ABCDEF", "", "3000", "-34.5", "151.2"), SBS_MAX_AIRCRAFT + 1);
+    TEST_ASSERT_EQUAL_UINT32(SBS_MAX_AIRCRAFT, table.size());
+    TEST_ASSERT_EQUAL_UINT32(1, table.getStats().evictions);
+    TEST_ASSERT_TRUE(find(table, "000000", aircraft));
+    TEST_ASSERT_FALSE(find(table, "000001", aircraft));
+    TEST_ASSERT_TRUE(find(table, "ABCDEF", aircraft));
+}
+
+static void test_reset() {
+    SbsAircraftTable table(isNearby);
+    feed(table, msg(3, "7C6B2D", "", "3000", "-33.9", "151.2"), 0);
+    feed(table, "MSG,3,1,1,7C4A", 0);
+    table.takeNearbyChanged();
+
+    // e.g. on reconnecting, a partial line is discarded
+    table.reset();
+    TEST_ASSERT_EQUAL_UINT32(0, table.size());
+    TEST_ASSERT_TRUE(table.takeNearbyChanged());
+    feed(table, "2B,1\r\n", 0);
+    TEST_ASSERT_EQUAL_UINT32(1, table.getStats().lines);
+    TEST_ASSERT_EQUAL_UINT32(0, table.getStats().bad_lines);
+    TEST_ASSERT_EQUAL_UINT32(0, table.size());
+}
+
+int main(int argc, char** argv) {
+    UNITY_BEGIN();
+    RUN_TEST(test_updates_from_messages);
+    RUN_TEST(test_any_chunking);
+    RUN_TEST(test_bad_lines);
+    RUN_TEST(test_nearby_changes);
+    RUN_TEST(test_expiry);
+    RUN_TEST(test_evicts_least_recently_heard);
+    RUN_TEST(test_reset);
+    return UNITY_END();
+}
@@ -0,0 +1,250 @@
+/*
+   Copyright 2022 Scott Bezek and the splitflap contributors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+/**
+ * Feeds SbsAircraftTable from software/chainlink/sbs_replay.py over a real TCP connection, as SbsFeed does on the
+ * device. Linux (or other POSIX) only, and needs python3 on the PATH (or PYTHON set to an interpreter):
+ *
+ *   pio test -e native -f test_sbs_replay -v
+ */
+#include <chrono>
+#include <string>
+#include <vector>
+
+#include <Arduino.h>
+#include <unity.h>
+
+#include "../../esp32/splitflap/geo_distance.h"
+#include "../../esp32/splitflap/sbs_aircraft_table.h"
+
+#if defined(__linux__) || defined(__APPLE__)
+
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <signal.h>
+#include <sys/socket.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#define HOME_LAT -33.9429f
+#define HOME_LNG 151.2562f
+#define MAX_DISTANCE_KM 2.5f
+
+#define CONNECT_TIMEOUT_MILLIS 5000
+#define RECEIVE_TIMEOUT_SECONDS 10
+
+typedef std::chrono::steady_clock Clock;
+
+static const GeoOrigin HOME(HOME_LAT, HOME_LNG, MAX_DISTANCE_KM);
+
+static std::string replayScriptPath() {
+    // This file is arduino/splitflap/test/test_sbs_replay/test_sbs_replay.cpp
+    std::string path = __FILE__;
+    size_t test_dir = path.rfind("test/test_sbs_replay/");
+    return path.substr(0, test_dir) + "../../software/chainlink/sbs_replay.py";
+}
+
+static uint16_t freePort() {
+    int fd = socket(AF_INET, SOCK_STREAM, 0);
+    sockaddr_in address = {};
+    address.sin_family = AF_INET;
+    address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    socklen_t length = sizeof(address);
+    bind(fd, (sockaddr*)&address, sizeof(address));
+    getsockname(fd, (sockaddr*)&address, &length);
+    close(fd);
+    return ntohs(address.sin_port);
+}
+
+// Runs sbs_replay.py with the given arguments (plus --port), returning its pid
+static pid_t startReplay(uint16_t port, std::initializer_list<std::string> args) {
+    const char* python = getenv("PYTHON") != nullptr ? getenv("PYTHON") : "python3";
+    std::string script = replayScriptPath();
+    std::string port_arg = "--port=" + std::to_string(port);
+    std::vector<const char*> argv = {python, script.c_str(), port_arg.c_str()};
+    for (const std::string& arg : args) {
+        argv.push_back(arg.c_str());
+    }
+    argv.push_back(nullptr);
+
+    pid_t pid = fork();
+    if (pid == 0) {
+        execvp(python, (char* const*)argv.data());
+        _exit(127);
+    }
+    return pid;
+}
+
+static void stopReplay(pid_t pid) {
+    kill(pid, SIGTERM);
+    waitpid(pid, nullptr, 0);
+}
+
+// Connects to the replay server once it's listening. Returns -1 if it doesn't start listening in time.
+static int connectToReplay(uint16_t port) {
+    sockaddr_in address = {};
+    address.sin_family = AF_INET;
+    address.sin_port = htons(port);
+    address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+
+    Clock::time_point start = Clock::now();
+    while (Clock::now() - start < std::chrono::milliseconds(CONNECT_TIMEOUT_MILLIS)) {
+        int fd = socket(AF_INET, SOCK_STREAM, 0);
+        if (connect(fd, (sockaddr*)&address, sizeof(address)) == 0) {
+            timeval timeout = {RECEIVE_TIMEOUT_SECONDS, 0};
+            setsockopt(fd, SOL_SOCKET, SO_RCVTIMEO, &timeout, sizeof(timeout));
+            return fd;
+        }
+        close(fd);
+        usleep(50 * 1000);
+    }
+    return -1;
+}
+
+static uint32_t elapsedMillis(Clock::time_point start) {
+    return std::chrono::duration_cast<std::chrono::milliseconds>(Clock::now() - start).count();
+}
+
+// Feeds the table until the server closes the connection. Calls on_change whenever takeNearbyChanged() is true.
+// Returns false if the connection failed or timed out.
+static bool receiveAll(int fd, SbsAircraftTable& table, std::function<void()> on_change) {
+    Clock::time_point start = Clock::now();
+    char buffer[512];
+    while (true) {
+        ssize_t length = recv(fd, buffer, sizeof(buffer), 0);
+        if (length == 0) {
+            return true;
+        }
+        if (length < 0) {
+            return false;
+        }
+        table.consume(buffer, length, elapsedMillis(start));
+        if (table.takeNearbyChanged()) {
+            on_change();
+        }
+    }
+}
+
+static void test_flyover() {
+    uint16_t port = freePort();
+    char flyover[40];
+    snprintf(flyover, sizeof(flyover), "--flyover=%f,%f", HOME_LAT, HOME_LNG);
+
+    // A 10km pass (50 positions 200m apart) in a couple of seconds
+    pid_t pid = startReplay(port, {flyover, "--callsign=QFA1", "--hex=7C6B2D", "--altitude=3000",
+        "--distance-km=5", "--speed-kmh=14400", "--interval=0.05"});
+    int fd = connectToReplay(port);
+    if (fd < 0) {
+        stopReplay(pid);
+    }
+    TEST_ASSERT_TRUE_MESSAGE(fd >= 0, "sbs_replay.py didn't start; is python3 on the PATH?");
+
+    SbsAircraftTable table([](const AircraftRecord& aircraft) {
+        return HOME.distanceWithin(aircraft.lat, aircraft.lon) >= 0;
+    });
+    uint32_t changes = 0;
+    uint32_t nearby_positions = 0;
+    float closest_km = MAX_DISTANCE_KM;
+    bool nearby_at_end = false;
+    bool callsign_known = false;
+    bool received = receiveAll(fd, table, [&]() {
+        changes++;
+        nearby_at_end = false;
+        table.forEach([&](const AircraftRecord& aircraft) {
+            float distance = HOME.distanceWithin(aircraft.lat, aircraft.lon);
+            if (distance >= 0) {
+                nearby_positions++;
+                closest_km = min(closest_km, distance);
+                nearby_at_end = true;
+                callsign_known |= aircraft.has_flight && strcmp(aircraft.flight, "QFA1") == 0;
+            }
+        });
+    });
+    close(fd);
+    stopReplay(pid);
+    TEST_ASSERT_TRUE(received);
+
+    const SbsTableStats& stats = table.getStats();
+    printf("%u lines, %u nearby changes, closest approach %.3f km\n", stats.lines, changes, closest_km);
+    TEST_ASSERT_EQUAL_UINT32(0, stats.bad_lines);
+    TEST_ASSERT_GREATER_THAN(50, stats.lines);
+    TEST_ASSERT_EQUAL_UINT32(1, table.size());
+
+    // Within range for 5km of the 10km pass, passing straight overhead, then out of range again
+    TEST_ASSERT_GREATER_OR_EQUAL(20, nearby_positions);
+    TEST_ASSERT_TRUE(closest_km < 0.2f);
+    TEST_ASSERT_TRUE(callsign_known);
+    TEST_ASSERT_FALSE(nearby_at_end);
+}
+
+static void test_capture() {
+    // Two aircraft, 100ms apart (sped up 10x), plus a record type the table skips
+    char path[] = "/tmp/test_sbs_replay_XXXXXX";
+    int capture_fd = mkstemp(path);
+    const char* capture =
+        "MSG,1,1,1,7C6B2D,1,2022/07/01,10:00:00.000,2022/07/01,10:00:00.000,QFA1    ,,,,,,,,0,0,0,0\r\n"
+        "MSG,3,1,1,7C6B2D,1,2022/07/01,10:00:00.100,2022/07/01,10:00:00.100,,3025,,,-33.94290,151.25620,,,0,0,0,0\r\n"
+        "STA,,1,1,7C4A2B,1,2022/07/01,10:00:00.200,2022/07/01,10:00:00.200,RM\r\n"
+        "MSG,3,1,1,7C4A2B,1,2022/07/01,10:00:00.300,2022/07/01,10:00:00.300,,8000,,,-34.10000,151.00000,,,0,0,0,0\r\n";
+    TEST_ASSERT_EQUAL(strlen(capture), write(capture_fd, capture, strlen(capture)));
+    close(capture_fd);
+
+    uint16_t port = freePort();
+    pid_t pid = startReplay(port, {path, "--speed=10"});
+    int fd = connectToReplay(port);
+    if (fd < 0) {
+        stopReplay(pid);
+    }
+    TEST_ASSERT_TRUE_MESSAGE(fd >= 0, "sbs_replay.py didn't start; is python3 on the PATH?");
+
+    SbsAircraftTable table([](const AircraftRecord& aircraft) {
+        return HOME.distanceWithin(aircraft.lat, aircraft.lon) >= 0;
+    });
+    bool received = receiveAll(fd, table, []() {});
+    close(fd);
+    stopReplay(pid);
+    unlink(path);
+    TEST_ASSERT_TRUE(received);
+
+    TEST_ASSERT_EQUAL_UINT32(4, table.getStats().lines);
+    TEST_ASSERT_EQUAL_UINT32(0, table.getStats().bad_lines);
+    TEST_ASSERT_EQUAL_UINT32(2, table.size());
+    uint32_t nearby = 0;
+    table.forEach([&](const AircraftRecord& aircraft) {
+        if (HOME.distanceWithin(aircraft.lat, aircraft.lon) >= 0) {
+            nearby++;
+            TEST_ASSERT_EQUAL_STRING("7C6B2D", aircraft.hex);
+            TEST_ASSERT_EQUAL_STRING("QFA1    ", aircraft.flight);
+        }
+    });
+    TEST_ASSERT_EQUAL_UINT32(1, nearby);
+}
+
+int main(int argc, char** argv) {
+    UNITY_BEGIN();
+    RUN_TEST(test_flyover);
+    RUN_TEST(test_capture);
+    return UNITY_END();
+}
+
+#else
+
+int main(int argc, char** argv) {
+    UNITY_BEGIN();
+    return UNITY_END();
+}
+
+#endif
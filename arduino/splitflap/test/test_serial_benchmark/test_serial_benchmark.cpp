@@ -0,0 +1,429 @@
+/*
+   Copyright 2022 Scott Bezek and the splitflap contributors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+/**
+ * Throughput and latency of the serial protocols on the host, driven through a FakeStream:
+ *
+ *   pio test -e native -f test_serial_benchmark -v
+ *
+ * Reports packets/s, bytes/s, per-message decode and encode latency, and heap allocations per message (which
+ * should all be 0, so the tests fail otherwise). Also reports the commands/s a client gets through a simulated
+ * serial link with each transport window size. Host numbers are only useful relative to each other, e.g. before
+ * and after a change; the ESP32 is roughly 20-50x slower.
+ */
+#include <chrono>
+#include <new>
+
+#include <unity.h>
+
+#include "pb_encode.h"
+
+#include "../../esp32/splitflap/crc32.h"
+#include "../../esp32/splitflap/serial_legacy_json_protocol.h"
+#include "../../esp32/splitflap/serial_proto_protocol.h"
+
+#include "fake_stream.h"
+#include "proto_client.h"
+#include "splitflap_task_stub.h"
+
+#define BENCHMARK_PACKETS 20000
+// Packets sent to the protocol between calls to loop(), like a burst arriving between serial task iterations
+#define BENCHMARK_BATCH 16
+
+static uint32_t allocation_count = 0;
+
+void* operator new(size_t size) {
+    allocation_count++;
+    void* p = malloc(size);
+    if (p == nullptr) {
+        throw std::bad_alloc();
+    }
+    return p;
+}
+
+void operator delete(void* p) noexcept {
+    free(p);
+}
+
+void operator delete(void* p, size_t size) noexcept {
+    free(p);
+}
+
+typedef std::chrono::steady_clock Clock;
+
+static double secondsSince(Clock::time_point start) {
+    return std::chrono::duration<double>(Clock::now() - start).count();
+}
+
+static void report(const char* name, uint32_t count, uint64_t bytes, double seconds, uint32_t allocations) {
+    printf("%-28s %8.0f msgs/s %10.0f bytes/s %8.2f us/msg %6.2f allocs/msg\n", name, count / seconds,
+        bytes / seconds, seconds * 1e6 / count, (double)allocations / count);
+}
+
+static bool encodeModuleCommands(pb_ostream_t* stream, const pb_field_t* field, void* const* arg) {
+    uint32_t seed = *(const uint32_t*)*arg;
+    for (uint8_t i = 0; i < NUM_MODULES; i++) {
+        PB_SplitflapCommand_ModuleCommand module = {};
+        module.action = PB_SplitflapCommand_ModuleCommand_Action_GO_TO_FLAP;
+        module.param = (seed + i) % NUM_FLAPS;
+        if (!pb_encode_tag_for_field(stream, field) || !pb_encode_submessage(stream, PB_SplitflapCommand_ModuleCommand_fields, &module)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+static size_t frameModuleCommand(uint32_t nonce, uint8_t* buffer) {
+    PB_ToSplitflap message = {};
+    message.nonce = nonce;
+    message.which_payload = PB_ToSplitflap_splitflap_command_tag;
+    message.payload.splitflap_command.modules.funcs.encode = &encodeModuleCommands;
+    message.payload.splitflap_command.modules.arg = &nonce;
+    return frameToSplitflap(message, buffer);
+}
+
+static void test_proto_decode() {
+    resetSplitflapTaskStub();
+    FakeStream stream;
+    SplitflapTask splitflap_task(0, LedMode::AUTO);
+    SerialProtoProtocol protocol(splitflap_task, stream);
+
+    uint32_t nonce = 1;
+    double seconds = 0;
+    uint64_t bytes = 0;
+    uint32_t allocations = 0;
+    for (uint32_t sent = 0; sent < BENCHMARK_PACKETS; sent += BENCHMARK_BATCH) {
+        // Packets are framed ahead of time so only the protocol's work is measured
+        uint8_t buffer[BENCHMARK_BATCH * MAX_FRAMED_PACKET_SIZE];
+        size_t size = 0;
+        for (uint8_t i = 0; i < BENCHMARK_BATCH; i++) {
+            size_t framed = frameModuleCommand(nonce++, buffer + size);
+            TEST_ASSERT_GREATER_THAN(0, framed);
+            size += framed;
+        }
+        stream.receive(buffer, size);
+        bytes += size;
+
+        uint32_t allocations_before = allocation_count;
+        Clock::time_point start = Clock::now();
+        protocol.loop();
+        seconds += secondsSince(start);
+        allocations += allocation_count - allocations_before;
+
+        // Acks (and the initial state message)
+        stream.takeOutput(nullptr, stream.outputSize());
+    }
+
+    report("proto decode+ack (command)", BENCHMARK_PACKETS, bytes, seconds, allocations);
+    TEST_ASSERT_EQUAL_UINT32(BENCHMARK_PACKETS, splitflap_task_stub_calls.raw_command_count);
+    TEST_ASSERT_EQUAL_UINT32(0, allocations);
+}
+
+// Simulated serial link for the window throughput benchmark: a 230400 baud UART (10 bits per byte) behind a USB
+// adapter that adds about 1ms in each direction, talking to the serial task's 1ms loop
+#define LINK_MICROS_PER_BYTE (10 * 1000000.0 / MONITOR_SPEED)
+#define LINK_LATENCY_MICROS 1000
+#define LOOP_PERIOD_MICROS 1000
+#define WINDOW_BENCHMARK_COMMANDS 2000
+
+struct SimulatedLink {
+    // When the line is next idle
+    double free_at = 0;
+
+    // Returns when a frame sent at time now arrives at the other end
+    double send(double now, size_t size) {
+        free_at = max(now, free_at) + size * LINK_MICROS_PER_BYTE;
+        return free_at + LINK_LATENCY_MICROS;
+    }
+};
+
+// Returns commands/s delivered by a client keeping up to window_size commands in flight, as the Python client does
+static double simulateWindowThroughput(uint8_t window_size) {
+    resetSplitflapTaskStub();
+    FakeStream stream;
+    SplitflapTask splitflap_task(0, LedMode::AUTO);
+    SerialProtoProtocol protocol(splitflap_task, stream);
+
+    PB_ToSplitflap window_config = {};
+    window_config.nonce = 0;
+    window_config.which_payload = PB_ToSplitflap_window_config_tag;
+    window_config.payload.window_config.window_size = window_size;
+    sendToSplitflap(stream, window_config);
+    protocol.loop();
+    stream.takeOutput(nullptr, stream.outputSize());
+
+    // Frames in flight in each direction, with their arrival times (microseconds). Acks are only tracked by the
+    // nonces they cover.
+    struct Arrival {
+        double at;
+        size_t size;
+        uint8_t frame[MAX_FRAMED_PACKET_SIZE];
+    };
+    static Arrival to_splitflap[PROTO_MAX_WINDOW_SIZE];
+    uint8_t to_splitflap_count = 0;
+    struct AckArrival {
+        double at;
+        uint32_t acked_through;
+    };
+    static AckArrival to_client[256];
+    uint16_t to_client_count = 0;
+
+    SimulatedLink downlink;
+    SimulatedLink uplink;
+    uint32_t next_nonce = 1;
+    uint32_t oldest_unacked = 1;
+    double now = 0;
+    double next_loop = LOOP_PERIOD_MICROS;
+    while (oldest_unacked <= WINDOW_BENCHMARK_COMMANDS) {
+        // Client: fill the window
+        while (next_nonce - oldest_unacked < window_size && next_nonce <= WINDOW_BENCHMARK_COMMANDS) {
+            Arrival& arrival = to_splitflap[to_splitflap_count++];
+            arrival.size = frameModuleCommand(next_nonce++, arrival.frame);
+            arrival.at = downlink.send(now, arrival.size);
+        }
+
+        // Advance to whatever happens next: an ack reaching the client or the next serial task loop
+        double next = next_loop;
+        for (uint16_t i = 0; i < to_client_count; i++) {
+            next = min(next, to_client[i].at);
+        }
+        now = next;
+
+        for (uint16_t i = 0; i < to_client_count;) {
+            if (to_client[i].at <= now) {
+                oldest_unacked = max(oldest_unacked, to_client[i].acked_through + 1);
+                to_client[i] = to_client[--to_client_count];
+            } else {
+                i++;
+            }
+        }
+
+        if (now >= next_loop) {
+            next_loop += LOOP_PERIOD_MICROS;
+            advanceMillis(LOOP_PERIOD_MICROS / 1000);
+
+            // Frames arrive in the order they were sent
+            uint8_t arrived = 0;
+            while (arrived < to_splitflap_count && to_splitflap[arrived].at <= now) {
+                stream.receive(to_splitflap[arrived].frame, to_splitflap[arrived].size);
+                arrived++;
+            }
+            memmove(to_splitflap, to_splitflap + arrived, (to_splitflap_count - arrived) * sizeof(Arrival));
+            to_splitflap_count -= arrived;
+
+            protocol.loop();
+
+            // Everything written (state messages included) shares the uplink
+            PB_FromSplitflap message;
+            size_t size_before = stream.outputSize();
+            while (receiveFromSplitflap(stream, message)) {
+                double arrives_at = uplink.send(now, size_before - stream.outputSize());
+                size_before = stream.outputSize();
+                if (message.which_payload == PB_FromSplitflap_ack_tag) {
+                    const PB_Ack& ack = message.payload.ack;
+                    AckArrival& arrival = to_client[to_client_count++];
+                    arrival.at = arrives_at;
+                    arrival.acked_through = ack.window_size > 0 ? ack.cumulative_nonce : ack.nonce;
+                }
+            }
+        }
+    }
+
+    return WINDOW_BENCHMARK_COMMANDS / (now / 1e6);
+}
+
+static void test_proto_window_throughput() {
+    double stop_and_wait = 0;
+    double windowed = 0;
+    for (uint8_t window_size = 1; window_size <= PROTO_MAX_WINDOW_SIZE; window_size *= 2) {
+        double commands_per_second = simulateWindowThroughput(window_size);
+        TEST_ASSERT_EQUAL_UINT32(WINDOW_BENCHMARK_COMMANDS, splitflap_task_stub_calls.raw_command_count);
+        printf("proto window %u                %8.0f commands/s (simulated %u baud link)\n", window_size,
+            commands_per_second, MONITOR_SPEED);
+        if (window_size == 1) {
+            stop_and_wait = commands_per_second;
+        } else if (window_size == PROTO_MAX_WINDOW_SIZE) {
+            windowed = commands_per_second;
+        }
+    }
+    // Stop-and-wait spends most of its time waiting on the round trip, which the window hides
+    TEST_ASSERT_GREATER_THAN(2 * stop_and_wait, windowed);
+}
+
+static void test_proto_encode_state() {
+    FakeStream stream;
+    SplitflapTask splitflap_task(0, LedMode::AUTO);
+    SerialProtoProtocol protocol(splitflap_task, stream);
+
+    SplitflapState state = {};
+    protocol.loop();
+    stream.takeOutput(nullptr, stream.outputSize());
+
+    uint64_t bytes_before = stream.bytesWritten();
+    double seconds = 0;
+    uint32_t allocations = 0;
+    for (uint32_t i = 0; i < BENCHMARK_PACKETS; i++) {
+        SplitflapState old_state = state;
+        for (uint8_t m = 0; m < NUM_MODULES; m++) {
+            state.modules[m].flap_index = (i + m) % NUM_FLAPS;
+            state.modules[m].moving = i % 2;
+        }
+        protocol.handleState(old_state, state);
+        // Past the state rate limit
+        advanceMillis(1000);
+
+        uint32_t allocations_before = allocation_count;
+        Clock::time_point start = Clock::now();
+        protocol.loop();
+        seconds += secondsSince(start);
+        allocations += allocation_count - allocations_before;
+
+        TEST_ASSERT_GREATER_THAN(0, stream.outputSize());
+        stream.takeOutput(nullptr, stream.outputSize());
+    }
+
+    report("proto encode (state)", BENCHMARK_PACKETS, stream.bytesWritten() - bytes_before, seconds, allocations);
+    TEST_ASSERT_EQUAL_UINT32(0, allocations);
+}
+
+static void test_proto_encode_log() {
+    FakeStream stream;
+    SplitflapTask splitflap_task(0, LedMode::AUTO);
+    SerialProtoProtocol protocol(splitflap_task, stream);
+
+    uint64_t bytes_before = stream.bytesWritten();
+    uint32_t allocations_before = allocation_count;
+    Clock::time_point start = Clock::now();
+    for (uint32_t i = 0; i < BENCHMARK_PACKETS; i++) {
+        protocol.log("Module 3 missed home; recalibrating");
+        stream.takeOutput(nullptr, stream.outputSize());
+    }
+    double seconds = secondsSince(start);
+    uint32_t allocations = allocation_count - allocations_before;
+
+    report("proto encode (log)", BENCHMARK_PACKETS, stream.bytesWritten() - bytes_before, seconds, allocations);
+    TEST_ASSERT_EQUAL_UINT32(0, allocations);
+}
+
+static void test_legacy_decode() {
+    resetSplitflapTaskStub();
+    FakeStream stream;
+    SplitflapTask splitflap_task(0, LedMode::AUTO);
+    SerialLegacyJsonProtocol protocol(splitflap_task, stream);
+
+    char line[NUM_MODULES + 3];
+    line[0] = '=';
+    for (uint8_t i = 0; i < NUM_MODULES; i++) {
+        line[1 + i] = 'a' + i % 26;
+    }
+    line[NUM_MODULES + 1] = '\n';
+    line[NUM_MODULES + 2] = '\0';
+    size_t line_length = strlen(line);
+
+    double seconds = 0;
+    uint64_t bytes = 0;
+    uint32_t allocations = 0;
+    for (uint32_t sent = 0; sent < BENCHMARK_PACKETS; sent += BENCHMARK_BATCH) {
+        for (uint8_t i = 0; i < BENCHMARK_BATCH; i++) {
+            stream.receive((const uint8_t*)line, line_length);
+        }
+        bytes += BENCHMARK_BATCH * line_length;
+
+        uint32_t allocations_before = allocation_count;
+        Clock::time_point start = Clock::now();
+        protocol.loop();
+        seconds += secondsSince(start);
+        allocations += allocation_count - allocations_before;
+
+        // Move echoes
+        stream.takeOutput(nullptr, stream.outputSize());
+    }
+
+    report("legacy decode (move)", BENCHMARK_PACKETS, bytes, seconds, allocations);
+    TEST_ASSERT_EQUAL_UINT32(BENCHMARK_PACKETS, splitflap_task_stub_calls.show_count);
+    TEST_ASSERT_EQUAL_STRING_LEN(line + 1, splitflap_task_stub_calls.last_string, NUM_MODULES);
+    TEST_ASSERT_EQUAL_UINT32(0, allocations);
+}
+
+static void test_legacy_encode_status() {
+    FakeStream stream;
+    SplitflapTask splitflap_task(0, LedMode::AUTO);
+    SerialLegacyJsonProtocol protocol(splitflap_task, stream);
+
+    // A move request makes the protocol report the status once every module has stopped
+    const char request[] = "=a\n";
+    SplitflapState moving = {};
+    SplitflapState stopped = {};
+    for (uint8_t m = 0; m < NUM_MODULES; m++) {
+        moving.modules[m].moving = true;
+    }
+
+    uint64_t bytes = 0;
+    double seconds = 0;
+    uint32_t allocations = 0;
+    for (uint32_t i = 0; i < BENCHMARK_PACKETS; i++) {
+        stream.receive((const uint8_t*)request, strlen(request));
+        protocol.loop();
+        protocol.handleState(stopped, moving);
+        stream.takeOutput(nullptr, stream.outputSize());
+
+        for (uint8_t m = 0; m < NUM_MODULES; m++) {
+            stopped.modules[m].flap_index = (i + m) % NUM_FLAPS;
+        }
+        uint32_t allocations_before = allocation_count;
+        Clock::time_point start = Clock::now();
+        protocol.handleState(moving, stopped);
+        seconds += secondsSince(start);
+        allocations += allocation_count - allocations_before;
+
+        TEST_ASSERT_GREATER_THAN(0, stream.outputSize());
+        bytes += stream.outputSize();
+        stream.takeOutput(nullptr, stream.outputSize());
+    }
+
+    report("legacy encode (status)", BENCHMARK_PACKETS, bytes, seconds, allocations);
+    TEST_ASSERT_EQUAL_UINT32(0, allocations);
+}
+
+static void test_crc32() {
+    uint8_t buffer[1024];
+    for (size_t i = 0; i < sizeof(buffer); i++) {
+        buffer[i] = i * 7;
+    }
+
+    uint32_t crc = 0;
+    Clock::time_point start = Clock::now();
+    for (uint32_t i = 0; i < BENCHMARK_PACKETS; i++) {
+        crc32(buffer, sizeof(buffer), &crc);
+    }
+    double seconds = secondsSince(start);
+
+    report("crc32 (1KiB)", BENCHMARK_PACKETS, (uint64_t)BENCHMARK_PACKETS * sizeof(buffer), seconds, 0);
+    // Keep the loop from being optimized out
+    TEST_ASSERT_NOT_EQUAL(0, crc);
+}
+
+int main(int argc, char** argv) {
+    UNITY_BEGIN();
+    RUN_TEST(test_proto_decode);
+    RUN_TEST(test_proto_window_throughput);
+    RUN_TEST(test_proto_encode_state);
+    RUN_TEST(test_proto_encode_log);
+    RUN_TEST(test_legacy_decode);
+    RUN_TEST(test_legacy_encode_status);
+    RUN_TEST(test_crc32);
+    return UNITY_END();
+}
@@ -0,0 +1,150 @@
+/*
+   Copyright 2022 Scott Bezek and the splitflap contributors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+#include <unity.h>
+#include <string>
+
+#include "../../esp32/splitflap/serial_legacy_json_protocol.h"
+
+#include "fake_stream.h"
+#include "splitflap_task_stub.h"
+
+static std::string takeOutput(FakeStream& stream) {
+    std::string output(stream.outputSize(), '\0');
+    stream.takeOutput((uint8_t*)&output[0], output.size());
+    return output;
+}
+
+// The status line as the protocol formatted it a piece at a time before JsonWriter, which clients parse
+static std::string referenceStatus(const SplitflapState& state) {
+    static const char* STATE_NAMES[] = {"normal", "look_for_home", "sensor_error", "panic", "disabled"};
+    std::string line = "{\"type\":\"status\", \"modules\":[";
+    char module[128];
+    for (uint8_t i = 0; i < NUM_MODULES; i++) {
+        snprintf(module, sizeof(module),
+            "{\"state\":\"%s\", \"flap\":\"%c\", \"count_missed_home\":%u, \"count_unexpected_home\":%u}",
+            STATE_NAMES[state.modules[i].state], flaps[state.modules[i].flap_index],
+            state.modules[i].count_missed_home, state.modules[i].count_unexpected_home);
+        line += module;
+        if (i < NUM_MODULES - 1) {
+            line += ", ";
+        }
+    }
+    return line + "]}\n";
+}
+
+// Makes the protocol report the status: a move request, then every module stopping
+static std::string requestStatus(SerialLegacyJsonProtocol& protocol, FakeStream& stream, const SplitflapState& state) {
+    SplitflapState moving = {};
+    for (uint8_t i = 0; i < NUM_MODULES; i++) {
+        moving.modules[i].moving = true;
+    }
+    const char* request = "=a\n";
+    stream.receive((const uint8_t*)request, strlen(request));
+    protocol.loop();
+    protocol.handleState(state, moving);
+    takeOutput(stream);
+
+    protocol.handleState(moving, state);
+    return takeOutput(stream);
+}
+
+static void test_status_format() {
+    FakeStream stream;
+    SplitflapTask splitflap_task(0, LedMode::AUTO);
+    SerialLegacyJsonProtocol protocol(splitflap_task, stream);
+
+    static const State STATES[] = {NORMAL, LOOK_FOR_HOME, SENSOR_ERROR, PANIC, STATE_DISABLED};
+    SplitflapState state = {};
+    for (uint8_t round = 0; round < NUM_FLAPS; round++) {
+        for (uint8_t i = 0; i < NUM_MODULES; i++) {
+            state.modules[i].state = STATES[(round + i) % 5];
+            state.modules[i].flap_index = (round + i) % NUM_FLAPS;
+            state.modules[i].count_missed_home = round * 7 + i;
+            state.modules[i].count_unexpected_home = 255 - round;
+        }
+        TEST_ASSERT_EQUAL_STRING(referenceStatus(state).c_str(), requestStatus(protocol, stream, state).c_str());
+    }
+}
+
+static void test_status_only_after_move() {
+    FakeStream stream;
+    SplitflapTask splitflap_task(0, LedMode::AUTO);
+    SerialLegacyJsonProtocol protocol(splitflap_task, stream);
+    SplitflapState state = {};
+
+    protocol.handleState(state, state);
+    TEST_ASSERT_EQUAL_UINT32(0, stream.outputSize());
+
+    TEST_ASSERT_GREATER_THAN(0, requestStatus(protocol, stream, state).length());
+    protocol.handleState(state, state);
+    TEST_ASSERT_EQUAL_UINT32(0, stream.outputSize());
+}
+
+static void test_longest_status_fits() {
+    FakeStream stream;
+    SplitflapTask splitflap_task(0, LedMode::AUTO);
+    SerialLegacyJsonProtocol protocol(splitflap_task, stream);
+
+    SplitflapState state = {};
+    for (uint8_t i = 0; i < NUM_MODULES; i++) {
+        state.modules[i].state = LOOK_FOR_HOME;
+        state.modules[i].count_missed_home = 255;
+        state.modules[i].count_unexpected_home = 255;
+    }
+    std::string status = requestStatus(protocol, stream, state);
+    TEST_ASSERT_EQUAL_STRING(referenceStatus(state).c_str(), status.c_str());
+    TEST_ASSERT_LESS_OR_EQUAL(LEGACY_STATUS_MAX_LINE_LENGTH, status.length());
+}
+
+static void test_log_format() {
+    FakeStream stream;
+    SplitflapTask splitflap_task(0, LedMode::AUTO);
+    SerialLegacyJsonProtocol protocol(splitflap_task, stream);
+
+    // As json11 used to format it (keys sorted)
+    protocol.log("Hello \"world\"\n\tC:\\splitflap");
+    TEST_ASSERT_EQUAL_STRING("{\"msg\": \"Hello \\\"world\\\"\\n\\tC:\\\\splitflap\", \"type\": \"log\"}\r\n",
+        takeOutput(stream).c_str());
+
+    protocol.log("");
+    TEST_ASSERT_EQUAL_STRING("{\"msg\": \"\", \"type\": \"log\"}\r\n", takeOutput(stream).c_str());
+}
+
+static void test_long_log_truncated() {
+    FakeStream stream;
+    SplitflapTask splitflap_task(0, LedMode::AUTO);
+    SerialLegacyJsonProtocol protocol(splitflap_task, stream);
+
+    // Long enough to overflow the line buffer if it weren't truncated, even without escapes
+    std::string message(LEGACY_LOG_MAX_LINE_LENGTH + 100, '\x01');
+    protocol.log(message.c_str());
+    std::string expected = "{\"msg\": \"";
+    for (uint16_t i = 0; i < LEGACY_LOG_MAX_MSG_LENGTH; i++) {
+        expected += "\\u0001";
+    }
+    expected += "\", \"type\": \"log\"}\r\n";
+    TEST_ASSERT_EQUAL_STRING(expected.c_str(), takeOutput(stream).c_str());
+}
+
+int main(int argc, char** argv) {
+    UNITY_BEGIN();
+    RUN_TEST(test_status_format);
+    RUN_TEST(test_status_only_after_move);
+    RUN_TEST(test_longest_status_fits);
+    RUN_TEST(test_log_format);
+    RUN_TEST(test_long_log_truncated);
+    return UNITY_END();
+}
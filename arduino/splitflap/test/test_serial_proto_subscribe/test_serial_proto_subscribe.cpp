@@ -0,0 +1,112 @@
+/*
+   Copyright 2022 Scott Bezek and the splitflap contributors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+#include <unity.h>
+
+#include "../../esp32/splitflap/serial_proto_protocol.h"
+
+#include "fake_stream.h"
+#include "proto_client.h"
+#include "splitflap_task_stub.h"
+
+static void sendSubscribe(FakeStream& stream, uint32_t nonce, uint8_t module_start, uint32_t heartbeat_interval_millis) {
+    PB_ToSplitflap message = {};
+    message.nonce = nonce;
+    message.which_payload = PB_ToSplitflap_subscribe_tag;
+    message.payload.subscribe.module_start = module_start;
+    message.payload.subscribe.heartbeat_interval_millis = heartbeat_interval_millis;
+    TEST_ASSERT_TRUE(sendToSplitflap(stream, message));
+}
+
+static void sendWindowConfig(FakeStream& stream, uint32_t nonce, uint8_t window_size) {
+    PB_ToSplitflap message = {};
+    message.nonce = nonce;
+    message.which_payload = PB_ToSplitflap_window_config_tag;
+    message.payload.window_config.window_size = window_size;
+    TEST_ASSERT_TRUE(sendToSplitflap(stream, message));
+}
+
+// Counts the state messages in the protocol's output (discarding everything), recording the last one's module_start
+static uint32_t takeStates(FakeStream& stream, uint8_t* module_start) {
+    uint32_t count = 0;
+    PB_FromSplitflap message;
+    while (receiveFromSplitflap(stream, message)) {
+        if (message.which_payload == PB_FromSplitflap_splitflap_state_tag) {
+            count++;
+            *module_start = message.payload.splitflap_state.module_start;
+        }
+    }
+    return count;
+}
+
+// Subscribes to modules from index 2 with a long heartbeat, checking it took effect
+static void subscribeToPartialState(SerialProtoProtocol& protocol, FakeStream& stream, uint32_t nonce) {
+    uint8_t module_start = 0;
+    sendSubscribe(stream, nonce, 2, 60000);
+    protocol.loop();
+    TEST_ASSERT_EQUAL_UINT32(1, takeStates(stream, &module_start));
+    TEST_ASSERT_EQUAL_UINT8(2, module_start);
+
+    advanceMillis(10000);
+    protocol.loop();
+    TEST_ASSERT_EQUAL_UINT32(0, takeStates(stream, &module_start));
+}
+
+// Checks that the default subscription is in effect: every module, and a heartbeat within 5s
+static void assertDefaultSubscription(SerialProtoProtocol& protocol, FakeStream& stream) {
+    uint8_t module_start = 0xFF;
+    protocol.loop();
+    TEST_ASSERT_EQUAL_UINT32(1, takeStates(stream, &module_start));
+    TEST_ASSERT_EQUAL_UINT8(0, module_start);
+
+    advanceMillis(5001);
+    protocol.loop();
+    TEST_ASSERT_EQUAL_UINT32(1, takeStates(stream, &module_start));
+    TEST_ASSERT_EQUAL_UINT8(0, module_start);
+}
+
+static void test_window_config_resets_subscription() {
+    FakeStream stream;
+    SplitflapTask splitflap_task(0, LedMode::AUTO);
+    SerialProtoProtocol protocol(splitflap_task, stream);
+    protocol.loop();
+    stream.takeOutput(nullptr, stream.outputSize());
+
+    subscribeToPartialState(protocol, stream, 10);
+
+    // A new client session starts
+    sendWindowConfig(stream, 500, 1);
+    assertDefaultSubscription(protocol, stream);
+}
+
+static void test_init_resets_subscription() {
+    FakeStream stream;
+    SplitflapTask splitflap_task(0, LedMode::AUTO);
+    SerialProtoProtocol protocol(splitflap_task, stream);
+    protocol.loop();
+    stream.takeOutput(nullptr, stream.outputSize());
+
+    subscribeToPartialState(protocol, stream, 10);
+
+    protocol.init();
+    assertDefaultSubscription(protocol, stream);
+}
+
+int main(int argc, char** argv) {
+    UNITY_BEGIN();
+    RUN_TEST(test_window_config_resets_subscription);
+    RUN_TEST(test_init_resets_subscription);
+    return UNITY_END();
+}
@@ -0,0 +1,236 @@
+/*
+   Copyright 2022 Scott Bezek and the splitflap contributors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+#include <unity.h>
+
+#include "pb_encode.h"
+
+#include "../../esp32/splitflap/serial_proto_protocol.h"
+
+#include "esp_partition.h"
+#include "fake_stream.h"
+#include "proto_client.h"
+#include "splitflap_task_stub.h"
+
+// Every module is sent to flap (nonce % NUM_FLAPS), so the last delivered command identifies its message
+static bool encodeModuleCommands(pb_ostream_t* stream, const pb_field_t* field, void* const* arg) {
+    uint32_t nonce = *(const uint32_t*)*arg;
+    for (uint8_t i = 0; i < NUM_MODULES; i++) {
+        PB_SplitflapCommand_ModuleCommand module = {};
+        module.action = PB_SplitflapCommand_ModuleCommand_Action_GO_TO_FLAP;
+        module.param = nonce % NUM_FLAPS;
+        if (!pb_encode_tag_for_field(stream, field) || !pb_encode_submessage(stream, PB_SplitflapCommand_ModuleCommand_fields, &module)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+static void sendCommand(FakeStream& stream, uint32_t nonce) {
+    PB_ToSplitflap message = {};
+    message.nonce = nonce;
+    message.which_payload = PB_ToSplitflap_splitflap_command_tag;
+    message.payload.splitflap_command.modules.funcs.encode = &encodeModuleCommands;
+    message.payload.splitflap_command.modules.arg = &nonce;
+    TEST_ASSERT_TRUE(sendToSplitflap(stream, message));
+}
+
+static void sendWindowConfig(FakeStream& stream, uint32_t nonce, uint8_t window_size) {
+    PB_ToSplitflap message = {};
+    message.nonce = nonce;
+    message.which_payload = PB_ToSplitflap_window_config_tag;
+    message.payload.window_config.window_size = window_size;
+    TEST_ASSERT_TRUE(sendToSplitflap(stream, message));
+}
+
+static void sendScheduleChunk(FakeStream& stream, uint32_t nonce, uint32_t offset, uint8_t fill) {
+    PB_ToSplitflap message = {};
+    message.nonce = nonce;
+    message.which_payload = PB_ToSplitflap_schedule_upload_tag;
+    PB_ScheduleUpload& upload = message.payload.schedule_upload;
+    upload.phase = PB_ScheduleUpload_Phase_DATA;
+    upload.offset = offset;
+    upload.data.size = sizeof(upload.data.bytes);
+    memset(upload.data.bytes, fill, upload.data.size);
+    TEST_ASSERT_TRUE(sendToSplitflap(stream, message));
+}
+
+// Takes the next ack from the protocol's output, skipping anything else. Leaves ack zeroed if there isn't one.
+static void receiveAck(FakeStream& stream, PB_Ack& ack) {
+    ack = {};
+    PB_FromSplitflap message;
+    while (receiveFromSplitflap(stream, message)) {
+        if (message.which_payload == PB_FromSplitflap_ack_tag) {
+            ack = message.payload.ack;
+            return;
+        }
+    }
+}
+
+static void assertLastCommand(uint32_t expected_count, uint32_t nonce) {
+    TEST_ASSERT_EQUAL_UINT32(expected_count, splitflap_task_stub_calls.raw_command_count);
+    TEST_ASSERT_EQUAL_UINT8(QCMD_FLAP + nonce % NUM_FLAPS, splitflap_task_stub_calls.last_raw_command.data.module_command[0]);
+}
+
+static void test_window_size_one_is_stop_and_wait() {
+    resetSplitflapTaskStub();
+    FakeStream stream;
+    SplitflapTask splitflap_task(0, LedMode::AUTO);
+    SerialProtoProtocol protocol(splitflap_task, stream);
+    PB_Ack ack;
+
+    sendWindowConfig(stream, 100, 1);
+    protocol.loop();
+    receiveAck(stream, ack);
+    TEST_ASSERT_EQUAL_UINT32(100, ack.nonce);
+    TEST_ASSERT_EQUAL_UINT8(0, ack.window_size);
+
+    sendCommand(stream, 101);
+    protocol.loop();
+    receiveAck(stream, ack);
+    TEST_ASSERT_EQUAL_UINT32(101, ack.nonce);
+    assertLastCommand(1, 101);
+
+    // A retry is acked again but not re-delivered
+    sendCommand(stream, 101);
+    protocol.loop();
+    receiveAck(stream, ack);
+    TEST_ASSERT_EQUAL_UINT32(101, ack.nonce);
+    assertLastCommand(1, 101);
+}
+
+static void test_new_client_within_stale_window() {
+    resetSplitflapTaskStub();
+    FakeStream stream;
+    SplitflapTask splitflap_task(0, LedMode::AUTO);
+    SerialProtoProtocol protocol(splitflap_task, stream);
+    PB_Ack ack;
+
+    // A windowed client exits after a few messages...
+    sendWindowConfig(stream, 1000, 8);
+    sendCommand(stream, 1001);
+    sendCommand(stream, 1002);
+    protocol.loop();
+    assertLastCommand(2, 1002);
+    stream.takeOutput(nullptr, stream.outputSize());
+
+    // ...and a stop-and-wait client's nonces happen to start at the old window's cumulative nonce, which would have
+    // been taken for a retry of an already-delivered message, and then one past the end of the window
+    sendWindowConfig(stream, 1001, 1);
+    protocol.loop();
+    receiveAck(stream, ack);
+    TEST_ASSERT_EQUAL_UINT32(1001, ack.nonce);
+    TEST_ASSERT_EQUAL_UINT8(0, ack.window_size);
+
+    sendCommand(stream, 1002);
+    protocol.loop();
+    receiveAck(stream, ack);
+    TEST_ASSERT_EQUAL_UINT32(1002, ack.nonce);
+    assertLastCommand(3, 1002);
+
+    sendCommand(stream, 1003);
+    protocol.loop();
+    assertLastCommand(4, 1003);
+}
+
+static void test_init_resets_window() {
+    resetSplitflapTaskStub();
+    FakeStream stream;
+    SplitflapTask splitflap_task(0, LedMode::AUTO);
+    SerialProtoProtocol protocol(splitflap_task, stream);
+    PB_Ack ack;
+
+    sendWindowConfig(stream, 50, 8);
+    sendCommand(stream, 51);
+    protocol.loop();
+    assertLastCommand(1, 51);
+    stream.takeOutput(nullptr, stream.outputSize());
+
+    // Switching to the protocol (again) leaves no window behind, even for a client that never configures one
+    protocol.init();
+    sendCommand(stream, 51);
+    protocol.loop();
+    receiveAck(stream, ack);
+    TEST_ASSERT_EQUAL_UINT32(51, ack.nonce);
+    TEST_ASSERT_EQUAL_UINT8(0, ack.window_size);
+    assertLastCommand(2, 51);
+
+    sendCommand(stream, 60);
+    protocol.loop();
+    assertLastCommand(3, 60);
+}
+
+static void test_window_drops_early_schedule_chunks() {
+    resetSplitflapTaskStub();
+    fakePartitionInit(16 * 1024);
+    ScheduleStore schedule_store;
+    schedule_store.begin();
+    FakeStream stream;
+    SplitflapTask splitflap_task(0, LedMode::AUTO);
+    SerialProtoProtocol protocol(splitflap_task, stream);
+    protocol.setScheduleStore(&schedule_store);
+    PB_Ack ack;
+
+    sendWindowConfig(stream, 0, 8);
+    PB_ToSplitflap begin = {};
+    begin.nonce = 1;
+    begin.which_payload = PB_ToSplitflap_schedule_upload_tag;
+    begin.payload.schedule_upload.phase = PB_ScheduleUpload_Phase_BEGIN;
+    begin.payload.schedule_upload.size = 1024;
+    TEST_ASSERT_TRUE(sendToSplitflap(stream, begin));
+    protocol.loop();
+    stream.takeOutput(nullptr, stream.outputSize());
+
+    // Chunks aren't held in the window, so one that arrives after a lost packet isn't acked (or written)...
+    sendScheduleChunk(stream, 3, 256, 0xB2);
+    protocol.loop();
+    receiveAck(stream, ack);
+    TEST_ASSERT_EQUAL_UINT32(0, ack.nonce);
+    TEST_ASSERT_EQUAL_UINT32(0, schedule_store.uploadOffset());
+
+    // ...while a command can be, as it's small
+    sendCommand(stream, 4);
+    protocol.loop();
+    receiveAck(stream, ack);
+    TEST_ASSERT_EQUAL_UINT32(4, ack.nonce);
+    TEST_ASSERT_EQUAL_UINT32(1, ack.cumulative_nonce);
+    TEST_ASSERT_EQUAL_UINT32(0b100, ack.selective_mask);
+    TEST_ASSERT_EQUAL_UINT32(0, splitflap_task_stub_calls.raw_command_count);
+
+    // Once the lost chunk and then the dropped one are retried, everything is delivered in order
+    sendScheduleChunk(stream, 2, 0, 0xB1);
+    protocol.loop();
+    receiveAck(stream, ack);
+    TEST_ASSERT_EQUAL_UINT32(2, ack.nonce);
+    TEST_ASSERT_EQUAL_UINT32(2, ack.cumulative_nonce);
+    TEST_ASSERT_EQUAL_UINT32(256, schedule_store.uploadOffset());
+
+    sendScheduleChunk(stream, 3, 256, 0xB2);
+    protocol.loop();
+    receiveAck(stream, ack);
+    TEST_ASSERT_EQUAL_UINT32(3, ack.nonce);
+    TEST_ASSERT_EQUAL_UINT32(4, ack.cumulative_nonce);
+    TEST_ASSERT_EQUAL_UINT32(512, schedule_store.uploadOffset());
+    assertLastCommand(1, 4);
+}
+
+int main(int argc, char** argv) {
+    UNITY_BEGIN();
+    RUN_TEST(test_window_size_one_is_stop_and_wait);
+    RUN_TEST(test_new_client_within_stale_window);
+    RUN_TEST(test_init_resets_window);
+    RUN_TEST(test_window_drops_early_schedule_chunks);
+    return UNITY_END();
+}
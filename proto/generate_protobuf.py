@@ -27,13 +27,13 @@ def run():
     proto_path = REPO_ROOT / 'proto'
 
     nanopb_path = REPO_ROOT / 'thirdparty' / 'nanopb'
+    nanopb_generator_path = nanopb_path / 'generator' / 'nanopb_generator.py'
 
-    # Make sure nanopb submodule is available
-    if not os.path.isdir(nanopb_path):
+    # Make sure nanopb submodule is available (an uninitialized submodule is just an empty directory)
+    if not os.path.isfile(nanopb_generator_path):
         print(f'Nanopb checkout not found! Make sure you have inited/updated the submodule located at {nanopb_path}', file=sys.stderr)
         exit(1)
 
-    nanopb_generator_path = nanopb_path / 'generator' / 'nanopb_generator.py'
     c_generated_output_path = REPO_ROOT / 'arduino' / 'splitflap' / 'esp32' / 'proto_gen'
     
     proto_files = [f for f in os.listdir(proto_path) if f.endswith('.proto')]
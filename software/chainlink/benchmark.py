@@ -0,0 +1,28 @@
+import time
+
+from splitflap_proto import (
+    Splitflap,
+    ask_for_serial_port,
+    splitflap_context,
+)
+
+NUM_COMMANDS = 500
+
+
+def _run():
+    p = ask_for_serial_port()
+
+    # Compare command throughput of the stop-and-wait transport against the sliding window transport
+    for window_size in (1, Splitflap.DEFAULT_WINDOW_SIZE):
+        with splitflap_context(p, default_logging=False, window_size=window_size) as s:
+            s.flush()
+            start = time.time()
+            for _ in range(NUM_COMMANDS):
+                s.request_state()
+            s.flush()
+            elapsed = time.time() - start
+            print(f'Window size {window_size}: {NUM_COMMANDS} commands in {elapsed:.2f}s ({NUM_COMMANDS / elapsed:.1f} commands/s)')
+
+
+if __name__ == '__main__':
+    _run()
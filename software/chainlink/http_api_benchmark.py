@@ -0,0 +1,161 @@
+"""
+Load generator for the firmware's HTTP API (HTTP_API in platformio.ini).
+
+Sends commands from several keep-alive connections at once and reports throughput and request latency, e.g.:
+
+    python http_api_benchmark.py splitflap.local --requests 500 --connections 2
+
+With --motion, it also follows the /events stream and measures how long it takes from sending a command to the
+first module starting to move.
+"""
+import argparse
+import http.client
+import json
+import random
+import statistics
+import string
+import threading
+import time
+
+
+def _percentile(values, fraction):
+    ordered = sorted(values)
+    return ordered[min(len(ordered) - 1, int(fraction * len(ordered)))]
+
+
+def _latency_summary(latencies):
+    return (f'median {statistics.median(latencies) * 1000:.1f}ms, p95 {_percentile(latencies, 0.95) * 1000:.1f}ms, '
+            f'max {max(latencies) * 1000:.1f}ms')
+
+
+def _random_text(length):
+    return ''.join(random.choice(string.ascii_lowercase + string.digits + ' ') for _ in range(length))
+
+
+def _send(connection, path, body):
+    start = time.time()
+    connection.request('POST', path, body=body, headers={'Content-Type': 'text/plain'})
+    response = connection.getresponse()
+    response.read()
+    if response.status != 202:
+        raise RuntimeError(f'{path} returned {response.status} {response.reason}')
+    return time.time() - start
+
+
+def throughput(host, port, path, requests, connections, num_modules, num_flaps):
+    """Sends requests commands split across connections, each sent as soon as the previous one is answered."""
+    latencies = []
+    errors = []
+    lock = threading.Lock()
+
+    def worker(count):
+        connection = http.client.HTTPConnection(host, port, timeout=10)
+        try:
+            for _ in range(count):
+                if path == '/flaps':
+                    body = ','.join(str(random.randrange(num_flaps)) for _ in range(num_modules))
+                else:
+                    body = _random_text(num_modules)
+                latency = _send(connection, path, body)
+                with lock:
+                    latencies.append(latency)
+        except Exception as e:
+            errors.append(e)
+        finally:
+            connection.close()
+
+    threads = [threading.Thread(target=worker, args=(requests // connections + (i < requests % connections),))
+               for i in range(connections)]
+    start = time.time()
+    for t in threads:
+        t.start()
+    for t in threads:
+        t.join()
+    elapsed = time.time() - start
+
+    for e in errors:
+        print(f'Error: {e}')
+    if latencies:
+        print(f'{path} x{connections} connections: {len(latencies)} requests in {elapsed:.2f}s '
+              f'({len(latencies) / elapsed:.1f} requests/s), latency {_latency_summary(latencies)}')
+
+
+class EventStream:
+    """Follows /events in the background, keeping the latest state of each module."""
+
+    def __init__(self, host, port):
+        self.modules = {}
+        self.condition = threading.Condition()
+        self._connection = http.client.HTTPConnection(host, port, timeout=60)
+        self._connection.request('GET', '/events')
+        self._response = self._connection.getresponse()
+        if self._response.status != 200:
+            raise RuntimeError(f'/events returned {self._response.status} {self._response.reason}')
+        threading.Thread(target=self._read, daemon=True).start()
+
+    def _read(self):
+        for line in self._response:
+            line = line.decode('utf-8').rstrip('\n')
+            if not line.startswith('data: '):
+                continue
+            state = json.loads(line[len('data: '):])
+            with self.condition:
+                for module in state['modules']:
+                    self.modules[module['module']] = module
+                self.condition.notify_all()
+
+    def wait_for(self, predicate, timeout):
+        with self.condition:
+            return self.condition.wait_for(lambda: predicate(self.modules), timeout)
+
+
+def motion_latency(host, port, samples, num_flaps):
+    """Moves the first module to a new flap repeatedly, timing how long it takes for it to be reported moving."""
+    events = EventStream(host, port)
+    if not events.wait_for(lambda modules: 0 in modules, 5):
+        raise RuntimeError('No initial state from /events')
+
+    connection = http.client.HTTPConnection(host, port, timeout=10)
+    latencies = []
+    for _ in range(samples):
+        current = events.modules[0]['index']
+        target = (current + random.randrange(1, num_flaps)) % num_flaps
+        start = time.time()
+        _send(connection, '/flaps', str(target))
+        if not events.wait_for(lambda modules: modules[0]['moving'] or modules[0]['index'] == target, 5):
+            print('Timed out waiting for the module to move')
+            continue
+        latencies.append(time.time() - start)
+        # Let it finish before the next one
+        events.wait_for(lambda modules: not modules[0]['moving'] and modules[0]['index'] == target, 10)
+    connection.close()
+
+    if latencies:
+        print(f'Command to motion: {len(latencies)} samples, {_latency_summary(latencies)}')
+
+
+def _run():
+    parser = argparse.ArgumentParser('HTTP API benchmark')
+    parser.add_argument('host', help='Address of the display, e.g. splitflap.local')
+    parser.add_argument('--port', type=int, default=80)
+    parser.add_argument('--requests', type=int, default=200)
+    parser.add_argument('--connections', type=int, default=1, help='Concurrent keep-alive connections')
+    parser.add_argument('--motion', type=int, default=0, metavar='SAMPLES',
+                        help='Also measure command-to-motion latency this many times, using /events')
+    parser.add_argument('--num-flaps', type=int, default=40)
+    args = parser.parse_args()
+
+    connection = http.client.HTTPConnection(args.host, args.port, timeout=10)
+    connection.request('GET', '/state')
+    num_modules = len(json.loads(connection.getresponse().read())['modules'])
+    connection.close()
+    print(f'{num_modules} modules')
+
+    for path in ('/text', '/flaps'):
+        throughput(args.host, args.port, path, args.requests, args.connections, num_modules, args.num_flaps)
+    if args.motion:
+        motion_latency(args.host, args.port, args.motion, args.num_flaps)
+
+
+if __name__ == '__main__':
+    _run()
@@ -7,6 +7,9 @@ export namespace PB {
 
         /** SplitflapState modules */
         modules?: (PB.SplitflapState.IModuleState[]|null);
+
+        /** Index of the module that modules[0] describes (nonzero only if a Subscribe restricted the module range). */
+        moduleStart?: (number|null);
     }
 
     /** Represents a SplitflapState. */
@@ -21,6 +24,9 @@ export namespace PB {
         /** SplitflapState modules. */
         public modules: PB.SplitflapState.IModuleState[];
 
+        /** Index of the module that modules[0] describes (nonzero only if a Subscribe restricted the module range). */
+        public moduleStart: number;
+
         /**
          * Creates a new SplitflapState instance using the specified properties.
          * @param [properties] Properties to set
@@ -322,6 +328,24 @@ export namespace PB {
 
         /** Ack nonce */
         nonce?: (number|null);
+
+        /**
+         * Sliding window transport only (see WindowConfig): every nonce up to and including
+         * cumulative_nonce has been received.
+         */
+        cumulativeNonce?: (number|null);
+
+        /**
+         * Sliding window transport only: bit i is set if nonce (cumulative_nonce + 1 + i) has also been
+         * received, ahead of a missing earlier nonce.
+         */
+        selectiveMask?: (number|null);
+
+        /**
+         * Number of unacknowledged messages the splitflap accepts from the client, as negotiated via
+         * WindowConfig. 0 means the transport is stop-and-wait: only one message may be in flight.
+         */
+        windowSize?: (number|null);
     }
 
     /** Represents an Ack. */
@@ -336,6 +360,24 @@ export namespace PB {
         /** Ack nonce. */
         public nonce: number;
 
+        /**
+         * Sliding window transport only (see WindowConfig): every nonce up to and including
+         * cumulative_nonce has been received.
+         */
+        public cumulativeNonce: number;
+
+        /**
+         * Sliding window transport only: bit i is set if nonce (cumulative_nonce + 1 + i) has also been
+         * received, ahead of a missing earlier nonce.
+         */
+        public selectiveMask: number;
+
+        /**
+         * Number of unacknowledged messages the splitflap accepts from the client, as negotiated via
+         * WindowConfig. 0 means the transport is stop-and-wait: only one message may be in flight.
+         */
+        public windowSize: number;
+
         /**
          * Creates a new Ack instance using the specified properties.
          * @param [properties] Properties to set
@@ -407,6 +449,237 @@ export namespace PB {
         public toJSON(): { [k: string]: any };
     }
 
+    /** Properties of a BaudRateResponse. */
+    interface IBaudRateResponse {
+
+        /** BaudRateResponse status */
+        status?: (PB.BaudRateResponse.Status|null);
+
+        /** BaudRateResponse baudRate */
+        baudRate?: (number|null);
+    }
+
+    /** Result of a BaudRateChange request; see BaudRateChange for the handshake. */
+    class BaudRateResponse implements IBaudRateResponse {
+
+        /**
+         * Constructs a new BaudRateResponse.
+         * @param [properties] Properties to set
+         */
+        constructor(properties?: PB.IBaudRateResponse);
+
+        /** BaudRateResponse status. */
+        public status: PB.BaudRateResponse.Status;
+
+        /** BaudRateResponse baudRate. */
+        public baudRate: number;
+
+        /**
+         * Creates a new BaudRateResponse instance using the specified properties.
+         * @param [properties] Properties to set
+         * @returns BaudRateResponse instance
+         */
+        public static create(properties?: PB.IBaudRateResponse): PB.BaudRateResponse;
+
+        /**
+         * Encodes the specified BaudRateResponse message. Does not implicitly {@link PB.BaudRateResponse.verify|verify} messages.
+         * @param message BaudRateResponse message or plain object to encode
+         * @param [writer] Writer to encode to
+         * @returns Writer
+         */
+        public static encode(message: PB.IBaudRateResponse, writer?: $protobuf.Writer): $protobuf.Writer;
+
+        /**
+         * Encodes the specified BaudRateResponse message, length delimited. Does not implicitly {@link PB.BaudRateResponse.verify|verify} messages.
+         * @param message BaudRateResponse message or plain object to encode
+         * @param [writer] Writer to encode to
+         * @returns Writer
+         */
+        public static encodeDelimited(message: PB.IBaudRateResponse, writer?: $protobuf.Writer): $protobuf.Writer;
+
+        /**
+         * Decodes a BaudRateResponse message from the specified reader or buffer.
+         * @param reader Reader or buffer to decode from
+         * @param [length] Message length if known beforehand
+         * @returns BaudRateResponse
+         * @throws {Error} If the payload is not a reader or valid buffer
+         * @throws {$protobuf.util.ProtocolError} If required fields are missing
+         */
+        public static decode(reader: ($protobuf.Reader|Uint8Array), length?: number): PB.BaudRateResponse;
+
+        /**
+         * Decodes a BaudRateResponse message from the specified reader or buffer, length delimited.
+         * @param reader Reader or buffer to decode from
+         * @returns BaudRateResponse
+         * @throws {Error} If the payload is not a reader or valid buffer
+         * @throws {$protobuf.util.ProtocolError} If required fields are missing
+         */
+        public static decodeDelimited(reader: ($protobuf.Reader|Uint8Array)): PB.BaudRateResponse;
+
+        /**
+         * Verifies a BaudRateResponse message.
+         * @param message Plain object to verify
+         * @returns `null` if valid, otherwise the reason why it is not
+         */
+        public static verify(message: { [k: string]: any }): (string|null);
+
+        /**
+         * Creates a BaudRateResponse message from a plain object. Also converts values to their respective internal types.
+         * @param object Plain object
+         * @returns BaudRateResponse
+         */
+        public static fromObject(object: { [k: string]: any }): PB.BaudRateResponse;
+
+        /**
+         * Creates a plain object from a BaudRateResponse message. Also converts values to other types if specified.
+         * @param message BaudRateResponse
+         * @param [options] Conversion options
+         * @returns Plain object
+         */
+        public static toObject(message: PB.BaudRateResponse, options?: $protobuf.IConversionOptions): { [k: string]: any };
+
+        /**
+         * Converts this BaudRateResponse to JSON.
+         * @returns JSON object
+         */
+        public toJSON(): { [k: string]: any };
+    }
+
+    namespace BaudRateResponse {
+
+        /** Status enum. */
+        enum Status {
+            ACCEPTED = 0,
+            REJECTED = 1,
+            CONFIRMED = 2,
+            REVERTED = 3
+        }
+    }
+
+    /** Properties of a ScheduleUploadResponse. */
+    interface IScheduleUploadResponse {
+
+        /** ScheduleUploadResponse phase */
+        phase?: (PB.ScheduleUpload.Phase|null);
+
+        /** ScheduleUploadResponse status */
+        status?: (PB.ScheduleUploadResponse.Status|null);
+
+        /** Bytes of the image received so far. */
+        nextOffset?: (number|null);
+
+        /** Number of entries in the schedule, after a successful COMMIT. */
+        recordCount?: (number|null);
+    }
+
+    /** Result of a ScheduleUpload. DATA chunks are only responded to if they fail; BEGIN and COMMIT always are. */
+    class ScheduleUploadResponse implements IScheduleUploadResponse {
+
+        /**
+         * Constructs a new ScheduleUploadResponse.
+         * @param [properties] Properties to set
+         */
+        constructor(properties?: PB.IScheduleUploadResponse);
+
+        /** ScheduleUploadResponse phase. */
+        public phase: PB.ScheduleUpload.Phase;
+
+        /** ScheduleUploadResponse status. */
+        public status: PB.ScheduleUploadResponse.Status;
+
+        /** Bytes of the image received so far. */
+        public nextOffset: number;
+
+        /** Number of entries in the schedule, after a successful COMMIT. */
+        public recordCount: number;
+
+        /**
+         * Creates a new ScheduleUploadResponse instance using the specified properties.
+         * @param [properties] Properties to set
+         * @returns ScheduleUploadResponse instance
+         */
+        public static create(properties?: PB.IScheduleUploadResponse): PB.ScheduleUploadResponse;
+
+        /**
+         * Encodes the specified ScheduleUploadResponse message. Does not implicitly {@link PB.ScheduleUploadResponse.verify|verify} messages.
+         * @param message ScheduleUploadResponse message or plain object to encode
+         * @param [writer] Writer to encode to
+         * @returns Writer
+         */
+        public static encode(message: PB.IScheduleUploadResponse, writer?: $protobuf.Writer): $protobuf.Writer;
+
+        /**
+         * Encodes the specified ScheduleUploadResponse message, length delimited. Does not implicitly {@link PB.ScheduleUploadResponse.verify|verify} messages.
+         * @param message ScheduleUploadResponse message or plain object to encode
+         * @param [writer] Writer to encode to
+         * @returns Writer
+         */
+        public static encodeDelimited(message: PB.IScheduleUploadResponse, writer?: $protobuf.Writer): $protobuf.Writer;
+
+        /**
+         * Decodes a ScheduleUploadResponse message from the specified reader or buffer.
+         * @param reader Reader or buffer to decode from
+         * @param [length] Message length if known beforehand
+         * @returns ScheduleUploadResponse
+         * @throws {Error} If the payload is not a reader or valid buffer
+         * @throws {$protobuf.util.ProtocolError} If required fields are missing
+         */
+        public static decode(reader: ($protobuf.Reader|Uint8Array), length?: number): PB.ScheduleUploadResponse;
+
+        /**
+         * Decodes a ScheduleUploadResponse message from the specified reader or buffer, length delimited.
+         * @param reader Reader or buffer to decode from
+         * @returns ScheduleUploadResponse
+         * @throws {Error} If the payload is not a reader or valid buffer
+         * @throws {$protobuf.util.ProtocolError} If required fields are missing
+         */
+        public static decodeDelimited(reader: ($protobuf.Reader|Uint8Array)): PB.ScheduleUploadResponse;
+
+        /**
+         * Verifies a ScheduleUploadResponse message.
+         * @param message Plain object to verify
+         * @returns `null` if valid, otherwise the reason why it is not
+         */
+        public static verify(message: { [k: string]: any }): (string|null);
+
+        /**
+         * Creates a ScheduleUploadResponse message from a plain object. Also converts values to their respective internal types.
+         * @param object Plain object
+         * @returns ScheduleUploadResponse
+         */
+        public static fromObject(object: { [k: string]: any }): PB.ScheduleUploadResponse;
+
+        /**
+         * Creates a plain object from a ScheduleUploadResponse message. Also converts values to other types if specified.
+         * @param message ScheduleUploadResponse
+         * @param [options] Conversion options
+         * @returns Plain object
+         */
+        public static toObject(message: PB.ScheduleUploadResponse, options?: $protobuf.IConversionOptions): { [k: string]: any };
+
+        /**
+         * Converts this ScheduleUploadResponse to JSON.
+         * @returns JSON object
+         */
+        public toJSON(): { [k: string]: any };
+    }
+
+    namespace ScheduleUploadResponse {
+
+        /** Status enum. */
+        enum Status {
+            OK = 0,
+            NO_PARTITION = 1,
+            TOO_LARGE = 2,
+            NOT_STARTED = 3,
+            BAD_OFFSET = 4,
+            INCOMPLETE = 5,
+            CRC_MISMATCH = 6,
+            INVALID_SCHEDULE = 7,
+            FLASH_ERROR = 8
+        }
+    }
+
     /** Properties of a SupervisorState. */
     interface ISupervisorState {
 
@@ -760,6 +1033,12 @@ export namespace PB {
 
         /** FromSplitflap supervisorState */
         supervisorState?: (PB.ISupervisorState|null);
+
+        /** FromSplitflap baudRateResponse */
+        baudRateResponse?: (PB.IBaudRateResponse|null);
+
+        /** FromSplitflap scheduleUploadResponse */
+        scheduleUploadResponse?: (PB.IScheduleUploadResponse|null);
     }
 
     /** Represents a FromSplitflap. */
@@ -783,8 +1062,14 @@ export namespace PB {
         /** FromSplitflap supervisorState. */
         public supervisorState?: (PB.ISupervisorState|null);
 
+        /** FromSplitflap baudRateResponse. */
+        public baudRateResponse?: (PB.IBaudRateResponse|null);
+
+        /** FromSplitflap scheduleUploadResponse. */
+        public scheduleUploadResponse?: (PB.IScheduleUploadResponse|null);
+
         /** FromSplitflap payload. */
-        public payload?: ("splitflapState"|"log"|"ack"|"supervisorState");
+        public payload?: ("splitflapState"|"log"|"ack"|"supervisorState"|"baudRateResponse"|"scheduleUploadResponse");
 
         /**
          * Creates a new FromSplitflap instance using the specified properties.
@@ -1275,6 +1560,571 @@ export namespace PB {
         }
     }
 
+    /** Properties of a RequestState. */
+    interface IRequestState {
+    }
+
+    /** Represents a RequestState. */
+    class RequestState implements IRequestState {
+
+        /**
+         * Constructs a new RequestState.
+         * @param [properties] Properties to set
+         */
+        constructor(properties?: PB.IRequestState);
+
+        /**
+         * Creates a new RequestState instance using the specified properties.
+         * @param [properties] Properties to set
+         * @returns RequestState instance
+         */
+        public static create(properties?: PB.IRequestState): PB.RequestState;
+
+        /**
+         * Encodes the specified RequestState message. Does not implicitly {@link PB.RequestState.verify|verify} messages.
+         * @param message RequestState message or plain object to encode
+         * @param [writer] Writer to encode to
+         * @returns Writer
+         */
+        public static encode(message: PB.IRequestState, writer?: $protobuf.Writer): $protobuf.Writer;
+
+        /**
+         * Encodes the specified RequestState message, length delimited. Does not implicitly {@link PB.RequestState.verify|verify} messages.
+         * @param message RequestState message or plain object to encode
+         * @param [writer] Writer to encode to
+         * @returns Writer
+         */
+        public static encodeDelimited(message: PB.IRequestState, writer?: $protobuf.Writer): $protobuf.Writer;
+
+        /**
+         * Decodes a RequestState message from the specified reader or buffer.
+         * @param reader Reader or buffer to decode from
+         * @param [length] Message length if known beforehand
+         * @returns RequestState
+         * @throws {Error} If the payload is not a reader or valid buffer
+         * @throws {$protobuf.util.ProtocolError} If required fields are missing
+         */
+        public static decode(reader: ($protobuf.Reader|Uint8Array), length?: number): PB.RequestState;
+
+        /**
+         * Decodes a RequestState message from the specified reader or buffer, length delimited.
+         * @param reader Reader or buffer to decode from
+         * @returns RequestState
+         * @throws {Error} If the payload is not a reader or valid buffer
+         * @throws {$protobuf.util.ProtocolError} If required fields are missing
+         */
+        public static decodeDelimited(reader: ($protobuf.Reader|Uint8Array)): PB.RequestState;
+
+        /**
+         * Verifies a RequestState message.
+         * @param message Plain object to verify
+         * @returns `null` if valid, otherwise the reason why it is not
+         */
+        public static verify(message: { [k: string]: any }): (string|null);
+
+        /**
+         * Creates a RequestState message from a plain object. Also converts values to their respective internal types.
+         * @param object Plain object
+         * @returns RequestState
+         */
+        public static fromObject(object: { [k: string]: any }): PB.RequestState;
+
+        /**
+         * Creates a plain object from a RequestState message. Also converts values to other types if specified.
+         * @param message RequestState
+         * @param [options] Conversion options
+         * @returns Plain object
+         */
+        public static toObject(message: PB.RequestState, options?: $protobuf.IConversionOptions): { [k: string]: any };
+
+        /**
+         * Converts this RequestState to JSON.
+         * @returns JSON object
+         */
+        public toJSON(): { [k: string]: any };
+    }
+
+    /** Properties of a Subscribe. */
+    interface ISubscribe {
+
+        /** Minimum time between state messages triggered by state changes. Default 250ms. */
+        minIntervalMillis?: (number|null);
+
+        /** Max time between state messages, even without any changes. Default 5000ms. */
+        heartbeatIntervalMillis?: (number|null);
+
+        /**
+         * Range of modules to report: module_count modules starting at module_start (reported back in
+         * SplitflapState.module_start). A module_count of 0 means all modules from module_start onward.
+         */
+        moduleStart?: (number|null);
+
+        /** Subscribe moduleCount */
+        moduleCount?: (number|null);
+
+        /**
+         * SplitflapState.ModuleState fields to report, as a bitmask where field number N is bit (N - 1). Fields
+         * that aren't included are left at their default value, so they aren't encoded at all, and changes to
+         * them don't trigger state messages. Default (0) is all fields.
+         */
+        fieldMask?: (number|null);
+    }
+
+    /**
+     * Configures the SplitflapState messages pushed to the client, so bandwidth scales with what it actually
+     * uses. Each Subscribe replaces the previous configuration; zero values select the defaults. A WindowConfig
+     * (which starts every client session) also restores the defaults.
+     */
+    class Subscribe implements ISubscribe {
+
+        /**
+         * Constructs a new Subscribe.
+         * @param [properties] Properties to set
+         */
+        constructor(properties?: PB.ISubscribe);
+
+        /** Minimum time between state messages triggered by state changes. Default 250ms. */
+        public minIntervalMillis: number;
+
+        /** Max time between state messages, even without any changes. Default 5000ms. */
+        public heartbeatIntervalMillis: number;
+
+        /**
+         * Range of modules to report: module_count modules starting at module_start (reported back in
+         * SplitflapState.module_start). A module_count of 0 means all modules from module_start onward.
+         */
+        public moduleStart: number;
+
+        /** Subscribe moduleCount. */
+        public moduleCount: number;
+
+        /**
+         * SplitflapState.ModuleState fields to report, as a bitmask where field number N is bit (N - 1). Fields
+         * that aren't included are left at their default value, so they aren't encoded at all, and changes to
+         * them don't trigger state messages. Default (0) is all fields.
+         */
+        public fieldMask: number;
+
+        /**
+         * Creates a new Subscribe instance using the specified properties.
+         * @param [properties] Properties to set
+         * @returns Subscribe instance
+         */
+        public static create(properties?: PB.ISubscribe): PB.Subscribe;
+
+        /**
+         * Encodes the specified Subscribe message. Does not implicitly {@link PB.Subscribe.verify|verify} messages.
+         * @param message Subscribe message or plain object to encode
+         * @param [writer] Writer to encode to
+         * @returns Writer
+         */
+        public static encode(message: PB.ISubscribe, writer?: $protobuf.Writer): $protobuf.Writer;
+
+        /**
+         * Encodes the specified Subscribe message, length delimited. Does not implicitly {@link PB.Subscribe.verify|verify} messages.
+         * @param message Subscribe message or plain object to encode
+         * @param [writer] Writer to encode to
+         * @returns Writer
+         */
+        public static encodeDelimited(message: PB.ISubscribe, writer?: $protobuf.Writer): $protobuf.Writer;
+
+        /**
+         * Decodes a Subscribe message from the specified reader or buffer.
+         * @param reader Reader or buffer to decode from
+         * @param [length] Message length if known beforehand
+         * @returns Subscribe
+         * @throws {Error} If the payload is not a reader or valid buffer
+         * @throws {$protobuf.util.ProtocolError} If required fields are missing
+         */
+        public static decode(reader: ($protobuf.Reader|Uint8Array), length?: number): PB.Subscribe;
+
+        /**
+         * Decodes a Subscribe message from the specified reader or buffer, length delimited.
+         * @param reader Reader or buffer to decode from
+         * @returns Subscribe
+         * @throws {Error} If the payload is not a reader or valid buffer
+         * @throws {$protobuf.util.ProtocolError} If required fields are missing
+         */
+        public static decodeDelimited(reader: ($protobuf.Reader|Uint8Array)): PB.Subscribe;
+
+        /**
+         * Verifies a Subscribe message.
+         * @param message Plain object to verify
+         * @returns `null` if valid, otherwise the reason why it is not
+         */
+        public static verify(message: { [k: string]: any }): (string|null);
+
+        /**
+         * Creates a Subscribe message from a plain object. Also converts values to their respective internal types.
+         * @param object Plain object
+         * @returns Subscribe
+         */
+        public static fromObject(object: { [k: string]: any }): PB.Subscribe;
+
+        /**
+         * Creates a plain object from a Subscribe message. Also converts values to other types if specified.
+         * @param message Subscribe
+         * @param [options] Conversion options
+         * @returns Plain object
+         */
+        public static toObject(message: PB.Subscribe, options?: $protobuf.IConversionOptions): { [k: string]: any };
+
+        /**
+         * Converts this Subscribe to JSON.
+         * @returns JSON object
+         */
+        public toJSON(): { [k: string]: any };
+    }
+
+    /** Properties of a WindowConfig. */
+    interface IWindowConfig {
+
+        /** WindowConfig windowSize */
+        windowSize?: (number|null);
+    }
+
+    /**
+     * Switches the transport to a sliding window, allowing multiple messages to be in flight before they are
+     * acknowledged. The nonce of the ToSplitflap message carrying this config is the base of the window; the
+     * client must send subsequent messages with consecutive nonces. The accepted window size (which may be
+     * smaller than requested) is reported in the Ack; a window_size of 1 selects the stop-and-wait transport.
+     *
+     * Clients should send this as their first message, even if they only use stop-and-wait, since the transport
+     * otherwise carries on from where the previous client left it (and a new client's nonces could fall within
+     * its window).
+     */
+    class WindowConfig implements IWindowConfig {
+
+        /**
+         * Constructs a new WindowConfig.
+         * @param [properties] Properties to set
+         */
+        constructor(properties?: PB.IWindowConfig);
+
+        /** WindowConfig windowSize. */
+        public windowSize: number;
+
+        /**
+         * Creates a new WindowConfig instance using the specified properties.
+         * @param [properties] Properties to set
+         * @returns WindowConfig instance
+         */
+        public static create(properties?: PB.IWindowConfig): PB.WindowConfig;
+
+        /**
+         * Encodes the specified WindowConfig message. Does not implicitly {@link PB.WindowConfig.verify|verify} messages.
+         * @param message WindowConfig message or plain object to encode
+         * @param [writer] Writer to encode to
+         * @returns Writer
+         */
+        public static encode(message: PB.IWindowConfig, writer?: $protobuf.Writer): $protobuf.Writer;
+
+        /**
+         * Encodes the specified WindowConfig message, length delimited. Does not implicitly {@link PB.WindowConfig.verify|verify} messages.
+         * @param message WindowConfig message or plain object to encode
+         * @param [writer] Writer to encode to
+         * @returns Writer
+         */
+        public static encodeDelimited(message: PB.IWindowConfig, writer?: $protobuf.Writer): $protobuf.Writer;
+
+        /**
+         * Decodes a WindowConfig message from the specified reader or buffer.
+         * @param reader Reader or buffer to decode from
+         * @param [length] Message length if known beforehand
+         * @returns WindowConfig
+         * @throws {Error} If the payload is not a reader or valid buffer
+         * @throws {$protobuf.util.ProtocolError} If required fields are missing
+         */
+        public static decode(reader: ($protobuf.Reader|Uint8Array), length?: number): PB.WindowConfig;
+
+        /**
+         * Decodes a WindowConfig message from the specified reader or buffer, length delimited.
+         * @param reader Reader or buffer to decode from
+         * @returns WindowConfig
+         * @throws {Error} If the payload is not a reader or valid buffer
+         * @throws {$protobuf.util.ProtocolError} If required fields are missing
+         */
+        public static decodeDelimited(reader: ($protobuf.Reader|Uint8Array)): PB.WindowConfig;
+
+        /**
+         * Verifies a WindowConfig message.
+         * @param message Plain object to verify
+         * @returns `null` if valid, otherwise the reason why it is not
+         */
+        public static verify(message: { [k: string]: any }): (string|null);
+
+        /**
+         * Creates a WindowConfig message from a plain object. Also converts values to their respective internal types.
+         * @param object Plain object
+         * @returns WindowConfig
+         */
+        public static fromObject(object: { [k: string]: any }): PB.WindowConfig;
+
+        /**
+         * Creates a plain object from a WindowConfig message. Also converts values to other types if specified.
+         * @param message WindowConfig
+         * @param [options] Conversion options
+         * @returns Plain object
+         */
+        public static toObject(message: PB.WindowConfig, options?: $protobuf.IConversionOptions): { [k: string]: any };
+
+        /**
+         * Converts this WindowConfig to JSON.
+         * @returns JSON object
+         */
+        public toJSON(): { [k: string]: any };
+    }
+
+    /** Properties of a BaudRateChange. */
+    interface IBaudRateChange {
+
+        /** BaudRateChange phase */
+        phase?: (PB.BaudRateChange.Phase|null);
+
+        /** BaudRateChange baudRate */
+        baudRate?: (number|null);
+    }
+
+    /**
+     * Two-phase change of the serial link's baud rate:
+     * 1. The client sends a PROPOSE at the current rate and waits for a BaudRateResponse. If ACCEPTED, the
+     * splitflap has already switched to the new rate.
+     * 2. The client switches to the new rate and sends a CONFIRM (with the same baud_rate) there. If the
+     * splitflap doesn't receive the CONFIRM within a timeout, it reverts to the previous rate (and reports
+     * REVERTED), so a rate that doesn't work on the link can never leave the splitflap unreachable. A client
+     * whose CONFIRM isn't acknowledged within the same timeout should revert as well.
+     *
+     * No other messages should be in flight during the handshake.
+     */
+    class BaudRateChange implements IBaudRateChange {
+
+        /**
+         * Constructs a new BaudRateChange.
+         * @param [properties] Properties to set
+         */
+        constructor(properties?: PB.IBaudRateChange);
+
+        /** BaudRateChange phase. */
+        public phase: PB.BaudRateChange.Phase;
+
+        /** BaudRateChange baudRate. */
+        public baudRate: number;
+
+        /**
+         * Creates a new BaudRateChange instance using the specified properties.
+         * @param [properties] Properties to set
+         * @returns BaudRateChange instance
+         */
+        public static create(properties?: PB.IBaudRateChange): PB.BaudRateChange;
+
+        /**
+         * Encodes the specified BaudRateChange message. Does not implicitly {@link PB.BaudRateChange.verify|verify} messages.
+         * @param message BaudRateChange message or plain object to encode
+         * @param [writer] Writer to encode to
+         * @returns Writer
+         */
+        public static encode(message: PB.IBaudRateChange, writer?: $protobuf.Writer): $protobuf.Writer;
+
+        /**
+         * Encodes the specified BaudRateChange message, length delimited. Does not implicitly {@link PB.BaudRateChange.verify|verify} messages.
+         * @param message BaudRateChange message or plain object to encode
+         * @param [writer] Writer to encode to
+         * @returns Writer
+         */
+        public static encodeDelimited(message: PB.IBaudRateChange, writer?: $protobuf.Writer): $protobuf.Writer;
+
+        /**
+         * Decodes a BaudRateChange message from the specified reader or buffer.
+         * @param reader Reader or buffer to decode from
+         * @param [length] Message length if known beforehand
+         * @returns BaudRateChange
+         * @throws {Error} If the payload is not a reader or valid buffer
+         * @throws {$protobuf.util.ProtocolError} If required fields are missing
+         */
+        public static decode(reader: ($protobuf.Reader|Uint8Array), length?: number): PB.BaudRateChange;
+
+        /**
+         * Decodes a BaudRateChange message from the specified reader or buffer, length delimited.
+         * @param reader Reader or buffer to decode from
+         * @returns BaudRateChange
+         * @throws {Error} If the payload is not a reader or valid buffer
+         * @throws {$protobuf.util.ProtocolError} If required fields are missing
+         */
+        public static decodeDelimited(reader: ($protobuf.Reader|Uint8Array)): PB.BaudRateChange;
+
+        /**
+         * Verifies a BaudRateChange message.
+         * @param message Plain object to verify
+         * @returns `null` if valid, otherwise the reason why it is not
+         */
+        public static verify(message: { [k: string]: any }): (string|null);
+
+        /**
+         * Creates a BaudRateChange message from a plain object. Also converts values to their respective internal types.
+         * @param object Plain object
+         * @returns BaudRateChange
+         */
+        public static fromObject(object: { [k: string]: any }): PB.BaudRateChange;
+
+        /**
+         * Creates a plain object from a BaudRateChange message. Also converts values to other types if specified.
+         * @param message BaudRateChange
+         * @param [options] Conversion options
+         * @returns Plain object
+         */
+        public static toObject(message: PB.BaudRateChange, options?: $protobuf.IConversionOptions): { [k: string]: any };
+
+        /**
+         * Converts this BaudRateChange to JSON.
+         * @returns JSON object
+         */
+        public toJSON(): { [k: string]: any };
+    }
+
+    namespace BaudRateChange {
+
+        /** Phase enum. */
+        enum Phase {
+            PROPOSE = 0,
+            CONFIRM = 1
+        }
+    }
+
+    /** Properties of a ScheduleUpload. */
+    interface IScheduleUpload {
+
+        /** ScheduleUpload phase */
+        phase?: (PB.ScheduleUpload.Phase|null);
+
+        /** BEGIN only: total size of the image. */
+        size?: (number|null);
+
+        /** DATA only. */
+        offset?: (number|null);
+
+        /** ScheduleUpload data */
+        data?: (Uint8Array|null);
+
+        /** COMMIT only: CRC32 of the whole image. */
+        crc32?: (number|null);
+    }
+
+    /**
+     * Replaces the schedule of timed messages with an image built by software/chainlink/schedule.py, which is written
+     * to a flash partition as it's received:
+     * 1. BEGIN with the size of the image. The current schedule stops being used immediately.
+     * 2. DATA chunks, in order, each at the offset following the previous one.
+     * 3. COMMIT with the CRC32 of the whole image. The image is verified and, if it's valid, used from then on.
+     *
+     * Failures are reported in a ScheduleUploadResponse and end the upload, so it has to be restarted with a BEGIN.
+     *
+     * With a sliding window, a ScheduleUpload that arrives while an earlier message is missing isn't buffered (or
+     * acked), so it's retried along with the missing one.
+     */
+    class ScheduleUpload implements IScheduleUpload {
+
+        /**
+         * Constructs a new ScheduleUpload.
+         * @param [properties] Properties to set
+         */
+        constructor(properties?: PB.IScheduleUpload);
+
+        /** ScheduleUpload phase. */
+        public phase: PB.ScheduleUpload.Phase;
+
+        /** BEGIN only: total size of the image. */
+        public size: number;
+
+        /** DATA only. */
+        public offset: number;
+
+        /** ScheduleUpload data. */
+        public data: Uint8Array;
+
+        /** COMMIT only: CRC32 of the whole image. */
+        public crc32: number;
+
+        /**
+         * Creates a new ScheduleUpload instance using the specified properties.
+         * @param [properties] Properties to set
+         * @returns ScheduleUpload instance
+         */
+        public static create(properties?: PB.IScheduleUpload): PB.ScheduleUpload;
+
+        /**
+         * Encodes the specified ScheduleUpload message. Does not implicitly {@link PB.ScheduleUpload.verify|verify} messages.
+         * @param message ScheduleUpload message or plain object to encode
+         * @param [writer] Writer to encode to
+         * @returns Writer
+         */
+        public static encode(message: PB.IScheduleUpload, writer?: $protobuf.Writer): $protobuf.Writer;
+
+        /**
+         * Encodes the specified ScheduleUpload message, length delimited. Does not implicitly {@link PB.ScheduleUpload.verify|verify} messages.
+         * @param message ScheduleUpload message or plain object to encode
+         * @param [writer] Writer to encode to
+         * @returns Writer
+         */
+        public static encodeDelimited(message: PB.IScheduleUpload, writer?: $protobuf.Writer): $protobuf.Writer;
+
+        /**
+         * Decodes a ScheduleUpload message from the specified reader or buffer.
+         * @param reader Reader or buffer to decode from
+         * @param [length] Message length if known beforehand
+         * @returns ScheduleUpload
+         * @throws {Error} If the payload is not a reader or valid buffer
+         * @throws {$protobuf.util.ProtocolError} If required fields are missing
+         */
+        public static decode(reader: ($protobuf.Reader|Uint8Array), length?: number): PB.ScheduleUpload;
+
+        /**
+         * Decodes a ScheduleUpload message from the specified reader or buffer, length delimited.
+         * @param reader Reader or buffer to decode from
+         * @returns ScheduleUpload
+         * @throws {Error} If the payload is not a reader or valid buffer
+         * @throws {$protobuf.util.ProtocolError} If required fields are missing
+         */
+        public static decodeDelimited(reader: ($protobuf.Reader|Uint8Array)): PB.ScheduleUpload;
+
+        /**
+         * Verifies a ScheduleUpload message.
+         * @param message Plain object to verify
+         * @returns `null` if valid, otherwise the reason why it is not
+         */
+        public static verify(message: { [k: string]: any }): (string|null);
+
+        /**
+         * Creates a ScheduleUpload message from a plain object. Also converts values to their respective internal types.
+         * @param object Plain object
+         * @returns ScheduleUpload
+         */
+        public static fromObject(object: { [k: string]: any }): PB.ScheduleUpload;
+
+        /**
+         * Creates a plain object from a ScheduleUpload message. Also converts values to other types if specified.
+         * @param message ScheduleUpload
+         * @param [options] Conversion options
+         * @returns Plain object
+         */
+        public static toObject(message: PB.ScheduleUpload, options?: $protobuf.IConversionOptions): { [k: string]: any };
+
+        /**
+         * Converts this ScheduleUpload to JSON.
+         * @returns JSON object
+         */
+        public toJSON(): { [k: string]: any };
+    }
+
+    namespace ScheduleUpload {
+
+        /** Phase enum. */
+        enum Phase {
+            BEGIN = 0,
+            DATA = 1,
+            COMMIT = 2
+        }
+    }
+
     /** Properties of a ToSplitflap. */
     interface IToSplitflap {
 
@@ -1286,6 +2136,21 @@ export namespace PB {
 
         /** ToSplitflap splitflapConfig */
         splitflapConfig?: (PB.ISplitflapConfig|null);
+
+        /** ToSplitflap requestState */
+        requestState?: (PB.IRequestState|null);
+
+        /** ToSplitflap windowConfig */
+        windowConfig?: (PB.IWindowConfig|null);
+
+        /** ToSplitflap baudRateChange */
+        baudRateChange?: (PB.IBaudRateChange|null);
+
+        /** ToSplitflap subscribe */
+        subscribe?: (PB.ISubscribe|null);
+
+        /** ToSplitflap scheduleUpload */
+        scheduleUpload?: (PB.IScheduleUpload|null);
     }
 
     /** Represents a ToSplitflap. */
@@ -1306,8 +2171,23 @@ export namespace PB {
         /** ToSplitflap splitflapConfig. */
         public splitflapConfig?: (PB.ISplitflapConfig|null);
 
+        /** ToSplitflap requestState. */
+        public requestState?: (PB.IRequestState|null);
+
+        /** ToSplitflap windowConfig. */
+        public windowConfig?: (PB.IWindowConfig|null);
+
+        /** ToSplitflap baudRateChange. */
+        public baudRateChange?: (PB.IBaudRateChange|null);
+
+        /** ToSplitflap subscribe. */
+        public subscribe?: (PB.ISubscribe|null);
+
+        /** ToSplitflap scheduleUpload. */
+        public scheduleUpload?: (PB.IScheduleUpload|null);
+
         /** ToSplitflap payload. */
-        public payload?: ("splitflapCommand"|"splitflapConfig");
+        public payload?: ("splitflapCommand"|"splitflapConfig"|"requestState"|"windowConfig"|"baudRateChange"|"subscribe"|"scheduleUpload");
 
         /**
          * Creates a new ToSplitflap instance using the specified properties.
@@ -32,6 +32,7 @@
              * @memberof PB
              * @interface ISplitflapState
              * @property {Array.<PB.SplitflapState.IModuleState>|null} [modules] SplitflapState modules
+             * @property {number|null} [moduleStart] Index of the module that modules[0] describes (nonzero only if a Subscribe restricted the module range).
              */
     
             /**
@@ -58,6 +59,14 @@
              */
             SplitflapState.prototype.modules = $util.emptyArray;
     
+            /**
+             * Index of the module that modules[0] describes (nonzero only if a Subscribe restricted the module range).
+             * @member {number} moduleStart
+             * @memberof PB.SplitflapState
+             * @instance
+             */
+            SplitflapState.prototype.moduleStart = 0;
+    
             /**
              * Creates a new SplitflapState instance using the specified properties.
              * @function create
@@ -85,6 +94,8 @@
                 if (message.modules != null && message.modules.length)
                     for (var i = 0; i < message.modules.length; ++i)
                         $root.PB.SplitflapState.ModuleState.encode(message.modules[i], writer.uint32(/* id 1, wireType 2 =*/10).fork()).ldelim();
+                if (message.moduleStart != null && Object.hasOwnProperty.call(message, "moduleStart"))
+                    writer.uint32(/* id 2, wireType 0 =*/16).uint32(message.moduleStart);
                 return writer;
             };
     
@@ -124,6 +135,9 @@
                             message.modules = [];
                         message.modules.push($root.PB.SplitflapState.ModuleState.decode(reader, reader.uint32()));
                         break;
+                    case 2:
+                        message.moduleStart = reader.uint32();
+                        break;
                     default:
                         reader.skipType(tag & 7);
                         break;
@@ -168,6 +182,9 @@
                             return "modules." + error;
                     }
                 }
+                if (message.moduleStart != null && message.hasOwnProperty("moduleStart"))
+                    if (!$util.isInteger(message.moduleStart))
+                        return "moduleStart: integer expected";
                 return null;
             };
     
@@ -193,6 +210,8 @@
                         message.modules[i] = $root.PB.SplitflapState.ModuleState.fromObject(object.modules[i]);
                     }
                 }
+                if (object.moduleStart != null)
+                    message.moduleStart = object.moduleStart >>> 0;
                 return message;
             };
     
@@ -211,11 +230,15 @@
                 var object = {};
                 if (options.arrays || options.defaults)
                     object.modules = [];
+                if (options.defaults)
+                    object.moduleStart = 0;
                 if (message.modules && message.modules.length) {
                     object.modules = [];
                     for (var j = 0; j < message.modules.length; ++j)
                         object.modules[j] = $root.PB.SplitflapState.ModuleState.toObject(message.modules[j], options);
                 }
+                if (message.moduleStart != null && message.hasOwnProperty("moduleStart"))
+                    object.moduleStart = message.moduleStart;
                 return object;
             };
     
@@ -773,6 +796,12 @@
              * @memberof PB
              * @interface IAck
              * @property {number|null} [nonce] Ack nonce
+             * @property {number|null} [cumulativeNonce] Sliding window transport only (see WindowConfig): every nonce up to and including
+             * cumulative_nonce has been received.
+             * @property {number|null} [selectiveMask] Sliding window transport only: bit i is set if nonce (cumulative_nonce + 1 + i) has also been
+             * received, ahead of a missing earlier nonce.
+             * @property {number|null} [windowSize] Number of unacknowledged messages the splitflap accepts from the client, as negotiated via
+             * WindowConfig. 0 means the transport is stop-and-wait: only one message may be in flight.
              */
     
             /**
@@ -798,6 +827,33 @@
              */
             Ack.prototype.nonce = 0;
     
+            /**
+             * Sliding window transport only (see WindowConfig): every nonce up to and including
+             * cumulative_nonce has been received.
+             * @member {number} cumulativeNonce
+             * @memberof PB.Ack
+             * @instance
+             */
+            Ack.prototype.cumulativeNonce = 0;
+    
+            /**
+             * Sliding window transport only: bit i is set if nonce (cumulative_nonce + 1 + i) has also been
+             * received, ahead of a missing earlier nonce.
+             * @member {number} selectiveMask
+             * @memberof PB.Ack
+             * @instance
+             */
+            Ack.prototype.selectiveMask = 0;
+    
+            /**
+             * Number of unacknowledged messages the splitflap accepts from the client, as negotiated via
+             * WindowConfig. 0 means the transport is stop-and-wait: only one message may be in flight.
+             * @member {number} windowSize
+             * @memberof PB.Ack
+             * @instance
+             */
+            Ack.prototype.windowSize = 0;
+    
             /**
              * Creates a new Ack instance using the specified properties.
              * @function create
@@ -824,6 +880,12 @@
                     writer = $Writer.create();
                 if (message.nonce != null && Object.hasOwnProperty.call(message, "nonce"))
                     writer.uint32(/* id 1, wireType 0 =*/8).uint32(message.nonce);
+                if (message.cumulativeNonce != null && Object.hasOwnProperty.call(message, "cumulativeNonce"))
+                    writer.uint32(/* id 2, wireType 0 =*/16).uint32(message.cumulativeNonce);
+                if (message.selectiveMask != null && Object.hasOwnProperty.call(message, "selectiveMask"))
+                    writer.uint32(/* id 3, wireType 0 =*/24).uint32(message.selectiveMask);
+                if (message.windowSize != null && Object.hasOwnProperty.call(message, "windowSize"))
+                    writer.uint32(/* id 4, wireType 0 =*/32).uint32(message.windowSize);
                 return writer;
             };
     
@@ -861,6 +923,15 @@
                     case 1:
                         message.nonce = reader.uint32();
                         break;
+                    case 2:
+                        message.cumulativeNonce = reader.uint32();
+                        break;
+                    case 3:
+                        message.selectiveMask = reader.uint32();
+                        break;
+                    case 4:
+                        message.windowSize = reader.uint32();
+                        break;
                     default:
                         reader.skipType(tag & 7);
                         break;
@@ -899,6 +970,15 @@
                 if (message.nonce != null && message.hasOwnProperty("nonce"))
                     if (!$util.isInteger(message.nonce))
                         return "nonce: integer expected";
+                if (message.cumulativeNonce != null && message.hasOwnProperty("cumulativeNonce"))
+                    if (!$util.isInteger(message.cumulativeNonce))
+                        return "cumulativeNonce: integer expected";
+                if (message.selectiveMask != null && message.hasOwnProperty("selectiveMask"))
+                    if (!$util.isInteger(message.selectiveMask))
+                        return "selectiveMask: integer expected";
+                if (message.windowSize != null && message.hasOwnProperty("windowSize"))
+                    if (!$util.isInteger(message.windowSize))
+                        return "windowSize: integer expected";
                 return null;
             };
     
@@ -916,6 +996,12 @@
                 var message = new $root.PB.Ack();
                 if (object.nonce != null)
                     message.nonce = object.nonce >>> 0;
+                if (object.cumulativeNonce != null)
+                    message.cumulativeNonce = object.cumulativeNonce >>> 0;
+                if (object.selectiveMask != null)
+                    message.selectiveMask = object.selectiveMask >>> 0;
+                if (object.windowSize != null)
+                    message.windowSize = object.windowSize >>> 0;
                 return message;
             };
     
@@ -932,10 +1018,20 @@
                 if (!options)
                     options = {};
                 var object = {};
-                if (options.defaults)
+                if (options.defaults) {
                     object.nonce = 0;
+                    object.cumulativeNonce = 0;
+                    object.selectiveMask = 0;
+                    object.windowSize = 0;
+                }
                 if (message.nonce != null && message.hasOwnProperty("nonce"))
                     object.nonce = message.nonce;
+                if (message.cumulativeNonce != null && message.hasOwnProperty("cumulativeNonce"))
+                    object.cumulativeNonce = message.cumulativeNonce;
+                if (message.selectiveMask != null && message.hasOwnProperty("selectiveMask"))
+                    object.selectiveMask = message.selectiveMask;
+                if (message.windowSize != null && message.hasOwnProperty("windowSize"))
+                    object.windowSize = message.windowSize;
                 return object;
             };
     
@@ -953,28 +1049,25 @@
             return Ack;
         })();
     
-        PB.SupervisorState = (function() {
+        PB.BaudRateResponse = (function() {
     
             /**
-             * Properties of a SupervisorState.
+             * Properties of a BaudRateResponse.
              * @memberof PB
-             * @interface ISupervisorState
-             * @property {number|null} [uptimeMillis] SupervisorState uptimeMillis
-             * @property {PB.SupervisorState.State|null} [state] SupervisorState state
-             * @property {Array.<PB.SupervisorState.IPowerChannelState>|null} [powerChannels] SupervisorState powerChannels
-             * @property {PB.SupervisorState.IFaultInfo|null} [faultInfo] SupervisorState faultInfo
+             * @interface IBaudRateResponse
+             * @property {PB.BaudRateResponse.Status|null} [status] BaudRateResponse status
+             * @property {number|null} [baudRate] BaudRateResponse baudRate
              */
     
             /**
-             * Constructs a new SupervisorState.
+             * Constructs a new BaudRateResponse.
              * @memberof PB
-             * @classdesc Represents a SupervisorState.
-             * @implements ISupervisorState
+             * @classdesc Result of a BaudRateChange request; see BaudRateChange for the handshake.
+             * @implements IBaudRateResponse
              * @constructor
-             * @param {PB.ISupervisorState=} [properties] Properties to set
+             * @param {PB.IBaudRateResponse=} [properties] Properties to set
              */
-            function SupervisorState(properties) {
-                this.powerChannels = [];
+            function BaudRateResponse(properties) {
                 if (properties)
                     for (var keys = Object.keys(properties), i = 0; i < keys.length; ++i)
                         if (properties[keys[i]] != null)
@@ -982,117 +1075,88 @@
             }
     
             /**
-             * SupervisorState uptimeMillis.
-             * @member {number} uptimeMillis
-             * @memberof PB.SupervisorState
-             * @instance
-             */
-            SupervisorState.prototype.uptimeMillis = 0;
-    
-            /**
-             * SupervisorState state.
-             * @member {PB.SupervisorState.State} state
-             * @memberof PB.SupervisorState
-             * @instance
-             */
-            SupervisorState.prototype.state = 0;
-    
-            /**
-             * SupervisorState powerChannels.
-             * @member {Array.<PB.SupervisorState.IPowerChannelState>} powerChannels
-             * @memberof PB.SupervisorState
+             * BaudRateResponse status.
+             * @member {PB.BaudRateResponse.Status} status
+             * @memberof PB.BaudRateResponse
              * @instance
              */
-            SupervisorState.prototype.powerChannels = $util.emptyArray;
+            BaudRateResponse.prototype.status = 0;
     
             /**
-             * SupervisorState faultInfo.
-             * @member {PB.SupervisorState.IFaultInfo|null|undefined} faultInfo
-             * @memberof PB.SupervisorState
+             * BaudRateResponse baudRate.
+             * @member {number} baudRate
+             * @memberof PB.BaudRateResponse
              * @instance
              */
-            SupervisorState.prototype.faultInfo = null;
+            BaudRateResponse.prototype.baudRate = 0;
     
             /**
-             * Creates a new SupervisorState instance using the specified properties.
+             * Creates a new BaudRateResponse instance using the specified properties.
              * @function create
-             * @memberof PB.SupervisorState
+             * @memberof PB.BaudRateResponse
              * @static
-             * @param {PB.ISupervisorState=} [properties] Properties to set
-             * @returns {PB.SupervisorState} SupervisorState instance
+             * @param {PB.IBaudRateResponse=} [properties] Properties to set
+             * @returns {PB.BaudRateResponse} BaudRateResponse instance
              */
-            SupervisorState.create = function create(properties) {
-                return new SupervisorState(properties);
+            BaudRateResponse.create = function create(properties) {
+                return new BaudRateResponse(properties);
             };
     
             /**
-             * Encodes the specified SupervisorState message. Does not implicitly {@link PB.SupervisorState.verify|verify} messages.
+             * Encodes the specified BaudRateResponse message. Does not implicitly {@link PB.BaudRateResponse.verify|verify} messages.
              * @function encode
-             * @memberof PB.SupervisorState
+             * @memberof PB.BaudRateResponse
              * @static
-             * @param {PB.ISupervisorState} message SupervisorState message or plain object to encode
+             * @param {PB.IBaudRateResponse} message BaudRateResponse message or plain object to encode
              * @param {$protobuf.Writer} [writer] Writer to encode to
              * @returns {$protobuf.Writer} Writer
              */
-            SupervisorState.encode = function encode(message, writer) {
+            BaudRateResponse.encode = function encode(message, writer) {
                 if (!writer)
                     writer = $Writer.create();
-                if (message.uptimeMillis != null && Object.hasOwnProperty.call(message, "uptimeMillis"))
-                    writer.uint32(/* id 1, wireType 0 =*/8).uint32(message.uptimeMillis);
-                if (message.state != null && Object.hasOwnProperty.call(message, "state"))
-                    writer.uint32(/* id 2, wireType 0 =*/16).int32(message.state);
-                if (message.powerChannels != null && message.powerChannels.length)
-                    for (var i = 0; i < message.powerChannels.length; ++i)
-                        $root.PB.SupervisorState.PowerChannelState.encode(message.powerChannels[i], writer.uint32(/* id 3, wireType 2 =*/26).fork()).ldelim();
-                if (message.faultInfo != null && Object.hasOwnProperty.call(message, "faultInfo"))
-                    $root.PB.SupervisorState.FaultInfo.encode(message.faultInfo, writer.uint32(/* id 4, wireType 2 =*/34).fork()).ldelim();
+                if (message.status != null && Object.hasOwnProperty.call(message, "status"))
+                    writer.uint32(/* id 1, wireType 0 =*/8).int32(message.status);
+                if (message.baudRate != null && Object.hasOwnProperty.call(message, "baudRate"))
+                    writer.uint32(/* id 2, wireType 0 =*/16).uint32(message.baudRate);
                 return writer;
             };
     
             /**
-             * Encodes the specified SupervisorState message, length delimited. Does not implicitly {@link PB.SupervisorState.verify|verify} messages.
+             * Encodes the specified BaudRateResponse message, length delimited. Does not implicitly {@link PB.BaudRateResponse.verify|verify} messages.
              * @function encodeDelimited
-             * @memberof PB.SupervisorState
+             * @memberof PB.BaudRateResponse
              * @static
-             * @param {PB.ISupervisorState} message SupervisorState message or plain object to encode
+             * @param {PB.IBaudRateResponse} message BaudRateResponse message or plain object to encode
              * @param {$protobuf.Writer} [writer] Writer to encode to
              * @returns {$protobuf.Writer} Writer
              */
-            SupervisorState.encodeDelimited = function encodeDelimited(message, writer) {
+            BaudRateResponse.encodeDelimited = function encodeDelimited(message, writer) {
                 return this.encode(message, writer).ldelim();
             };
     
             /**
-             * Decodes a SupervisorState message from the specified reader or buffer.
+             * Decodes a BaudRateResponse message from the specified reader or buffer.
              * @function decode
-             * @memberof PB.SupervisorState
+             * @memberof PB.BaudRateResponse
              * @static
              * @param {$protobuf.Reader|Uint8Array} reader Reader or buffer to decode from
              * @param {number} [length] Message length if known beforehand
-             * @returns {PB.SupervisorState} SupervisorState
+             * @returns {PB.BaudRateResponse} BaudRateResponse
              * @throws {Error} If the payload is not a reader or valid buffer
              * @throws {$protobuf.util.ProtocolError} If required fields are missing
              */
-            SupervisorState.decode = function decode(reader, length) {
+            BaudRateResponse.decode = function decode(reader, length) {
                 if (!(reader instanceof $Reader))
                     reader = $Reader.create(reader);
-                var end = length === undefined ? reader.len : reader.pos + length, message = new $root.PB.SupervisorState();
+                var end = length === undefined ? reader.len : reader.pos + length, message = new $root.PB.BaudRateResponse();
                 while (reader.pos < end) {
                     var tag = reader.uint32();
                     switch (tag >>> 3) {
                     case 1:
-                        message.uptimeMillis = reader.uint32();
+                        message.status = reader.int32();
                         break;
                     case 2:
-                        message.state = reader.int32();
-                        break;
-                    case 3:
-                        if (!(message.powerChannels && message.powerChannels.length))
-                            message.powerChannels = [];
-                        message.powerChannels.push($root.PB.SupervisorState.PowerChannelState.decode(reader, reader.uint32()));
-                        break;
-                    case 4:
-                        message.faultInfo = $root.PB.SupervisorState.FaultInfo.decode(reader, reader.uint32());
+                        message.baudRate = reader.uint32();
                         break;
                     default:
                         reader.skipType(tag & 7);
@@ -1103,311 +1167,2043 @@
             };
     
             /**
-             * Decodes a SupervisorState message from the specified reader or buffer, length delimited.
+             * Decodes a BaudRateResponse message from the specified reader or buffer, length delimited.
              * @function decodeDelimited
-             * @memberof PB.SupervisorState
+             * @memberof PB.BaudRateResponse
              * @static
              * @param {$protobuf.Reader|Uint8Array} reader Reader or buffer to decode from
-             * @returns {PB.SupervisorState} SupervisorState
+             * @returns {PB.BaudRateResponse} BaudRateResponse
              * @throws {Error} If the payload is not a reader or valid buffer
              * @throws {$protobuf.util.ProtocolError} If required fields are missing
              */
-            SupervisorState.decodeDelimited = function decodeDelimited(reader) {
+            BaudRateResponse.decodeDelimited = function decodeDelimited(reader) {
                 if (!(reader instanceof $Reader))
                     reader = new $Reader(reader);
                 return this.decode(reader, reader.uint32());
             };
     
             /**
-             * Verifies a SupervisorState message.
+             * Verifies a BaudRateResponse message.
              * @function verify
-             * @memberof PB.SupervisorState
+             * @memberof PB.BaudRateResponse
              * @static
              * @param {Object.<string,*>} message Plain object to verify
              * @returns {string|null} `null` if valid, otherwise the reason why it is not
              */
-            SupervisorState.verify = function verify(message) {
+            BaudRateResponse.verify = function verify(message) {
                 if (typeof message !== "object" || message === null)
                     return "object expected";
-                if (message.uptimeMillis != null && message.hasOwnProperty("uptimeMillis"))
-                    if (!$util.isInteger(message.uptimeMillis))
-                        return "uptimeMillis: integer expected";
-                if (message.state != null && message.hasOwnProperty("state"))
-                    switch (message.state) {
+                if (message.status != null && message.hasOwnProperty("status"))
+                    switch (message.status) {
                     default:
-                        return "state: enum value expected";
+                        return "status: enum value expected";
                     case 0:
                     case 1:
                     case 2:
                     case 3:
-                    case 4:
-                    case 5:
                         break;
                     }
-                if (message.powerChannels != null && message.hasOwnProperty("powerChannels")) {
-                    if (!Array.isArray(message.powerChannels))
-                        return "powerChannels: array expected";
-                    for (var i = 0; i < message.powerChannels.length; ++i) {
-                        var error = $root.PB.SupervisorState.PowerChannelState.verify(message.powerChannels[i]);
-                        if (error)
-                            return "powerChannels." + error;
-                    }
-                }
-                if (message.faultInfo != null && message.hasOwnProperty("faultInfo")) {
-                    var error = $root.PB.SupervisorState.FaultInfo.verify(message.faultInfo);
-                    if (error)
-                        return "faultInfo." + error;
-                }
+                if (message.baudRate != null && message.hasOwnProperty("baudRate"))
+                    if (!$util.isInteger(message.baudRate))
+                        return "baudRate: integer expected";
                 return null;
             };
     
             /**
-             * Creates a SupervisorState message from a plain object. Also converts values to their respective internal types.
+             * Creates a BaudRateResponse message from a plain object. Also converts values to their respective internal types.
              * @function fromObject
-             * @memberof PB.SupervisorState
+             * @memberof PB.BaudRateResponse
              * @static
              * @param {Object.<string,*>} object Plain object
-             * @returns {PB.SupervisorState} SupervisorState
+             * @returns {PB.BaudRateResponse} BaudRateResponse
              */
-            SupervisorState.fromObject = function fromObject(object) {
-                if (object instanceof $root.PB.SupervisorState)
+            BaudRateResponse.fromObject = function fromObject(object) {
+                if (object instanceof $root.PB.BaudRateResponse)
                     return object;
-                var message = new $root.PB.SupervisorState();
-                if (object.uptimeMillis != null)
-                    message.uptimeMillis = object.uptimeMillis >>> 0;
-                switch (object.state) {
-                case "UNKNOWN":
+                var message = new $root.PB.BaudRateResponse();
+                switch (object.status) {
+                case "ACCEPTED":
                 case 0:
-                    message.state = 0;
+                    message.status = 0;
                     break;
-                case "STARTING_VERIFY_PSU_OFF":
+                case "REJECTED":
                 case 1:
-                    message.state = 1;
+                    message.status = 1;
                     break;
-                case "STARTING_VERIFY_VOLTAGES":
+                case "CONFIRMED":
                 case 2:
-                    message.state = 2;
+                    message.status = 2;
                     break;
-                case "STARTING_ENABLE_CHANNELS":
+                case "REVERTED":
                 case 3:
-                    message.state = 3;
-                    break;
-                case "NORMAL":
-                case 4:
-                    message.state = 4;
-                    break;
-                case "FAULT":
-                case 5:
-                    message.state = 5;
+                    message.status = 3;
                     break;
                 }
-                if (object.powerChannels) {
-                    if (!Array.isArray(object.powerChannels))
-                        throw TypeError(".PB.SupervisorState.powerChannels: array expected");
-                    message.powerChannels = [];
-                    for (var i = 0; i < object.powerChannels.length; ++i) {
-                        if (typeof object.powerChannels[i] !== "object")
-                            throw TypeError(".PB.SupervisorState.powerChannels: object expected");
-                        message.powerChannels[i] = $root.PB.SupervisorState.PowerChannelState.fromObject(object.powerChannels[i]);
-                    }
-                }
-                if (object.faultInfo != null) {
-                    if (typeof object.faultInfo !== "object")
-                        throw TypeError(".PB.SupervisorState.faultInfo: object expected");
-                    message.faultInfo = $root.PB.SupervisorState.FaultInfo.fromObject(object.faultInfo);
-                }
+                if (object.baudRate != null)
+                    message.baudRate = object.baudRate >>> 0;
                 return message;
             };
     
             /**
-             * Creates a plain object from a SupervisorState message. Also converts values to other types if specified.
+             * Creates a plain object from a BaudRateResponse message. Also converts values to other types if specified.
              * @function toObject
-             * @memberof PB.SupervisorState
+             * @memberof PB.BaudRateResponse
              * @static
-             * @param {PB.SupervisorState} message SupervisorState
+             * @param {PB.BaudRateResponse} message BaudRateResponse
              * @param {$protobuf.IConversionOptions} [options] Conversion options
              * @returns {Object.<string,*>} Plain object
              */
-            SupervisorState.toObject = function toObject(message, options) {
+            BaudRateResponse.toObject = function toObject(message, options) {
                 if (!options)
                     options = {};
                 var object = {};
-                if (options.arrays || options.defaults)
-                    object.powerChannels = [];
                 if (options.defaults) {
-                    object.uptimeMillis = 0;
-                    object.state = options.enums === String ? "UNKNOWN" : 0;
-                    object.faultInfo = null;
-                }
-                if (message.uptimeMillis != null && message.hasOwnProperty("uptimeMillis"))
-                    object.uptimeMillis = message.uptimeMillis;
-                if (message.state != null && message.hasOwnProperty("state"))
-                    object.state = options.enums === String ? $root.PB.SupervisorState.State[message.state] : message.state;
-                if (message.powerChannels && message.powerChannels.length) {
-                    object.powerChannels = [];
-                    for (var j = 0; j < message.powerChannels.length; ++j)
-                        object.powerChannels[j] = $root.PB.SupervisorState.PowerChannelState.toObject(message.powerChannels[j], options);
+                    object.status = options.enums === String ? "ACCEPTED" : 0;
+                    object.baudRate = 0;
                 }
-                if (message.faultInfo != null && message.hasOwnProperty("faultInfo"))
-                    object.faultInfo = $root.PB.SupervisorState.FaultInfo.toObject(message.faultInfo, options);
+                if (message.status != null && message.hasOwnProperty("status"))
+                    object.status = options.enums === String ? $root.PB.BaudRateResponse.Status[message.status] : message.status;
+                if (message.baudRate != null && message.hasOwnProperty("baudRate"))
+                    object.baudRate = message.baudRate;
                 return object;
             };
     
             /**
-             * Converts this SupervisorState to JSON.
+             * Converts this BaudRateResponse to JSON.
              * @function toJSON
-             * @memberof PB.SupervisorState
+             * @memberof PB.BaudRateResponse
              * @instance
              * @returns {Object.<string,*>} JSON object
              */
-            SupervisorState.prototype.toJSON = function toJSON() {
+            BaudRateResponse.prototype.toJSON = function toJSON() {
                 return this.constructor.toObject(this, $protobuf.util.toJSONOptions);
             };
     
             /**
-             * State enum.
-             * @name PB.SupervisorState.State
+             * Status enum.
+             * @name PB.BaudRateResponse.Status
              * @enum {number}
-             * @property {number} UNKNOWN=0 UNKNOWN value
-             * @property {number} STARTING_VERIFY_PSU_OFF=1 STARTING_VERIFY_PSU_OFF value
-             * @property {number} STARTING_VERIFY_VOLTAGES=2 STARTING_VERIFY_VOLTAGES value
-             * @property {number} STARTING_ENABLE_CHANNELS=3 STARTING_ENABLE_CHANNELS value
-             * @property {number} NORMAL=4 NORMAL value
-             * @property {number} FAULT=5 FAULT value
+             * @property {number} ACCEPTED=0 ACCEPTED value
+             * @property {number} REJECTED=1 REJECTED value
+             * @property {number} CONFIRMED=2 CONFIRMED value
+             * @property {number} REVERTED=3 REVERTED value
              */
-            SupervisorState.State = (function() {
+            BaudRateResponse.Status = (function() {
                 var valuesById = {}, values = Object.create(valuesById);
-                values[valuesById[0] = "UNKNOWN"] = 0;
-                values[valuesById[1] = "STARTING_VERIFY_PSU_OFF"] = 1;
-                values[valuesById[2] = "STARTING_VERIFY_VOLTAGES"] = 2;
-                values[valuesById[3] = "STARTING_ENABLE_CHANNELS"] = 3;
-                values[valuesById[4] = "NORMAL"] = 4;
-                values[valuesById[5] = "FAULT"] = 5;
+                values[valuesById[0] = "ACCEPTED"] = 0;
+                values[valuesById[1] = "REJECTED"] = 1;
+                values[valuesById[2] = "CONFIRMED"] = 2;
+                values[valuesById[3] = "REVERTED"] = 3;
                 return values;
             })();
     
-            SupervisorState.PowerChannelState = (function() {
-    
-                /**
-                 * Properties of a PowerChannelState.
-                 * @memberof PB.SupervisorState
-                 * @interface IPowerChannelState
-                 * @property {number|null} [voltageVolts] PowerChannelState voltageVolts
-                 * @property {number|null} [currentAmps] PowerChannelState currentAmps
-                 * @property {boolean|null} [on] PowerChannelState on
-                 */
+            return BaudRateResponse;
+        })();
     
-                /**
-                 * Constructs a new PowerChannelState.
-                 * @memberof PB.SupervisorState
-                 * @classdesc Represents a PowerChannelState.
-                 * @implements IPowerChannelState
-                 * @constructor
-                 * @param {PB.SupervisorState.IPowerChannelState=} [properties] Properties to set
-                 */
-                function PowerChannelState(properties) {
-                    if (properties)
-                        for (var keys = Object.keys(properties), i = 0; i < keys.length; ++i)
-                            if (properties[keys[i]] != null)
-                                this[keys[i]] = properties[keys[i]];
-                }
+        PB.ScheduleUploadResponse = (function() {
     
-                /**
-                 * PowerChannelState voltageVolts.
-                 * @member {number} voltageVolts
-                 * @memberof PB.SupervisorState.PowerChannelState
-                 * @instance
-                 */
-                PowerChannelState.prototype.voltageVolts = 0;
+            /**
+             * Properties of a ScheduleUploadResponse.
+             * @memberof PB
+             * @interface IScheduleUploadResponse
+             * @property {PB.ScheduleUpload.Phase|null} [phase] ScheduleUploadResponse phase
+             * @property {PB.ScheduleUploadResponse.Status|null} [status] ScheduleUploadResponse status
+             * @property {number|null} [nextOffset] Bytes of the image received so far.
+             * @property {number|null} [recordCount] Number of entries in the schedule, after a successful COMMIT.
+             */
     
-                /**
-                 * PowerChannelState currentAmps.
-                 * @member {number} currentAmps
-                 * @memberof PB.SupervisorState.PowerChannelState
-                 * @instance
-                 */
-                PowerChannelState.prototype.currentAmps = 0;
+            /**
+             * Constructs a new ScheduleUploadResponse.
+             * @memberof PB
+             * @classdesc Result of a ScheduleUpload. DATA chunks are only responded to if they fail; BEGIN and COMMIT always are.
+             * @implements IScheduleUploadResponse
+             * @constructor
+             * @param {PB.IScheduleUploadResponse=} [properties] Properties to set
+             */
+            function ScheduleUploadResponse(properties) {
+                if (properties)
+                    for (var keys = Object.keys(properties), i = 0; i < keys.length; ++i)
+                        if (properties[keys[i]] != null)
+                            this[keys[i]] = properties[keys[i]];
+            }
+    
+            /**
+             * ScheduleUploadResponse phase.
+             * @member {PB.ScheduleUpload.Phase} phase
+             * @memberof PB.ScheduleUploadResponse
+             * @instance
+             */
+            ScheduleUploadResponse.prototype.phase = 0;
+    
+            /**
+             * ScheduleUploadResponse status.
+             * @member {PB.ScheduleUploadResponse.Status} status
+             * @memberof PB.ScheduleUploadResponse
+             * @instance
+             */
+            ScheduleUploadResponse.prototype.status = 0;
+    
+            /**
+             * Bytes of the image received so far.
+             * @member {number} nextOffset
+             * @memberof PB.ScheduleUploadResponse
+             * @instance
+             */
+            ScheduleUploadResponse.prototype.nextOffset = 0;
+    
+            /**
+             * Number of entries in the schedule, after a successful COMMIT.
+             * @member {number} recordCount
+             * @memberof PB.ScheduleUploadResponse
+             * @instance
+             */
+            ScheduleUploadResponse.prototype.recordCount = 0;
+    
+            /**
+             * Creates a new ScheduleUploadResponse instance using the specified properties.
+             * @function create
+             * @memberof PB.ScheduleUploadResponse
+             * @static
+             * @param {PB.IScheduleUploadResponse=} [properties] Properties to set
+             * @returns {PB.ScheduleUploadResponse} ScheduleUploadResponse instance
+             */
+            ScheduleUploadResponse.create = function create(properties) {
+                return new ScheduleUploadResponse(properties);
+            };
+    
+            /**
+             * Encodes the specified ScheduleUploadResponse message. Does not implicitly {@link PB.ScheduleUploadResponse.verify|verify} messages.
+             * @function encode
+             * @memberof PB.ScheduleUploadResponse
+             * @static
+             * @param {PB.IScheduleUploadResponse} message ScheduleUploadResponse message or plain object to encode
+             * @param {$protobuf.Writer} [writer] Writer to encode to
+             * @returns {$protobuf.Writer} Writer
+             */
+            ScheduleUploadResponse.encode = function encode(message, writer) {
+                if (!writer)
+                    writer = $Writer.create();
+                if (message.phase != null && Object.hasOwnProperty.call(message, "phase"))
+                    writer.uint32(/* id 1, wireType 0 =*/8).int32(message.phase);
+                if (message.status != null && Object.hasOwnProperty.call(message, "status"))
+                    writer.uint32(/* id 2, wireType 0 =*/16).int32(message.status);
+                if (message.nextOffset != null && Object.hasOwnProperty.call(message, "nextOffset"))
+                    writer.uint32(/* id 3, wireType 0 =*/24).uint32(message.nextOffset);
+                if (message.recordCount != null && Object.hasOwnProperty.call(message, "recordCount"))
+                    writer.uint32(/* id 4, wireType 0 =*/32).uint32(message.recordCount);
+                return writer;
+            };
+    
+            /**
+             * Encodes the specified ScheduleUploadResponse message, length delimited. Does not implicitly {@link PB.ScheduleUploadResponse.verify|verify} messages.
+             * @function encodeDelimited
+             * @memberof PB.ScheduleUploadResponse
+             * @static
+             * @param {PB.IScheduleUploadResponse} message ScheduleUploadResponse message or plain object to encode
+             * @param {$protobuf.Writer} [writer] Writer to encode to
+             * @returns {$protobuf.Writer} Writer
+             */
+            ScheduleUploadResponse.encodeDelimited = function encodeDelimited(message, writer) {
+                return this.encode(message, writer).ldelim();
+            };
+    
+            /**
+             * Decodes a ScheduleUploadResponse message from the specified reader or buffer.
+             * @function decode
+             * @memberof PB.ScheduleUploadResponse
+             * @static
+             * @param {$protobuf.Reader|Uint8Array} reader Reader or buffer to decode from
+             * @param {number} [length] Message length if known beforehand
+             * @returns {PB.ScheduleUploadResponse} ScheduleUploadResponse
+             * @throws {Error} If the payload is not a reader or valid buffer
+             * @throws {$protobuf.util.ProtocolError} If required fields are missing
+             */
+            ScheduleUploadResponse.decode = function decode(reader, length) {
+                if (!(reader instanceof $Reader))
+                    reader = $Reader.create(reader);
+                var end = length === undefined ? reader.len : reader.pos + length, message = new $root.PB.ScheduleUploadResponse();
+                while (reader.pos < end) {
+                    var tag = reader.uint32();
+                    switch (tag >>> 3) {
+                    case 1:
+                        message.phase = reader.int32();
+                        break;
+                    case 2:
+                        message.status = reader.int32();
+                        break;
+                    case 3:
+                        message.nextOffset = reader.uint32();
+                        break;
+                    case 4:
+                        message.recordCount = reader.uint32();
+                        break;
+                    default:
+                        reader.skipType(tag & 7);
+                        break;
+                    }
+                }
+                return message;
+            };
+    
+            /**
+             * Decodes a ScheduleUploadResponse message from the specified reader or buffer, length delimited.
+             * @function decodeDelimited
+             * @memberof PB.ScheduleUploadResponse
+             * @static
+             * @param {$protobuf.Reader|Uint8Array} reader Reader or buffer to decode from
+             * @returns {PB.ScheduleUploadResponse} ScheduleUploadResponse
+             * @throws {Error} If the payload is not a reader or valid buffer
+             * @throws {$protobuf.util.ProtocolError} If required fields are missing
+             */
+            ScheduleUploadResponse.decodeDelimited = function decodeDelimited(reader) {
+                if (!(reader instanceof $Reader))
+                    reader = new $Reader(reader);
+                return this.decode(reader, reader.uint32());
+            };
+    
+            /**
+             * Verifies a ScheduleUploadResponse message.
+             * @function verify
+             * @memberof PB.ScheduleUploadResponse
+             * @static
+             * @param {Object.<string,*>} message Plain object to verify
+             * @returns {string|null} `null` if valid, otherwise the reason why it is not
+             */
+            ScheduleUploadResponse.verify = function verify(message) {
+                if (typeof message !== "object" || message === null)
+                    return "object expected";
+                if (message.phase != null && message.hasOwnProperty("phase"))
+                    switch (message.phase) {
+                    default:
+                        return "phase: enum value expected";
+                    case 0:
+                    case 1:
+                    case 2:
+                        break;
+                    }
+                if (message.status != null && message.hasOwnProperty("status"))
+                    switch (message.status) {
+                    default:
+                        return "status: enum value expected";
+                    case 0:
+                    case 1:
+                    case 2:
+                    case 3:
+                    case 4:
+                    case 5:
+                    case 6:
+                    case 7:
+                    case 8:
+                        break;
+                    }
+                if (message.nextOffset != null && message.hasOwnProperty("nextOffset"))
+                    if (!$util.isInteger(message.nextOffset))
+                        return "nextOffset: integer expected";
+                if (message.recordCount != null && message.hasOwnProperty("recordCount"))
+                    if (!$util.isInteger(message.recordCount))
+                        return "recordCount: integer expected";
+                return null;
+            };
+    
+            /**
+             * Creates a ScheduleUploadResponse message from a plain object. Also converts values to their respective internal types.
+             * @function fromObject
+             * @memberof PB.ScheduleUploadResponse
+             * @static
+             * @param {Object.<string,*>} object Plain object
+             * @returns {PB.ScheduleUploadResponse} ScheduleUploadResponse
+             */
+            ScheduleUploadResponse.fromObject = function fromObject(object) {
+                if (object instanceof $root.PB.ScheduleUploadResponse)
+                    return object;
+                var message = new $root.PB.ScheduleUploadResponse();
+                switch (object.phase) {
+                case "BEGIN":
+                case 0:
+                    message.phase = 0;
+                    break;
+                case "DATA":
+                case 1:
+                    message.phase = 1;
+                    break;
+                case "COMMIT":
+                case 2:
+                    message.phase = 2;
+                    break;
+                }
+                switch (object.status) {
+                case "OK":
+                case 0:
+                    message.status = 0;
+                    break;
+                case "NO_PARTITION":
+                case 1:
+                    message.status = 1;
+                    break;
+                case "TOO_LARGE":
+                case 2:
+                    message.status = 2;
+                    break;
+                case "NOT_STARTED":
+                case 3:
+                    message.status = 3;
+                    break;
+                case "BAD_OFFSET":
+                case 4:
+                    message.status = 4;
+                    break;
+                case "INCOMPLETE":
+                case 5:
+                    message.status = 5;
+                    break;
+                case "CRC_MISMATCH":
+                case 6:
+                    message.status = 6;
+                    break;
+                case "INVALID_SCHEDULE":
+                case 7:
+                    message.status = 7;
+                    break;
+                case "FLASH_ERROR":
+                case 8:
+                    message.status = 8;
+                    break;
+                }
+                if (object.nextOffset != null)
+                    message.nextOffset = object.nextOffset >>> 0;
+                if (object.recordCount != null)
+                    message.recordCount = object.recordCount >>> 0;
+                return message;
+            };
+    
+            /**
+             * Creates a plain object from a ScheduleUploadResponse message. Also converts values to other types if specified.
+             * @function toObject
+             * @memberof PB.ScheduleUploadResponse
+             * @static
+             * @param {PB.ScheduleUploadResponse} message ScheduleUploadResponse
+             * @param {$protobuf.IConversionOptions} [options] Conversion options
+             * @returns {Object.<string,*>} Plain object
+             */
+            ScheduleUploadResponse.toObject = function toObject(message, options) {
+                if (!options)
+                    options = {};
+                var object = {};
+                if (options.defaults) {
+                    object.phase = options.enums === String ? "BEGIN" : 0;
+                    object.status = options.enums === String ? "OK" : 0;
+                    object.nextOffset = 0;
+                    object.recordCount = 0;
+                }
+                if (message.phase != null && message.hasOwnProperty("phase"))
+                    object.phase = options.enums === String ? $root.PB.ScheduleUpload.Phase[message.phase] : message.phase;
+                if (message.status != null && message.hasOwnProperty("status"))
+                    object.status = options.enums === String ? $root.PB.ScheduleUploadResponse.Status[message.status] : message.status;
+                if (message.nextOffset != null && message.hasOwnProperty("nextOffset"))
+                    object.nextOffset = message.nextOffset;
+                if (message.recordCount != null && message.hasOwnProperty("recordCount"))
+                    object.recordCount = message.recordCount;
+                return object;
+            };
+    
+            /**
+             * Converts this ScheduleUploadResponse to JSON.
+             * @function toJSON
+             * @memberof PB.ScheduleUploadResponse
+             * @instance
+             * @returns {Object.<string,*>} JSON object
+             */
+            ScheduleUploadResponse.prototype.toJSON = function toJSON() {
+                return this.constructor.toObject(this, $protobuf.util.toJSONOptions);
+            };
+    
+            /**
+             * Status enum.
+             * @name PB.ScheduleUploadResponse.Status
+             * @enum {number}
+             * @property {number} OK=0 OK value
+             * @property {number} NO_PARTITION=1 NO_PARTITION value
+             * @property {number} TOO_LARGE=2 TOO_LARGE value
+             * @property {number} NOT_STARTED=3 NOT_STARTED value
+             * @property {number} BAD_OFFSET=4 BAD_OFFSET value
+             * @property {number} INCOMPLETE=5 INCOMPLETE value
+             * @property {number} CRC_MISMATCH=6 CRC_MISMATCH value
+             * @property {number} INVALID_SCHEDULE=7 INVALID_SCHEDULE value
+             * @property {number} FLASH_ERROR=8 FLASH_ERROR value
+             */
+            ScheduleUploadResponse.Status = (function() {
+                var valuesById = {}, values = Object.create(valuesById);
+                values[valuesById[0] = "OK"] = 0;
+                values[valuesById[1] = "NO_PARTITION"] = 1;
+                values[valuesById[2] = "TOO_LARGE"] = 2;
+                values[valuesById[3] = "NOT_STARTED"] = 3;
+                values[valuesById[4] = "BAD_OFFSET"] = 4;
+                values[valuesById[5] = "INCOMPLETE"] = 5;
+                values[valuesById[6] = "CRC_MISMATCH"] = 6;
+                values[valuesById[7] = "INVALID_SCHEDULE"] = 7;
+                values[valuesById[8] = "FLASH_ERROR"] = 8;
+                return values;
+            })();
+    
+            return ScheduleUploadResponse;
+        })();
+    
+        PB.SupervisorState = (function() {
+    
+            /**
+             * Properties of a SupervisorState.
+             * @memberof PB
+             * @interface ISupervisorState
+             * @property {number|null} [uptimeMillis] SupervisorState uptimeMillis
+             * @property {PB.SupervisorState.State|null} [state] SupervisorState state
+             * @property {Array.<PB.SupervisorState.IPowerChannelState>|null} [powerChannels] SupervisorState powerChannels
+             * @property {PB.SupervisorState.IFaultInfo|null} [faultInfo] SupervisorState faultInfo
+             */
+    
+            /**
+             * Constructs a new SupervisorState.
+             * @memberof PB
+             * @classdesc Represents a SupervisorState.
+             * @implements ISupervisorState
+             * @constructor
+             * @param {PB.ISupervisorState=} [properties] Properties to set
+             */
+            function SupervisorState(properties) {
+                this.powerChannels = [];
+                if (properties)
+                    for (var keys = Object.keys(properties), i = 0; i < keys.length; ++i)
+                        if (properties[keys[i]] != null)
+                            this[keys[i]] = properties[keys[i]];
+            }
+    
+            /**
+             * SupervisorState uptimeMillis.
+             * @member {number} uptimeMillis
+             * @memberof PB.SupervisorState
+             * @instance
+             */
+            SupervisorState.prototype.uptimeMillis = 0;
+    
+            /**
+             * SupervisorState state.
+             * @member {PB.SupervisorState.State} state
+             * @memberof PB.SupervisorState
+             * @instance
+             */
+            SupervisorState.prototype.state = 0;
+    
+            /**
+             * SupervisorState powerChannels.
+             * @member {Array.<PB.SupervisorState.IPowerChannelState>} powerChannels
+             * @memberof PB.SupervisorState
+             * @instance
+             */
+            SupervisorState.prototype.powerChannels = $util.emptyArray;
+    
+            /**
+             * SupervisorState faultInfo.
+             * @member {PB.SupervisorState.IFaultInfo|null|undefined} faultInfo
+             * @memberof PB.SupervisorState
+             * @instance
+             */
+            SupervisorState.prototype.faultInfo = null;
+    
+            /**
+             * Creates a new SupervisorState instance using the specified properties.
+             * @function create
+             * @memberof PB.SupervisorState
+             * @static
+             * @param {PB.ISupervisorState=} [properties] Properties to set
+             * @returns {PB.SupervisorState} SupervisorState instance
+             */
+            SupervisorState.create = function create(properties) {
+                return new SupervisorState(properties);
+            };
+    
+            /**
+             * Encodes the specified SupervisorState message. Does not implicitly {@link PB.SupervisorState.verify|verify} messages.
+             * @function encode
+             * @memberof PB.SupervisorState
+             * @static
+             * @param {PB.ISupervisorState} message SupervisorState message or plain object to encode
+             * @param {$protobuf.Writer} [writer] Writer to encode to
+             * @returns {$protobuf.Writer} Writer
+             */
+            SupervisorState.encode = function encode(message, writer) {
+                if (!writer)
+                    writer = $Writer.create();
+                if (message.uptimeMillis != null && Object.hasOwnProperty.call(message, "uptimeMillis"))
+                    writer.uint32(/* id 1, wireType 0 =*/8).uint32(message.uptimeMillis);
+                if (message.state != null && Object.hasOwnProperty.call(message, "state"))
+                    writer.uint32(/* id 2, wireType 0 =*/16).int32(message.state);
+                if (message.powerChannels != null && message.powerChannels.length)
+                    for (var i = 0; i < message.powerChannels.length; ++i)
+                        $root.PB.SupervisorState.PowerChannelState.encode(message.powerChannels[i], writer.uint32(/* id 3, wireType 2 =*/26).fork()).ldelim();
+                if (message.faultInfo != null && Object.hasOwnProperty.call(message, "faultInfo"))
+                    $root.PB.SupervisorState.FaultInfo.encode(message.faultInfo, writer.uint32(/* id 4, wireType 2 =*/34).fork()).ldelim();
+                return writer;
+            };
+    
+            /**
+             * Encodes the specified SupervisorState message, length delimited. Does not implicitly {@link PB.SupervisorState.verify|verify} messages.
+             * @function encodeDelimited
+             * @memberof PB.SupervisorState
+             * @static
+             * @param {PB.ISupervisorState} message SupervisorState message or plain object to encode
+             * @param {$protobuf.Writer} [writer] Writer to encode to
+             * @returns {$protobuf.Writer} Writer
+             */
+            SupervisorState.encodeDelimited = function encodeDelimited(message, writer) {
+                return this.encode(message, writer).ldelim();
+            };
+    
+            /**
+             * Decodes a SupervisorState message from the specified reader or buffer.
+             * @function decode
+             * @memberof PB.SupervisorState
+             * @static
+             * @param {$protobuf.Reader|Uint8Array} reader Reader or buffer to decode from
+             * @param {number} [length] Message length if known beforehand
+             * @returns {PB.SupervisorState} SupervisorState
+             * @throws {Error} If the payload is not a reader or valid buffer
+             * @throws {$protobuf.util.ProtocolError} If required fields are missing
+             */
+            SupervisorState.decode = function decode(reader, length) {
+                if (!(reader instanceof $Reader))
+                    reader = $Reader.create(reader);
+                var end = length === undefined ? reader.len : reader.pos + length, message = new $root.PB.SupervisorState();
+                while (reader.pos < end) {
+                    var tag = reader.uint32();
+                    switch (tag >>> 3) {
+                    case 1:
+                        message.uptimeMillis = reader.uint32();
+                        break;
+                    case 2:
+                        message.state = reader.int32();
+                        break;
+                    case 3:
+                        if (!(message.powerChannels && message.powerChannels.length))
+                            message.powerChannels = [];
+                        message.powerChannels.push($root.PB.SupervisorState.PowerChannelState.decode(reader, reader.uint32()));
+                        break;
+                    case 4:
+                        message.faultInfo = $root.PB.SupervisorState.FaultInfo.decode(reader, reader.uint32());
+                        break;
+                    default:
+                        reader.skipType(tag & 7);
+                        break;
+                    }
+                }
+                return message;
+            };
+    
+            /**
+             * Decodes a SupervisorState message from the specified reader or buffer, length delimited.
+             * @function decodeDelimited
+             * @memberof PB.SupervisorState
+             * @static
+             * @param {$protobuf.Reader|Uint8Array} reader Reader or buffer to decode from
+             * @returns {PB.SupervisorState} SupervisorState
+             * @throws {Error} If the payload is not a reader or valid buffer
+             * @throws {$protobuf.util.ProtocolError} If required fields are missing
+             */
+            SupervisorState.decodeDelimited = function decodeDelimited(reader) {
+                if (!(reader instanceof $Reader))
+                    reader = new $Reader(reader);
+                return this.decode(reader, reader.uint32());
+            };
+    
+            /**
+             * Verifies a SupervisorState message.
+             * @function verify
+             * @memberof PB.SupervisorState
+             * @static
+             * @param {Object.<string,*>} message Plain object to verify
+             * @returns {string|null} `null` if valid, otherwise the reason why it is not
+             */
+            SupervisorState.verify = function verify(message) {
+                if (typeof message !== "object" || message === null)
+                    return "object expected";
+                if (message.uptimeMillis != null && message.hasOwnProperty("uptimeMillis"))
+                    if (!$util.isInteger(message.uptimeMillis))
+                        return "uptimeMillis: integer expected";
+                if (message.state != null && message.hasOwnProperty("state"))
+                    switch (message.state) {
+                    default:
+                        return "state: enum value expected";
+                    case 0:
+                    case 1:
+                    case 2:
+                    case 3:
+                    case 4:
+                    case 5:
+                        break;
+                    }
+                if (message.powerChannels != null && message.hasOwnProperty("powerChannels")) {
+                    if (!Array.isArray(message.powerChannels))
+                        return "powerChannels: array expected";
+                    for (var i = 0; i < message.powerChannels.length; ++i) {
+                        var error = $root.PB.SupervisorState.PowerChannelState.verify(message.powerChannels[i]);
+                        if (error)
+                            return "powerChannels." + error;
+                    }
+                }
+                if (message.faultInfo != null && message.hasOwnProperty("faultInfo")) {
+                    var error = $root.PB.SupervisorState.FaultInfo.verify(message.faultInfo);
+                    if (error)
+                        return "faultInfo." + error;
+                }
+                return null;
+            };
+    
+            /**
+             * Creates a SupervisorState message from a plain object. Also converts values to their respective internal types.
+             * @function fromObject
+             * @memberof PB.SupervisorState
+             * @static
+             * @param {Object.<string,*>} object Plain object
+             * @returns {PB.SupervisorState} SupervisorState
+             */
+            SupervisorState.fromObject = function fromObject(object) {
+                if (object instanceof $root.PB.SupervisorState)
+                    return object;
+                var message = new $root.PB.SupervisorState();
+                if (object.uptimeMillis != null)
+                    message.uptimeMillis = object.uptimeMillis >>> 0;
+                switch (object.state) {
+                case "UNKNOWN":
+                case 0:
+                    message.state = 0;
+                    break;
+                case "STARTING_VERIFY_PSU_OFF":
+                case 1:
+                    message.state = 1;
+                    break;
+                case "STARTING_VERIFY_VOLTAGES":
+                case 2:
+                    message.state = 2;
+                    break;
+                case "STARTING_ENABLE_CHANNELS":
+                case 3:
+                    message.state = 3;
+                    break;
+                case "NORMAL":
+                case 4:
+                    message.state = 4;
+                    break;
+                case "FAULT":
+                case 5:
+                    message.state = 5;
+                    break;
+                }
+                if (object.powerChannels) {
+                    if (!Array.isArray(object.powerChannels))
+                        throw TypeError(".PB.SupervisorState.powerChannels: array expected");
+                    message.powerChannels = [];
+                    for (var i = 0; i < object.powerChannels.length; ++i) {
+                        if (typeof object.powerChannels[i] !== "object")
+                            throw TypeError(".PB.SupervisorState.powerChannels: object expected");
+                        message.powerChannels[i] = $root.PB.SupervisorState.PowerChannelState.fromObject(object.powerChannels[i]);
+                    }
+                }
+                if (object.faultInfo != null) {
+                    if (typeof object.faultInfo !== "object")
+                        throw TypeError(".PB.SupervisorState.faultInfo: object expected");
+                    message.faultInfo = $root.PB.SupervisorState.FaultInfo.fromObject(object.faultInfo);
+                }
+                return message;
+            };
+    
+            /**
+             * Creates a plain object from a SupervisorState message. Also converts values to other types if specified.
+             * @function toObject
+             * @memberof PB.SupervisorState
+             * @static
+             * @param {PB.SupervisorState} message SupervisorState
+             * @param {$protobuf.IConversionOptions} [options] Conversion options
+             * @returns {Object.<string,*>} Plain object
+             */
+            SupervisorState.toObject = function toObject(message, options) {
+                if (!options)
+                    options = {};
+                var object = {};
+                if (options.arrays || options.defaults)
+                    object.powerChannels = [];
+                if (options.defaults) {
+                    object.uptimeMillis = 0;
+                    object.state = options.enums === String ? "UNKNOWN" : 0;
+                    object.faultInfo = null;
+                }
+                if (message.uptimeMillis != null && message.hasOwnProperty("uptimeMillis"))
+                    object.uptimeMillis = message.uptimeMillis;
+                if (message.state != null && message.hasOwnProperty("state"))
+                    object.state = options.enums === String ? $root.PB.SupervisorState.State[message.state] : message.state;
+                if (message.powerChannels && message.powerChannels.length) {
+                    object.powerChannels = [];
+                    for (var j = 0; j < message.powerChannels.length; ++j)
+                        object.powerChannels[j] = $root.PB.SupervisorState.PowerChannelState.toObject(message.powerChannels[j], options);
+                }
+                if (message.faultInfo != null && message.hasOwnProperty("faultInfo"))
+                    object.faultInfo = $root.PB.SupervisorState.FaultInfo.toObject(message.faultInfo, options);
+                return object;
+            };
+    
+            /**
+             * Converts this SupervisorState to JSON.
+             * @function toJSON
+             * @memberof PB.SupervisorState
+             * @instance
+             * @returns {Object.<string,*>} JSON object
+             */
+            SupervisorState.prototype.toJSON = function toJSON() {
+                return this.constructor.toObject(this, $protobuf.util.toJSONOptions);
+            };
+    
+            /**
+             * State enum.
+             * @name PB.SupervisorState.State
+             * @enum {number}
+             * @property {number} UNKNOWN=0 UNKNOWN value
+             * @property {number} STARTING_VERIFY_PSU_OFF=1 STARTING_VERIFY_PSU_OFF value
+             * @property {number} STARTING_VERIFY_VOLTAGES=2 STARTING_VERIFY_VOLTAGES value
+             * @property {number} STARTING_ENABLE_CHANNELS=3 STARTING_ENABLE_CHANNELS value
+             * @property {number} NORMAL=4 NORMAL value
+             * @property {number} FAULT=5 FAULT value
+             */
+            SupervisorState.State = (function() {
+                var valuesById = {}, values = Object.create(valuesById);
+                values[valuesById[0] = "UNKNOWN"] = 0;
+                values[valuesById[1] = "STARTING_VERIFY_PSU_OFF"] = 1;
+                values[valuesById[2] = "STARTING_VERIFY_VOLTAGES"] = 2;
+                values[valuesById[3] = "STARTING_ENABLE_CHANNELS"] = 3;
+                values[valuesById[4] = "NORMAL"] = 4;
+                values[valuesById[5] = "FAULT"] = 5;
+                return values;
+            })();
+    
+            SupervisorState.PowerChannelState = (function() {
+    
+                /**
+                 * Properties of a PowerChannelState.
+                 * @memberof PB.SupervisorState
+                 * @interface IPowerChannelState
+                 * @property {number|null} [voltageVolts] PowerChannelState voltageVolts
+                 * @property {number|null} [currentAmps] PowerChannelState currentAmps
+                 * @property {boolean|null} [on] PowerChannelState on
+                 */
+    
+                /**
+                 * Constructs a new PowerChannelState.
+                 * @memberof PB.SupervisorState
+                 * @classdesc Represents a PowerChannelState.
+                 * @implements IPowerChannelState
+                 * @constructor
+                 * @param {PB.SupervisorState.IPowerChannelState=} [properties] Properties to set
+                 */
+                function PowerChannelState(properties) {
+                    if (properties)
+                        for (var keys = Object.keys(properties), i = 0; i < keys.length; ++i)
+                            if (properties[keys[i]] != null)
+                                this[keys[i]] = properties[keys[i]];
+                }
+    
+                /**
+                 * PowerChannelState voltageVolts.
+                 * @member {number} voltageVolts
+                 * @memberof PB.SupervisorState.PowerChannelState
+                 * @instance
+                 */
+                PowerChannelState.prototype.voltageVolts = 0;
+    
+                /**
+                 * PowerChannelState currentAmps.
+                 * @member {number} currentAmps
+                 * @memberof PB.SupervisorState.PowerChannelState
+                 * @instance
+                 */
+                PowerChannelState.prototype.currentAmps = 0;
+    
+                /**
+                 * PowerChannelState on.
+                 * @member {boolean} on
+                 * @memberof PB.SupervisorState.PowerChannelState
+                 * @instance
+                 */
+                PowerChannelState.prototype.on = false;
+    
+                /**
+                 * Creates a new PowerChannelState instance using the specified properties.
+                 * @function create
+                 * @memberof PB.SupervisorState.PowerChannelState
+                 * @static
+                 * @param {PB.SupervisorState.IPowerChannelState=} [properties] Properties to set
+                 * @returns {PB.SupervisorState.PowerChannelState} PowerChannelState instance
+                 */
+                PowerChannelState.create = function create(properties) {
+                    return new PowerChannelState(properties);
+                };
+    
+                /**
+                 * Encodes the specified PowerChannelState message. Does not implicitly {@link PB.SupervisorState.PowerChannelState.verify|verify} messages.
+                 * @function encode
+                 * @memberof PB.SupervisorState.PowerChannelState
+                 * @static
+                 * @param {PB.SupervisorState.IPowerChannelState} message PowerChannelState message or plain object to encode
+                 * @param {$protobuf.Writer} [writer] Writer to encode to
+                 * @returns {$protobuf.Writer} Writer
+                 */
+                PowerChannelState.encode = function encode(message, writer) {
+                    if (!writer)
+                        writer = $Writer.create();
+                    if (message.voltageVolts != null && Object.hasOwnProperty.call(message, "voltageVolts"))
+                        writer.uint32(/* id 1, wireType 5 =*/13).float(message.voltageVolts);
+                    if (message.currentAmps != null && Object.hasOwnProperty.call(message, "currentAmps"))
+                        writer.uint32(/* id 2, wireType 5 =*/21).float(message.currentAmps);
+                    if (message.on != null && Object.hasOwnProperty.call(message, "on"))
+                        writer.uint32(/* id 3, wireType 0 =*/24).bool(message.on);
+                    return writer;
+                };
+    
+                /**
+                 * Encodes the specified PowerChannelState message, length delimited. Does not implicitly {@link PB.SupervisorState.PowerChannelState.verify|verify} messages.
+                 * @function encodeDelimited
+                 * @memberof PB.SupervisorState.PowerChannelState
+                 * @static
+                 * @param {PB.SupervisorState.IPowerChannelState} message PowerChannelState message or plain object to encode
+                 * @param {$protobuf.Writer} [writer] Writer to encode to
+                 * @returns {$protobuf.Writer} Writer
+                 */
+                PowerChannelState.encodeDelimited = function encodeDelimited(message, writer) {
+                    return this.encode(message, writer).ldelim();
+                };
+    
+                /**
+                 * Decodes a PowerChannelState message from the specified reader or buffer.
+                 * @function decode
+                 * @memberof PB.SupervisorState.PowerChannelState
+                 * @static
+                 * @param {$protobuf.Reader|Uint8Array} reader Reader or buffer to decode from
+                 * @param {number} [length] Message length if known beforehand
+                 * @returns {PB.SupervisorState.PowerChannelState} PowerChannelState
+                 * @throws {Error} If the payload is not a reader or valid buffer
+                 * @throws {$protobuf.util.ProtocolError} If required fields are missing
+                 */
+                PowerChannelState.decode = function decode(reader, length) {
+                    if (!(reader instanceof $Reader))
+                        reader = $Reader.create(reader);
+                    var end = length === undefined ? reader.len : reader.pos + length, message = new $root.PB.SupervisorState.PowerChannelState();
+                    while (reader.pos < end) {
+                        var tag = reader.uint32();
+                        switch (tag >>> 3) {
+                        case 1:
+                            message.voltageVolts = reader.float();
+                            break;
+                        case 2:
+                            message.currentAmps = reader.float();
+                            break;
+                        case 3:
+                            message.on = reader.bool();
+                            break;
+                        default:
+                            reader.skipType(tag & 7);
+                            break;
+                        }
+                    }
+                    return message;
+                };
+    
+                /**
+                 * Decodes a PowerChannelState message from the specified reader or buffer, length delimited.
+                 * @function decodeDelimited
+                 * @memberof PB.SupervisorState.PowerChannelState
+                 * @static
+                 * @param {$protobuf.Reader|Uint8Array} reader Reader or buffer to decode from
+                 * @returns {PB.SupervisorState.PowerChannelState} PowerChannelState
+                 * @throws {Error} If the payload is not a reader or valid buffer
+                 * @throws {$protobuf.util.ProtocolError} If required fields are missing
+                 */
+                PowerChannelState.decodeDelimited = function decodeDelimited(reader) {
+                    if (!(reader instanceof $Reader))
+                        reader = new $Reader(reader);
+                    return this.decode(reader, reader.uint32());
+                };
+    
+                /**
+                 * Verifies a PowerChannelState message.
+                 * @function verify
+                 * @memberof PB.SupervisorState.PowerChannelState
+                 * @static
+                 * @param {Object.<string,*>} message Plain object to verify
+                 * @returns {string|null} `null` if valid, otherwise the reason why it is not
+                 */
+                PowerChannelState.verify = function verify(message) {
+                    if (typeof message !== "object" || message === null)
+                        return "object expected";
+                    if (message.voltageVolts != null && message.hasOwnProperty("voltageVolts"))
+                        if (typeof message.voltageVolts !== "number")
+                            return "voltageVolts: number expected";
+                    if (message.currentAmps != null && message.hasOwnProperty("currentAmps"))
+                        if (typeof message.currentAmps !== "number")
+                            return "currentAmps: number expected";
+                    if (message.on != null && message.hasOwnProperty("on"))
+                        if (typeof message.on !== "boolean")
+                            return "on: boolean expected";
+                    return null;
+                };
+    
+                /**
+                 * Creates a PowerChannelState message from a plain object. Also converts values to their respective internal types.
+                 * @function fromObject
+                 * @memberof PB.SupervisorState.PowerChannelState
+                 * @static
+                 * @param {Object.<string,*>} object Plain object
+                 * @returns {PB.SupervisorState.PowerChannelState} PowerChannelState
+                 */
+                PowerChannelState.fromObject = function fromObject(object) {
+                    if (object instanceof $root.PB.SupervisorState.PowerChannelState)
+                        return object;
+                    var message = new $root.PB.SupervisorState.PowerChannelState();
+                    if (object.voltageVolts != null)
+                        message.voltageVolts = Number(object.voltageVolts);
+                    if (object.currentAmps != null)
+                        message.currentAmps = Number(object.currentAmps);
+                    if (object.on != null)
+                        message.on = Boolean(object.on);
+                    return message;
+                };
+    
+                /**
+                 * Creates a plain object from a PowerChannelState message. Also converts values to other types if specified.
+                 * @function toObject
+                 * @memberof PB.SupervisorState.PowerChannelState
+                 * @static
+                 * @param {PB.SupervisorState.PowerChannelState} message PowerChannelState
+                 * @param {$protobuf.IConversionOptions} [options] Conversion options
+                 * @returns {Object.<string,*>} Plain object
+                 */
+                PowerChannelState.toObject = function toObject(message, options) {
+                    if (!options)
+                        options = {};
+                    var object = {};
+                    if (options.defaults) {
+                        object.voltageVolts = 0;
+                        object.currentAmps = 0;
+                        object.on = false;
+                    }
+                    if (message.voltageVolts != null && message.hasOwnProperty("voltageVolts"))
+                        object.voltageVolts = options.json && !isFinite(message.voltageVolts) ? String(message.voltageVolts) : message.voltageVolts;
+                    if (message.currentAmps != null && message.hasOwnProperty("currentAmps"))
+                        object.currentAmps = options.json && !isFinite(message.currentAmps) ? String(message.currentAmps) : message.currentAmps;
+                    if (message.on != null && message.hasOwnProperty("on"))
+                        object.on = message.on;
+                    return object;
+                };
+    
+                /**
+                 * Converts this PowerChannelState to JSON.
+                 * @function toJSON
+                 * @memberof PB.SupervisorState.PowerChannelState
+                 * @instance
+                 * @returns {Object.<string,*>} JSON object
+                 */
+                PowerChannelState.prototype.toJSON = function toJSON() {
+                    return this.constructor.toObject(this, $protobuf.util.toJSONOptions);
+                };
+    
+                return PowerChannelState;
+            })();
+    
+            SupervisorState.FaultInfo = (function() {
+    
+                /**
+                 * Properties of a FaultInfo.
+                 * @memberof PB.SupervisorState
+                 * @interface IFaultInfo
+                 * @property {PB.SupervisorState.FaultInfo.FaultType|null} [type] FaultInfo type
+                 * @property {string|null} [msg] FaultInfo msg
+                 * @property {number|null} [tsMillis] FaultInfo tsMillis
+                 */
+    
+                /**
+                 * Constructs a new FaultInfo.
+                 * @memberof PB.SupervisorState
+                 * @classdesc Represents a FaultInfo.
+                 * @implements IFaultInfo
+                 * @constructor
+                 * @param {PB.SupervisorState.IFaultInfo=} [properties] Properties to set
+                 */
+                function FaultInfo(properties) {
+                    if (properties)
+                        for (var keys = Object.keys(properties), i = 0; i < keys.length; ++i)
+                            if (properties[keys[i]] != null)
+                                this[keys[i]] = properties[keys[i]];
+                }
+    
+                /**
+                 * FaultInfo type.
+                 * @member {PB.SupervisorState.FaultInfo.FaultType} type
+                 * @memberof PB.SupervisorState.FaultInfo
+                 * @instance
+                 */
+                FaultInfo.prototype.type = 0;
+    
+                /**
+                 * FaultInfo msg.
+                 * @member {string} msg
+                 * @memberof PB.SupervisorState.FaultInfo
+                 * @instance
+                 */
+                FaultInfo.prototype.msg = "";
+    
+                /**
+                 * FaultInfo tsMillis.
+                 * @member {number} tsMillis
+                 * @memberof PB.SupervisorState.FaultInfo
+                 * @instance
+                 */
+                FaultInfo.prototype.tsMillis = 0;
+    
+                /**
+                 * Creates a new FaultInfo instance using the specified properties.
+                 * @function create
+                 * @memberof PB.SupervisorState.FaultInfo
+                 * @static
+                 * @param {PB.SupervisorState.IFaultInfo=} [properties] Properties to set
+                 * @returns {PB.SupervisorState.FaultInfo} FaultInfo instance
+                 */
+                FaultInfo.create = function create(properties) {
+                    return new FaultInfo(properties);
+                };
+    
+                /**
+                 * Encodes the specified FaultInfo message. Does not implicitly {@link PB.SupervisorState.FaultInfo.verify|verify} messages.
+                 * @function encode
+                 * @memberof PB.SupervisorState.FaultInfo
+                 * @static
+                 * @param {PB.SupervisorState.IFaultInfo} message FaultInfo message or plain object to encode
+                 * @param {$protobuf.Writer} [writer] Writer to encode to
+                 * @returns {$protobuf.Writer} Writer
+                 */
+                FaultInfo.encode = function encode(message, writer) {
+                    if (!writer)
+                        writer = $Writer.create();
+                    if (message.type != null && Object.hasOwnProperty.call(message, "type"))
+                        writer.uint32(/* id 1, wireType 0 =*/8).int32(message.type);
+                    if (message.msg != null && Object.hasOwnProperty.call(message, "msg"))
+                        writer.uint32(/* id 2, wireType 2 =*/18).string(message.msg);
+                    if (message.tsMillis != null && Object.hasOwnProperty.call(message, "tsMillis"))
+                        writer.uint32(/* id 3, wireType 0 =*/24).uint32(message.tsMillis);
+                    return writer;
+                };
+    
+                /**
+                 * Encodes the specified FaultInfo message, length delimited. Does not implicitly {@link PB.SupervisorState.FaultInfo.verify|verify} messages.
+                 * @function encodeDelimited
+                 * @memberof PB.SupervisorState.FaultInfo
+                 * @static
+                 * @param {PB.SupervisorState.IFaultInfo} message FaultInfo message or plain object to encode
+                 * @param {$protobuf.Writer} [writer] Writer to encode to
+                 * @returns {$protobuf.Writer} Writer
+                 */
+                FaultInfo.encodeDelimited = function encodeDelimited(message, writer) {
+                    return this.encode(message, writer).ldelim();
+                };
+    
+                /**
+                 * Decodes a FaultInfo message from the specified reader or buffer.
+                 * @function decode
+                 * @memberof PB.SupervisorState.FaultInfo
+                 * @static
+                 * @param {$protobuf.Reader|Uint8Array} reader Reader or buffer to decode from
+                 * @param {number} [length] Message length if known beforehand
+                 * @returns {PB.SupervisorState.FaultInfo} FaultInfo
+                 * @throws {Error} If the payload is not a reader or valid buffer
+                 * @throws {$protobuf.util.ProtocolError} If required fields are missing
+                 */
+                FaultInfo.decode = function decode(reader, length) {
+                    if (!(reader instanceof $Reader))
+                        reader = $Reader.create(reader);
+                    var end = length === undefined ? reader.len : reader.pos + length, message = new $root.PB.SupervisorState.FaultInfo();
+                    while (reader.pos < end) {
+                        var tag = reader.uint32();
+                        switch (tag >>> 3) {
+                        case 1:
+                            message.type = reader.int32();
+                            break;
+                        case 2:
+                            message.msg = reader.string();
+                            break;
+                        case 3:
+                            message.tsMillis = reader.uint32();
+                            break;
+                        default:
+                            reader.skipType(tag & 7);
+                            break;
+                        }
+                    }
+                    return message;
+                };
+    
+                /**
+                 * Decodes a FaultInfo message from the specified reader or buffer, length delimited.
+                 * @function decodeDelimited
+                 * @memberof PB.SupervisorState.FaultInfo
+                 * @static
+                 * @param {$protobuf.Reader|Uint8Array} reader Reader or buffer to decode from
+                 * @returns {PB.SupervisorState.FaultInfo} FaultInfo
+                 * @throws {Error} If the payload is not a reader or valid buffer
+                 * @throws {$protobuf.util.ProtocolError} If required fields are missing
+                 */
+                FaultInfo.decodeDelimited = function decodeDelimited(reader) {
+                    if (!(reader instanceof $Reader))
+                        reader = new $Reader(reader);
+                    return this.decode(reader, reader.uint32());
+                };
+    
+                /**
+                 * Verifies a FaultInfo message.
+                 * @function verify
+                 * @memberof PB.SupervisorState.FaultInfo
+                 * @static
+                 * @param {Object.<string,*>} message Plain object to verify
+                 * @returns {string|null} `null` if valid, otherwise the reason why it is not
+                 */
+                FaultInfo.verify = function verify(message) {
+                    if (typeof message !== "object" || message === null)
+                        return "object expected";
+                    if (message.type != null && message.hasOwnProperty("type"))
+                        switch (message.type) {
+                        default:
+                            return "type: enum value expected";
+                        case 0:
+                        case 1:
+                        case 2:
+                        case 3:
+                        case 4:
+                        case 5:
+                        case 6:
+                            break;
+                        }
+                    if (message.msg != null && message.hasOwnProperty("msg"))
+                        if (!$util.isString(message.msg))
+                            return "msg: string expected";
+                    if (message.tsMillis != null && message.hasOwnProperty("tsMillis"))
+                        if (!$util.isInteger(message.tsMillis))
+                            return "tsMillis: integer expected";
+                    return null;
+                };
+    
+                /**
+                 * Creates a FaultInfo message from a plain object. Also converts values to their respective internal types.
+                 * @function fromObject
+                 * @memberof PB.SupervisorState.FaultInfo
+                 * @static
+                 * @param {Object.<string,*>} object Plain object
+                 * @returns {PB.SupervisorState.FaultInfo} FaultInfo
+                 */
+                FaultInfo.fromObject = function fromObject(object) {
+                    if (object instanceof $root.PB.SupervisorState.FaultInfo)
+                        return object;
+                    var message = new $root.PB.SupervisorState.FaultInfo();
+                    switch (object.type) {
+                    case "UNKNOWN":
+                    case 0:
+                        message.type = 0;
+                        break;
+                    case "NONE":
+                    case 1:
+                        message.type = 1;
+                        break;
+                    case "INRUSH_CURRENT_NOT_SETTLED":
+                    case 2:
+                        message.type = 2;
+                        break;
+                    case "SPLITFLAP_SHUTDOWN":
+                    case 3:
+                        message.type = 3;
+                        break;
+                    case "OUT_OF_RANGE":
+                    case 4:
+                        message.type = 4;
+                        break;
+                    case "OVER_CURRENT":
+                    case 5:
+                        message.type = 5;
+                        break;
+                    case "UNEXPECTED_POWER":
+                    case 6:
+                        message.type = 6;
+                        break;
+                    }
+                    if (object.msg != null)
+                        message.msg = String(object.msg);
+                    if (object.tsMillis != null)
+                        message.tsMillis = object.tsMillis >>> 0;
+                    return message;
+                };
+    
+                /**
+                 * Creates a plain object from a FaultInfo message. Also converts values to other types if specified.
+                 * @function toObject
+                 * @memberof PB.SupervisorState.FaultInfo
+                 * @static
+                 * @param {PB.SupervisorState.FaultInfo} message FaultInfo
+                 * @param {$protobuf.IConversionOptions} [options] Conversion options
+                 * @returns {Object.<string,*>} Plain object
+                 */
+                FaultInfo.toObject = function toObject(message, options) {
+                    if (!options)
+                        options = {};
+                    var object = {};
+                    if (options.defaults) {
+                        object.type = options.enums === String ? "UNKNOWN" : 0;
+                        object.msg = "";
+                        object.tsMillis = 0;
+                    }
+                    if (message.type != null && message.hasOwnProperty("type"))
+                        object.type = options.enums === String ? $root.PB.SupervisorState.FaultInfo.FaultType[message.type] : message.type;
+                    if (message.msg != null && message.hasOwnProperty("msg"))
+                        object.msg = message.msg;
+                    if (message.tsMillis != null && message.hasOwnProperty("tsMillis"))
+                        object.tsMillis = message.tsMillis;
+                    return object;
+                };
+    
+                /**
+                 * Converts this FaultInfo to JSON.
+                 * @function toJSON
+                 * @memberof PB.SupervisorState.FaultInfo
+                 * @instance
+                 * @returns {Object.<string,*>} JSON object
+                 */
+                FaultInfo.prototype.toJSON = function toJSON() {
+                    return this.constructor.toObject(this, $protobuf.util.toJSONOptions);
+                };
+    
+                /**
+                 * FaultType enum.
+                 * @name PB.SupervisorState.FaultInfo.FaultType
+                 * @enum {number}
+                 * @property {number} UNKNOWN=0 UNKNOWN value
+                 * @property {number} NONE=1 NONE value
+                 * @property {number} INRUSH_CURRENT_NOT_SETTLED=2 INRUSH_CURRENT_NOT_SETTLED value
+                 * @property {number} SPLITFLAP_SHUTDOWN=3 SPLITFLAP_SHUTDOWN value
+                 * @property {number} OUT_OF_RANGE=4 OUT_OF_RANGE value
+                 * @property {number} OVER_CURRENT=5 OVER_CURRENT value
+                 * @property {number} UNEXPECTED_POWER=6 UNEXPECTED_POWER value
+                 */
+                FaultInfo.FaultType = (function() {
+                    var valuesById = {}, values = Object.create(valuesById);
+                    values[valuesById[0] = "UNKNOWN"] = 0;
+                    values[valuesById[1] = "NONE"] = 1;
+                    values[valuesById[2] = "INRUSH_CURRENT_NOT_SETTLED"] = 2;
+                    values[valuesById[3] = "SPLITFLAP_SHUTDOWN"] = 3;
+                    values[valuesById[4] = "OUT_OF_RANGE"] = 4;
+                    values[valuesById[5] = "OVER_CURRENT"] = 5;
+                    values[valuesById[6] = "UNEXPECTED_POWER"] = 6;
+                    return values;
+                })();
+    
+                return FaultInfo;
+            })();
+    
+            return SupervisorState;
+        })();
+    
+        PB.FromSplitflap = (function() {
+    
+            /**
+             * Properties of a FromSplitflap.
+             * @memberof PB
+             * @interface IFromSplitflap
+             * @property {PB.ISplitflapState|null} [splitflapState] FromSplitflap splitflapState
+             * @property {PB.ILog|null} [log] FromSplitflap log
+             * @property {PB.IAck|null} [ack] FromSplitflap ack
+             * @property {PB.ISupervisorState|null} [supervisorState] FromSplitflap supervisorState
+             * @property {PB.IBaudRateResponse|null} [baudRateResponse] FromSplitflap baudRateResponse
+             * @property {PB.IScheduleUploadResponse|null} [scheduleUploadResponse] FromSplitflap scheduleUploadResponse
+             */
+    
+            /**
+             * Constructs a new FromSplitflap.
+             * @memberof PB
+             * @classdesc Represents a FromSplitflap.
+             * @implements IFromSplitflap
+             * @constructor
+             * @param {PB.IFromSplitflap=} [properties] Properties to set
+             */
+            function FromSplitflap(properties) {
+                if (properties)
+                    for (var keys = Object.keys(properties), i = 0; i < keys.length; ++i)
+                        if (properties[keys[i]] != null)
+                            this[keys[i]] = properties[keys[i]];
+            }
+    
+            /**
+             * FromSplitflap splitflapState.
+             * @member {PB.ISplitflapState|null|undefined} splitflapState
+             * @memberof PB.FromSplitflap
+             * @instance
+             */
+            FromSplitflap.prototype.splitflapState = null;
+    
+            /**
+             * FromSplitflap log.
+             * @member {PB.ILog|null|undefined} log
+             * @memberof PB.FromSplitflap
+             * @instance
+             */
+            FromSplitflap.prototype.log = null;
+    
+            /**
+             * FromSplitflap ack.
+             * @member {PB.IAck|null|undefined} ack
+             * @memberof PB.FromSplitflap
+             * @instance
+             */
+            FromSplitflap.prototype.ack = null;
+    
+            /**
+             * FromSplitflap supervisorState.
+             * @member {PB.ISupervisorState|null|undefined} supervisorState
+             * @memberof PB.FromSplitflap
+             * @instance
+             */
+            FromSplitflap.prototype.supervisorState = null;
+    
+            /**
+             * FromSplitflap baudRateResponse.
+             * @member {PB.IBaudRateResponse|null|undefined} baudRateResponse
+             * @memberof PB.FromSplitflap
+             * @instance
+             */
+            FromSplitflap.prototype.baudRateResponse = null;
+    
+            /**
+             * FromSplitflap scheduleUploadResponse.
+             * @member {PB.IScheduleUploadResponse|null|undefined} scheduleUploadResponse
+             * @memberof PB.FromSplitflap
+             * @instance
+             */
+            FromSplitflap.prototype.scheduleUploadResponse = null;
+    
+            // OneOf field names bound to virtual getters and setters
+            var $oneOfFields;
+    
+            /**
+             * FromSplitflap payload.
+             * @member {"splitflapState"|"log"|"ack"|"supervisorState"|"baudRateResponse"|"scheduleUploadResponse"|undefined} payload
+             * @memberof PB.FromSplitflap
+             * @instance
+             */
+            Object.defineProperty(FromSplitflap.prototype, "payload", {
+                get: $util.oneOfGetter($oneOfFields = ["splitflapState", "log", "ack", "supervisorState", "baudRateResponse", "scheduleUploadResponse"]),
+                set: $util.oneOfSetter($oneOfFields)
+            });
+    
+            /**
+             * Creates a new FromSplitflap instance using the specified properties.
+             * @function create
+             * @memberof PB.FromSplitflap
+             * @static
+             * @param {PB.IFromSplitflap=} [properties] Properties to set
+             * @returns {PB.FromSplitflap} FromSplitflap instance
+             */
+            FromSplitflap.create = function create(properties) {
+                return new FromSplitflap(properties);
+            };
+    
+            /**
+             * Encodes the specified FromSplitflap message. Does not implicitly {@link PB.FromSplitflap.verify|verify} messages.
+             * @function encode
+             * @memberof PB.FromSplitflap
+             * @static
+             * @param {PB.IFromSplitflap} message FromSplitflap message or plain object to encode
+             * @param {$protobuf.Writer} [writer] Writer to encode to
+             * @returns {$protobuf.Writer} Writer
+             */
+            FromSplitflap.encode = function encode(message, writer) {
+                if (!writer)
+                    writer = $Writer.create();
+                if (message.splitflapState != null && Object.hasOwnProperty.call(message, "splitflapState"))
+                    $root.PB.SplitflapState.encode(message.splitflapState, writer.uint32(/* id 1, wireType 2 =*/10).fork()).ldelim();
+                if (message.log != null && Object.hasOwnProperty.call(message, "log"))
+                    $root.PB.Log.encode(message.log, writer.uint32(/* id 2, wireType 2 =*/18).fork()).ldelim();
+                if (message.ack != null && Object.hasOwnProperty.call(message, "ack"))
+                    $root.PB.Ack.encode(message.ack, writer.uint32(/* id 3, wireType 2 =*/26).fork()).ldelim();
+                if (message.supervisorState != null && Object.hasOwnProperty.call(message, "supervisorState"))
+                    $root.PB.SupervisorState.encode(message.supervisorState, writer.uint32(/* id 4, wireType 2 =*/34).fork()).ldelim();
+                if (message.baudRateResponse != null && Object.hasOwnProperty.call(message, "baudRateResponse"))
+                    $root.PB.BaudRateResponse.encode(message.baudRateResponse, writer.uint32(/* id 5, wireType 2 =*/42).fork()).ldelim();
+                if (message.scheduleUploadResponse != null && Object.hasOwnProperty.call(message, "scheduleUploadResponse"))
+                    $root.PB.ScheduleUploadResponse.encode(message.scheduleUploadResponse, writer.uint32(/* id 6, wireType 2 =*/50).fork()).ldelim();
+                return writer;
+            };
+    
+            /**
+             * Encodes the specified FromSplitflap message, length delimited. Does not implicitly {@link PB.FromSplitflap.verify|verify} messages.
+             * @function encodeDelimited
+             * @memberof PB.FromSplitflap
+             * @static
+             * @param {PB.IFromSplitflap} message FromSplitflap message or plain object to encode
+             * @param {$protobuf.Writer} [writer] Writer to encode to
+             * @returns {$protobuf.Writer} Writer
+             */
+            FromSplitflap.encodeDelimited = function encodeDelimited(message, writer) {
+                return this.encode(message, writer).ldelim();
+            };
+    
+            /**
+             * Decodes a FromSplitflap message from the specified reader or buffer.
+             * @function decode
+             * @memberof PB.FromSplitflap
+             * @static
+             * @param {$protobuf.Reader|Uint8Array} reader Reader or buffer to decode from
+             * @param {number} [length] Message length if known beforehand
+             * @returns {PB.FromSplitflap} FromSplitflap
+             * @throws {Error} If the payload is not a reader or valid buffer
+             * @throws {$protobuf.util.ProtocolError} If required fields are missing
+             */
+            FromSplitflap.decode = function decode(reader, length) {
+                if (!(reader instanceof $Reader))
+                    reader = $Reader.create(reader);
+                var end = length === undefined ? reader.len : reader.pos + length, message = new $root.PB.FromSplitflap();
+                while (reader.pos < end) {
+                    var tag = reader.uint32();
+                    switch (tag >>> 3) {
+                    case 1:
+                        message.splitflapState = $root.PB.SplitflapState.decode(reader, reader.uint32());
+                        break;
+                    case 2:
+                        message.log = $root.PB.Log.decode(reader, reader.uint32());
+                        break;
+                    case 3:
+                        message.ack = $root.PB.Ack.decode(reader, reader.uint32());
+                        break;
+                    case 4:
+                        message.supervisorState = $root.PB.SupervisorState.decode(reader, reader.uint32());
+                        break;
+                    case 5:
+                        message.baudRateResponse = $root.PB.BaudRateResponse.decode(reader, reader.uint32());
+                        break;
+                    case 6:
+                        message.scheduleUploadResponse = $root.PB.ScheduleUploadResponse.decode(reader, reader.uint32());
+                        break;
+                    default:
+                        reader.skipType(tag & 7);
+                        break;
+                    }
+                }
+                return message;
+            };
+    
+            /**
+             * Decodes a FromSplitflap message from the specified reader or buffer, length delimited.
+             * @function decodeDelimited
+             * @memberof PB.FromSplitflap
+             * @static
+             * @param {$protobuf.Reader|Uint8Array} reader Reader or buffer to decode from
+             * @returns {PB.FromSplitflap} FromSplitflap
+             * @throws {Error} If the payload is not a reader or valid buffer
+             * @throws {$protobuf.util.ProtocolError} If required fields are missing
+             */
+            FromSplitflap.decodeDelimited = function decodeDelimited(reader) {
+                if (!(reader instanceof $Reader))
+                    reader = new $Reader(reader);
+                return this.decode(reader, reader.uint32());
+            };
+    
+            /**
+             * Verifies a FromSplitflap message.
+             * @function verify
+             * @memberof PB.FromSplitflap
+             * @static
+             * @param {Object.<string,*>} message Plain object to verify
+             * @returns {string|null} `null` if valid, otherwise the reason why it is not
+             */
+            FromSplitflap.verify = function verify(message) {
+                if (typeof message !== "object" || message === null)
+                    return "object expected";
+                var properties = {};
+                if (message.splitflapState != null && message.hasOwnProperty("splitflapState")) {
+                    properties.payload = 1;
+                    {
+                        var error = $root.PB.SplitflapState.verify(message.splitflapState);
+                        if (error)
+                            return "splitflapState." + error;
+                    }
+                }
+                if (message.log != null && message.hasOwnProperty("log")) {
+                    if (properties.payload === 1)
+                        return "payload: multiple values";
+                    properties.payload = 1;
+                    {
+                        var error = $root.PB.Log.verify(message.log);
+                        if (error)
+                            return "log." + error;
+                    }
+                }
+                if (message.ack != null && message.hasOwnProperty("ack")) {
+                    if (properties.payload === 1)
+                        return "payload: multiple values";
+                    properties.payload = 1;
+                    {
+                        var error = $root.PB.Ack.verify(message.ack);
+                        if (error)
+                            return "ack." + error;
+                    }
+                }
+                if (message.supervisorState != null && message.hasOwnProperty("supervisorState")) {
+                    if (properties.payload === 1)
+                        return "payload: multiple values";
+                    properties.payload = 1;
+                    {
+                        var error = $root.PB.SupervisorState.verify(message.supervisorState);
+                        if (error)
+                            return "supervisorState." + error;
+                    }
+                }
+                if (message.baudRateResponse != null && message.hasOwnProperty("baudRateResponse")) {
+                    if (properties.payload === 1)
+                        return "payload: multiple values";
+                    properties.payload = 1;
+                    {
+                        var error = $root.PB.BaudRateResponse.verify(message.baudRateResponse);
+                        if (error)
+                            return "baudRateResponse." + error;
+                    }
+                }
+                if (message.scheduleUploadResponse != null && message.hasOwnProperty("scheduleUploadResponse")) {
+                    if (properties.payload === 1)
+                        return "payload: multiple values";
+                    properties.payload = 1;
+                    {
+                        var error = $root.PB.ScheduleUploadResponse.verify(message.scheduleUploadResponse);
+                        if (error)
+                            return "scheduleUploadResponse." + error;
+                    }
+                }
+                return null;
+            };
+    
+            /**
+             * Creates a FromSplitflap message from a plain object. Also converts values to their respective internal types.
+             * @function fromObject
+             * @memberof PB.FromSplitflap
+             * @static
+             * @param {Object.<string,*>} object Plain object
+             * @returns {PB.FromSplitflap} FromSplitflap
+             */
+            FromSplitflap.fromObject = function fromObject(object) {
+                if (object instanceof $root.PB.FromSplitflap)
+                    return object;
+                var message = new $root.PB.FromSplitflap();
+                if (object.splitflapState != null) {
+                    if (typeof object.splitflapState !== "object")
+                        throw TypeError(".PB.FromSplitflap.splitflapState: object expected");
+                    message.splitflapState = $root.PB.SplitflapState.fromObject(object.splitflapState);
+                }
+                if (object.log != null) {
+                    if (typeof object.log !== "object")
+                        throw TypeError(".PB.FromSplitflap.log: object expected");
+                    message.log = $root.PB.Log.fromObject(object.log);
+                }
+                if (object.ack != null) {
+                    if (typeof object.ack !== "object")
+                        throw TypeError(".PB.FromSplitflap.ack: object expected");
+                    message.ack = $root.PB.Ack.fromObject(object.ack);
+                }
+                if (object.supervisorState != null) {
+                    if (typeof object.supervisorState !== "object")
+                        throw TypeError(".PB.FromSplitflap.supervisorState: object expected");
+                    message.supervisorState = $root.PB.SupervisorState.fromObject(object.supervisorState);
+                }
+                if (object.baudRateResponse != null) {
+                    if (typeof object.baudRateResponse !== "object")
+                        throw TypeError(".PB.FromSplitflap.baudRateResponse: object expected");
+                    message.baudRateResponse = $root.PB.BaudRateResponse.fromObject(object.baudRateResponse);
+                }
+                if (object.scheduleUploadResponse != null) {
+                    if (typeof object.scheduleUploadResponse !== "object")
+                        throw TypeError(".PB.FromSplitflap.scheduleUploadResponse: object expected");
+                    message.scheduleUploadResponse = $root.PB.ScheduleUploadResponse.fromObject(object.scheduleUploadResponse);
+                }
+                return message;
+            };
+    
+            /**
+             * Creates a plain object from a FromSplitflap message. Also converts values to other types if specified.
+             * @function toObject
+             * @memberof PB.FromSplitflap
+             * @static
+             * @param {PB.FromSplitflap} message FromSplitflap
+             * @param {$protobuf.IConversionOptions} [options] Conversion options
+             * @returns {Object.<string,*>} Plain object
+             */
+            FromSplitflap.toObject = function toObject(message, options) {
+                if (!options)
+                    options = {};
+                var object = {};
+                if (message.splitflapState != null && message.hasOwnProperty("splitflapState")) {
+                    object.splitflapState = $root.PB.SplitflapState.toObject(message.splitflapState, options);
+                    if (options.oneofs)
+                        object.payload = "splitflapState";
+                }
+                if (message.log != null && message.hasOwnProperty("log")) {
+                    object.log = $root.PB.Log.toObject(message.log, options);
+                    if (options.oneofs)
+                        object.payload = "log";
+                }
+                if (message.ack != null && message.hasOwnProperty("ack")) {
+                    object.ack = $root.PB.Ack.toObject(message.ack, options);
+                    if (options.oneofs)
+                        object.payload = "ack";
+                }
+                if (message.supervisorState != null && message.hasOwnProperty("supervisorState")) {
+                    object.supervisorState = $root.PB.SupervisorState.toObject(message.supervisorState, options);
+                    if (options.oneofs)
+                        object.payload = "supervisorState";
+                }
+                if (message.baudRateResponse != null && message.hasOwnProperty("baudRateResponse")) {
+                    object.baudRateResponse = $root.PB.BaudRateResponse.toObject(message.baudRateResponse, options);
+                    if (options.oneofs)
+                        object.payload = "baudRateResponse";
+                }
+                if (message.scheduleUploadResponse != null && message.hasOwnProperty("scheduleUploadResponse")) {
+                    object.scheduleUploadResponse = $root.PB.ScheduleUploadResponse.toObject(message.scheduleUploadResponse, options);
+                    if (options.oneofs)
+                        object.payload = "scheduleUploadResponse";
+                }
+                return object;
+            };
+    
+            /**
+             * Converts this FromSplitflap to JSON.
+             * @function toJSON
+             * @memberof PB.FromSplitflap
+             * @instance
+             * @returns {Object.<string,*>} JSON object
+             */
+            FromSplitflap.prototype.toJSON = function toJSON() {
+                return this.constructor.toObject(this, $protobuf.util.toJSONOptions);
+            };
+    
+            return FromSplitflap;
+        })();
+    
+        PB.SplitflapCommand = (function() {
+    
+            /**
+             * Properties of a SplitflapCommand.
+             * @memberof PB
+             * @interface ISplitflapCommand
+             * @property {Array.<PB.SplitflapCommand.IModuleCommand>|null} [modules] SplitflapCommand modules
+             */
+    
+            /**
+             * Constructs a new SplitflapCommand.
+             * @memberof PB
+             * @classdesc Represents a SplitflapCommand.
+             * @implements ISplitflapCommand
+             * @constructor
+             * @param {PB.ISplitflapCommand=} [properties] Properties to set
+             */
+            function SplitflapCommand(properties) {
+                this.modules = [];
+                if (properties)
+                    for (var keys = Object.keys(properties), i = 0; i < keys.length; ++i)
+                        if (properties[keys[i]] != null)
+                            this[keys[i]] = properties[keys[i]];
+            }
+    
+            /**
+             * SplitflapCommand modules.
+             * @member {Array.<PB.SplitflapCommand.IModuleCommand>} modules
+             * @memberof PB.SplitflapCommand
+             * @instance
+             */
+            SplitflapCommand.prototype.modules = $util.emptyArray;
+    
+            /**
+             * Creates a new SplitflapCommand instance using the specified properties.
+             * @function create
+             * @memberof PB.SplitflapCommand
+             * @static
+             * @param {PB.ISplitflapCommand=} [properties] Properties to set
+             * @returns {PB.SplitflapCommand} SplitflapCommand instance
+             */
+            SplitflapCommand.create = function create(properties) {
+                return new SplitflapCommand(properties);
+            };
+    
+            /**
+             * Encodes the specified SplitflapCommand message. Does not implicitly {@link PB.SplitflapCommand.verify|verify} messages.
+             * @function encode
+             * @memberof PB.SplitflapCommand
+             * @static
+             * @param {PB.ISplitflapCommand} message SplitflapCommand message or plain object to encode
+             * @param {$protobuf.Writer} [writer] Writer to encode to
+             * @returns {$protobuf.Writer} Writer
+             */
+            SplitflapCommand.encode = function encode(message, writer) {
+                if (!writer)
+                    writer = $Writer.create();
+                if (message.modules != null && message.modules.length)
+                    for (var i = 0; i < message.modules.length; ++i)
+                        $root.PB.SplitflapCommand.ModuleCommand.encode(message.modules[i], writer.uint32(/* id 2, wireType 2 =*/18).fork()).ldelim();
+                return writer;
+            };
+    
+            /**
+             * Encodes the specified SplitflapCommand message, length delimited. Does not implicitly {@link PB.SplitflapCommand.verify|verify} messages.
+             * @function encodeDelimited
+             * @memberof PB.SplitflapCommand
+             * @static
+             * @param {PB.ISplitflapCommand} message SplitflapCommand message or plain object to encode
+             * @param {$protobuf.Writer} [writer] Writer to encode to
+             * @returns {$protobuf.Writer} Writer
+             */
+            SplitflapCommand.encodeDelimited = function encodeDelimited(message, writer) {
+                return this.encode(message, writer).ldelim();
+            };
+    
+            /**
+             * Decodes a SplitflapCommand message from the specified reader or buffer.
+             * @function decode
+             * @memberof PB.SplitflapCommand
+             * @static
+             * @param {$protobuf.Reader|Uint8Array} reader Reader or buffer to decode from
+             * @param {number} [length] Message length if known beforehand
+             * @returns {PB.SplitflapCommand} SplitflapCommand
+             * @throws {Error} If the payload is not a reader or valid buffer
+             * @throws {$protobuf.util.ProtocolError} If required fields are missing
+             */
+            SplitflapCommand.decode = function decode(reader, length) {
+                if (!(reader instanceof $Reader))
+                    reader = $Reader.create(reader);
+                var end = length === undefined ? reader.len : reader.pos + length, message = new $root.PB.SplitflapCommand();
+                while (reader.pos < end) {
+                    var tag = reader.uint32();
+                    switch (tag >>> 3) {
+                    case 2:
+                        if (!(message.modules && message.modules.length))
+                            message.modules = [];
+                        message.modules.push($root.PB.SplitflapCommand.ModuleCommand.decode(reader, reader.uint32()));
+                        break;
+                    default:
+                        reader.skipType(tag & 7);
+                        break;
+                    }
+                }
+                return message;
+            };
+    
+            /**
+             * Decodes a SplitflapCommand message from the specified reader or buffer, length delimited.
+             * @function decodeDelimited
+             * @memberof PB.SplitflapCommand
+             * @static
+             * @param {$protobuf.Reader|Uint8Array} reader Reader or buffer to decode from
+             * @returns {PB.SplitflapCommand} SplitflapCommand
+             * @throws {Error} If the payload is not a reader or valid buffer
+             * @throws {$protobuf.util.ProtocolError} If required fields are missing
+             */
+            SplitflapCommand.decodeDelimited = function decodeDelimited(reader) {
+                if (!(reader instanceof $Reader))
+                    reader = new $Reader(reader);
+                return this.decode(reader, reader.uint32());
+            };
+    
+            /**
+             * Verifies a SplitflapCommand message.
+             * @function verify
+             * @memberof PB.SplitflapCommand
+             * @static
+             * @param {Object.<string,*>} message Plain object to verify
+             * @returns {string|null} `null` if valid, otherwise the reason why it is not
+             */
+            SplitflapCommand.verify = function verify(message) {
+                if (typeof message !== "object" || message === null)
+                    return "object expected";
+                if (message.modules != null && message.hasOwnProperty("modules")) {
+                    if (!Array.isArray(message.modules))
+                        return "modules: array expected";
+                    for (var i = 0; i < message.modules.length; ++i) {
+                        var error = $root.PB.SplitflapCommand.ModuleCommand.verify(message.modules[i]);
+                        if (error)
+                            return "modules." + error;
+                    }
+                }
+                return null;
+            };
+    
+            /**
+             * Creates a SplitflapCommand message from a plain object. Also converts values to their respective internal types.
+             * @function fromObject
+             * @memberof PB.SplitflapCommand
+             * @static
+             * @param {Object.<string,*>} object Plain object
+             * @returns {PB.SplitflapCommand} SplitflapCommand
+             */
+            SplitflapCommand.fromObject = function fromObject(object) {
+                if (object instanceof $root.PB.SplitflapCommand)
+                    return object;
+                var message = new $root.PB.SplitflapCommand();
+                if (object.modules) {
+                    if (!Array.isArray(object.modules))
+                        throw TypeError(".PB.SplitflapCommand.modules: array expected");
+                    message.modules = [];
+                    for (var i = 0; i < object.modules.length; ++i) {
+                        if (typeof object.modules[i] !== "object")
+                            throw TypeError(".PB.SplitflapCommand.modules: object expected");
+                        message.modules[i] = $root.PB.SplitflapCommand.ModuleCommand.fromObject(object.modules[i]);
+                    }
+                }
+                return message;
+            };
+    
+            /**
+             * Creates a plain object from a SplitflapCommand message. Also converts values to other types if specified.
+             * @function toObject
+             * @memberof PB.SplitflapCommand
+             * @static
+             * @param {PB.SplitflapCommand} message SplitflapCommand
+             * @param {$protobuf.IConversionOptions} [options] Conversion options
+             * @returns {Object.<string,*>} Plain object
+             */
+            SplitflapCommand.toObject = function toObject(message, options) {
+                if (!options)
+                    options = {};
+                var object = {};
+                if (options.arrays || options.defaults)
+                    object.modules = [];
+                if (message.modules && message.modules.length) {
+                    object.modules = [];
+                    for (var j = 0; j < message.modules.length; ++j)
+                        object.modules[j] = $root.PB.SplitflapCommand.ModuleCommand.toObject(message.modules[j], options);
+                }
+                return object;
+            };
+    
+            /**
+             * Converts this SplitflapCommand to JSON.
+             * @function toJSON
+             * @memberof PB.SplitflapCommand
+             * @instance
+             * @returns {Object.<string,*>} JSON object
+             */
+            SplitflapCommand.prototype.toJSON = function toJSON() {
+                return this.constructor.toObject(this, $protobuf.util.toJSONOptions);
+            };
+    
+            SplitflapCommand.ModuleCommand = (function() {
     
                 /**
-                 * PowerChannelState on.
-                 * @member {boolean} on
-                 * @memberof PB.SupervisorState.PowerChannelState
+                 * Properties of a ModuleCommand.
+                 * @memberof PB.SplitflapCommand
+                 * @interface IModuleCommand
+                 * @property {PB.SplitflapCommand.ModuleCommand.Action|null} [action] ModuleCommand action
+                 * @property {number|null} [param] ModuleCommand param
+                 */
+    
+                /**
+                 * Constructs a new ModuleCommand.
+                 * @memberof PB.SplitflapCommand
+                 * @classdesc Represents a ModuleCommand.
+                 * @implements IModuleCommand
+                 * @constructor
+                 * @param {PB.SplitflapCommand.IModuleCommand=} [properties] Properties to set
+                 */
+                function ModuleCommand(properties) {
+                    if (properties)
+                        for (var keys = Object.keys(properties), i = 0; i < keys.length; ++i)
+                            if (properties[keys[i]] != null)
+                                this[keys[i]] = properties[keys[i]];
+                }
+    
+                /**
+                 * ModuleCommand action.
+                 * @member {PB.SplitflapCommand.ModuleCommand.Action} action
+                 * @memberof PB.SplitflapCommand.ModuleCommand
                  * @instance
                  */
-                PowerChannelState.prototype.on = false;
+                ModuleCommand.prototype.action = 0;
     
                 /**
-                 * Creates a new PowerChannelState instance using the specified properties.
+                 * ModuleCommand param.
+                 * @member {number} param
+                 * @memberof PB.SplitflapCommand.ModuleCommand
+                 * @instance
+                 */
+                ModuleCommand.prototype.param = 0;
+    
+                /**
+                 * Creates a new ModuleCommand instance using the specified properties.
                  * @function create
-                 * @memberof PB.SupervisorState.PowerChannelState
+                 * @memberof PB.SplitflapCommand.ModuleCommand
                  * @static
-                 * @param {PB.SupervisorState.IPowerChannelState=} [properties] Properties to set
-                 * @returns {PB.SupervisorState.PowerChannelState} PowerChannelState instance
+                 * @param {PB.SplitflapCommand.IModuleCommand=} [properties] Properties to set
+                 * @returns {PB.SplitflapCommand.ModuleCommand} ModuleCommand instance
                  */
-                PowerChannelState.create = function create(properties) {
-                    return new PowerChannelState(properties);
+                ModuleCommand.create = function create(properties) {
+                    return new ModuleCommand(properties);
                 };
     
                 /**
-                 * Encodes the specified PowerChannelState message. Does not implicitly {@link PB.SupervisorState.PowerChannelState.verify|verify} messages.
+                 * Encodes the specified ModuleCommand message. Does not implicitly {@link PB.SplitflapCommand.ModuleCommand.verify|verify} messages.
                  * @function encode
-                 * @memberof PB.SupervisorState.PowerChannelState
+                 * @memberof PB.SplitflapCommand.ModuleCommand
                  * @static
-                 * @param {PB.SupervisorState.IPowerChannelState} message PowerChannelState message or plain object to encode
+                 * @param {PB.SplitflapCommand.IModuleCommand} message ModuleCommand message or plain object to encode
                  * @param {$protobuf.Writer} [writer] Writer to encode to
                  * @returns {$protobuf.Writer} Writer
                  */
-                PowerChannelState.encode = function encode(message, writer) {
+                ModuleCommand.encode = function encode(message, writer) {
                     if (!writer)
                         writer = $Writer.create();
-                    if (message.voltageVolts != null && Object.hasOwnProperty.call(message, "voltageVolts"))
-                        writer.uint32(/* id 1, wireType 5 =*/13).float(message.voltageVolts);
-                    if (message.currentAmps != null && Object.hasOwnProperty.call(message, "currentAmps"))
-                        writer.uint32(/* id 2, wireType 5 =*/21).float(message.currentAmps);
-                    if (message.on != null && Object.hasOwnProperty.call(message, "on"))
-                        writer.uint32(/* id 3, wireType 0 =*/24).bool(message.on);
+                    if (message.action != null && Object.hasOwnProperty.call(message, "action"))
+                        writer.uint32(/* id 1, wireType 0 =*/8).int32(message.action);
+                    if (message.param != null && Object.hasOwnProperty.call(message, "param"))
+                        writer.uint32(/* id 2, wireType 0 =*/16).uint32(message.param);
                     return writer;
                 };
     
                 /**
-                 * Encodes the specified PowerChannelState message, length delimited. Does not implicitly {@link PB.SupervisorState.PowerChannelState.verify|verify} messages.
+                 * Encodes the specified ModuleCommand message, length delimited. Does not implicitly {@link PB.SplitflapCommand.ModuleCommand.verify|verify} messages.
                  * @function encodeDelimited
-                 * @memberof PB.SupervisorState.PowerChannelState
+                 * @memberof PB.SplitflapCommand.ModuleCommand
                  * @static
-                 * @param {PB.SupervisorState.IPowerChannelState} message PowerChannelState message or plain object to encode
+                 * @param {PB.SplitflapCommand.IModuleCommand} message ModuleCommand message or plain object to encode
                  * @param {$protobuf.Writer} [writer] Writer to encode to
                  * @returns {$protobuf.Writer} Writer
                  */
-                PowerChannelState.encodeDelimited = function encodeDelimited(message, writer) {
+                ModuleCommand.encodeDelimited = function encodeDelimited(message, writer) {
                     return this.encode(message, writer).ldelim();
                 };
     
                 /**
-                 * Decodes a PowerChannelState message from the specified reader or buffer.
+                 * Decodes a ModuleCommand message from the specified reader or buffer.
                  * @function decode
-                 * @memberof PB.SupervisorState.PowerChannelState
+                 * @memberof PB.SplitflapCommand.ModuleCommand
                  * @static
                  * @param {$protobuf.Reader|Uint8Array} reader Reader or buffer to decode from
                  * @param {number} [length] Message length if known beforehand
-                 * @returns {PB.SupervisorState.PowerChannelState} PowerChannelState
+                 * @returns {PB.SplitflapCommand.ModuleCommand} ModuleCommand
                  * @throws {Error} If the payload is not a reader or valid buffer
                  * @throws {$protobuf.util.ProtocolError} If required fields are missing
                  */
-                PowerChannelState.decode = function decode(reader, length) {
+                ModuleCommand.decode = function decode(reader, length) {
                     if (!(reader instanceof $Reader))
                         reader = $Reader.create(reader);
-                    var end = length === undefined ? reader.len : reader.pos + length, message = new $root.PB.SupervisorState.PowerChannelState();
+                    var end = length === undefined ? reader.len : reader.pos + length, message = new $root.PB.SplitflapCommand.ModuleCommand();
                     while (reader.pos < end) {
                         var tag = reader.uint32();
                         switch (tag >>> 3) {
                         case 1:
-                            message.voltageVolts = reader.float();
+                            message.action = reader.int32();
                             break;
                         case 2:
-                            message.currentAmps = reader.float();
-                            break;
-                        case 3:
-                            message.on = reader.bool();
+                            message.param = reader.uint32();
                             break;
                         default:
                             reader.skipType(tag & 7);
@@ -1418,126 +3214,368 @@
                 };
     
                 /**
-                 * Decodes a PowerChannelState message from the specified reader or buffer, length delimited.
+                 * Decodes a ModuleCommand message from the specified reader or buffer, length delimited.
                  * @function decodeDelimited
-                 * @memberof PB.SupervisorState.PowerChannelState
+                 * @memberof PB.SplitflapCommand.ModuleCommand
                  * @static
                  * @param {$protobuf.Reader|Uint8Array} reader Reader or buffer to decode from
-                 * @returns {PB.SupervisorState.PowerChannelState} PowerChannelState
+                 * @returns {PB.SplitflapCommand.ModuleCommand} ModuleCommand
                  * @throws {Error} If the payload is not a reader or valid buffer
                  * @throws {$protobuf.util.ProtocolError} If required fields are missing
                  */
-                PowerChannelState.decodeDelimited = function decodeDelimited(reader) {
+                ModuleCommand.decodeDelimited = function decodeDelimited(reader) {
                     if (!(reader instanceof $Reader))
                         reader = new $Reader(reader);
                     return this.decode(reader, reader.uint32());
                 };
     
                 /**
-                 * Verifies a PowerChannelState message.
+                 * Verifies a ModuleCommand message.
                  * @function verify
-                 * @memberof PB.SupervisorState.PowerChannelState
+                 * @memberof PB.SplitflapCommand.ModuleCommand
                  * @static
                  * @param {Object.<string,*>} message Plain object to verify
                  * @returns {string|null} `null` if valid, otherwise the reason why it is not
                  */
-                PowerChannelState.verify = function verify(message) {
+                ModuleCommand.verify = function verify(message) {
                     if (typeof message !== "object" || message === null)
                         return "object expected";
-                    if (message.voltageVolts != null && message.hasOwnProperty("voltageVolts"))
-                        if (typeof message.voltageVolts !== "number")
-                            return "voltageVolts: number expected";
-                    if (message.currentAmps != null && message.hasOwnProperty("currentAmps"))
-                        if (typeof message.currentAmps !== "number")
-                            return "currentAmps: number expected";
-                    if (message.on != null && message.hasOwnProperty("on"))
-                        if (typeof message.on !== "boolean")
-                            return "on: boolean expected";
+                    if (message.action != null && message.hasOwnProperty("action"))
+                        switch (message.action) {
+                        default:
+                            return "action: enum value expected";
+                        case 0:
+                        case 1:
+                        case 2:
+                            break;
+                        }
+                    if (message.param != null && message.hasOwnProperty("param"))
+                        if (!$util.isInteger(message.param))
+                            return "param: integer expected";
                     return null;
                 };
     
                 /**
-                 * Creates a PowerChannelState message from a plain object. Also converts values to their respective internal types.
+                 * Creates a ModuleCommand message from a plain object. Also converts values to their respective internal types.
                  * @function fromObject
-                 * @memberof PB.SupervisorState.PowerChannelState
+                 * @memberof PB.SplitflapCommand.ModuleCommand
                  * @static
                  * @param {Object.<string,*>} object Plain object
-                 * @returns {PB.SupervisorState.PowerChannelState} PowerChannelState
+                 * @returns {PB.SplitflapCommand.ModuleCommand} ModuleCommand
                  */
-                PowerChannelState.fromObject = function fromObject(object) {
-                    if (object instanceof $root.PB.SupervisorState.PowerChannelState)
+                ModuleCommand.fromObject = function fromObject(object) {
+                    if (object instanceof $root.PB.SplitflapCommand.ModuleCommand)
                         return object;
-                    var message = new $root.PB.SupervisorState.PowerChannelState();
-                    if (object.voltageVolts != null)
-                        message.voltageVolts = Number(object.voltageVolts);
-                    if (object.currentAmps != null)
-                        message.currentAmps = Number(object.currentAmps);
-                    if (object.on != null)
-                        message.on = Boolean(object.on);
+                    var message = new $root.PB.SplitflapCommand.ModuleCommand();
+                    switch (object.action) {
+                    case "NO_OP":
+                    case 0:
+                        message.action = 0;
+                        break;
+                    case "GO_TO_FLAP":
+                    case 1:
+                        message.action = 1;
+                        break;
+                    case "RESET_AND_HOME":
+                    case 2:
+                        message.action = 2;
+                        break;
+                    }
+                    if (object.param != null)
+                        message.param = object.param >>> 0;
                     return message;
                 };
     
                 /**
-                 * Creates a plain object from a PowerChannelState message. Also converts values to other types if specified.
+                 * Creates a plain object from a ModuleCommand message. Also converts values to other types if specified.
                  * @function toObject
-                 * @memberof PB.SupervisorState.PowerChannelState
+                 * @memberof PB.SplitflapCommand.ModuleCommand
                  * @static
-                 * @param {PB.SupervisorState.PowerChannelState} message PowerChannelState
+                 * @param {PB.SplitflapCommand.ModuleCommand} message ModuleCommand
                  * @param {$protobuf.IConversionOptions} [options] Conversion options
                  * @returns {Object.<string,*>} Plain object
                  */
-                PowerChannelState.toObject = function toObject(message, options) {
+                ModuleCommand.toObject = function toObject(message, options) {
                     if (!options)
                         options = {};
                     var object = {};
                     if (options.defaults) {
-                        object.voltageVolts = 0;
-                        object.currentAmps = 0;
-                        object.on = false;
+                        object.action = options.enums === String ? "NO_OP" : 0;
+                        object.param = 0;
                     }
-                    if (message.voltageVolts != null && message.hasOwnProperty("voltageVolts"))
-                        object.voltageVolts = options.json && !isFinite(message.voltageVolts) ? String(message.voltageVolts) : message.voltageVolts;
-                    if (message.currentAmps != null && message.hasOwnProperty("currentAmps"))
-                        object.currentAmps = options.json && !isFinite(message.currentAmps) ? String(message.currentAmps) : message.currentAmps;
-                    if (message.on != null && message.hasOwnProperty("on"))
-                        object.on = message.on;
+                    if (message.action != null && message.hasOwnProperty("action"))
+                        object.action = options.enums === String ? $root.PB.SplitflapCommand.ModuleCommand.Action[message.action] : message.action;
+                    if (message.param != null && message.hasOwnProperty("param"))
+                        object.param = message.param;
                     return object;
                 };
     
                 /**
-                 * Converts this PowerChannelState to JSON.
+                 * Converts this ModuleCommand to JSON.
                  * @function toJSON
-                 * @memberof PB.SupervisorState.PowerChannelState
+                 * @memberof PB.SplitflapCommand.ModuleCommand
                  * @instance
                  * @returns {Object.<string,*>} JSON object
                  */
-                PowerChannelState.prototype.toJSON = function toJSON() {
+                ModuleCommand.prototype.toJSON = function toJSON() {
                     return this.constructor.toObject(this, $protobuf.util.toJSONOptions);
                 };
     
-                return PowerChannelState;
-            })();
+                /**
+                 * Action enum.
+                 * @name PB.SplitflapCommand.ModuleCommand.Action
+                 * @enum {number}
+                 * @property {number} NO_OP=0 NO_OP value
+                 * @property {number} GO_TO_FLAP=1 GO_TO_FLAP value
+                 * @property {number} RESET_AND_HOME=2 RESET_AND_HOME value
+                 */
+                ModuleCommand.Action = (function() {
+                    var valuesById = {}, values = Object.create(valuesById);
+                    values[valuesById[0] = "NO_OP"] = 0;
+                    values[valuesById[1] = "GO_TO_FLAP"] = 1;
+                    values[valuesById[2] = "RESET_AND_HOME"] = 2;
+                    return values;
+                })();
+    
+                return ModuleCommand;
+            })();
+    
+            return SplitflapCommand;
+        })();
+    
+        PB.SplitflapConfig = (function() {
+    
+            /**
+             * Properties of a SplitflapConfig.
+             * @memberof PB
+             * @interface ISplitflapConfig
+             * @property {Array.<PB.SplitflapConfig.IModuleConfig>|null} [modules] SplitflapConfig modules
+             */
+    
+            /**
+             * Constructs a new SplitflapConfig.
+             * @memberof PB
+             * @classdesc Represents a SplitflapConfig.
+             * @implements ISplitflapConfig
+             * @constructor
+             * @param {PB.ISplitflapConfig=} [properties] Properties to set
+             */
+            function SplitflapConfig(properties) {
+                this.modules = [];
+                if (properties)
+                    for (var keys = Object.keys(properties), i = 0; i < keys.length; ++i)
+                        if (properties[keys[i]] != null)
+                            this[keys[i]] = properties[keys[i]];
+            }
+    
+            /**
+             * SplitflapConfig modules.
+             * @member {Array.<PB.SplitflapConfig.IModuleConfig>} modules
+             * @memberof PB.SplitflapConfig
+             * @instance
+             */
+            SplitflapConfig.prototype.modules = $util.emptyArray;
+    
+            /**
+             * Creates a new SplitflapConfig instance using the specified properties.
+             * @function create
+             * @memberof PB.SplitflapConfig
+             * @static
+             * @param {PB.ISplitflapConfig=} [properties] Properties to set
+             * @returns {PB.SplitflapConfig} SplitflapConfig instance
+             */
+            SplitflapConfig.create = function create(properties) {
+                return new SplitflapConfig(properties);
+            };
+    
+            /**
+             * Encodes the specified SplitflapConfig message. Does not implicitly {@link PB.SplitflapConfig.verify|verify} messages.
+             * @function encode
+             * @memberof PB.SplitflapConfig
+             * @static
+             * @param {PB.ISplitflapConfig} message SplitflapConfig message or plain object to encode
+             * @param {$protobuf.Writer} [writer] Writer to encode to
+             * @returns {$protobuf.Writer} Writer
+             */
+            SplitflapConfig.encode = function encode(message, writer) {
+                if (!writer)
+                    writer = $Writer.create();
+                if (message.modules != null && message.modules.length)
+                    for (var i = 0; i < message.modules.length; ++i)
+                        $root.PB.SplitflapConfig.ModuleConfig.encode(message.modules[i], writer.uint32(/* id 1, wireType 2 =*/10).fork()).ldelim();
+                return writer;
+            };
+    
+            /**
+             * Encodes the specified SplitflapConfig message, length delimited. Does not implicitly {@link PB.SplitflapConfig.verify|verify} messages.
+             * @function encodeDelimited
+             * @memberof PB.SplitflapConfig
+             * @static
+             * @param {PB.ISplitflapConfig} message SplitflapConfig message or plain object to encode
+             * @param {$protobuf.Writer} [writer] Writer to encode to
+             * @returns {$protobuf.Writer} Writer
+             */
+            SplitflapConfig.encodeDelimited = function encodeDelimited(message, writer) {
+                return this.encode(message, writer).ldelim();
+            };
+    
+            /**
+             * Decodes a SplitflapConfig message from the specified reader or buffer.
+             * @function decode
+             * @memberof PB.SplitflapConfig
+             * @static
+             * @param {$protobuf.Reader|Uint8Array} reader Reader or buffer to decode from
+             * @param {number} [length] Message length if known beforehand
+             * @returns {PB.SplitflapConfig} SplitflapConfig
+             * @throws {Error} If the payload is not a reader or valid buffer
+             * @throws {$protobuf.util.ProtocolError} If required fields are missing
+             */
+            SplitflapConfig.decode = function decode(reader, length) {
+                if (!(reader instanceof $Reader))
+                    reader = $Reader.create(reader);
+                var end = length === undefined ? reader.len : reader.pos + length, message = new $root.PB.SplitflapConfig();
+                while (reader.pos < end) {
+                    var tag = reader.uint32();
+                    switch (tag >>> 3) {
+                    case 1:
+                        if (!(message.modules && message.modules.length))
+                            message.modules = [];
+                        message.modules.push($root.PB.SplitflapConfig.ModuleConfig.decode(reader, reader.uint32()));
+                        break;
+                    default:
+                        reader.skipType(tag & 7);
+                        break;
+                    }
+                }
+                return message;
+            };
+    
+            /**
+             * Decodes a SplitflapConfig message from the specified reader or buffer, length delimited.
+             * @function decodeDelimited
+             * @memberof PB.SplitflapConfig
+             * @static
+             * @param {$protobuf.Reader|Uint8Array} reader Reader or buffer to decode from
+             * @returns {PB.SplitflapConfig} SplitflapConfig
+             * @throws {Error} If the payload is not a reader or valid buffer
+             * @throws {$protobuf.util.ProtocolError} If required fields are missing
+             */
+            SplitflapConfig.decodeDelimited = function decodeDelimited(reader) {
+                if (!(reader instanceof $Reader))
+                    reader = new $Reader(reader);
+                return this.decode(reader, reader.uint32());
+            };
+    
+            /**
+             * Verifies a SplitflapConfig message.
+             * @function verify
+             * @memberof PB.SplitflapConfig
+             * @static
+             * @param {Object.<string,*>} message Plain object to verify
+             * @returns {string|null} `null` if valid, otherwise the reason why it is not
+             */
+            SplitflapConfig.verify = function verify(message) {
+                if (typeof message !== "object" || message === null)
+                    return "object expected";
+                if (message.modules != null && message.hasOwnProperty("modules")) {
+                    if (!Array.isArray(message.modules))
+                        return "modules: array expected";
+                    for (var i = 0; i < message.modules.length; ++i) {
+                        var error = $root.PB.SplitflapConfig.ModuleConfig.verify(message.modules[i]);
+                        if (error)
+                            return "modules." + error;
+                    }
+                }
+                return null;
+            };
+    
+            /**
+             * Creates a SplitflapConfig message from a plain object. Also converts values to their respective internal types.
+             * @function fromObject
+             * @memberof PB.SplitflapConfig
+             * @static
+             * @param {Object.<string,*>} object Plain object
+             * @returns {PB.SplitflapConfig} SplitflapConfig
+             */
+            SplitflapConfig.fromObject = function fromObject(object) {
+                if (object instanceof $root.PB.SplitflapConfig)
+                    return object;
+                var message = new $root.PB.SplitflapConfig();
+                if (object.modules) {
+                    if (!Array.isArray(object.modules))
+                        throw TypeError(".PB.SplitflapConfig.modules: array expected");
+                    message.modules = [];
+                    for (var i = 0; i < object.modules.length; ++i) {
+                        if (typeof object.modules[i] !== "object")
+                            throw TypeError(".PB.SplitflapConfig.modules: object expected");
+                        message.modules[i] = $root.PB.SplitflapConfig.ModuleConfig.fromObject(object.modules[i]);
+                    }
+                }
+                return message;
+            };
+    
+            /**
+             * Creates a plain object from a SplitflapConfig message. Also converts values to other types if specified.
+             * @function toObject
+             * @memberof PB.SplitflapConfig
+             * @static
+             * @param {PB.SplitflapConfig} message SplitflapConfig
+             * @param {$protobuf.IConversionOptions} [options] Conversion options
+             * @returns {Object.<string,*>} Plain object
+             */
+            SplitflapConfig.toObject = function toObject(message, options) {
+                if (!options)
+                    options = {};
+                var object = {};
+                if (options.arrays || options.defaults)
+                    object.modules = [];
+                if (message.modules && message.modules.length) {
+                    object.modules = [];
+                    for (var j = 0; j < message.modules.length; ++j)
+                        object.modules[j] = $root.PB.SplitflapConfig.ModuleConfig.toObject(message.modules[j], options);
+                }
+                return object;
+            };
     
-            SupervisorState.FaultInfo = (function() {
+            /**
+             * Converts this SplitflapConfig to JSON.
+             * @function toJSON
+             * @memberof PB.SplitflapConfig
+             * @instance
+             * @returns {Object.<string,*>} JSON object
+             */
+            SplitflapConfig.prototype.toJSON = function toJSON() {
+                return this.constructor.toObject(this, $protobuf.util.toJSONOptions);
+            };
+    
+            SplitflapConfig.ModuleConfig = (function() {
     
                 /**
-                 * Properties of a FaultInfo.
-                 * @memberof PB.SupervisorState
-                 * @interface IFaultInfo
-                 * @property {PB.SupervisorState.FaultInfo.FaultType|null} [type] FaultInfo type
-                 * @property {string|null} [msg] FaultInfo msg
-                 * @property {number|null} [tsMillis] FaultInfo tsMillis
+                 * Properties of a ModuleConfig.
+                 * @memberof PB.SplitflapConfig
+                 * @interface IModuleConfig
+                 * @property {number|null} [targetFlapIndex] ModuleConfig targetFlapIndex
+                 * @property {number|null} [movementNonce] Value that triggers a movement upon change. If unused, only changes to target_flap_index
+                 * will trigger a movement. This can be used to trigger a full revolution back to the *same*
+                 * flap index.
+                 * 
+                 * NOTE: Must be < 256
+                 * @property {number|null} [resetNonce] Value that triggers a reset (clear error counters, re-home) upon change. If unused,
+                 * module will only re-home upon recoverable errors, and error counters will continue
+                 * to increase until overflow.
+                 * 
+                 * NOTE: Must be < 256
                  */
     
                 /**
-                 * Constructs a new FaultInfo.
-                 * @memberof PB.SupervisorState
-                 * @classdesc Represents a FaultInfo.
-                 * @implements IFaultInfo
+                 * Constructs a new ModuleConfig.
+                 * @memberof PB.SplitflapConfig
+                 * @classdesc Represents a ModuleConfig.
+                 * @implements IModuleConfig
                  * @constructor
-                 * @param {PB.SupervisorState.IFaultInfo=} [properties] Properties to set
+                 * @param {PB.SplitflapConfig.IModuleConfig=} [properties] Properties to set
                  */
-                function FaultInfo(properties) {
+                function ModuleConfig(properties) {
                     if (properties)
                         for (var keys = Object.keys(properties), i = 0; i < keys.length; ++i)
                             if (properties[keys[i]] != null)
@@ -1545,101 +3583,109 @@
                 }
     
                 /**
-                 * FaultInfo type.
-                 * @member {PB.SupervisorState.FaultInfo.FaultType} type
-                 * @memberof PB.SupervisorState.FaultInfo
+                 * ModuleConfig targetFlapIndex.
+                 * @member {number} targetFlapIndex
+                 * @memberof PB.SplitflapConfig.ModuleConfig
                  * @instance
                  */
-                FaultInfo.prototype.type = 0;
+                ModuleConfig.prototype.targetFlapIndex = 0;
     
                 /**
-                 * FaultInfo msg.
-                 * @member {string} msg
-                 * @memberof PB.SupervisorState.FaultInfo
+                 * Value that triggers a movement upon change. If unused, only changes to target_flap_index
+                 * will trigger a movement. This can be used to trigger a full revolution back to the *same*
+                 * flap index.
+                 * 
+                 * NOTE: Must be < 256
+                 * @member {number} movementNonce
+                 * @memberof PB.SplitflapConfig.ModuleConfig
                  * @instance
                  */
-                FaultInfo.prototype.msg = "";
+                ModuleConfig.prototype.movementNonce = 0;
     
                 /**
-                 * FaultInfo tsMillis.
-                 * @member {number} tsMillis
-                 * @memberof PB.SupervisorState.FaultInfo
+                 * Value that triggers a reset (clear error counters, re-home) upon change. If unused,
+                 * module will only re-home upon recoverable errors, and error counters will continue
+                 * to increase until overflow.
+                 * 
+                 * NOTE: Must be < 256
+                 * @member {number} resetNonce
+                 * @memberof PB.SplitflapConfig.ModuleConfig
                  * @instance
                  */
-                FaultInfo.prototype.tsMillis = 0;
+                ModuleConfig.prototype.resetNonce = 0;
     
                 /**
-                 * Creates a new FaultInfo instance using the specified properties.
+                 * Creates a new ModuleConfig instance using the specified properties.
                  * @function create
-                 * @memberof PB.SupervisorState.FaultInfo
+                 * @memberof PB.SplitflapConfig.ModuleConfig
                  * @static
-                 * @param {PB.SupervisorState.IFaultInfo=} [properties] Properties to set
-                 * @returns {PB.SupervisorState.FaultInfo} FaultInfo instance
+                 * @param {PB.SplitflapConfig.IModuleConfig=} [properties] Properties to set
+                 * @returns {PB.SplitflapConfig.ModuleConfig} ModuleConfig instance
                  */
-                FaultInfo.create = function create(properties) {
-                    return new FaultInfo(properties);
+                ModuleConfig.create = function create(properties) {
+                    return new ModuleConfig(properties);
                 };
     
                 /**
-                 * Encodes the specified FaultInfo message. Does not implicitly {@link PB.SupervisorState.FaultInfo.verify|verify} messages.
+                 * Encodes the specified ModuleConfig message. Does not implicitly {@link PB.SplitflapConfig.ModuleConfig.verify|verify} messages.
                  * @function encode
-                 * @memberof PB.SupervisorState.FaultInfo
+                 * @memberof PB.SplitflapConfig.ModuleConfig
                  * @static
-                 * @param {PB.SupervisorState.IFaultInfo} message FaultInfo message or plain object to encode
+                 * @param {PB.SplitflapConfig.IModuleConfig} message ModuleConfig message or plain object to encode
                  * @param {$protobuf.Writer} [writer] Writer to encode to
                  * @returns {$protobuf.Writer} Writer
                  */
-                FaultInfo.encode = function encode(message, writer) {
+                ModuleConfig.encode = function encode(message, writer) {
                     if (!writer)
                         writer = $Writer.create();
-                    if (message.type != null && Object.hasOwnProperty.call(message, "type"))
-                        writer.uint32(/* id 1, wireType 0 =*/8).int32(message.type);
-                    if (message.msg != null && Object.hasOwnProperty.call(message, "msg"))
-                        writer.uint32(/* id 2, wireType 2 =*/18).string(message.msg);
-                    if (message.tsMillis != null && Object.hasOwnProperty.call(message, "tsMillis"))
-                        writer.uint32(/* id 3, wireType 0 =*/24).uint32(message.tsMillis);
+                    if (message.targetFlapIndex != null && Object.hasOwnProperty.call(message, "targetFlapIndex"))
+                        writer.uint32(/* id 1, wireType 0 =*/8).uint32(message.targetFlapIndex);
+                    if (message.movementNonce != null && Object.hasOwnProperty.call(message, "movementNonce"))
+                        writer.uint32(/* id 2, wireType 0 =*/16).uint32(message.movementNonce);
+                    if (message.resetNonce != null && Object.hasOwnProperty.call(message, "resetNonce"))
+                        writer.uint32(/* id 3, wireType 0 =*/24).uint32(message.resetNonce);
                     return writer;
                 };
     
                 /**
-                 * Encodes the specified FaultInfo message, length delimited. Does not implicitly {@link PB.SupervisorState.FaultInfo.verify|verify} messages.
+                 * Encodes the specified ModuleConfig message, length delimited. Does not implicitly {@link PB.SplitflapConfig.ModuleConfig.verify|verify} messages.
                  * @function encodeDelimited
-                 * @memberof PB.SupervisorState.FaultInfo
+                 * @memberof PB.SplitflapConfig.ModuleConfig
                  * @static
-                 * @param {PB.SupervisorState.IFaultInfo} message FaultInfo message or plain object to encode
+                 * @param {PB.SplitflapConfig.IModuleConfig} message ModuleConfig message or plain object to encode
                  * @param {$protobuf.Writer} [writer] Writer to encode to
                  * @returns {$protobuf.Writer} Writer
                  */
-                FaultInfo.encodeDelimited = function encodeDelimited(message, writer) {
+                ModuleConfig.encodeDelimited = function encodeDelimited(message, writer) {
                     return this.encode(message, writer).ldelim();
                 };
     
                 /**
-                 * Decodes a FaultInfo message from the specified reader or buffer.
+                 * Decodes a ModuleConfig message from the specified reader or buffer.
                  * @function decode
-                 * @memberof PB.SupervisorState.FaultInfo
+                 * @memberof PB.SplitflapConfig.ModuleConfig
                  * @static
                  * @param {$protobuf.Reader|Uint8Array} reader Reader or buffer to decode from
                  * @param {number} [length] Message length if known beforehand
-                 * @returns {PB.SupervisorState.FaultInfo} FaultInfo
+                 * @returns {PB.SplitflapConfig.ModuleConfig} ModuleConfig
                  * @throws {Error} If the payload is not a reader or valid buffer
                  * @throws {$protobuf.util.ProtocolError} If required fields are missing
                  */
-                FaultInfo.decode = function decode(reader, length) {
+                ModuleConfig.decode = function decode(reader, length) {
                     if (!(reader instanceof $Reader))
                         reader = $Reader.create(reader);
-                    var end = length === undefined ? reader.len : reader.pos + length, message = new $root.PB.SupervisorState.FaultInfo();
+                    var end = length === undefined ? reader.len : reader.pos + length, message = new $root.PB.SplitflapConfig.ModuleConfig();
                     while (reader.pos < end) {
                         var tag = reader.uint32();
                         switch (tag >>> 3) {
                         case 1:
-                            message.type = reader.int32();
+                            message.targetFlapIndex = reader.uint32();
                             break;
                         case 2:
-                            message.msg = reader.string();
+                            message.movementNonce = reader.uint32();
                             break;
                         case 3:
-                            message.tsMillis = reader.uint32();
+                            message.resetNonce = reader.uint32();
                             break;
                         default:
                             reader.skipType(tag & 7);
@@ -1650,192 +3696,126 @@
                 };
     
                 /**
-                 * Decodes a FaultInfo message from the specified reader or buffer, length delimited.
+                 * Decodes a ModuleConfig message from the specified reader or buffer, length delimited.
                  * @function decodeDelimited
-                 * @memberof PB.SupervisorState.FaultInfo
+                 * @memberof PB.SplitflapConfig.ModuleConfig
                  * @static
                  * @param {$protobuf.Reader|Uint8Array} reader Reader or buffer to decode from
-                 * @returns {PB.SupervisorState.FaultInfo} FaultInfo
+                 * @returns {PB.SplitflapConfig.ModuleConfig} ModuleConfig
                  * @throws {Error} If the payload is not a reader or valid buffer
                  * @throws {$protobuf.util.ProtocolError} If required fields are missing
                  */
-                FaultInfo.decodeDelimited = function decodeDelimited(reader) {
+                ModuleConfig.decodeDelimited = function decodeDelimited(reader) {
                     if (!(reader instanceof $Reader))
                         reader = new $Reader(reader);
                     return this.decode(reader, reader.uint32());
                 };
     
                 /**
-                 * Verifies a FaultInfo message.
+                 * Verifies a ModuleConfig message.
                  * @function verify
-                 * @memberof PB.SupervisorState.FaultInfo
+                 * @memberof PB.SplitflapConfig.ModuleConfig
                  * @static
                  * @param {Object.<string,*>} message Plain object to verify
                  * @returns {string|null} `null` if valid, otherwise the reason why it is not
                  */
-                FaultInfo.verify = function verify(message) {
+                ModuleConfig.verify = function verify(message) {
                     if (typeof message !== "object" || message === null)
                         return "object expected";
-                    if (message.type != null && message.hasOwnProperty("type"))
-                        switch (message.type) {
-                        default:
-                            return "type: enum value expected";
-                        case 0:
-                        case 1:
-                        case 2:
-                        case 3:
-                        case 4:
-                        case 5:
-                        case 6:
-                            break;
-                        }
-                    if (message.msg != null && message.hasOwnProperty("msg"))
-                        if (!$util.isString(message.msg))
-                            return "msg: string expected";
-                    if (message.tsMillis != null && message.hasOwnProperty("tsMillis"))
-                        if (!$util.isInteger(message.tsMillis))
-                            return "tsMillis: integer expected";
+                    if (message.targetFlapIndex != null && message.hasOwnProperty("targetFlapIndex"))
+                        if (!$util.isInteger(message.targetFlapIndex))
+                            return "targetFlapIndex: integer expected";
+                    if (message.movementNonce != null && message.hasOwnProperty("movementNonce"))
+                        if (!$util.isInteger(message.movementNonce))
+                            return "movementNonce: integer expected";
+                    if (message.resetNonce != null && message.hasOwnProperty("resetNonce"))
+                        if (!$util.isInteger(message.resetNonce))
+                            return "resetNonce: integer expected";
                     return null;
                 };
     
                 /**
-                 * Creates a FaultInfo message from a plain object. Also converts values to their respective internal types.
+                 * Creates a ModuleConfig message from a plain object. Also converts values to their respective internal types.
                  * @function fromObject
-                 * @memberof PB.SupervisorState.FaultInfo
+                 * @memberof PB.SplitflapConfig.ModuleConfig
                  * @static
                  * @param {Object.<string,*>} object Plain object
-                 * @returns {PB.SupervisorState.FaultInfo} FaultInfo
+                 * @returns {PB.SplitflapConfig.ModuleConfig} ModuleConfig
                  */
-                FaultInfo.fromObject = function fromObject(object) {
-                    if (object instanceof $root.PB.SupervisorState.FaultInfo)
+                ModuleConfig.fromObject = function fromObject(object) {
+                    if (object instanceof $root.PB.SplitflapConfig.ModuleConfig)
                         return object;
-                    var message = new $root.PB.SupervisorState.FaultInfo();
-                    switch (object.type) {
-                    case "UNKNOWN":
-                    case 0:
-                        message.type = 0;
-                        break;
-                    case "NONE":
-                    case 1:
-                        message.type = 1;
-                        break;
-                    case "INRUSH_CURRENT_NOT_SETTLED":
-                    case 2:
-                        message.type = 2;
-                        break;
-                    case "SPLITFLAP_SHUTDOWN":
-                    case 3:
-                        message.type = 3;
-                        break;
-                    case "OUT_OF_RANGE":
-                    case 4:
-                        message.type = 4;
-                        break;
-                    case "OVER_CURRENT":
-                    case 5:
-                        message.type = 5;
-                        break;
-                    case "UNEXPECTED_POWER":
-                    case 6:
-                        message.type = 6;
-                        break;
-                    }
-                    if (object.msg != null)
-                        message.msg = String(object.msg);
-                    if (object.tsMillis != null)
-                        message.tsMillis = object.tsMillis >>> 0;
+                    var message = new $root.PB.SplitflapConfig.ModuleConfig();
+                    if (object.targetFlapIndex != null)
+                        message.targetFlapIndex = object.targetFlapIndex >>> 0;
+                    if (object.movementNonce != null)
+                        message.movementNonce = object.movementNonce >>> 0;
+                    if (object.resetNonce != null)
+                        message.resetNonce = object.resetNonce >>> 0;
                     return message;
                 };
     
                 /**
-                 * Creates a plain object from a FaultInfo message. Also converts values to other types if specified.
+                 * Creates a plain object from a ModuleConfig message. Also converts values to other types if specified.
                  * @function toObject
-                 * @memberof PB.SupervisorState.FaultInfo
+                 * @memberof PB.SplitflapConfig.ModuleConfig
                  * @static
-                 * @param {PB.SupervisorState.FaultInfo} message FaultInfo
+                 * @param {PB.SplitflapConfig.ModuleConfig} message ModuleConfig
                  * @param {$protobuf.IConversionOptions} [options] Conversion options
                  * @returns {Object.<string,*>} Plain object
                  */
-                FaultInfo.toObject = function toObject(message, options) {
+                ModuleConfig.toObject = function toObject(message, options) {
                     if (!options)
                         options = {};
                     var object = {};
                     if (options.defaults) {
-                        object.type = options.enums === String ? "UNKNOWN" : 0;
-                        object.msg = "";
-                        object.tsMillis = 0;
+                        object.targetFlapIndex = 0;
+                        object.movementNonce = 0;
+                        object.resetNonce = 0;
                     }
-                    if (message.type != null && message.hasOwnProperty("type"))
-                        object.type = options.enums === String ? $root.PB.SupervisorState.FaultInfo.FaultType[message.type] : message.type;
-                    if (message.msg != null && message.hasOwnProperty("msg"))
-                        object.msg = message.msg;
-                    if (message.tsMillis != null && message.hasOwnProperty("tsMillis"))
-                        object.tsMillis = message.tsMillis;
+                    if (message.targetFlapIndex != null && message.hasOwnProperty("targetFlapIndex"))
+                        object.targetFlapIndex = message.targetFlapIndex;
+                    if (message.movementNonce != null && message.hasOwnProperty("movementNonce"))
+                        object.movementNonce = message.movementNonce;
+                    if (message.resetNonce != null && message.hasOwnProperty("resetNonce"))
+                        object.resetNonce = message.resetNonce;
                     return object;
                 };
     
                 /**
-                 * Converts this FaultInfo to JSON.
+                 * Converts this ModuleConfig to JSON.
                  * @function toJSON
-                 * @memberof PB.SupervisorState.FaultInfo
+                 * @memberof PB.SplitflapConfig.ModuleConfig
                  * @instance
                  * @returns {Object.<string,*>} JSON object
                  */
-                FaultInfo.prototype.toJSON = function toJSON() {
+                ModuleConfig.prototype.toJSON = function toJSON() {
                     return this.constructor.toObject(this, $protobuf.util.toJSONOptions);
                 };
     
-                /**
-                 * FaultType enum.
-                 * @name PB.SupervisorState.FaultInfo.FaultType
-                 * @enum {number}
-                 * @property {number} UNKNOWN=0 UNKNOWN value
-                 * @property {number} NONE=1 NONE value
-                 * @property {number} INRUSH_CURRENT_NOT_SETTLED=2 INRUSH_CURRENT_NOT_SETTLED value
-                 * @property {number} SPLITFLAP_SHUTDOWN=3 SPLITFLAP_SHUTDOWN value
-                 * @property {number} OUT_OF_RANGE=4 OUT_OF_RANGE value
-                 * @property {number} OVER_CURRENT=5 OVER_CURRENT value
-                 * @property {number} UNEXPECTED_POWER=6 UNEXPECTED_POWER value
-                 */
-                FaultInfo.FaultType = (function() {
-                    var valuesById = {}, values = Object.create(valuesById);
-                    values[valuesById[0] = "UNKNOWN"] = 0;
-                    values[valuesById[1] = "NONE"] = 1;
-                    values[valuesById[2] = "INRUSH_CURRENT_NOT_SETTLED"] = 2;
-                    values[valuesById[3] = "SPLITFLAP_SHUTDOWN"] = 3;
-                    values[valuesById[4] = "OUT_OF_RANGE"] = 4;
-                    values[valuesById[5] = "OVER_CURRENT"] = 5;
-                    values[valuesById[6] = "UNEXPECTED_POWER"] = 6;
-                    return values;
-                })();
-    
-                return FaultInfo;
+                return ModuleConfig;
             })();
     
-            return SupervisorState;
+            return SplitflapConfig;
         })();
     
-        PB.FromSplitflap = (function() {
+        PB.RequestState = (function() {
     
             /**
-             * Properties of a FromSplitflap.
+             * Properties of a RequestState.
              * @memberof PB
-             * @interface IFromSplitflap
-             * @property {PB.ISplitflapState|null} [splitflapState] FromSplitflap splitflapState
-             * @property {PB.ILog|null} [log] FromSplitflap log
-             * @property {PB.IAck|null} [ack] FromSplitflap ack
-             * @property {PB.ISupervisorState|null} [supervisorState] FromSplitflap supervisorState
+             * @interface IRequestState
              */
     
             /**
-             * Constructs a new FromSplitflap.
+             * Constructs a new RequestState.
              * @memberof PB
-             * @classdesc Represents a FromSplitflap.
-             * @implements IFromSplitflap
+             * @classdesc Represents a RequestState.
+             * @implements IRequestState
              * @constructor
-             * @param {PB.IFromSplitflap=} [properties] Properties to set
+             * @param {PB.IRequestState=} [properties] Properties to set
              */
-            function FromSplitflap(properties) {
+            function RequestState(properties) {
                 if (properties)
                     for (var keys = Object.keys(properties), i = 0; i < keys.length; ++i)
                         if (properties[keys[i]] != null)
@@ -1843,129 +3823,63 @@
             }
     
             /**
-             * FromSplitflap splitflapState.
-             * @member {PB.ISplitflapState|null|undefined} splitflapState
-             * @memberof PB.FromSplitflap
-             * @instance
-             */
-            FromSplitflap.prototype.splitflapState = null;
-    
-            /**
-             * FromSplitflap log.
-             * @member {PB.ILog|null|undefined} log
-             * @memberof PB.FromSplitflap
-             * @instance
-             */
-            FromSplitflap.prototype.log = null;
-    
-            /**
-             * FromSplitflap ack.
-             * @member {PB.IAck|null|undefined} ack
-             * @memberof PB.FromSplitflap
-             * @instance
-             */
-            FromSplitflap.prototype.ack = null;
-    
-            /**
-             * FromSplitflap supervisorState.
-             * @member {PB.ISupervisorState|null|undefined} supervisorState
-             * @memberof PB.FromSplitflap
-             * @instance
-             */
-            FromSplitflap.prototype.supervisorState = null;
-    
-            // OneOf field names bound to virtual getters and setters
-            var $oneOfFields;
-    
-            /**
-             * FromSplitflap payload.
-             * @member {"splitflapState"|"log"|"ack"|"supervisorState"|undefined} payload
-             * @memberof PB.FromSplitflap
-             * @instance
-             */
-            Object.defineProperty(FromSplitflap.prototype, "payload", {
-                get: $util.oneOfGetter($oneOfFields = ["splitflapState", "log", "ack", "supervisorState"]),
-                set: $util.oneOfSetter($oneOfFields)
-            });
-    
-            /**
-             * Creates a new FromSplitflap instance using the specified properties.
+             * Creates a new RequestState instance using the specified properties.
              * @function create
-             * @memberof PB.FromSplitflap
+             * @memberof PB.RequestState
              * @static
-             * @param {PB.IFromSplitflap=} [properties] Properties to set
-             * @returns {PB.FromSplitflap} FromSplitflap instance
+             * @param {PB.IRequestState=} [properties] Properties to set
+             * @returns {PB.RequestState} RequestState instance
              */
-            FromSplitflap.create = function create(properties) {
-                return new FromSplitflap(properties);
+            RequestState.create = function create(properties) {
+                return new RequestState(properties);
             };
     
             /**
-             * Encodes the specified FromSplitflap message. Does not implicitly {@link PB.FromSplitflap.verify|verify} messages.
+             * Encodes the specified RequestState message. Does not implicitly {@link PB.RequestState.verify|verify} messages.
              * @function encode
-             * @memberof PB.FromSplitflap
+             * @memberof PB.RequestState
              * @static
-             * @param {PB.IFromSplitflap} message FromSplitflap message or plain object to encode
+             * @param {PB.IRequestState} message RequestState message or plain object to encode
              * @param {$protobuf.Writer} [writer] Writer to encode to
              * @returns {$protobuf.Writer} Writer
              */
-            FromSplitflap.encode = function encode(message, writer) {
+            RequestState.encode = function encode(message, writer) {
                 if (!writer)
                     writer = $Writer.create();
-                if (message.splitflapState != null && Object.hasOwnProperty.call(message, "splitflapState"))
-                    $root.PB.SplitflapState.encode(message.splitflapState, writer.uint32(/* id 1, wireType 2 =*/10).fork()).ldelim();
-                if (message.log != null && Object.hasOwnProperty.call(message, "log"))
-                    $root.PB.Log.encode(message.log, writer.uint32(/* id 2, wireType 2 =*/18).fork()).ldelim();
-                if (message.ack != null && Object.hasOwnProperty.call(message, "ack"))
-                    $root.PB.Ack.encode(message.ack, writer.uint32(/* id 3, wireType 2 =*/26).fork()).ldelim();
-                if (message.supervisorState != null && Object.hasOwnProperty.call(message, "supervisorState"))
-                    $root.PB.SupervisorState.encode(message.supervisorState, writer.uint32(/* id 4, wireType 2 =*/34).fork()).ldelim();
                 return writer;
             };
     
             /**
-             * Encodes the specified FromSplitflap message, length delimited. Does not implicitly {@link PB.FromSplitflap.verify|verify} messages.
+             * Encodes the specified RequestState message, length delimited. Does not implicitly {@link PB.RequestState.verify|verify} messages.
              * @function encodeDelimited
-             * @memberof PB.FromSplitflap
+             * @memberof PB.RequestState
              * @static
-             * @param {PB.IFromSplitflap} message FromSplitflap message or plain object to encode
+             * @param {PB.IRequestState} message RequestState message or plain object to encode
              * @param {$protobuf.Writer} [writer] Writer to encode to
              * @returns {$protobuf.Writer} Writer
              */
-            FromSplitflap.encodeDelimited = function encodeDelimited(message, writer) {
+            RequestState.encodeDelimited = function encodeDelimited(message, writer) {
                 return this.encode(message, writer).ldelim();
             };
     
             /**
-             * Decodes a FromSplitflap message from the specified reader or buffer.
+             * Decodes a RequestState message from the specified reader or buffer.
              * @function decode
-             * @memberof PB.FromSplitflap
+             * @memberof PB.RequestState
              * @static
              * @param {$protobuf.Reader|Uint8Array} reader Reader or buffer to decode from
              * @param {number} [length] Message length if known beforehand
-             * @returns {PB.FromSplitflap} FromSplitflap
+             * @returns {PB.RequestState} RequestState
              * @throws {Error} If the payload is not a reader or valid buffer
              * @throws {$protobuf.util.ProtocolError} If required fields are missing
              */
-            FromSplitflap.decode = function decode(reader, length) {
+            RequestState.decode = function decode(reader, length) {
                 if (!(reader instanceof $Reader))
                     reader = $Reader.create(reader);
-                var end = length === undefined ? reader.len : reader.pos + length, message = new $root.PB.FromSplitflap();
+                var end = length === undefined ? reader.len : reader.pos + length, message = new $root.PB.RequestState();
                 while (reader.pos < end) {
                     var tag = reader.uint32();
                     switch (tag >>> 3) {
-                    case 1:
-                        message.splitflapState = $root.PB.SplitflapState.decode(reader, reader.uint32());
-                        break;
-                    case 2:
-                        message.log = $root.PB.Log.decode(reader, reader.uint32());
-                        break;
-                    case 3:
-                        message.ack = $root.PB.Ack.decode(reader, reader.uint32());
-                        break;
-                    case 4:
-                        message.supervisorState = $root.PB.SupervisorState.decode(reader, reader.uint32());
-                        break;
                     default:
                         reader.skipType(tag & 7);
                         break;
@@ -1975,178 +3889,103 @@
             };
     
             /**
-             * Decodes a FromSplitflap message from the specified reader or buffer, length delimited.
+             * Decodes a RequestState message from the specified reader or buffer, length delimited.
              * @function decodeDelimited
-             * @memberof PB.FromSplitflap
+             * @memberof PB.RequestState
              * @static
              * @param {$protobuf.Reader|Uint8Array} reader Reader or buffer to decode from
-             * @returns {PB.FromSplitflap} FromSplitflap
+             * @returns {PB.RequestState} RequestState
              * @throws {Error} If the payload is not a reader or valid buffer
              * @throws {$protobuf.util.ProtocolError} If required fields are missing
              */
-            FromSplitflap.decodeDelimited = function decodeDelimited(reader) {
+            RequestState.decodeDelimited = function decodeDelimited(reader) {
                 if (!(reader instanceof $Reader))
                     reader = new $Reader(reader);
                 return this.decode(reader, reader.uint32());
             };
     
             /**
-             * Verifies a FromSplitflap message.
+             * Verifies a RequestState message.
              * @function verify
-             * @memberof PB.FromSplitflap
+             * @memberof PB.RequestState
              * @static
              * @param {Object.<string,*>} message Plain object to verify
              * @returns {string|null} `null` if valid, otherwise the reason why it is not
              */
-            FromSplitflap.verify = function verify(message) {
+            RequestState.verify = function verify(message) {
                 if (typeof message !== "object" || message === null)
                     return "object expected";
-                var properties = {};
-                if (message.splitflapState != null && message.hasOwnProperty("splitflapState")) {
-                    properties.payload = 1;
-                    {
-                        var error = $root.PB.SplitflapState.verify(message.splitflapState);
-                        if (error)
-                            return "splitflapState." + error;
-                    }
-                }
-                if (message.log != null && message.hasOwnProperty("log")) {
-                    if (properties.payload === 1)
-                        return "payload: multiple values";
-                    properties.payload = 1;
-                    {
-                        var error = $root.PB.Log.verify(message.log);
-                        if (error)
-                            return "log." + error;
-                    }
-                }
-                if (message.ack != null && message.hasOwnProperty("ack")) {
-                    if (properties.payload === 1)
-                        return "payload: multiple values";
-                    properties.payload = 1;
-                    {
-                        var error = $root.PB.Ack.verify(message.ack);
-                        if (error)
-                            return "ack." + error;
-                    }
-                }
-                if (message.supervisorState != null && message.hasOwnProperty("supervisorState")) {
-                    if (properties.payload === 1)
-                        return "payload: multiple values";
-                    properties.payload = 1;
-                    {
-                        var error = $root.PB.SupervisorState.verify(message.supervisorState);
-                        if (error)
-                            return "supervisorState." + error;
-                    }
-                }
                 return null;
             };
     
             /**
-             * Creates a FromSplitflap message from a plain object. Also converts values to their respective internal types.
+             * Creates a RequestState message from a plain object. Also converts values to their respective internal types.
              * @function fromObject
-             * @memberof PB.FromSplitflap
+             * @memberof PB.RequestState
              * @static
              * @param {Object.<string,*>} object Plain object
-             * @returns {PB.FromSplitflap} FromSplitflap
+             * @returns {PB.RequestState} RequestState
              */
-            FromSplitflap.fromObject = function fromObject(object) {
-                if (object instanceof $root.PB.FromSplitflap)
+            RequestState.fromObject = function fromObject(object) {
+                if (object instanceof $root.PB.RequestState)
                     return object;
-                var message = new $root.PB.FromSplitflap();
-                if (object.splitflapState != null) {
-                    if (typeof object.splitflapState !== "object")
-                        throw TypeError(".PB.FromSplitflap.splitflapState: object expected");
-                    message.splitflapState = $root.PB.SplitflapState.fromObject(object.splitflapState);
-                }
-                if (object.log != null) {
-                    if (typeof object.log !== "object")
-                        throw TypeError(".PB.FromSplitflap.log: object expected");
-                    message.log = $root.PB.Log.fromObject(object.log);
-                }
-                if (object.ack != null) {
-                    if (typeof object.ack !== "object")
-                        throw TypeError(".PB.FromSplitflap.ack: object expected");
-                    message.ack = $root.PB.Ack.fromObject(object.ack);
-                }
-                if (object.supervisorState != null) {
-                    if (typeof object.supervisorState !== "object")
-                        throw TypeError(".PB.FromSplitflap.supervisorState: object expected");
-                    message.supervisorState = $root.PB.SupervisorState.fromObject(object.supervisorState);
-                }
-                return message;
+                return new $root.PB.RequestState();
             };
     
             /**
-             * Creates a plain object from a FromSplitflap message. Also converts values to other types if specified.
+             * Creates a plain object from a RequestState message. Also converts values to other types if specified.
              * @function toObject
-             * @memberof PB.FromSplitflap
+             * @memberof PB.RequestState
              * @static
-             * @param {PB.FromSplitflap} message FromSplitflap
+             * @param {PB.RequestState} message RequestState
              * @param {$protobuf.IConversionOptions} [options] Conversion options
              * @returns {Object.<string,*>} Plain object
              */
-            FromSplitflap.toObject = function toObject(message, options) {
-                if (!options)
-                    options = {};
-                var object = {};
-                if (message.splitflapState != null && message.hasOwnProperty("splitflapState")) {
-                    object.splitflapState = $root.PB.SplitflapState.toObject(message.splitflapState, options);
-                    if (options.oneofs)
-                        object.payload = "splitflapState";
-                }
-                if (message.log != null && message.hasOwnProperty("log")) {
-                    object.log = $root.PB.Log.toObject(message.log, options);
-                    if (options.oneofs)
-                        object.payload = "log";
-                }
-                if (message.ack != null && message.hasOwnProperty("ack")) {
-                    object.ack = $root.PB.Ack.toObject(message.ack, options);
-                    if (options.oneofs)
-                        object.payload = "ack";
-                }
-                if (message.supervisorState != null && message.hasOwnProperty("supervisorState")) {
-                    object.supervisorState = $root.PB.SupervisorState.toObject(message.supervisorState, options);
-                    if (options.oneofs)
-                        object.payload = "supervisorState";
-                }
-                return object;
+            RequestState.toObject = function toObject() {
+                return {};
             };
     
             /**
-             * Converts this FromSplitflap to JSON.
+             * Converts this RequestState to JSON.
              * @function toJSON
-             * @memberof PB.FromSplitflap
+             * @memberof PB.RequestState
              * @instance
              * @returns {Object.<string,*>} JSON object
              */
-            FromSplitflap.prototype.toJSON = function toJSON() {
+            RequestState.prototype.toJSON = function toJSON() {
                 return this.constructor.toObject(this, $protobuf.util.toJSONOptions);
             };
     
-            return FromSplitflap;
+            return RequestState;
         })();
     
-        PB.SplitflapCommand = (function() {
+        PB.Subscribe = (function() {
     
             /**
-             * Properties of a SplitflapCommand.
+             * Properties of a Subscribe.
              * @memberof PB
-             * @interface ISplitflapCommand
-             * @property {Array.<PB.SplitflapCommand.IModuleCommand>|null} [modules] SplitflapCommand modules
+             * @interface ISubscribe
+             * @property {number|null} [minIntervalMillis] Minimum time between state messages triggered by state changes. Default 250ms.
+             * @property {number|null} [heartbeatIntervalMillis] Max time between state messages, even without any changes. Default 5000ms.
+             * @property {number|null} [moduleStart] Range of modules to report: module_count modules starting at module_start (reported back in
+             * SplitflapState.module_start). A module_count of 0 means all modules from module_start onward.
+             * @property {number|null} [moduleCount] Subscribe moduleCount
+             * @property {number|null} [fieldMask] SplitflapState.ModuleState fields to report, as a bitmask where field number N is bit (N - 1). Fields
+             * that aren't included are left at their default value, so they aren't encoded at all, and changes to
+             * them don't trigger state messages. Default (0) is all fields.
              */
     
             /**
-             * Constructs a new SplitflapCommand.
+             * Constructs a new Subscribe.
              * @memberof PB
-             * @classdesc Represents a SplitflapCommand.
-             * @implements ISplitflapCommand
+             * @classdesc Configures the SplitflapState messages pushed to the client, so bandwidth scales with what it actually
+             * uses. Each Subscribe replaces the previous configuration; zero values select the defaults. A WindowConfig
+             * (which starts every client session) also restores the defaults.
+             * @implements ISubscribe
              * @constructor
-             * @param {PB.ISplitflapCommand=} [properties] Properties to set
+             * @param {PB.ISubscribe=} [properties] Properties to set
              */
-            function SplitflapCommand(properties) {
-                this.modules = [];
+            function Subscribe(properties) {
                 if (properties)
                     for (var keys = Object.keys(properties), i = 0; i < keys.length; ++i)
                         if (properties[keys[i]] != null)
@@ -2154,78 +3993,130 @@
             }
     
             /**
-             * SplitflapCommand modules.
-             * @member {Array.<PB.SplitflapCommand.IModuleCommand>} modules
-             * @memberof PB.SplitflapCommand
+             * Minimum time between state messages triggered by state changes. Default 250ms.
+             * @member {number} minIntervalMillis
+             * @memberof PB.Subscribe
              * @instance
              */
-            SplitflapCommand.prototype.modules = $util.emptyArray;
+            Subscribe.prototype.minIntervalMillis = 0;
     
             /**
-             * Creates a new SplitflapCommand instance using the specified properties.
+             * Max time between state messages, even without any changes. Default 5000ms.
+             * @member {number} heartbeatIntervalMillis
+             * @memberof PB.Subscribe
+             * @instance
+             */
+            Subscribe.prototype.heartbeatIntervalMillis = 0;
+    
+            /**
+             * Range of modules to report: module_count modules starting at module_start (reported back in
+             * SplitflapState.module_start). A module_count of 0 means all modules from module_start onward.
+             * @member {number} moduleStart
+             * @memberof PB.Subscribe
+             * @instance
+             */
+            Subscribe.prototype.moduleStart = 0;
+    
+            /**
+             * Subscribe moduleCount.
+             * @member {number} moduleCount
+             * @memberof PB.Subscribe
+             * @instance
+             */
+            Subscribe.prototype.moduleCount = 0;
+    
+            /**
+             * SplitflapState.ModuleState fields to report, as a bitmask where field number N is bit (N - 1). Fields
+             * that aren't included are left at their default value, so they aren't encoded at all, and changes to
+             * them don't trigger state messages. Default (0) is all fields.
+             * @member {number} fieldMask
+             * @memberof PB.Subscribe
+             * @instance
+             */
+            Subscribe.prototype.fieldMask = 0;
+    
+            /**
+             * Creates a new Subscribe instance using the specified properties.
              * @function create
-             * @memberof PB.SplitflapCommand
+             * @memberof PB.Subscribe
              * @static
-             * @param {PB.ISplitflapCommand=} [properties] Properties to set
-             * @returns {PB.SplitflapCommand} SplitflapCommand instance
+             * @param {PB.ISubscribe=} [properties] Properties to set
+             * @returns {PB.Subscribe} Subscribe instance
              */
-            SplitflapCommand.create = function create(properties) {
-                return new SplitflapCommand(properties);
+            Subscribe.create = function create(properties) {
+                return new Subscribe(properties);
             };
     
             /**
-             * Encodes the specified SplitflapCommand message. Does not implicitly {@link PB.SplitflapCommand.verify|verify} messages.
+             * Encodes the specified Subscribe message. Does not implicitly {@link PB.Subscribe.verify|verify} messages.
              * @function encode
-             * @memberof PB.SplitflapCommand
+             * @memberof PB.Subscribe
              * @static
-             * @param {PB.ISplitflapCommand} message SplitflapCommand message or plain object to encode
+             * @param {PB.ISubscribe} message Subscribe message or plain object to encode
              * @param {$protobuf.Writer} [writer] Writer to encode to
              * @returns {$protobuf.Writer} Writer
              */
-            SplitflapCommand.encode = function encode(message, writer) {
+            Subscribe.encode = function encode(message, writer) {
                 if (!writer)
                     writer = $Writer.create();
-                if (message.modules != null && message.modules.length)
-                    for (var i = 0; i < message.modules.length; ++i)
-                        $root.PB.SplitflapCommand.ModuleCommand.encode(message.modules[i], writer.uint32(/* id 2, wireType 2 =*/18).fork()).ldelim();
+                if (message.minIntervalMillis != null && Object.hasOwnProperty.call(message, "minIntervalMillis"))
+                    writer.uint32(/* id 1, wireType 0 =*/8).uint32(message.minIntervalMillis);
+                if (message.heartbeatIntervalMillis != null && Object.hasOwnProperty.call(message, "heartbeatIntervalMillis"))
+                    writer.uint32(/* id 2, wireType 0 =*/16).uint32(message.heartbeatIntervalMillis);
+                if (message.moduleStart != null && Object.hasOwnProperty.call(message, "moduleStart"))
+                    writer.uint32(/* id 3, wireType 0 =*/24).uint32(message.moduleStart);
+                if (message.moduleCount != null && Object.hasOwnProperty.call(message, "moduleCount"))
+                    writer.uint32(/* id 4, wireType 0 =*/32).uint32(message.moduleCount);
+                if (message.fieldMask != null && Object.hasOwnProperty.call(message, "fieldMask"))
+                    writer.uint32(/* id 5, wireType 0 =*/40).uint32(message.fieldMask);
                 return writer;
             };
     
             /**
-             * Encodes the specified SplitflapCommand message, length delimited. Does not implicitly {@link PB.SplitflapCommand.verify|verify} messages.
+             * Encodes the specified Subscribe message, length delimited. Does not implicitly {@link PB.Subscribe.verify|verify} messages.
              * @function encodeDelimited
-             * @memberof PB.SplitflapCommand
+             * @memberof PB.Subscribe
              * @static
-             * @param {PB.ISplitflapCommand} message SplitflapCommand message or plain object to encode
+             * @param {PB.ISubscribe} message Subscribe message or plain object to encode
              * @param {$protobuf.Writer} [writer] Writer to encode to
              * @returns {$protobuf.Writer} Writer
              */
-            SplitflapCommand.encodeDelimited = function encodeDelimited(message, writer) {
+            Subscribe.encodeDelimited = function encodeDelimited(message, writer) {
                 return this.encode(message, writer).ldelim();
             };
     
             /**
-             * Decodes a SplitflapCommand message from the specified reader or buffer.
+             * Decodes a Subscribe message from the specified reader or buffer.
              * @function decode
-             * @memberof PB.SplitflapCommand
+             * @memberof PB.Subscribe
              * @static
              * @param {$protobuf.Reader|Uint8Array} reader Reader or buffer to decode from
              * @param {number} [length] Message length if known beforehand
-             * @returns {PB.SplitflapCommand} SplitflapCommand
+             * @returns {PB.Subscribe} Subscribe
              * @throws {Error} If the payload is not a reader or valid buffer
              * @throws {$protobuf.util.ProtocolError} If required fields are missing
              */
-            SplitflapCommand.decode = function decode(reader, length) {
+            Subscribe.decode = function decode(reader, length) {
                 if (!(reader instanceof $Reader))
                     reader = $Reader.create(reader);
-                var end = length === undefined ? reader.len : reader.pos + length, message = new $root.PB.SplitflapCommand();
+                var end = length === undefined ? reader.len : reader.pos + length, message = new $root.PB.Subscribe();
                 while (reader.pos < end) {
                     var tag = reader.uint32();
                     switch (tag >>> 3) {
+                    case 1:
+                        message.minIntervalMillis = reader.uint32();
+                        break;
                     case 2:
-                        if (!(message.modules && message.modules.length))
-                            message.modules = [];
-                        message.modules.push($root.PB.SplitflapCommand.ModuleCommand.decode(reader, reader.uint32()));
+                        message.heartbeatIntervalMillis = reader.uint32();
+                        break;
+                    case 3:
+                        message.moduleStart = reader.uint32();
+                        break;
+                    case 4:
+                        message.moduleCount = reader.uint32();
+                        break;
+                    case 5:
+                        message.fieldMask = reader.uint32();
                         break;
                     default:
                         reader.skipType(tag & 7);
@@ -2236,369 +4127,343 @@
             };
     
             /**
-             * Decodes a SplitflapCommand message from the specified reader or buffer, length delimited.
+             * Decodes a Subscribe message from the specified reader or buffer, length delimited.
              * @function decodeDelimited
-             * @memberof PB.SplitflapCommand
+             * @memberof PB.Subscribe
              * @static
              * @param {$protobuf.Reader|Uint8Array} reader Reader or buffer to decode from
-             * @returns {PB.SplitflapCommand} SplitflapCommand
+             * @returns {PB.Subscribe} Subscribe
              * @throws {Error} If the payload is not a reader or valid buffer
              * @throws {$protobuf.util.ProtocolError} If required fields are missing
              */
-            SplitflapCommand.decodeDelimited = function decodeDelimited(reader) {
+            Subscribe.decodeDelimited = function decodeDelimited(reader) {
                 if (!(reader instanceof $Reader))
                     reader = new $Reader(reader);
                 return this.decode(reader, reader.uint32());
             };
     
             /**
-             * Verifies a SplitflapCommand message.
+             * Verifies a Subscribe message.
              * @function verify
-             * @memberof PB.SplitflapCommand
+             * @memberof PB.Subscribe
              * @static
              * @param {Object.<string,*>} message Plain object to verify
              * @returns {string|null} `null` if valid, otherwise the reason why it is not
              */
-            SplitflapCommand.verify = function verify(message) {
+            Subscribe.verify = function verify(message) {
                 if (typeof message !== "object" || message === null)
                     return "object expected";
-                if (message.modules != null && message.hasOwnProperty("modules")) {
-                    if (!Array.isArray(message.modules))
-                        return "modules: array expected";
-                    for (var i = 0; i < message.modules.length; ++i) {
-                        var error = $root.PB.SplitflapCommand.ModuleCommand.verify(message.modules[i]);
-                        if (error)
-                            return "modules." + error;
-                    }
-                }
+                if (message.minIntervalMillis != null && message.hasOwnProperty("minIntervalMillis"))
+                    if (!$util.isInteger(message.minIntervalMillis))
+                        return "minIntervalMillis: integer expected";
+                if (message.heartbeatIntervalMillis != null && message.hasOwnProperty("heartbeatIntervalMillis"))
+                    if (!$util.isInteger(message.heartbeatIntervalMillis))
+                        return "heartbeatIntervalMillis: integer expected";
+                if (message.moduleStart != null && message.hasOwnProperty("moduleStart"))
+                    if (!$util.isInteger(message.moduleStart))
+                        return "moduleStart: integer expected";
+                if (message.moduleCount != null && message.hasOwnProperty("moduleCount"))
+                    if (!$util.isInteger(message.moduleCount))
+                        return "moduleCount: integer expected";
+                if (message.fieldMask != null && message.hasOwnProperty("fieldMask"))
+                    if (!$util.isInteger(message.fieldMask))
+                        return "fieldMask: integer expected";
                 return null;
             };
     
             /**
-             * Creates a SplitflapCommand message from a plain object. Also converts values to their respective internal types.
+             * Creates a Subscribe message from a plain object. Also converts values to their respective internal types.
              * @function fromObject
-             * @memberof PB.SplitflapCommand
+             * @memberof PB.Subscribe
              * @static
              * @param {Object.<string,*>} object Plain object
-             * @returns {PB.SplitflapCommand} SplitflapCommand
+             * @returns {PB.Subscribe} Subscribe
              */
-            SplitflapCommand.fromObject = function fromObject(object) {
-                if (object instanceof $root.PB.SplitflapCommand)
+            Subscribe.fromObject = function fromObject(object) {
+                if (object instanceof $root.PB.Subscribe)
                     return object;
-                var message = new $root.PB.SplitflapCommand();
-                if (object.modules) {
-                    if (!Array.isArray(object.modules))
-                        throw TypeError(".PB.SplitflapCommand.modules: array expected");
-                    message.modules = [];
-                    for (var i = 0; i < object.modules.length; ++i) {
-                        if (typeof object.modules[i] !== "object")
-                            throw TypeError(".PB.SplitflapCommand.modules: object expected");
-                        message.modules[i] = $root.PB.SplitflapCommand.ModuleCommand.fromObject(object.modules[i]);
-                    }
-                }
+                var message = new $root.PB.Subscribe();
+                if (object.minIntervalMillis != null)
+                    message.minIntervalMillis = object.minIntervalMillis >>> 0;
+                if (object.heartbeatIntervalMillis != null)
+                    message.heartbeatIntervalMillis = object.heartbeatIntervalMillis >>> 0;
+                if (object.moduleStart != null)
+                    message.moduleStart = object.moduleStart >>> 0;
+                if (object.moduleCount != null)
+                    message.moduleCount = object.moduleCount >>> 0;
+                if (object.fieldMask != null)
+                    message.fieldMask = object.fieldMask >>> 0;
                 return message;
             };
     
             /**
-             * Creates a plain object from a SplitflapCommand message. Also converts values to other types if specified.
+             * Creates a plain object from a Subscribe message. Also converts values to other types if specified.
              * @function toObject
-             * @memberof PB.SplitflapCommand
+             * @memberof PB.Subscribe
              * @static
-             * @param {PB.SplitflapCommand} message SplitflapCommand
+             * @param {PB.Subscribe} message Subscribe
              * @param {$protobuf.IConversionOptions} [options] Conversion options
              * @returns {Object.<string,*>} Plain object
              */
-            SplitflapCommand.toObject = function toObject(message, options) {
+            Subscribe.toObject = function toObject(message, options) {
                 if (!options)
                     options = {};
                 var object = {};
-                if (options.arrays || options.defaults)
-                    object.modules = [];
-                if (message.modules && message.modules.length) {
-                    object.modules = [];
-                    for (var j = 0; j < message.modules.length; ++j)
-                        object.modules[j] = $root.PB.SplitflapCommand.ModuleCommand.toObject(message.modules[j], options);
+                if (options.defaults) {
+                    object.minIntervalMillis = 0;
+                    object.heartbeatIntervalMillis = 0;
+                    object.moduleStart = 0;
+                    object.moduleCount = 0;
+                    object.fieldMask = 0;
                 }
+                if (message.minIntervalMillis != null && message.hasOwnProperty("minIntervalMillis"))
+                    object.minIntervalMillis = message.minIntervalMillis;
+                if (message.heartbeatIntervalMillis != null && message.hasOwnProperty("heartbeatIntervalMillis"))
+                    object.heartbeatIntervalMillis = message.heartbeatIntervalMillis;
+                if (message.moduleStart != null && message.hasOwnProperty("moduleStart"))
+                    object.moduleStart = message.moduleStart;
+                if (message.moduleCount != null && message.hasOwnProperty("moduleCount"))
+                    object.moduleCount = message.moduleCount;
+                if (message.fieldMask != null && message.hasOwnProperty("fieldMask"))
+                    object.fieldMask = message.fieldMask;
                 return object;
             };
     
             /**
-             * Converts this SplitflapCommand to JSON.
+             * Converts this Subscribe to JSON.
              * @function toJSON
-             * @memberof PB.SplitflapCommand
+             * @memberof PB.Subscribe
              * @instance
              * @returns {Object.<string,*>} JSON object
              */
-            SplitflapCommand.prototype.toJSON = function toJSON() {
+            Subscribe.prototype.toJSON = function toJSON() {
                 return this.constructor.toObject(this, $protobuf.util.toJSONOptions);
             };
     
-            SplitflapCommand.ModuleCommand = (function() {
-    
-                /**
-                 * Properties of a ModuleCommand.
-                 * @memberof PB.SplitflapCommand
-                 * @interface IModuleCommand
-                 * @property {PB.SplitflapCommand.ModuleCommand.Action|null} [action] ModuleCommand action
-                 * @property {number|null} [param] ModuleCommand param
-                 */
-    
-                /**
-                 * Constructs a new ModuleCommand.
-                 * @memberof PB.SplitflapCommand
-                 * @classdesc Represents a ModuleCommand.
-                 * @implements IModuleCommand
-                 * @constructor
-                 * @param {PB.SplitflapCommand.IModuleCommand=} [properties] Properties to set
-                 */
-                function ModuleCommand(properties) {
-                    if (properties)
-                        for (var keys = Object.keys(properties), i = 0; i < keys.length; ++i)
-                            if (properties[keys[i]] != null)
-                                this[keys[i]] = properties[keys[i]];
-                }
-    
-                /**
-                 * ModuleCommand action.
-                 * @member {PB.SplitflapCommand.ModuleCommand.Action} action
-                 * @memberof PB.SplitflapCommand.ModuleCommand
-                 * @instance
-                 */
-                ModuleCommand.prototype.action = 0;
-    
-                /**
-                 * ModuleCommand param.
-                 * @member {number} param
-                 * @memberof PB.SplitflapCommand.ModuleCommand
-                 * @instance
-                 */
-                ModuleCommand.prototype.param = 0;
+            return Subscribe;
+        })();
     
-                /**
-                 * Creates a new ModuleCommand instance using the specified properties.
-                 * @function create
-                 * @memberof PB.SplitflapCommand.ModuleCommand
-                 * @static
-                 * @param {PB.SplitflapCommand.IModuleCommand=} [properties] Properties to set
-                 * @returns {PB.SplitflapCommand.ModuleCommand} ModuleCommand instance
-                 */
-                ModuleCommand.create = function create(properties) {
-                    return new ModuleCommand(properties);
-                };
+        PB.WindowConfig = (function() {
     
-                /**
-                 * Encodes the specified ModuleCommand message. Does not implicitly {@link PB.SplitflapCommand.ModuleCommand.verify|verify} messages.
-                 * @function encode
-                 * @memberof PB.SplitflapCommand.ModuleCommand
-                 * @static
-                 * @param {PB.SplitflapCommand.IModuleCommand} message ModuleCommand message or plain object to encode
-                 * @param {$protobuf.Writer} [writer] Writer to encode to
-                 * @returns {$protobuf.Writer} Writer
-                 */
-                ModuleCommand.encode = function encode(message, writer) {
-                    if (!writer)
-                        writer = $Writer.create();
-                    if (message.action != null && Object.hasOwnProperty.call(message, "action"))
-                        writer.uint32(/* id 1, wireType 0 =*/8).int32(message.action);
-                    if (message.param != null && Object.hasOwnProperty.call(message, "param"))
-                        writer.uint32(/* id 2, wireType 0 =*/16).uint32(message.param);
-                    return writer;
-                };
+            /**
+             * Properties of a WindowConfig.
+             * @memberof PB
+             * @interface IWindowConfig
+             * @property {number|null} [windowSize] WindowConfig windowSize
+             */
     
-                /**
-                 * Encodes the specified ModuleCommand message, length delimited. Does not implicitly {@link PB.SplitflapCommand.ModuleCommand.verify|verify} messages.
-                 * @function encodeDelimited
-                 * @memberof PB.SplitflapCommand.ModuleCommand
-                 * @static
-                 * @param {PB.SplitflapCommand.IModuleCommand} message ModuleCommand message or plain object to encode
-                 * @param {$protobuf.Writer} [writer] Writer to encode to
-                 * @returns {$protobuf.Writer} Writer
-                 */
-                ModuleCommand.encodeDelimited = function encodeDelimited(message, writer) {
-                    return this.encode(message, writer).ldelim();
-                };
+            /**
+             * Constructs a new WindowConfig.
+             * @memberof PB
+             * @classdesc Switches the transport to a sliding window, allowing multiple messages to be in flight before they are
+             * acknowledged. The nonce of the ToSplitflap message carrying this config is the base of the window; the
+             * client must send subsequent messages with consecutive nonces. The accepted window size (which may be
+             * smaller than requested) is reported in the Ack; a window_size of 1 selects the stop-and-wait transport.
+             * 
+             * Clients should send this as their first message, even if they only use stop-and-wait, since the transport
+             * otherwise carries on from where the previous client left it (and a new client's nonces could fall within
+             * its window).
+             * @implements IWindowConfig
+             * @constructor
+             * @param {PB.IWindowConfig=} [properties] Properties to set
+             */
+            function WindowConfig(properties) {
+                if (properties)
+                    for (var keys = Object.keys(properties), i = 0; i < keys.length; ++i)
+                        if (properties[keys[i]] != null)
+                            this[keys[i]] = properties[keys[i]];
+            }
     
-                /**
-                 * Decodes a ModuleCommand message from the specified reader or buffer.
-                 * @function decode
-                 * @memberof PB.SplitflapCommand.ModuleCommand
-                 * @static
-                 * @param {$protobuf.Reader|Uint8Array} reader Reader or buffer to decode from
-                 * @param {number} [length] Message length if known beforehand
-                 * @returns {PB.SplitflapCommand.ModuleCommand} ModuleCommand
-                 * @throws {Error} If the payload is not a reader or valid buffer
-                 * @throws {$protobuf.util.ProtocolError} If required fields are missing
-                 */
-                ModuleCommand.decode = function decode(reader, length) {
-                    if (!(reader instanceof $Reader))
-                        reader = $Reader.create(reader);
-                    var end = length === undefined ? reader.len : reader.pos + length, message = new $root.PB.SplitflapCommand.ModuleCommand();
-                    while (reader.pos < end) {
-                        var tag = reader.uint32();
-                        switch (tag >>> 3) {
-                        case 1:
-                            message.action = reader.int32();
-                            break;
-                        case 2:
-                            message.param = reader.uint32();
-                            break;
-                        default:
-                            reader.skipType(tag & 7);
-                            break;
-                        }
-                    }
-                    return message;
-                };
+            /**
+             * WindowConfig windowSize.
+             * @member {number} windowSize
+             * @memberof PB.WindowConfig
+             * @instance
+             */
+            WindowConfig.prototype.windowSize = 0;
     
-                /**
-                 * Decodes a ModuleCommand message from the specified reader or buffer, length delimited.
-                 * @function decodeDelimited
-                 * @memberof PB.SplitflapCommand.ModuleCommand
-                 * @static
-                 * @param {$protobuf.Reader|Uint8Array} reader Reader or buffer to decode from
-                 * @returns {PB.SplitflapCommand.ModuleCommand} ModuleCommand
-                 * @throws {Error} If the payload is not a reader or valid buffer
-                 * @throws {$protobuf.util.ProtocolError} If required fields are missing
-                 */
-                ModuleCommand.decodeDelimited = function decodeDelimited(reader) {
-                    if (!(reader instanceof $Reader))
-                        reader = new $Reader(reader);
-                    return this.decode(reader, reader.uint32());
-                };
+            /**
+             * Creates a new WindowConfig instance using the specified properties.
+             * @function create
+             * @memberof PB.WindowConfig
+             * @static
+             * @param {PB.IWindowConfig=} [properties] Properties to set
+             * @returns {PB.WindowConfig} WindowConfig instance
+             */
+            WindowConfig.create = function create(properties) {
+                return new WindowConfig(properties);
+            };
     
-                /**
-                 * Verifies a ModuleCommand message.
-                 * @function verify
-                 * @memberof PB.SplitflapCommand.ModuleCommand
-                 * @static
-                 * @param {Object.<string,*>} message Plain object to verify
-                 * @returns {string|null} `null` if valid, otherwise the reason why it is not
-                 */
-                ModuleCommand.verify = function verify(message) {
-                    if (typeof message !== "object" || message === null)
-                        return "object expected";
-                    if (message.action != null && message.hasOwnProperty("action"))
-                        switch (message.action) {
-                        default:
-                            return "action: enum value expected";
-                        case 0:
-                        case 1:
-                        case 2:
-                            break;
-                        }
-                    if (message.param != null && message.hasOwnProperty("param"))
-                        if (!$util.isInteger(message.param))
-                            return "param: integer expected";
-                    return null;
-                };
+            /**
+             * Encodes the specified WindowConfig message. Does not implicitly {@link PB.WindowConfig.verify|verify} messages.
+             * @function encode
+             * @memberof PB.WindowConfig
+             * @static
+             * @param {PB.IWindowConfig} message WindowConfig message or plain object to encode
+             * @param {$protobuf.Writer} [writer] Writer to encode to
+             * @returns {$protobuf.Writer} Writer
+             */
+            WindowConfig.encode = function encode(message, writer) {
+                if (!writer)
+                    writer = $Writer.create();
+                if (message.windowSize != null && Object.hasOwnProperty.call(message, "windowSize"))
+                    writer.uint32(/* id 1, wireType 0 =*/8).uint32(message.windowSize);
+                return writer;
+            };
     
-                /**
-                 * Creates a ModuleCommand message from a plain object. Also converts values to their respective internal types.
-                 * @function fromObject
-                 * @memberof PB.SplitflapCommand.ModuleCommand
-                 * @static
-                 * @param {Object.<string,*>} object Plain object
-                 * @returns {PB.SplitflapCommand.ModuleCommand} ModuleCommand
-                 */
-                ModuleCommand.fromObject = function fromObject(object) {
-                    if (object instanceof $root.PB.SplitflapCommand.ModuleCommand)
-                        return object;
-                    var message = new $root.PB.SplitflapCommand.ModuleCommand();
-                    switch (object.action) {
-                    case "NO_OP":
-                    case 0:
-                        message.action = 0;
-                        break;
-                    case "GO_TO_FLAP":
+            /**
+             * Encodes the specified WindowConfig message, length delimited. Does not implicitly {@link PB.WindowConfig.verify|verify} messages.
+             * @function encodeDelimited
+             * @memberof PB.WindowConfig
+             * @static
+             * @param {PB.IWindowConfig} message WindowConfig message or plain object to encode
+             * @param {$protobuf.Writer} [writer] Writer to encode to
+             * @returns {$protobuf.Writer} Writer
+             */
+            WindowConfig.encodeDelimited = function encodeDelimited(message, writer) {
+                return this.encode(message, writer).ldelim();
+            };
+    
+            /**
+             * Decodes a WindowConfig message from the specified reader or buffer.
+             * @function decode
+             * @memberof PB.WindowConfig
+             * @static
+             * @param {$protobuf.Reader|Uint8Array} reader Reader or buffer to decode from
+             * @param {number} [length] Message length if known beforehand
+             * @returns {PB.WindowConfig} WindowConfig
+             * @throws {Error} If the payload is not a reader or valid buffer
+             * @throws {$protobuf.util.ProtocolError} If required fields are missing
+             */
+            WindowConfig.decode = function decode(reader, length) {
+                if (!(reader instanceof $Reader))
+                    reader = $Reader.create(reader);
+                var end = length === undefined ? reader.len : reader.pos + length, message = new $root.PB.WindowConfig();
+                while (reader.pos < end) {
+                    var tag = reader.uint32();
+                    switch (tag >>> 3) {
                     case 1:
-                        message.action = 1;
+                        message.windowSize = reader.uint32();
                         break;
-                    case "RESET_AND_HOME":
-                    case 2:
-                        message.action = 2;
+                    default:
+                        reader.skipType(tag & 7);
                         break;
                     }
-                    if (object.param != null)
-                        message.param = object.param >>> 0;
-                    return message;
-                };
+                }
+                return message;
+            };
     
-                /**
-                 * Creates a plain object from a ModuleCommand message. Also converts values to other types if specified.
-                 * @function toObject
-                 * @memberof PB.SplitflapCommand.ModuleCommand
-                 * @static
-                 * @param {PB.SplitflapCommand.ModuleCommand} message ModuleCommand
-                 * @param {$protobuf.IConversionOptions} [options] Conversion options
-                 * @returns {Object.<string,*>} Plain object
-                 */
-                ModuleCommand.toObject = function toObject(message, options) {
-                    if (!options)
-                        options = {};
-                    var object = {};
-                    if (options.defaults) {
-                        object.action = options.enums === String ? "NO_OP" : 0;
-                        object.param = 0;
-                    }
-                    if (message.action != null && message.hasOwnProperty("action"))
-                        object.action = options.enums === String ? $root.PB.SplitflapCommand.ModuleCommand.Action[message.action] : message.action;
-                    if (message.param != null && message.hasOwnProperty("param"))
-                        object.param = message.param;
-                    return object;
-                };
+            /**
+             * Decodes a WindowConfig message from the specified reader or buffer, length delimited.
+             * @function decodeDelimited
+             * @memberof PB.WindowConfig
+             * @static
+             * @param {$protobuf.Reader|Uint8Array} reader Reader or buffer to decode from
+             * @returns {PB.WindowConfig} WindowConfig
+             * @throws {Error} If the payload is not a reader or valid buffer
+             * @throws {$protobuf.util.ProtocolError} If required fields are missing
+             */
+            WindowConfig.decodeDelimited = function decodeDelimited(reader) {
+                if (!(reader instanceof $Reader))
+                    reader = new $Reader(reader);
+                return this.decode(reader, reader.uint32());
+            };
     
-                /**
-                 * Converts this ModuleCommand to JSON.
-                 * @function toJSON
-                 * @memberof PB.SplitflapCommand.ModuleCommand
-                 * @instance
-                 * @returns {Object.<string,*>} JSON object
-                 */
-                ModuleCommand.prototype.toJSON = function toJSON() {
-                    return this.constructor.toObject(this, $protobuf.util.toJSONOptions);
-                };
+            /**
+             * Verifies a WindowConfig message.
+             * @function verify
+             * @memberof PB.WindowConfig
+             * @static
+             * @param {Object.<string,*>} message Plain object to verify
+             * @returns {string|null} `null` if valid, otherwise the reason why it is not
+             */
+            WindowConfig.verify = function verify(message) {
+                if (typeof message !== "object" || message === null)
+                    return "object expected";
+                if (message.windowSize != null && message.hasOwnProperty("windowSize"))
+                    if (!$util.isInteger(message.windowSize))
+                        return "windowSize: integer expected";
+                return null;
+            };
     
-                /**
-                 * Action enum.
-                 * @name PB.SplitflapCommand.ModuleCommand.Action
-                 * @enum {number}
-                 * @property {number} NO_OP=0 NO_OP value
-                 * @property {number} GO_TO_FLAP=1 GO_TO_FLAP value
-                 * @property {number} RESET_AND_HOME=2 RESET_AND_HOME value
-                 */
-                ModuleCommand.Action = (function() {
-                    var valuesById = {}, values = Object.create(valuesById);
-                    values[valuesById[0] = "NO_OP"] = 0;
-                    values[valuesById[1] = "GO_TO_FLAP"] = 1;
-                    values[valuesById[2] = "RESET_AND_HOME"] = 2;
-                    return values;
-                })();
+            /**
+             * Creates a WindowConfig message from a plain object. Also converts values to their respective internal types.
+             * @function fromObject
+             * @memberof PB.WindowConfig
+             * @static
+             * @param {Object.<string,*>} object Plain object
+             * @returns {PB.WindowConfig} WindowConfig
+             */
+            WindowConfig.fromObject = function fromObject(object) {
+                if (object instanceof $root.PB.WindowConfig)
+                    return object;
+                var message = new $root.PB.WindowConfig();
+                if (object.windowSize != null)
+                    message.windowSize = object.windowSize >>> 0;
+                return message;
+            };
     
-                return ModuleCommand;
-            })();
+            /**
+             * Creates a plain object from a WindowConfig message. Also converts values to other types if specified.
+             * @function toObject
+             * @memberof PB.WindowConfig
+             * @static
+             * @param {PB.WindowConfig} message WindowConfig
+             * @param {$protobuf.IConversionOptions} [options] Conversion options
+             * @returns {Object.<string,*>} Plain object
+             */
+            WindowConfig.toObject = function toObject(message, options) {
+                if (!options)
+                    options = {};
+                var object = {};
+                if (options.defaults)
+                    object.windowSize = 0;
+                if (message.windowSize != null && message.hasOwnProperty("windowSize"))
+                    object.windowSize = message.windowSize;
+                return object;
+            };
     
-            return SplitflapCommand;
+            /**
+             * Converts this WindowConfig to JSON.
+             * @function toJSON
+             * @memberof PB.WindowConfig
+             * @instance
+             * @returns {Object.<string,*>} JSON object
+             */
+            WindowConfig.prototype.toJSON = function toJSON() {
+                return this.constructor.toObject(this, $protobuf.util.toJSONOptions);
+            };
+    
+            return WindowConfig;
         })();
     
-        PB.SplitflapConfig = (function() {
+        PB.BaudRateChange = (function() {
     
             /**
-             * Properties of a SplitflapConfig.
+             * Properties of a BaudRateChange.
              * @memberof PB
-             * @interface ISplitflapConfig
-             * @property {Array.<PB.SplitflapConfig.IModuleConfig>|null} [modules] SplitflapConfig modules
+             * @interface IBaudRateChange
+             * @property {PB.BaudRateChange.Phase|null} [phase] BaudRateChange phase
+             * @property {number|null} [baudRate] BaudRateChange baudRate
              */
     
             /**
-             * Constructs a new SplitflapConfig.
+             * Constructs a new BaudRateChange.
              * @memberof PB
-             * @classdesc Represents a SplitflapConfig.
-             * @implements ISplitflapConfig
+             * @classdesc Two-phase change of the serial link's baud rate:
+             * 1. The client sends a PROPOSE at the current rate and waits for a BaudRateResponse. If ACCEPTED, the
+             * splitflap has already switched to the new rate.
+             * 2. The client switches to the new rate and sends a CONFIRM (with the same baud_rate) there. If the
+             * splitflap doesn't receive the CONFIRM within a timeout, it reverts to the previous rate (and reports
+             * REVERTED), so a rate that doesn't work on the link can never leave the splitflap unreachable. A client
+             * whose CONFIRM isn't acknowledged within the same timeout should revert as well.
+             * 
+             * No other messages should be in flight during the handshake.
+             * @implements IBaudRateChange
              * @constructor
-             * @param {PB.ISplitflapConfig=} [properties] Properties to set
+             * @param {PB.IBaudRateChange=} [properties] Properties to set
              */
-            function SplitflapConfig(properties) {
-                this.modules = [];
+            function BaudRateChange(properties) {
                 if (properties)
                     for (var keys = Object.keys(properties), i = 0; i < keys.length; ++i)
                         if (properties[keys[i]] != null)
@@ -2606,78 +4471,88 @@
             }
     
             /**
-             * SplitflapConfig modules.
-             * @member {Array.<PB.SplitflapConfig.IModuleConfig>} modules
-             * @memberof PB.SplitflapConfig
+             * BaudRateChange phase.
+             * @member {PB.BaudRateChange.Phase} phase
+             * @memberof PB.BaudRateChange
              * @instance
              */
-            SplitflapConfig.prototype.modules = $util.emptyArray;
+            BaudRateChange.prototype.phase = 0;
     
             /**
-             * Creates a new SplitflapConfig instance using the specified properties.
+             * BaudRateChange baudRate.
+             * @member {number} baudRate
+             * @memberof PB.BaudRateChange
+             * @instance
+             */
+            BaudRateChange.prototype.baudRate = 0;
+    
+            /**
+             * Creates a new BaudRateChange instance using the specified properties.
              * @function create
-             * @memberof PB.SplitflapConfig
+             * @memberof PB.BaudRateChange
              * @static
-             * @param {PB.ISplitflapConfig=} [properties] Properties to set
-             * @returns {PB.SplitflapConfig} SplitflapConfig instance
+             * @param {PB.IBaudRateChange=} [properties] Properties to set
+             * @returns {PB.BaudRateChange} BaudRateChange instance
              */
-            SplitflapConfig.create = function create(properties) {
-                return new SplitflapConfig(properties);
+            BaudRateChange.create = function create(properties) {
+                return new BaudRateChange(properties);
             };
     
             /**
-             * Encodes the specified SplitflapConfig message. Does not implicitly {@link PB.SplitflapConfig.verify|verify} messages.
+             * Encodes the specified BaudRateChange message. Does not implicitly {@link PB.BaudRateChange.verify|verify} messages.
              * @function encode
-             * @memberof PB.SplitflapConfig
+             * @memberof PB.BaudRateChange
              * @static
-             * @param {PB.ISplitflapConfig} message SplitflapConfig message or plain object to encode
+             * @param {PB.IBaudRateChange} message BaudRateChange message or plain object to encode
              * @param {$protobuf.Writer} [writer] Writer to encode to
              * @returns {$protobuf.Writer} Writer
              */
-            SplitflapConfig.encode = function encode(message, writer) {
+            BaudRateChange.encode = function encode(message, writer) {
                 if (!writer)
                     writer = $Writer.create();
-                if (message.modules != null && message.modules.length)
-                    for (var i = 0; i < message.modules.length; ++i)
-                        $root.PB.SplitflapConfig.ModuleConfig.encode(message.modules[i], writer.uint32(/* id 1, wireType 2 =*/10).fork()).ldelim();
+                if (message.phase != null && Object.hasOwnProperty.call(message, "phase"))
+                    writer.uint32(/* id 1, wireType 0 =*/8).int32(message.phase);
+                if (message.baudRate != null && Object.hasOwnProperty.call(message, "baudRate"))
+                    writer.uint32(/* id 2, wireType 0 =*/16).uint32(message.baudRate);
                 return writer;
             };
     
             /**
-             * Encodes the specified SplitflapConfig message, length delimited. Does not implicitly {@link PB.SplitflapConfig.verify|verify} messages.
+             * Encodes the specified BaudRateChange message, length delimited. Does not implicitly {@link PB.BaudRateChange.verify|verify} messages.
              * @function encodeDelimited
-             * @memberof PB.SplitflapConfig
+             * @memberof PB.BaudRateChange
              * @static
-             * @param {PB.ISplitflapConfig} message SplitflapConfig message or plain object to encode
+             * @param {PB.IBaudRateChange} message BaudRateChange message or plain object to encode
              * @param {$protobuf.Writer} [writer] Writer to encode to
              * @returns {$protobuf.Writer} Writer
              */
-            SplitflapConfig.encodeDelimited = function encodeDelimited(message, writer) {
+            BaudRateChange.encodeDelimited = function encodeDelimited(message, writer) {
                 return this.encode(message, writer).ldelim();
             };
     
             /**
-             * Decodes a SplitflapConfig message from the specified reader or buffer.
+             * Decodes a BaudRateChange message from the specified reader or buffer.
              * @function decode
-             * @memberof PB.SplitflapConfig
+             * @memberof PB.BaudRateChange
              * @static
              * @param {$protobuf.Reader|Uint8Array} reader Reader or buffer to decode from
              * @param {number} [length] Message length if known beforehand
-             * @returns {PB.SplitflapConfig} SplitflapConfig
+             * @returns {PB.BaudRateChange} BaudRateChange
              * @throws {Error} If the payload is not a reader or valid buffer
              * @throws {$protobuf.util.ProtocolError} If required fields are missing
              */
-            SplitflapConfig.decode = function decode(reader, length) {
+            BaudRateChange.decode = function decode(reader, length) {
                 if (!(reader instanceof $Reader))
                     reader = $Reader.create(reader);
-                var end = length === undefined ? reader.len : reader.pos + length, message = new $root.PB.SplitflapConfig();
+                var end = length === undefined ? reader.len : reader.pos + length, message = new $root.PB.BaudRateChange();
                 while (reader.pos < end) {
                     var tag = reader.uint32();
                     switch (tag >>> 3) {
                     case 1:
-                        if (!(message.modules && message.modules.length))
-                            message.modules = [];
-                        message.modules.push($root.PB.SplitflapConfig.ModuleConfig.decode(reader, reader.uint32()));
+                        message.phase = reader.int32();
+                        break;
+                    case 2:
+                        message.baudRate = reader.uint32();
                         break;
                     default:
                         reader.skipType(tag & 7);
@@ -2688,352 +4563,451 @@
             };
     
             /**
-             * Decodes a SplitflapConfig message from the specified reader or buffer, length delimited.
+             * Decodes a BaudRateChange message from the specified reader or buffer, length delimited.
              * @function decodeDelimited
-             * @memberof PB.SplitflapConfig
+             * @memberof PB.BaudRateChange
              * @static
              * @param {$protobuf.Reader|Uint8Array} reader Reader or buffer to decode from
-             * @returns {PB.SplitflapConfig} SplitflapConfig
+             * @returns {PB.BaudRateChange} BaudRateChange
              * @throws {Error} If the payload is not a reader or valid buffer
              * @throws {$protobuf.util.ProtocolError} If required fields are missing
              */
-            SplitflapConfig.decodeDelimited = function decodeDelimited(reader) {
+            BaudRateChange.decodeDelimited = function decodeDelimited(reader) {
                 if (!(reader instanceof $Reader))
                     reader = new $Reader(reader);
                 return this.decode(reader, reader.uint32());
             };
     
             /**
-             * Verifies a SplitflapConfig message.
+             * Verifies a BaudRateChange message.
              * @function verify
-             * @memberof PB.SplitflapConfig
+             * @memberof PB.BaudRateChange
              * @static
              * @param {Object.<string,*>} message Plain object to verify
-             * @returns {string|null} `null` if valid, otherwise the reason why it is not
-             */
-            SplitflapConfig.verify = function verify(message) {
-                if (typeof message !== "object" || message === null)
-                    return "object expected";
-                if (message.modules != null && message.hasOwnProperty("modules")) {
-                    if (!Array.isArray(message.modules))
-                        return "modules: array expected";
-                    for (var i = 0; i < message.modules.length; ++i) {
-                        var error = $root.PB.SplitflapConfig.ModuleConfig.verify(message.modules[i]);
-                        if (error)
-                            return "modules." + error;
+             * @returns {string|null} `null` if valid, otherwise the reason why it is not
+             */
+            BaudRateChange.verify = function verify(message) {
+                if (typeof message !== "object" || message === null)
+                    return "object expected";
+                if (message.phase != null && message.hasOwnProperty("phase"))
+                    switch (message.phase) {
+                    default:
+                        return "phase: enum value expected";
+                    case 0:
+                    case 1:
+                        break;
                     }
-                }
+                if (message.baudRate != null && message.hasOwnProperty("baudRate"))
+                    if (!$util.isInteger(message.baudRate))
+                        return "baudRate: integer expected";
                 return null;
             };
     
             /**
-             * Creates a SplitflapConfig message from a plain object. Also converts values to their respective internal types.
+             * Creates a BaudRateChange message from a plain object. Also converts values to their respective internal types.
              * @function fromObject
-             * @memberof PB.SplitflapConfig
+             * @memberof PB.BaudRateChange
              * @static
              * @param {Object.<string,*>} object Plain object
-             * @returns {PB.SplitflapConfig} SplitflapConfig
+             * @returns {PB.BaudRateChange} BaudRateChange
              */
-            SplitflapConfig.fromObject = function fromObject(object) {
-                if (object instanceof $root.PB.SplitflapConfig)
+            BaudRateChange.fromObject = function fromObject(object) {
+                if (object instanceof $root.PB.BaudRateChange)
                     return object;
-                var message = new $root.PB.SplitflapConfig();
-                if (object.modules) {
-                    if (!Array.isArray(object.modules))
-                        throw TypeError(".PB.SplitflapConfig.modules: array expected");
-                    message.modules = [];
-                    for (var i = 0; i < object.modules.length; ++i) {
-                        if (typeof object.modules[i] !== "object")
-                            throw TypeError(".PB.SplitflapConfig.modules: object expected");
-                        message.modules[i] = $root.PB.SplitflapConfig.ModuleConfig.fromObject(object.modules[i]);
-                    }
+                var message = new $root.PB.BaudRateChange();
+                switch (object.phase) {
+                case "PROPOSE":
+                case 0:
+                    message.phase = 0;
+                    break;
+                case "CONFIRM":
+                case 1:
+                    message.phase = 1;
+                    break;
                 }
+                if (object.baudRate != null)
+                    message.baudRate = object.baudRate >>> 0;
                 return message;
             };
     
             /**
-             * Creates a plain object from a SplitflapConfig message. Also converts values to other types if specified.
+             * Creates a plain object from a BaudRateChange message. Also converts values to other types if specified.
              * @function toObject
-             * @memberof PB.SplitflapConfig
+             * @memberof PB.BaudRateChange
              * @static
-             * @param {PB.SplitflapConfig} message SplitflapConfig
+             * @param {PB.BaudRateChange} message BaudRateChange
              * @param {$protobuf.IConversionOptions} [options] Conversion options
              * @returns {Object.<string,*>} Plain object
              */
-            SplitflapConfig.toObject = function toObject(message, options) {
+            BaudRateChange.toObject = function toObject(message, options) {
                 if (!options)
                     options = {};
                 var object = {};
-                if (options.arrays || options.defaults)
-                    object.modules = [];
-                if (message.modules && message.modules.length) {
-                    object.modules = [];
-                    for (var j = 0; j < message.modules.length; ++j)
-                        object.modules[j] = $root.PB.SplitflapConfig.ModuleConfig.toObject(message.modules[j], options);
+                if (options.defaults) {
+                    object.phase = options.enums === String ? "PROPOSE" : 0;
+                    object.baudRate = 0;
                 }
+                if (message.phase != null && message.hasOwnProperty("phase"))
+                    object.phase = options.enums === String ? $root.PB.BaudRateChange.Phase[message.phase] : message.phase;
+                if (message.baudRate != null && message.hasOwnProperty("baudRate"))
+                    object.baudRate = message.baudRate;
                 return object;
             };
     
             /**
-             * Converts this SplitflapConfig to JSON.
+             * Converts this BaudRateChange to JSON.
              * @function toJSON
-             * @memberof PB.SplitflapConfig
+             * @memberof PB.BaudRateChange
              * @instance
              * @returns {Object.<string,*>} JSON object
              */
-            SplitflapConfig.prototype.toJSON = function toJSON() {
+            BaudRateChange.prototype.toJSON = function toJSON() {
                 return this.constructor.toObject(this, $protobuf.util.toJSONOptions);
             };
     
-            SplitflapConfig.ModuleConfig = (function() {
+            /**
+             * Phase enum.
+             * @name PB.BaudRateChange.Phase
+             * @enum {number}
+             * @property {number} PROPOSE=0 PROPOSE value
+             * @property {number} CONFIRM=1 CONFIRM value
+             */
+            BaudRateChange.Phase = (function() {
+                var valuesById = {}, values = Object.create(valuesById);
+                values[valuesById[0] = "PROPOSE"] = 0;
+                values[valuesById[1] = "CONFIRM"] = 1;
+                return values;
+            })();
     
-                /**
-                 * Properties of a ModuleConfig.
-                 * @memberof PB.SplitflapConfig
-                 * @interface IModuleConfig
-                 * @property {number|null} [targetFlapIndex] ModuleConfig targetFlapIndex
-                 * @property {number|null} [movementNonce] Value that triggers a movement upon change. If unused, only changes to target_flap_index
-                 * will trigger a movement. This can be used to trigger a full revolution back to the *same*
-                 * flap index.
-                 * 
-                 * NOTE: Must be < 256
-                 * @property {number|null} [resetNonce] Value that triggers a reset (clear error counters, re-home) upon change. If unused,
-                 * module will only re-home upon recoverable errors, and error counters will continue
-                 * to increase until overflow.
-                 * 
-                 * NOTE: Must be < 256
-                 */
+            return BaudRateChange;
+        })();
     
-                /**
-                 * Constructs a new ModuleConfig.
-                 * @memberof PB.SplitflapConfig
-                 * @classdesc Represents a ModuleConfig.
-                 * @implements IModuleConfig
-                 * @constructor
-                 * @param {PB.SplitflapConfig.IModuleConfig=} [properties] Properties to set
-                 */
-                function ModuleConfig(properties) {
-                    if (properties)
-                        for (var keys = Object.keys(properties), i = 0; i < keys.length; ++i)
-                            if (properties[keys[i]] != null)
-                                this[keys[i]] = properties[keys[i]];
-                }
+        PB.ScheduleUpload = (function() {
     
-                /**
-                 * ModuleConfig targetFlapIndex.
-                 * @member {number} targetFlapIndex
-                 * @memberof PB.SplitflapConfig.ModuleConfig
-                 * @instance
-                 */
-                ModuleConfig.prototype.targetFlapIndex = 0;
+            /**
+             * Properties of a ScheduleUpload.
+             * @memberof PB
+             * @interface IScheduleUpload
+             * @property {PB.ScheduleUpload.Phase|null} [phase] ScheduleUpload phase
+             * @property {number|null} [size] BEGIN only: total size of the image.
+             * @property {number|null} [offset] DATA only.
+             * @property {Uint8Array|null} [data] ScheduleUpload data
+             * @property {number|null} [crc32] COMMIT only: CRC32 of the whole image.
+             */
     
-                /**
-                 * Value that triggers a movement upon change. If unused, only changes to target_flap_index
-                 * will trigger a movement. This can be used to trigger a full revolution back to the *same*
-                 * flap index.
-                 * 
-                 * NOTE: Must be < 256
-                 * @member {number} movementNonce
-                 * @memberof PB.SplitflapConfig.ModuleConfig
-                 * @instance
-                 */
-                ModuleConfig.prototype.movementNonce = 0;
+            /**
+             * Constructs a new ScheduleUpload.
+             * @memberof PB
+             * @classdesc Replaces the schedule of timed messages with an image built by software/chainlink/schedule.py, which is written
+             * to a flash partition as it's received:
+             * 1. BEGIN with the size of the image. The current schedule stops being used immediately.
+             * 2. DATA chunks, in order, each at the offset following the previous one.
+             * 3. COMMIT with the CRC32 of the whole image. The image is verified and, if it's valid, used from then on.
+             * 
+             * Failures are reported in a ScheduleUploadResponse and end the upload, so it has to be restarted with a BEGIN.
+             * 
+             * With a sliding window, a ScheduleUpload that arrives while an earlier message is missing isn't buffered (or
+             * acked), so it's retried along with the missing one.
+             * @implements IScheduleUpload
+             * @constructor
+             * @param {PB.IScheduleUpload=} [properties] Properties to set
+             */
+            function ScheduleUpload(properties) {
+                if (properties)
+                    for (var keys = Object.keys(properties), i = 0; i < keys.length; ++i)
+                        if (properties[keys[i]] != null)
+                            this[keys[i]] = properties[keys[i]];
+            }
     
-                /**
-                 * Value that triggers a reset (clear error counters, re-home) upon change. If unused,
-                 * module will only re-home upon recoverable errors, and error counters will continue
-                 * to increase until overflow.
-                 * 
-                 * NOTE: Must be < 256
-                 * @member {number} resetNonce
-                 * @memberof PB.SplitflapConfig.ModuleConfig
-                 * @instance
-                 */
-                ModuleConfig.prototype.resetNonce = 0;
+            /**
+             * ScheduleUpload phase.
+             * @member {PB.ScheduleUpload.Phase} phase
+             * @memberof PB.ScheduleUpload
+             * @instance
+             */
+            ScheduleUpload.prototype.phase = 0;
     
-                /**
-                 * Creates a new ModuleConfig instance using the specified properties.
-                 * @function create
-                 * @memberof PB.SplitflapConfig.ModuleConfig
-                 * @static
-                 * @param {PB.SplitflapConfig.IModuleConfig=} [properties] Properties to set
-                 * @returns {PB.SplitflapConfig.ModuleConfig} ModuleConfig instance
-                 */
-                ModuleConfig.create = function create(properties) {
-                    return new ModuleConfig(properties);
-                };
+            /**
+             * BEGIN only: total size of the image.
+             * @member {number} size
+             * @memberof PB.ScheduleUpload
+             * @instance
+             */
+            ScheduleUpload.prototype.size = 0;
     
-                /**
-                 * Encodes the specified ModuleConfig message. Does not implicitly {@link PB.SplitflapConfig.ModuleConfig.verify|verify} messages.
-                 * @function encode
-                 * @memberof PB.SplitflapConfig.ModuleConfig
-                 * @static
-                 * @param {PB.SplitflapConfig.IModuleConfig} message ModuleConfig message or plain object to encode
-                 * @param {$protobuf.Writer} [writer] Writer to encode to
-                 * @returns {$protobuf.Writer} Writer
-                 */
-                ModuleConfig.encode = function encode(message, writer) {
-                    if (!writer)
-                        writer = $Writer.create();
-                    if (message.targetFlapIndex != null && Object.hasOwnProperty.call(message, "targetFlapIndex"))
-                        writer.uint32(/* id 1, wireType 0 =*/8).uint32(message.targetFlapIndex);
-                    if (message.movementNonce != null && Object.hasOwnProperty.call(message, "movementNonce"))
-                        writer.uint32(/* id 2, wireType 0 =*/16).uint32(message.movementNonce);
-                    if (message.resetNonce != null && Object.hasOwnProperty.call(message, "resetNonce"))
-                        writer.uint32(/* id 3, wireType 0 =*/24).uint32(message.resetNonce);
-                    return writer;
-                };
+            /**
+             * DATA only.
+             * @member {number} offset
+             * @memberof PB.ScheduleUpload
+             * @instance
+             */
+            ScheduleUpload.prototype.offset = 0;
     
-                /**
-                 * Encodes the specified ModuleConfig message, length delimited. Does not implicitly {@link PB.SplitflapConfig.ModuleConfig.verify|verify} messages.
-                 * @function encodeDelimited
-                 * @memberof PB.SplitflapConfig.ModuleConfig
-                 * @static
-                 * @param {PB.SplitflapConfig.IModuleConfig} message ModuleConfig message or plain object to encode
-                 * @param {$protobuf.Writer} [writer] Writer to encode to
-                 * @returns {$protobuf.Writer} Writer
-                 */
-                ModuleConfig.encodeDelimited = function encodeDelimited(message, writer) {
-                    return this.encode(message, writer).ldelim();
-                };
+            /**
+             * ScheduleUpload data.
+             * @member {Uint8Array} data
+             * @memberof PB.ScheduleUpload
+             * @instance
+             */
+            ScheduleUpload.prototype.data = $util.newBuffer([]);
     
-                /**
-                 * Decodes a ModuleConfig message from the specified reader or buffer.
-                 * @function decode
-                 * @memberof PB.SplitflapConfig.ModuleConfig
-                 * @static
-                 * @param {$protobuf.Reader|Uint8Array} reader Reader or buffer to decode from
-                 * @param {number} [length] Message length if known beforehand
-                 * @returns {PB.SplitflapConfig.ModuleConfig} ModuleConfig
-                 * @throws {Error} If the payload is not a reader or valid buffer
-                 * @throws {$protobuf.util.ProtocolError} If required fields are missing
-                 */
-                ModuleConfig.decode = function decode(reader, length) {
-                    if (!(reader instanceof $Reader))
-                        reader = $Reader.create(reader);
-                    var end = length === undefined ? reader.len : reader.pos + length, message = new $root.PB.SplitflapConfig.ModuleConfig();
-                    while (reader.pos < end) {
-                        var tag = reader.uint32();
-                        switch (tag >>> 3) {
-                        case 1:
-                            message.targetFlapIndex = reader.uint32();
-                            break;
-                        case 2:
-                            message.movementNonce = reader.uint32();
-                            break;
-                        case 3:
-                            message.resetNonce = reader.uint32();
-                            break;
-                        default:
-                            reader.skipType(tag & 7);
-                            break;
-                        }
+            /**
+             * COMMIT only: CRC32 of the whole image.
+             * @member {number} crc32
+             * @memberof PB.ScheduleUpload
+             * @instance
+             */
+            ScheduleUpload.prototype.crc32 = 0;
+    
+            /**
+             * Creates a new ScheduleUpload instance using the specified properties.
+             * @function create
+             * @memberof PB.ScheduleUpload
+             * @static
+             * @param {PB.IScheduleUpload=} [properties] Properties to set
+             * @returns {PB.ScheduleUpload} ScheduleUpload instance
+             */
+            ScheduleUpload.create = function create(properties) {
+                return new ScheduleUpload(properties);
+            };
+    
+            /**
+             * Encodes the specified ScheduleUpload message. Does not implicitly {@link PB.ScheduleUpload.verify|verify} messages.
+             * @function encode
+             * @memberof PB.ScheduleUpload
+             * @static
+             * @param {PB.IScheduleUpload} message ScheduleUpload message or plain object to encode
+             * @param {$protobuf.Writer} [writer] Writer to encode to
+             * @returns {$protobuf.Writer} Writer
+             */
+            ScheduleUpload.encode = function encode(message, writer) {
+                if (!writer)
+                    writer = $Writer.create();
+                if (message.phase != null && Object.hasOwnProperty.call(message, "phase"))
+                    writer.uint32(/* id 1, wireType 0 =*/8).int32(message.phase);
+                if (message.size != null && Object.hasOwnProperty.call(message, "size"))
+                    writer.uint32(/* id 2, wireType 0 =*/16).uint32(message.size);
+                if (message.offset != null && Object.hasOwnProperty.call(message, "offset"))
+                    writer.uint32(/* id 3, wireType 0 =*/24).uint32(message.offset);
+                if (message.data != null && Object.hasOwnProperty.call(message, "data"))
+                    writer.uint32(/* id 4, wireType 2 =*/34).bytes(message.data);
+                if (message.crc32 != null && Object.hasOwnProperty.call(message, "crc32"))
+                    writer.uint32(/* id 5, wireType 0 =*/40).uint32(message.crc32);
+                return writer;
+            };
+    
+            /**
+             * Encodes the specified ScheduleUpload message, length delimited. Does not implicitly {@link PB.ScheduleUpload.verify|verify} messages.
+             * @function encodeDelimited
+             * @memberof PB.ScheduleUpload
+             * @static
+             * @param {PB.IScheduleUpload} message ScheduleUpload message or plain object to encode
+             * @param {$protobuf.Writer} [writer] Writer to encode to
+             * @returns {$protobuf.Writer} Writer
+             */
+            ScheduleUpload.encodeDelimited = function encodeDelimited(message, writer) {
+                return this.encode(message, writer).ldelim();
+            };
+    
+            /**
+             * Decodes a ScheduleUpload message from the specified reader or buffer.
+             * @function decode
+             * @memberof PB.ScheduleUpload
+             * @static
+             * @param {$protobuf.Reader|Uint8Array} reader Reader or buffer to decode from
+             * @param {number} [length] Message length if known beforehand
+             * @returns {PB.ScheduleUpload} ScheduleUpload
+             * @throws {Error} If the payload is not a reader or valid buffer
+             * @throws {$protobuf.util.ProtocolError} If required fields are missing
+             */
+            ScheduleUpload.decode = function decode(reader, length) {
+                if (!(reader instanceof $Reader))
+                    reader = $Reader.create(reader);
+                var end = length === undefined ? reader.len : reader.pos + length, message = new $root.PB.ScheduleUpload();
+                while (reader.pos < end) {
+                    var tag = reader.uint32();
+                    switch (tag >>> 3) {
+                    case 1:
+                        message.phase = reader.int32();
+                        break;
+                    case 2:
+                        message.size = reader.uint32();
+                        break;
+                    case 3:
+                        message.offset = reader.uint32();
+                        break;
+                    case 4:
+                        message.data = reader.bytes();
+                        break;
+                    case 5:
+                        message.crc32 = reader.uint32();
+                        break;
+                    default:
+                        reader.skipType(tag & 7);
+                        break;
                     }
-                    return message;
-                };
+                }
+                return message;
+            };
     
-                /**
-                 * Decodes a ModuleConfig message from the specified reader or buffer, length delimited.
-                 * @function decodeDelimited
-                 * @memberof PB.SplitflapConfig.ModuleConfig
-                 * @static
-                 * @param {$protobuf.Reader|Uint8Array} reader Reader or buffer to decode from
-                 * @returns {PB.SplitflapConfig.ModuleConfig} ModuleConfig
-                 * @throws {Error} If the payload is not a reader or valid buffer
-                 * @throws {$protobuf.util.ProtocolError} If required fields are missing
-                 */
-                ModuleConfig.decodeDelimited = function decodeDelimited(reader) {
-                    if (!(reader instanceof $Reader))
-                        reader = new $Reader(reader);
-                    return this.decode(reader, reader.uint32());
-                };
+            /**
+             * Decodes a ScheduleUpload message from the specified reader or buffer, length delimited.
+             * @function decodeDelimited
+             * @memberof PB.ScheduleUpload
+             * @static
+             * @param {$protobuf.Reader|Uint8Array} reader Reader or buffer to decode from
+             * @returns {PB.ScheduleUpload} ScheduleUpload
+             * @throws {Error} If the payload is not a reader or valid buffer
+             * @throws {$protobuf.util.ProtocolError} If required fields are missing
+             */
+            ScheduleUpload.decodeDelimited = function decodeDelimited(reader) {
+                if (!(reader instanceof $Reader))
+                    reader = new $Reader(reader);
+                return this.decode(reader, reader.uint32());
+            };
     
-                /**
-                 * Verifies a ModuleConfig message.
-                 * @function verify
-                 * @memberof PB.SplitflapConfig.ModuleConfig
-                 * @static
-                 * @param {Object.<string,*>} message Plain object to verify
-                 * @returns {string|null} `null` if valid, otherwise the reason why it is not
-                 */
-                ModuleConfig.verify = function verify(message) {
-                    if (typeof message !== "object" || message === null)
-                        return "object expected";
-                    if (message.targetFlapIndex != null && message.hasOwnProperty("targetFlapIndex"))
-                        if (!$util.isInteger(message.targetFlapIndex))
-                            return "targetFlapIndex: integer expected";
-                    if (message.movementNonce != null && message.hasOwnProperty("movementNonce"))
-                        if (!$util.isInteger(message.movementNonce))
-                            return "movementNonce: integer expected";
-                    if (message.resetNonce != null && message.hasOwnProperty("resetNonce"))
-                        if (!$util.isInteger(message.resetNonce))
-                            return "resetNonce: integer expected";
-                    return null;
-                };
+            /**
+             * Verifies a ScheduleUpload message.
+             * @function verify
+             * @memberof PB.ScheduleUpload
+             * @static
+             * @param {Object.<string,*>} message Plain object to verify
+             * @returns {string|null} `null` if valid, otherwise the reason why it is not
+             */
+            ScheduleUpload.verify = function verify(message) {
+                if (typeof message !== "object" || message === null)
+                    return "object expected";
+                if (message.phase != null && message.hasOwnProperty("phase"))
+                    switch (message.phase) {
+                    default:
+                        return "phase: enum value expected";
+                    case 0:
+                    case 1:
+                    case 2:
+                        break;
+                    }
+                if (message.size != null && message.hasOwnProperty("size"))
+                    if (!$util.isInteger(message.size))
+                        return "size: integer expected";
+                if (message.offset != null && message.hasOwnProperty("offset"))
+                    if (!$util.isInteger(message.offset))
+                        return "offset: integer expected";
+                if (message.data != null && message.hasOwnProperty("data"))
+                    if (!(message.data && typeof message.data.length === "number" || $util.isString(message.data)))
+                        return "data: buffer expected";
+                if (message.crc32 != null && message.hasOwnProperty("crc32"))
+                    if (!$util.isInteger(message.crc32))
+                        return "crc32: integer expected";
+                return null;
+            };
     
-                /**
-                 * Creates a ModuleConfig message from a plain object. Also converts values to their respective internal types.
-                 * @function fromObject
-                 * @memberof PB.SplitflapConfig.ModuleConfig
-                 * @static
-                 * @param {Object.<string,*>} object Plain object
-                 * @returns {PB.SplitflapConfig.ModuleConfig} ModuleConfig
-                 */
-                ModuleConfig.fromObject = function fromObject(object) {
-                    if (object instanceof $root.PB.SplitflapConfig.ModuleConfig)
-                        return object;
-                    var message = new $root.PB.SplitflapConfig.ModuleConfig();
-                    if (object.targetFlapIndex != null)
-                        message.targetFlapIndex = object.targetFlapIndex >>> 0;
-                    if (object.movementNonce != null)
-                        message.movementNonce = object.movementNonce >>> 0;
-                    if (object.resetNonce != null)
-                        message.resetNonce = object.resetNonce >>> 0;
-                    return message;
-                };
+            /**
+             * Creates a ScheduleUpload message from a plain object. Also converts values to their respective internal types.
+             * @function fromObject
+             * @memberof PB.ScheduleUpload
+             * @static
+             * @param {Object.<string,*>} object Plain object
+             * @returns {PB.ScheduleUpload} ScheduleUpload
+             */
+            ScheduleUpload.fromObject = function fromObject(object) {
+                if (object instanceof $root.PB.ScheduleUpload)
+                    return object;
+                var message = new $root.PB.ScheduleUpload();
+                switch (object.phase) {
+                case "BEGIN":
+                case 0:
+                    message.phase = 0;
+                    break;
+                case "DATA":
+                case 1:
+                    message.phase = 1;
+                    break;
+                case "COMMIT":
+                case 2:
+                    message.phase = 2;
+                    break;
+                }
+                if (object.size != null)
+                    message.size = object.size >>> 0;
+                if (object.offset != null)
+                    message.offset = object.offset >>> 0;
+                if (object.data != null)
+                    if (typeof object.data === "string")
+                        $util.base64.decode(object.data, message.data = $util.newBuffer($util.base64.length(object.data)), 0);
+                    else if (object.data.length)
+                        message.data = object.data;
+                if (object.crc32 != null)
+                    message.crc32 = object.crc32 >>> 0;
+                return message;
+            };
     
-                /**
-                 * Creates a plain object from a ModuleConfig message. Also converts values to other types if specified.
-                 * @function toObject
-                 * @memberof PB.SplitflapConfig.ModuleConfig
-                 * @static
-                 * @param {PB.SplitflapConfig.ModuleConfig} message ModuleConfig
-                 * @param {$protobuf.IConversionOptions} [options] Conversion options
-                 * @returns {Object.<string,*>} Plain object
-                 */
-                ModuleConfig.toObject = function toObject(message, options) {
-                    if (!options)
-                        options = {};
-                    var object = {};
-                    if (options.defaults) {
-                        object.targetFlapIndex = 0;
-                        object.movementNonce = 0;
-                        object.resetNonce = 0;
+            /**
+             * Creates a plain object from a ScheduleUpload message. Also converts values to other types if specified.
+             * @function toObject
+             * @memberof PB.ScheduleUpload
+             * @static
+             * @param {PB.ScheduleUpload} message ScheduleUpload
+             * @param {$protobuf.IConversionOptions} [options] Conversion options
+             * @returns {Object.<string,*>} Plain object
+             */
+            ScheduleUpload.toObject = function toObject(message, options) {
+                if (!options)
+                    options = {};
+                var object = {};
+                if (options.defaults) {
+                    object.phase = options.enums === String ? "BEGIN" : 0;
+                    object.size = 0;
+                    object.offset = 0;
+                    if (options.bytes === String)
+                        object.data = "";
+                    else {
+                        object.data = [];
+                        if (options.bytes !== Array)
+                            object.data = $util.newBuffer(object.data);
                     }
-                    if (message.targetFlapIndex != null && message.hasOwnProperty("targetFlapIndex"))
-                        object.targetFlapIndex = message.targetFlapIndex;
-                    if (message.movementNonce != null && message.hasOwnProperty("movementNonce"))
-                        object.movementNonce = message.movementNonce;
-                    if (message.resetNonce != null && message.hasOwnProperty("resetNonce"))
-                        object.resetNonce = message.resetNonce;
-                    return object;
-                };
+                    object.crc32 = 0;
+                }
+                if (message.phase != null && message.hasOwnProperty("phase"))
+                    object.phase = options.enums === String ? $root.PB.ScheduleUpload.Phase[message.phase] : message.phase;
+                if (message.size != null && message.hasOwnProperty("size"))
+                    object.size = message.size;
+                if (message.offset != null && message.hasOwnProperty("offset"))
+                    object.offset = message.offset;
+                if (message.data != null && message.hasOwnProperty("data"))
+                    object.data = options.bytes === String ? $util.base64.encode(message.data, 0, message.data.length) : options.bytes === Array ? Array.prototype.slice.call(message.data) : message.data;
+                if (message.crc32 != null && message.hasOwnProperty("crc32"))
+                    object.crc32 = message.crc32;
+                return object;
+            };
     
-                /**
-                 * Converts this ModuleConfig to JSON.
-                 * @function toJSON
-                 * @memberof PB.SplitflapConfig.ModuleConfig
-                 * @instance
-                 * @returns {Object.<string,*>} JSON object
-                 */
-                ModuleConfig.prototype.toJSON = function toJSON() {
-                    return this.constructor.toObject(this, $protobuf.util.toJSONOptions);
-                };
+            /**
+             * Converts this ScheduleUpload to JSON.
+             * @function toJSON
+             * @memberof PB.ScheduleUpload
+             * @instance
+             * @returns {Object.<string,*>} JSON object
+             */
+            ScheduleUpload.prototype.toJSON = function toJSON() {
+                return this.constructor.toObject(this, $protobuf.util.toJSONOptions);
+            };
     
-                return ModuleConfig;
+            /**
+             * Phase enum.
+             * @name PB.ScheduleUpload.Phase
+             * @enum {number}
+             * @property {number} BEGIN=0 BEGIN value
+             * @property {number} DATA=1 DATA value
+             * @property {number} COMMIT=2 COMMIT value
+             */
+            ScheduleUpload.Phase = (function() {
+                var valuesById = {}, values = Object.create(valuesById);
+                values[valuesById[0] = "BEGIN"] = 0;
+                values[valuesById[1] = "DATA"] = 1;
+                values[valuesById[2] = "COMMIT"] = 2;
+                return values;
             })();
     
-            return SplitflapConfig;
+            return ScheduleUpload;
         })();
     
         PB.ToSplitflap = (function() {
@@ -3045,6 +5019,11 @@
              * @property {number|null} [nonce] ToSplitflap nonce
              * @property {PB.ISplitflapCommand|null} [splitflapCommand] ToSplitflap splitflapCommand
              * @property {PB.ISplitflapConfig|null} [splitflapConfig] ToSplitflap splitflapConfig
+             * @property {PB.IRequestState|null} [requestState] ToSplitflap requestState
+             * @property {PB.IWindowConfig|null} [windowConfig] ToSplitflap windowConfig
+             * @property {PB.IBaudRateChange|null} [baudRateChange] ToSplitflap baudRateChange
+             * @property {PB.ISubscribe|null} [subscribe] ToSplitflap subscribe
+             * @property {PB.IScheduleUpload|null} [scheduleUpload] ToSplitflap scheduleUpload
              */
     
             /**
@@ -3086,17 +5065,57 @@
              */
             ToSplitflap.prototype.splitflapConfig = null;
     
+            /**
+             * ToSplitflap requestState.
+             * @member {PB.IRequestState|null|undefined} requestState
+             * @memberof PB.ToSplitflap
+             * @instance
+             */
+            ToSplitflap.prototype.requestState = null;
+    
+            /**
+             * ToSplitflap windowConfig.
+             * @member {PB.IWindowConfig|null|undefined} windowConfig
+             * @memberof PB.ToSplitflap
+             * @instance
+             */
+            ToSplitflap.prototype.windowConfig = null;
+    
+            /**
+             * ToSplitflap baudRateChange.
+             * @member {PB.IBaudRateChange|null|undefined} baudRateChange
+             * @memberof PB.ToSplitflap
+             * @instance
+             */
+            ToSplitflap.prototype.baudRateChange = null;
+    
+            /**
+             * ToSplitflap subscribe.
+             * @member {PB.ISubscribe|null|undefined} subscribe
+             * @memberof PB.ToSplitflap
+             * @instance
+             */
+            ToSplitflap.prototype.subscribe = null;
+    
+            /**
+             * ToSplitflap scheduleUpload.
+             * @member {PB.IScheduleUpload|null|undefined} scheduleUpload
+             * @memberof PB.ToSplitflap
+             * @instance
+             */
+            ToSplitflap.prototype.scheduleUpload = null;
+    
             // OneOf field names bound to virtual getters and setters
             var $oneOfFields;
     
             /**
              * ToSplitflap payload.
-             * @member {"splitflapCommand"|"splitflapConfig"|undefined} payload
+             * @member {"splitflapCommand"|"splitflapConfig"|"requestState"|"windowConfig"|"baudRateChange"|"subscribe"|"scheduleUpload"|undefined} payload
              * @memberof PB.ToSplitflap
              * @instance
              */
             Object.defineProperty(ToSplitflap.prototype, "payload", {
-                get: $util.oneOfGetter($oneOfFields = ["splitflapCommand", "splitflapConfig"]),
+                get: $util.oneOfGetter($oneOfFields = ["splitflapCommand", "splitflapConfig", "requestState", "windowConfig", "baudRateChange", "subscribe", "scheduleUpload"]),
                 set: $util.oneOfSetter($oneOfFields)
             });
     
@@ -3130,6 +5149,16 @@
                     $root.PB.SplitflapCommand.encode(message.splitflapCommand, writer.uint32(/* id 2, wireType 2 =*/18).fork()).ldelim();
                 if (message.splitflapConfig != null && Object.hasOwnProperty.call(message, "splitflapConfig"))
                     $root.PB.SplitflapConfig.encode(message.splitflapConfig, writer.uint32(/* id 3, wireType 2 =*/26).fork()).ldelim();
+                if (message.requestState != null && Object.hasOwnProperty.call(message, "requestState"))
+                    $root.PB.RequestState.encode(message.requestState, writer.uint32(/* id 4, wireType 2 =*/34).fork()).ldelim();
+                if (message.windowConfig != null && Object.hasOwnProperty.call(message, "windowConfig"))
+                    $root.PB.WindowConfig.encode(message.windowConfig, writer.uint32(/* id 5, wireType 2 =*/42).fork()).ldelim();
+                if (message.baudRateChange != null && Object.hasOwnProperty.call(message, "baudRateChange"))
+                    $root.PB.BaudRateChange.encode(message.baudRateChange, writer.uint32(/* id 6, wireType 2 =*/50).fork()).ldelim();
+                if (message.subscribe != null && Object.hasOwnProperty.call(message, "subscribe"))
+                    $root.PB.Subscribe.encode(message.subscribe, writer.uint32(/* id 7, wireType 2 =*/58).fork()).ldelim();
+                if (message.scheduleUpload != null && Object.hasOwnProperty.call(message, "scheduleUpload"))
+                    $root.PB.ScheduleUpload.encode(message.scheduleUpload, writer.uint32(/* id 8, wireType 2 =*/66).fork()).ldelim();
                 return writer;
             };
     
@@ -3173,6 +5202,21 @@
                     case 3:
                         message.splitflapConfig = $root.PB.SplitflapConfig.decode(reader, reader.uint32());
                         break;
+                    case 4:
+                        message.requestState = $root.PB.RequestState.decode(reader, reader.uint32());
+                        break;
+                    case 5:
+                        message.windowConfig = $root.PB.WindowConfig.decode(reader, reader.uint32());
+                        break;
+                    case 6:
+                        message.baudRateChange = $root.PB.BaudRateChange.decode(reader, reader.uint32());
+                        break;
+                    case 7:
+                        message.subscribe = $root.PB.Subscribe.decode(reader, reader.uint32());
+                        break;
+                    case 8:
+                        message.scheduleUpload = $root.PB.ScheduleUpload.decode(reader, reader.uint32());
+                        break;
                     default:
                         reader.skipType(tag & 7);
                         break;
@@ -3230,6 +5274,56 @@
                             return "splitflapConfig." + error;
                     }
                 }
+                if (message.requestState != null && message.hasOwnProperty("requestState")) {
+                    if (properties.payload === 1)
+                        return "payload: multiple values";
+                    properties.payload = 1;
+                    {
+                        var error = $root.PB.RequestState.verify(message.requestState);
+                        if (error)
+                            return "requestState." + error;
+                    }
+                }
+                if (message.windowConfig != null && message.hasOwnProperty("windowConfig")) {
+                    if (properties.payload === 1)
+                        return "payload: multiple values";
+                    properties.payload = 1;
+                    {
+                        var error = $root.PB.WindowConfig.verify(message.windowConfig);
+                        if (error)
+                            return "windowConfig." + error;
+                    }
+                }
+                if (message.baudRateChange != null && message.hasOwnProperty("baudRateChange")) {
+                    if (properties.payload === 1)
+                        return "payload: multiple values";
+                    properties.payload = 1;
+                    {
+                        var error = $root.PB.BaudRateChange.verify(message.baudRateChange);
+                        if (error)
+                            return "baudRateChange." + error;
+                    }
+                }
+                if (message.subscribe != null && message.hasOwnProperty("subscribe")) {
+                    if (properties.payload === 1)
+                        return "payload: multiple values";
+                    properties.payload = 1;
+                    {
+                        var error = $root.PB.Subscribe.verify(message.subscribe);
+                        if (error)
+                            return "subscribe." + error;
+                    }
+                }
+                if (message.scheduleUpload != null && message.hasOwnProperty("scheduleUpload")) {
+                    if (properties.payload === 1)
+                        return "payload: multiple values";
+                    properties.payload = 1;
+                    {
+                        var error = $root.PB.ScheduleUpload.verify(message.scheduleUpload);
+                        if (error)
+                            return "scheduleUpload." + error;
+                    }
+                }
                 return null;
             };
     
@@ -3257,6 +5351,31 @@
                         throw TypeError(".PB.ToSplitflap.splitflapConfig: object expected");
                     message.splitflapConfig = $root.PB.SplitflapConfig.fromObject(object.splitflapConfig);
                 }
+                if (object.requestState != null) {
+                    if (typeof object.requestState !== "object")
+                        throw TypeError(".PB.ToSplitflap.requestState: object expected");
+                    message.requestState = $root.PB.RequestState.fromObject(object.requestState);
+                }
+                if (object.windowConfig != null) {
+                    if (typeof object.windowConfig !== "object")
+                        throw TypeError(".PB.ToSplitflap.windowConfig: object expected");
+                    message.windowConfig = $root.PB.WindowConfig.fromObject(object.windowConfig);
+                }
+                if (object.baudRateChange != null) {
+                    if (typeof object.baudRateChange !== "object")
+                        throw TypeError(".PB.ToSplitflap.baudRateChange: object expected");
+                    message.baudRateChange = $root.PB.BaudRateChange.fromObject(object.baudRateChange);
+                }
+                if (object.subscribe != null) {
+                    if (typeof object.subscribe !== "object")
+                        throw TypeError(".PB.ToSplitflap.subscribe: object expected");
+                    message.subscribe = $root.PB.Subscribe.fromObject(object.subscribe);
+                }
+                if (object.scheduleUpload != null) {
+                    if (typeof object.scheduleUpload !== "object")
+                        throw TypeError(".PB.ToSplitflap.scheduleUpload: object expected");
+                    message.scheduleUpload = $root.PB.ScheduleUpload.fromObject(object.scheduleUpload);
+                }
                 return message;
             };
     
@@ -3287,6 +5406,31 @@
                     if (options.oneofs)
                         object.payload = "splitflapConfig";
                 }
+                if (message.requestState != null && message.hasOwnProperty("requestState")) {
+                    object.requestState = $root.PB.RequestState.toObject(message.requestState, options);
+                    if (options.oneofs)
+                        object.payload = "requestState";
+                }
+                if (message.windowConfig != null && message.hasOwnProperty("windowConfig")) {
+                    object.windowConfig = $root.PB.WindowConfig.toObject(message.windowConfig, options);
+                    if (options.oneofs)
+                        object.payload = "windowConfig";
+                }
+                if (message.baudRateChange != null && message.hasOwnProperty("baudRateChange")) {
+                    object.baudRateChange = $root.PB.BaudRateChange.toObject(message.baudRateChange, options);
+                    if (options.oneofs)
+                        object.payload = "baudRateChange";
+                }
+                if (message.subscribe != null && message.hasOwnProperty("subscribe")) {
+                    object.subscribe = $root.PB.Subscribe.toObject(message.subscribe, options);
+                    if (options.oneofs)
+                        object.payload = "subscribe";
+                }
+                if (message.scheduleUpload != null && message.hasOwnProperty("scheduleUpload")) {
+                    object.scheduleUpload = $root.PB.ScheduleUpload.toObject(message.scheduleUpload, options);
+                    if (options.oneofs)
+                        object.payload = "scheduleUpload";
+                }
                 return object;
             };
     
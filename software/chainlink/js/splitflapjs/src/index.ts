@@ -46,6 +46,9 @@ export class Splitflap {
                 this.buffer = Buffer.concat([this.buffer, data])
                 this.processBuffer()
             })
+
+            // Restart the transport before anything else is sent, so nothing is left over from a previous client
+            this.sendWindowConfig()
         } else {
             this.port = null
         }
@@ -164,14 +167,29 @@ export class Splitflap {
         message.nonce = this.lastNonce++
 
         // Encode before enqueueing to ensure messages don't change once they're queued
-        const payload = PB.ToSplitflap.encode(message).finish()
+        this.enqueue(message.nonce, PB.ToSplitflap.encode(message).finish())
+    }
+
+    /**
+     * Sends a WindowConfig selecting the stop-and-wait transport (window_size 1).
+     */
+    private sendWindowConfig(): void {
+        this.sendMessage(
+            PB.ToSplitflap.create({
+                windowConfig: PB.WindowConfig.create({
+                    windowSize: 1,
+                }),
+            }),
+        )
+    }
 
+    private enqueue(nonce: number, payload: Uint8Array): void {
         if (this.outgoingQueue.length > 10) {
             console.warn(`Splitflap outgoing queue overflowed! Dropping ${this.outgoingQueue.length} pending messages!`)
             this.outgoingQueue.length = 0
         }
         this.outgoingQueue.push({
-            nonce: message.nonce,
+            nonce: nonce,
             encodedToSplitflapPayload: payload,
         })
         this.serviceQueue()
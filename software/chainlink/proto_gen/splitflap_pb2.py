@@ -20,7 +20,7 @@ DESCRIPTOR = _descriptor.FileDescriptor(
   package='PB',
   syntax='proto3',
   serialized_options=None,
-  serialized_pb=_b('\n\x0fsplitflap.proto\x12\x02PB\x1a\x0cnanopb.proto\"\xee\x02\n\x0eSplitflapState\x12\x37\n\x07modules\x18\x01 \x03(\x0b\x32\x1e.PB.SplitflapState.ModuleStateB\x06\x92?\x03\x10\xff\x01\x1a\xa2\x02\n\x0bModuleState\x12\x33\n\x05state\x18\x01 \x01(\x0e\x32$.PB.SplitflapState.ModuleState.State\x12\x19\n\nflap_index\x18\x02 \x01(\rB\x05\x92?\x02\x38\x08\x12\x0e\n\x06moving\x18\x03 \x01(\x08\x12\x12\n\nhome_state\x18\x04 \x01(\x08\x12$\n\x15\x63ount_unexpected_home\x18\x05 \x01(\rB\x05\x92?\x02\x38\x08\x12 \n\x11\x63ount_missed_home\x18\x06 \x01(\rB\x05\x92?\x02\x38\x08\"W\n\x05State\x12\n\n\x06NORMAL\x10\x00\x12\x11\n\rLOOK_FOR_HOME\x10\x01\x12\x10\n\x0cSENSOR_ERROR\x10\x02\x12\t\n\x05PANIC\x10\x03\x12\x12\n\x0eSTATE_DISABLED\x10\x04\"\x1a\n\x03Log\x12\x13\n\x03msg\x18\x01 \x01(\tB\x06\x92?\x03p\xff\x01\"\x14\n\x03\x41\x63k\x12\r\n\x05nonce\x18\x01 \x01(\r\"\xa4\x05\n\x0fSupervisorState\x12\x15\n\ruptime_millis\x18\x01 \x01(\r\x12(\n\x05state\x18\x02 \x01(\x0e\x32\x19.PB.SupervisorState.State\x12\x44\n\x0epower_channels\x18\x03 \x03(\x0b\x32%.PB.SupervisorState.PowerChannelStateB\x05\x92?\x02\x10\x05\x12\x31\n\nfault_info\x18\x04 \x01(\x0b\x32\x1d.PB.SupervisorState.FaultInfo\x1aL\n\x11PowerChannelState\x12\x15\n\rvoltage_volts\x18\x01 \x01(\x02\x12\x14\n\x0c\x63urrent_amps\x18\x02 \x01(\x02\x12\n\n\x02on\x18\x03 \x01(\x08\x1a\x81\x02\n\tFaultInfo\x12\x35\n\x04type\x18\x01 \x01(\x0e\x32\'.PB.SupervisorState.FaultInfo.FaultType\x12\x13\n\x03msg\x18\x02 \x01(\tB\x06\x92?\x03p\xff\x01\x12\x11\n\tts_millis\x18\x03 \x01(\r\"\x94\x01\n\tFaultType\x12\x0b\n\x07UNKNOWN\x10\x00\x12\x08\n\x04NONE\x10\x01\x12\x1e\n\x1aINRUSH_CURRENT_NOT_SETTLED\x10\x02\x12\x16\n\x12SPLITFLAP_SHUTDOWN\x10\x03\x12\x10\n\x0cOUT_OF_RANGE\x10\x04\x12\x10\n\x0cOVER_CURRENT\x10\x05\x12\x14\n\x10UNEXPECTED_POWER\x10\x06\"\x84\x01\n\x05State\x12\x0b\n\x07UNKNOWN\x10\x00\x12\x1b\n\x17STARTING_VERIFY_PSU_OFF\x10\x01\x12\x1c\n\x18STARTING_VERIFY_VOLTAGES\x10\x02\x12\x1c\n\x18STARTING_ENABLE_CHANNELS\x10\x03\x12\n\n\x06NORMAL\x10\x04\x12\t\n\x05\x46\x41ULT\x10\x05\"\xaa\x01\n\rFromSplitflap\x12-\n\x0fsplitflap_state\x18\x01 \x01(\x0b\x32\x12.PB.SplitflapStateH\x00\x12\x16\n\x03log\x18\x02 \x01(\x0b\x32\x07.PB.LogH\x00\x12\x16\n\x03\x61\x63k\x18\x03 \x01(\x0b\x32\x07.PB.AckH\x00\x12/\n\x10supervisor_state\x18\x04 \x01(\x0b\x32\x13.PB.SupervisorStateH\x00\x42\t\n\x07payload\"\xeb\x01\n\x10SplitflapCommand\x12;\n\x07modules\x18\x02 \x03(\x0b\x32\".PB.SplitflapCommand.ModuleCommandB\x06\x92?\x03\x10\xff\x01\x1a\x99\x01\n\rModuleCommand\x12\x39\n\x06\x61\x63tion\x18\x01 \x01(\x0e\x32).PB.SplitflapCommand.ModuleCommand.Action\x12\x14\n\x05param\x18\x02 \x01(\rB\x05\x92?\x02\x38\x08\"7\n\x06\x41\x63tion\x12\t\n\x05NO_OP\x10\x00\x12\x0e\n\nGO_TO_FLAP\x10\x01\x12\x12\n\x0eRESET_AND_HOME\x10\x02\"\xb9\x01\n\x0fSplitflapConfig\x12\x39\n\x07modules\x18\x01 \x03(\x0b\x32 .PB.SplitflapConfig.ModuleConfigB\x06\x92?\x03\x10\xff\x01\x1ak\n\x0cModuleConfig\x12 \n\x11target_flap_index\x18\x01 \x01(\rB\x05\x92?\x02\x38\x08\x12\x1d\n\x0emovement_nonce\x18\x02 \x01(\rB\x05\x92?\x02\x38\x08\x12\x1a\n\x0breset_nonce\x18\x03 \x01(\rB\x05\x92?\x02\x38\x08\"\x0e\n\x0cRequestState\"\xb6\x01\n\x0bToSplitflap\x12\r\n\x05nonce\x18\x01 \x01(\r\x12\x31\n\x11splitflap_command\x18\x02 \x01(\x0b\x32\x14.PB.SplitflapCommandH\x00\x12/\n\x10splitflap_config\x18\x03 \x01(\x0b\x32\x13.PB.SplitflapConfigH\x00\x12)\n\rrequest_state\x18\x04 \x01(\x0b\x32\x10.PB.RequestStateH\x00\x42\t\n\x07payloadb\x06proto3')
+  serialized_pb=_b('\n\x0fsplitflap.proto\x12\x02PB\x1a\x0cnanopb.proto\"\x8a\x03\n\x0eSplitflapState\x12\x36\n\x07modules\x18\x01 \x03(\x0b\x32\x1e.PB.SplitflapState.ModuleStateB\x05\x92?\x02\x18\x01\x12\x1b\n\x0cmodule_start\x18\x02 \x01(\rB\x05\x92?\x02\x38\x08\x1a\xa2\x02\n\x0bModuleState\x12\x33\n\x05state\x18\x01 \x01(\x0e\x32$.PB.SplitflapState.ModuleState.State\x12\x19\n\nflap_index\x18\x02 \x01(\rB\x05\x92?\x02\x38\x08\x12\x0e\n\x06moving\x18\x03 \x01(\x08\x12\x12\n\nhome_state\x18\x04 \x01(\x08\x12$\n\x15\x63ount_unexpected_home\x18\x05 \x01(\rB\x05\x92?\x02\x38\x08\x12 \n\x11\x63ount_missed_home\x18\x06 \x01(\rB\x05\x92?\x02\x38\x08\"W\n\x05State\x12\n\n\x06NORMAL\x10\x00\x12\x11\n\rLOOK_FOR_HOME\x10\x01\x12\x10\n\x0cSENSOR_ERROR\x10\x02\x12\t\n\x05PANIC\x10\x03\x12\x12\n\x0eSTATE_DISABLED\x10\x04\"\x1a\n\x03Log\x12\x13\n\x03msg\x18\x01 \x01(\tB\x06\x92?\x03p\xff\x01\"b\n\x03\x41\x63k\x12\r\n\x05nonce\x18\x01 \x01(\r\x12\x18\n\x10\x63umulative_nonce\x18\x02 \x01(\r\x12\x16\n\x0eselective_mask\x18\x03 \x01(\r\x12\x1a\n\x0bwindow_size\x18\x04 \x01(\rB\x05\x92?\x02\x38\x08\"\x95\x01\n\x10\x42\x61udRateResponse\x12+\n\x06status\x18\x01 \x01(\x0e\x32\x1b.PB.BaudRateResponse.Status\x12\x11\n\tbaud_rate\x18\x02 \x01(\r\"A\n\x06Status\x12\x0c\n\x08\x41\x43\x43\x45PTED\x10\x00\x12\x0c\n\x08REJECTED\x10\x01\x12\r\n\tCONFIRMED\x10\x02\x12\x0c\n\x08REVERTED\x10\x03\"\xbd\x02\n\x16ScheduleUploadResponse\x12\'\n\x05phase\x18\x01 \x01(\x0e\x32\x18.PB.ScheduleUpload.Phase\x12\x31\n\x06status\x18\x02 \x01(\x0e\x32!.PB.ScheduleUploadResponse.Status\x12\x13\n\x0bnext_offset\x18\x03 \x01(\r\x12\x14\n\x0crecord_count\x18\x04 \x01(\r\"\x9b\x01\n\x06Status\x12\x06\n\x02OK\x10\x00\x12\x10\n\x0cNO_PARTITION\x10\x01\x12\r\n\tTOO_LARGE\x10\x02\x12\x0f\n\x0bNOT_STARTED\x10\x03\x12\x0e\n\nBAD_OFFSET\x10\x04\x12\x0e\n\nINCOMPLETE\x10\x05\x12\x10\n\x0c\x43RC_MISMATCH\x10\x06\x12\x14\n\x10INVALID_SCHEDULE\x10\x07\x12\x0f\n\x0b\x46LASH_ERROR\x10\x08\"\xa4\x05\n\x0fSupervisorState\x12\x15\n\ruptime_millis\x18\x01 \x01(\r\x12(\n\x05state\x18\x02 \x01(\x0e\x32\x19.PB.SupervisorState.State\x12\x44\n\x0epower_channels\x18\x03 \x03(\x0b\x32%.PB.SupervisorState.PowerChannelStateB\x05\x92?\x02\x10\x05\x12\x31\n\nfault_info\x18\x04 \x01(\x0b\x32\x1d.PB.SupervisorState.FaultInfo\x1aL\n\x11PowerChannelState\x12\x15\n\rvoltage_volts\x18\x01 \x01(\x02\x12\x14\n\x0c\x63urrent_amps\x18\x02 \x01(\x02\x12\n\n\x02on\x18\x03 \x01(\x08\x1a\x81\x02\n\tFaultInfo\x12\x35\n\x04type\x18\x01 \x01(\x0e\x32\'.PB.SupervisorState.FaultInfo.FaultType\x12\x13\n\x03msg\x18\x02 \x01(\tB\x06\x92?\x03p\xff\x01\x12\x11\n\tts_millis\x18\x03 \x01(\r\"\x94\x01\n\tFaultType\x12\x0b\n\x07UNKNOWN\x10\x00\x12\x08\n\x04NONE\x10\x01\x12\x1e\n\x1aINRUSH_CURRENT_NOT_SETTLED\x10\x02\x12\x16\n\x12SPLITFLAP_SHUTDOWN\x10\x03\x12\x10\n\x0cOUT_OF_RANGE\x10\x04\x12\x10\n\x0cOVER_CURRENT\x10\x05\x12\x14\n\x10UNEXPECTED_POWER\x10\x06\"\x84\x01\n\x05State\x12\x0b\n\x07UNKNOWN\x10\x00\x12\x1b\n\x17STARTING_VERIFY_PSU_OFF\x10\x01\x12\x1c\n\x18STARTING_VERIFY_VOLTAGES\x10\x02\x12\x1c\n\x18STARTING_ENABLE_CHANNELS\x10\x03\x12\n\n\x06NORMAL\x10\x04\x12\t\n\x05\x46\x41ULT\x10\x05\"\x9e\x02\n\rFromSplitflap\x12-\n\x0fsplitflap_state\x18\x01 \x01(\x0b\x32\x12.PB.SplitflapStateH\x00\x12\x16\n\x03log\x18\x02 \x01(\x0b\x32\x07.PB.LogH\x00\x12\x16\n\x03\x61\x63k\x18\x03 \x01(\x0b\x32\x07.PB.AckH\x00\x12/\n\x10supervisor_state\x18\x04 \x01(\x0b\x32\x13.PB.SupervisorStateH\x00\x12\x32\n\x12\x62\x61ud_rate_response\x18\x05 \x01(\x0b\x32\x14.PB.BaudRateResponseH\x00\x12>\n\x18schedule_upload_response\x18\x06 \x01(\x0b\x32\x1a.PB.ScheduleUploadResponseH\x00\x42\t\n\x07payload\"\xea\x01\n\x10SplitflapCommand\x12:\n\x07modules\x18\x02 \x03(\x0b\x32\".PB.SplitflapCommand.ModuleCommandB\x05\x92?\x02\x18\x01\x1a\x99\x01\n\rModuleCommand\x12\x39\n\x06\x61\x63tion\x18\x01 \x01(\x0e\x32).PB.SplitflapCommand.ModuleCommand.Action\x12\x14\n\x05param\x18\x02 \x01(\rB\x05\x92?\x02\x38\x08\"7\n\x06\x41\x63tion\x12\t\n\x05NO_OP\x10\x00\x12\x0e\n\nGO_TO_FLAP\x10\x01\x12\x12\n\x0eRESET_AND_HOME\x10\x02\"\xb8\x01\n\x0fSplitflapConfig\x12\x38\n\x07modules\x18\x01 \x03(\x0b\x32 .PB.SplitflapConfig.ModuleConfigB\x05\x92?\x02\x18\x01\x1ak\n\x0cModuleConfig\x12 \n\x11target_flap_index\x18\x01 \x01(\rB\x05\x92?\x02\x38\x08\x12\x1d\n\x0emovement_nonce\x18\x02 \x01(\rB\x05\x92?\x02\x38\x08\x12\x1a\n\x0breset_nonce\x18\x03 \x01(\rB\x05\x92?\x02\x38\x08\"\x0e\n\x0cRequestState\"\x99\x01\n\tSubscribe\x12\x1b\n\x13min_interval_millis\x18\x01 \x01(\r\x12!\n\x19heartbeat_interval_millis\x18\x02 \x01(\r\x12\x1b\n\x0cmodule_start\x18\x03 \x01(\rB\x05\x92?\x02\x38\x08\x12\x1b\n\x0cmodule_count\x18\x04 \x01(\rB\x05\x92?\x02\x38\x08\x12\x12\n\nfield_mask\x18\x05 \x01(\r\"*\n\x0cWindowConfig\x12\x1a\n\x0bwindow_size\x18\x01 \x01(\rB\x05\x92?\x02\x38\x08\"o\n\x0e\x42\x61udRateChange\x12\'\n\x05phase\x18\x01 \x01(\x0e\x32\x18.PB.BaudRateChange.Phase\x12\x11\n\tbaud_rate\x18\x02 \x01(\r\"!\n\x05Phase\x12\x0b\n\x07PROPOSE\x10\x00\x12\x0b\n\x07\x43ONFIRM\x10\x01\"\xa6\x01\n\x0eScheduleUpload\x12\'\n\x05phase\x18\x01 \x01(\x0e\x32\x18.PB.ScheduleUpload.Phase\x12\x0c\n\x04size\x18\x02 \x01(\r\x12\x0e\n\x06offset\x18\x03 \x01(\r\x12\x14\n\x04\x64\x61ta\x18\x04 \x01(\x0c\x42\x06\x92?\x03\x08\x80\x02\x12\r\n\x05\x63rc32\x18\x05 \x01(\r\"(\n\x05Phase\x12\t\n\x05\x42\x45GIN\x10\x00\x12\x08\n\x04\x44\x41TA\x10\x01\x12\n\n\x06\x43OMMIT\x10\x02\"\xec\x02\n\x0bToSplitflap\x12\r\n\x05nonce\x18\x01 \x01(\r\x12\x31\n\x11splitflap_command\x18\x02 \x01(\x0b\x32\x14.PB.SplitflapCommandH\x00\x12/\n\x10splitflap_config\x18\x03 \x01(\x0b\x32\x13.PB.SplitflapConfigH\x00\x12)\n\rrequest_state\x18\x04 \x01(\x0b\x32\x10.PB.RequestStateH\x00\x12)\n\rwindow_config\x18\x05 \x01(\x0b\x32\x10.PB.WindowConfigH\x00\x12.\n\x10\x62\x61ud_rate_change\x18\x06 \x01(\x0b\x32\x12.PB.BaudRateChangeH\x00\x12\"\n\tsubscribe\x18\x07 \x01(\x0b\x32\r.PB.SubscribeH\x00\x12-\n\x0fschedule_upload\x18\x08 \x01(\x0b\x32\x12.PB.ScheduleUploadH\x00:\x06\x92?\x03\xb0\x01\x01\x42\t\n\x07payloadb\x06proto3')
   ,
   dependencies=[nanopb__pb2.DESCRIPTOR,])
 
@@ -55,11 +55,91 @@ _SPLITFLAPSTATE_MODULESTATE_STATE = _descriptor.EnumDescriptor(
   ],
   containing_type=None,
   serialized_options=None,
-  serialized_start=317,
-  serialized_end=404,
+  serialized_start=345,
+  serialized_end=432,
 )
 _sym_db.RegisterEnumDescriptor(_SPLITFLAPSTATE_MODULESTATE_STATE)
 
+_BAUDRATERESPONSE_STATUS = _descriptor.EnumDescriptor(
+  name='Status',
+  full_name='PB.BaudRateResponse.Status',
+  filename=None,
+  file=DESCRIPTOR,
+  values=[
+    _descriptor.EnumValueDescriptor(
+      name='ACCEPTED', index=0, number=0,
+      serialized_options=None,
+      type=None),
+    _descriptor.EnumValueDescriptor(
+      name='REJECTED', index=1, number=1,
+      serialized_options=None,
+      type=None),
+    _descriptor.EnumValueDescriptor(
+      name='CONFIRMED', index=2, number=2,
+      serialized_options=None,
+      type=None),
+    _descriptor.EnumValueDescriptor(
+      name='REVERTED', index=3, number=3,
+      serialized_options=None,
+      type=None),
+  ],
+  containing_type=None,
+  serialized_options=None,
+  serialized_start=647,
+  serialized_end=712,
+)
+_sym_db.RegisterEnumDescriptor(_BAUDRATERESPONSE_STATUS)
+
+_SCHEDULEUPLOADRESPONSE_STATUS = _descriptor.EnumDescriptor(
+  name='Status',
+  full_name='PB.ScheduleUploadResponse.Status',
+  filename=None,
+  file=DESCRIPTOR,
+  values=[
+    _descriptor.EnumValueDescriptor(
+      name='OK', index=0, number=0,
+      serialized_options=None,
+      type=None),
+    _descriptor.EnumValueDescriptor(
+      name='NO_PARTITION', index=1, number=1,
+      serialized_options=None,
+      type=None),
+    _descriptor.EnumValueDescriptor(
+      name='TOO_LARGE', index=2, number=2,
+      serialized_options=None,
+      type=None),
+    _descriptor.EnumValueDescriptor(
+      name='NOT_STARTED', index=3, number=3,
+      serialized_options=None,
+      type=None),
+    _descriptor.EnumValueDescriptor(
+      name='BAD_OFFSET', index=4, number=4,
+      serialized_options=None,
+      type=None),
+    _descriptor.EnumValueDescriptor(
+      name='INCOMPLETE', index=5, number=5,
+      serialized_options=None,
+      type=None),
+    _descriptor.EnumValueDescriptor(
+      name='CRC_MISMATCH', index=6, number=6,
+      serialized_options=None,
+      type=None),
+    _descriptor.EnumValueDescriptor(
+      name='INVALID_SCHEDULE', index=7, number=7,
+      serialized_options=None,
+      type=None),
+    _descriptor.EnumValueDescriptor(
+      name='FLASH_ERROR', index=8, number=8,
+      serialized_options=None,
+      type=None),
+  ],
+  containing_type=None,
+  serialized_options=None,
+  serialized_start=877,
+  serialized_end=1032,
+)
+_sym_db.RegisterEnumDescriptor(_SCHEDULEUPLOADRESPONSE_STATUS)
+
 _SUPERVISORSTATE_FAULTINFO_FAULTTYPE = _descriptor.EnumDescriptor(
   name='FaultType',
   full_name='PB.SupervisorState.FaultInfo.FaultType',
@@ -97,8 +177,8 @@ _SUPERVISORSTATE_FAULTINFO_FAULTTYPE = _descriptor.EnumDescriptor(
   ],
   containing_type=None,
   serialized_options=None,
-  serialized_start=850,
-  serialized_end=998,
+  serialized_start=1428,
+  serialized_end=1576,
 )
 _sym_db.RegisterEnumDescriptor(_SUPERVISORSTATE_FAULTINFO_FAULTTYPE)
 
@@ -135,8 +215,8 @@ _SUPERVISORSTATE_STATE = _descriptor.EnumDescriptor(
   ],
   containing_type=None,
   serialized_options=None,
-  serialized_start=1001,
-  serialized_end=1133,
+  serialized_start=1579,
+  serialized_end=1711,
 )
 _sym_db.RegisterEnumDescriptor(_SUPERVISORSTATE_STATE)
 
@@ -161,11 +241,59 @@ _SPLITFLAPCOMMAND_MODULECOMMAND_ACTION = _descriptor.EnumDescriptor(
   ],
   containing_type=None,
   serialized_options=None,
-  serialized_start=1489,
-  serialized_end=1544,
+  serialized_start=2182,
+  serialized_end=2237,
 )
 _sym_db.RegisterEnumDescriptor(_SPLITFLAPCOMMAND_MODULECOMMAND_ACTION)
 
+_BAUDRATECHANGE_PHASE = _descriptor.EnumDescriptor(
+  name='Phase',
+  full_name='PB.BaudRateChange.Phase',
+  filename=None,
+  file=DESCRIPTOR,
+  values=[
+    _descriptor.EnumValueDescriptor(
+      name='PROPOSE', index=0, number=0,
+      serialized_options=None,
+      type=None),
+    _descriptor.EnumValueDescriptor(
+      name='CONFIRM', index=1, number=1,
+      serialized_options=None,
+      type=None),
+  ],
+  containing_type=None,
+  serialized_options=None,
+  serialized_start=2720,
+  serialized_end=2753,
+)
+_sym_db.RegisterEnumDescriptor(_BAUDRATECHANGE_PHASE)
+
+_SCHEDULEUPLOAD_PHASE = _descriptor.EnumDescriptor(
+  name='Phase',
+  full_name='PB.ScheduleUpload.Phase',
+  filename=None,
+  file=DESCRIPTOR,
+  values=[
+    _descriptor.EnumValueDescriptor(
+      name='BEGIN', index=0, number=0,
+      serialized_options=None,
+      type=None),
+    _descriptor.EnumValueDescriptor(
+      name='DATA', index=1, number=1,
+      serialized_options=None,
+      type=None),
+    _descriptor.EnumValueDescriptor(
+      name='COMMIT', index=2, number=2,
+      serialized_options=None,
+      type=None),
+  ],
+  containing_type=None,
+  serialized_options=None,
+  serialized_start=2882,
+  serialized_end=2922,
+)
+_sym_db.RegisterEnumDescriptor(_SCHEDULEUPLOAD_PHASE)
+
 
 _SPLITFLAPSTATE_MODULESTATE = _descriptor.Descriptor(
   name='ModuleState',
@@ -229,8 +357,8 @@ _SPLITFLAPSTATE_MODULESTATE = _descriptor.Descriptor(
   extension_ranges=[],
   oneofs=[
   ],
-  serialized_start=114,
-  serialized_end=404,
+  serialized_start=142,
+  serialized_end=432,
 )
 
 _SPLITFLAPSTATE = _descriptor.Descriptor(
@@ -246,7 +374,14 @@ _SPLITFLAPSTATE = _descriptor.Descriptor(
       has_default_value=False, default_value=[],
       message_type=None, enum_type=None, containing_type=None,
       is_extension=False, extension_scope=None,
-      serialized_options=_b('\222?\003\020\377\001'), file=DESCRIPTOR),
+      serialized_options=_b('\222?\002\030\001'), file=DESCRIPTOR),
+    _descriptor.FieldDescriptor(
+      name='module_start', full_name='PB.SplitflapState.module_start', index=1,
+      number=2, type=13, cpp_type=3, label=1,
+      has_default_value=False, default_value=0,
+      message_type=None, enum_type=None, containing_type=None,
+      is_extension=False, extension_scope=None,
+      serialized_options=_b('\222?\0028\010'), file=DESCRIPTOR),
   ],
   extensions=[
   ],
@@ -260,7 +395,7 @@ _SPLITFLAPSTATE = _descriptor.Descriptor(
   oneofs=[
   ],
   serialized_start=38,
-  serialized_end=404,
+  serialized_end=432,
 )
 
 
@@ -290,8 +425,8 @@ _LOG = _descriptor.Descriptor(
   extension_ranges=[],
   oneofs=[
   ],
-  serialized_start=406,
-  serialized_end=432,
+  serialized_start=434,
+  serialized_end=460,
 )
 
 
@@ -309,6 +444,27 @@ _ACK = _descriptor.Descriptor(
       message_type=None, enum_type=None, containing_type=None,
       is_extension=False, extension_scope=None,
       serialized_options=None, file=DESCRIPTOR),
+    _descriptor.FieldDescriptor(
+      name='cumulative_nonce', full_name='PB.Ack.cumulative_nonce', index=1,
+      number=2, type=13, cpp_type=3, label=1,
+      has_default_value=False, default_value=0,
+      message_type=None, enum_type=None, containing_type=None,
+      is_extension=False, extension_scope=None,
+      serialized_options=None, file=DESCRIPTOR),
+    _descriptor.FieldDescriptor(
+      name='selective_mask', full_name='PB.Ack.selective_mask', index=2,
+      number=3, type=13, cpp_type=3, label=1,
+      has_default_value=False, default_value=0,
+      message_type=None, enum_type=None, containing_type=None,
+      is_extension=False, extension_scope=None,
+      serialized_options=None, file=DESCRIPTOR),
+    _descriptor.FieldDescriptor(
+      name='window_size', full_name='PB.Ack.window_size', index=3,
+      number=4, type=13, cpp_type=3, label=1,
+      has_default_value=False, default_value=0,
+      message_type=None, enum_type=None, containing_type=None,
+      is_extension=False, extension_scope=None,
+      serialized_options=_b('\222?\0028\010'), file=DESCRIPTOR),
   ],
   extensions=[
   ],
@@ -321,8 +477,100 @@ _ACK = _descriptor.Descriptor(
   extension_ranges=[],
   oneofs=[
   ],
-  serialized_start=434,
-  serialized_end=454,
+  serialized_start=462,
+  serialized_end=560,
+)
+
+
+_BAUDRATERESPONSE = _descriptor.Descriptor(
+  name='BaudRateResponse',
+  full_name='PB.BaudRateResponse',
+  filename=None,
+  file=DESCRIPTOR,
+  containing_type=None,
+  fields=[
+    _descriptor.FieldDescriptor(
+      name='status', full_name='PB.BaudRateResponse.status', index=0,
+      number=1, type=14, cpp_type=8, label=1,
+      has_default_value=False, default_value=0,
+      message_type=None, enum_type=None, containing_type=None,
+      is_extension=False, extension_scope=None,
+      serialized_options=None, file=DESCRIPTOR),
+    _descriptor.FieldDescriptor(
+      name='baud_rate', full_name='PB.BaudRateResponse.baud_rate', index=1,
+      number=2, type=13, cpp_type=3, label=1,
+      has_default_value=False, default_value=0,
+      message_type=None, enum_type=None, containing_type=None,
+      is_extension=False, extension_scope=None,
+      serialized_options=None, file=DESCRIPTOR),
+  ],
+  extensions=[
+  ],
+  nested_types=[],
+  enum_types=[
+    _BAUDRATERESPONSE_STATUS,
+  ],
+  serialized_options=None,
+  is_extendable=False,
+  syntax='proto3',
+  extension_ranges=[],
+  oneofs=[
+  ],
+  serialized_start=563,
+  serialized_end=712,
+)
+
+
+_SCHEDULEUPLOADRESPONSE = _descriptor.Descriptor(
+  name='ScheduleUploadResponse',
+  full_name='PB.ScheduleUploadResponse',
+  filename=None,
+  file=DESCRIPTOR,
+  containing_type=None,
+  fields=[
+    _descriptor.FieldDescriptor(
+      name='phase', full_name='PB.ScheduleUploadResponse.phase', index=0,
+      number=1, type=14, cpp_type=8, label=1,
+      has_default_value=False, default_value=0,
+      message_type=None, enum_type=None, containing_type=None,
+      is_extension=False, extension_scope=None,
+      serialized_options=None, file=DESCRIPTOR),
+    _descriptor.FieldDescriptor(
+      name='status', full_name='PB.ScheduleUploadResponse.status', index=1,
+      number=2, type=14, cpp_type=8, label=1,
+      has_default_value=False, default_value=0,
+      message_type=None, enum_type=None, containing_type=None,
+      is_extension=False, extension_scope=None,
+      serialized_options=None, file=DESCRIPTOR),
+    _descriptor.FieldDescriptor(
+      name='next_offset', full_name='PB.ScheduleUploadResponse.next_offset', index=2,
+      number=3, type=13, cpp_type=3, label=1,
+      has_default_value=False, default_value=0,
+      message_type=None, enum_type=None, containing_type=None,
+      is_extension=False, extension_scope=None,
+      serialized_options=None, file=DESCRIPTOR),
+    _descriptor.FieldDescriptor(
+      name='record_count', full_name='PB.ScheduleUploadResponse.record_count', index=3,
+      number=4, type=13, cpp_type=3, label=1,
+      has_default_value=False, default_value=0,
+      message_type=None, enum_type=None, containing_type=None,
+      is_extension=False, extension_scope=None,
+      serialized_options=None, file=DESCRIPTOR),
+  ],
+  extensions=[
+  ],
+  nested_types=[],
+  enum_types=[
+    _SCHEDULEUPLOADRESPONSE_STATUS,
+  ],
+  serialized_options=None,
+  is_extendable=False,
+  syntax='proto3',
+  extension_ranges=[],
+  oneofs=[
+  ],
+  serialized_start=715,
+  serialized_end=1032,
 )
 
 
@@ -366,8 +614,8 @@ _SUPERVISORSTATE_POWERCHANNELSTATE = _descriptor.Descriptor(
   extension_ranges=[],
   oneofs=[
   ],
-  serialized_start=662,
-  serialized_end=738,
+  serialized_start=1240,
+  serialized_end=1316,
 )
 
 _SUPERVISORSTATE_FAULTINFO = _descriptor.Descriptor(
@@ -411,8 +659,8 @@ _SUPERVISORSTATE_FAULTINFO = _descriptor.Descriptor(
   extension_ranges=[],
   oneofs=[
   ],
-  serialized_start=741,
-  serialized_end=998,
+  serialized_start=1319,
+  serialized_end=1576,
 )
 
 _SUPERVISORSTATE = _descriptor.Descriptor(
@@ -463,8 +711,8 @@ _SUPERVISORSTATE = _descriptor.Descriptor(
   extension_ranges=[],
   oneofs=[
   ],
-  serialized_start=457,
-  serialized_end=1133,
+  serialized_start=1035,
+  serialized_end=1711,
 )
 
 
@@ -503,6 +751,20 @@ _FROMSPLITFLAP = _descriptor.Descriptor(
       message_type=None, enum_type=None, containing_type=None,
       is_extension=False, extension_scope=None,
       serialized_options=None, file=DESCRIPTOR),
+    _descriptor.FieldDescriptor(
+      name='baud_rate_response', full_name='PB.FromSplitflap.baud_rate_response', index=4,
+      number=5, type=11, cpp_type=10, label=1,
+      has_default_value=False, default_value=None,
+      message_type=None, enum_type=None, containing_type=None,
+      is_extension=False, extension_scope=None,
+      serialized_options=None, file=DESCRIPTOR),
+    _descriptor.FieldDescriptor(
+      name='schedule_upload_response', full_name='PB.FromSplitflap.schedule_upload_response', index=5,
+      number=6, type=11, cpp_type=10, label=1,
+      has_default_value=False, default_value=None,
+      message_type=None, enum_type=None, containing_type=None,
+      is_extension=False, extension_scope=None,
+      serialized_options=None, file=DESCRIPTOR),
   ],
   extensions=[
   ],
@@ -518,8 +780,8 @@ _FROMSPLITFLAP = _descriptor.Descriptor(
       name='payload', full_name='PB.FromSplitflap.payload',
       index=0, containing_type=None, fields=[]),
   ],
-  serialized_start=1136,
-  serialized_end=1306,
+  serialized_start=1714,
+  serialized_end=2000,
 )
 
 
@@ -557,8 +819,8 @@ _SPLITFLAPCOMMAND_MODULECOMMAND = _descriptor.Descriptor(
   extension_ranges=[],
   oneofs=[
   ],
-  serialized_start=1391,
-  serialized_end=1544,
+  serialized_start=2084,
+  serialized_end=2237,
 )
 
 _SPLITFLAPCOMMAND = _descriptor.Descriptor(
@@ -574,7 +836,7 @@ _SPLITFLAPCOMMAND = _descriptor.Descriptor(
       has_default_value=False, default_value=[],
       message_type=None, enum_type=None, containing_type=None,
       is_extension=False, extension_scope=None,
-      serialized_options=_b('\222?\003\020\377\001'), file=DESCRIPTOR),
+      serialized_options=_b('\222?\002\030\001'), file=DESCRIPTOR),
   ],
   extensions=[
   ],
@@ -587,8 +849,8 @@ _SPLITFLAPCOMMAND = _descriptor.Descriptor(
   extension_ranges=[],
   oneofs=[
   ],
-  serialized_start=1309,
-  serialized_end=1544,
+  serialized_start=2003,
+  serialized_end=2237,
 )
 
 
@@ -632,8 +894,8 @@ _SPLITFLAPCONFIG_MODULECONFIG = _descriptor.Descriptor(
   extension_ranges=[],
   oneofs=[
   ],
-  serialized_start=1625,
-  serialized_end=1732,
+  serialized_start=2317,
+  serialized_end=2424,
 )
 
 _SPLITFLAPCONFIG = _descriptor.Descriptor(
@@ -649,7 +911,7 @@ _SPLITFLAPCONFIG = _descriptor.Descriptor(
       has_default_value=False, default_value=[],
       message_type=None, enum_type=None, containing_type=None,
       is_extension=False, extension_scope=None,
-      serialized_options=_b('\222?\003\020\377\001'), file=DESCRIPTOR),
+      serialized_options=_b('\222?\002\030\001'), file=DESCRIPTOR),
   ],
   extensions=[
   ],
@@ -662,8 +924,8 @@ _SPLITFLAPCONFIG = _descriptor.Descriptor(
   extension_ranges=[],
   oneofs=[
   ],
-  serialized_start=1547,
-  serialized_end=1732,
+  serialized_start=2240,
+  serialized_end=2424,
 )
 
 
@@ -686,8 +948,197 @@ _REQUESTSTATE = _descriptor.Descriptor(
   extension_ranges=[],
   oneofs=[
   ],
-  serialized_start=1734,
-  serialized_end=1748,
+  serialized_start=2426,
+  serialized_end=2440,
+)
+
+
+_SUBSCRIBE = _descriptor.Descriptor(
+  name='Subscribe',
+  full_name='PB.Subscribe',
+  filename=None,
+  file=DESCRIPTOR,
+  containing_type=None,
+  fields=[
+    _descriptor.FieldDescriptor(
+      name='min_interval_millis', full_name='PB.Subscribe.min_interval_millis', index=0,
+      number=1, type=13, cpp_type=3, label=1,
+      has_default_value=False, default_value=0,
+      message_type=None, enum_type=None, containing_type=None,
+      is_extension=False, extension_scope=None,
+      serialized_options=None, file=DESCRIPTOR),
+    _descriptor.FieldDescriptor(
+      name='heartbeat_interval_millis', full_name='PB.Subscribe.heartbeat_interval_millis', index=1,
+      number=2, type=13, cpp_type=3, label=1,
+      has_default_value=False, default_value=0,
+      message_type=None, enum_type=None, containing_type=None,
+      is_extension=False, extension_scope=None,
+      serialized_options=None, file=DESCRIPTOR),
+    _descriptor.FieldDescriptor(
+      name='module_start', full_name='PB.Subscribe.module_start', index=2,
+      number=3, type=13, cpp_type=3, label=1,
+      has_default_value=False, default_value=0,
+      message_type=None, enum_type=None, containing_type=None,
+      is_extension=False, extension_scope=None,
+      serialized_options=_b('\222?\0028\010'), file=DESCRIPTOR),
+    _descriptor.FieldDescriptor(
+      name='module_count', full_name='PB.Subscribe.module_count', index=3,
+      number=4, type=13, cpp_type=3, label=1,
+      has_default_value=False, default_value=0,
+      message_type=None, enum_type=None, containing_type=None,
+      is_extension=False, extension_scope=None,
+      serialized_options=_b('\222?\0028\010'), file=DESCRIPTOR),
+    _descriptor.FieldDescriptor(
+      name='field_mask', full_name='PB.Subscribe.field_mask', index=4,
+      number=5, type=13, cpp_type=3, label=1,
+      has_default_value=False, default_value=0,
+      message_type=None, enum_type=None, containing_type=None,
+      is_extension=False, extension_scope=None,
+      serialized_options=None, file=DESCRIPTOR),
+  ],
+  extensions=[
+  ],
+  nested_types=[],
+  enum_types=[
+  ],
+  serialized_options=None,
+  is_extendable=False,
+  syntax='proto3',
+  extension_ranges=[],
+  oneofs=[
+  ],
+  serialized_start=2443,
+  serialized_end=2596,
+)
+
+
+_WINDOWCONFIG = _descriptor.Descriptor(
+  name='WindowConfig',
+  full_name='PB.WindowConfig',
+  filename=None,
+  file=DESCRIPTOR,
+  containing_type=None,
+  fields=[
+    _descriptor.FieldDescriptor(
+      name='window_size', full_name='PB.WindowConfig.window_size', index=0,
+      number=1, type=13, cpp_type=3, label=1,
+      has_default_value=False, default_value=0,
+      message_type=None, enum_type=None, containing_type=None,
+      is_extension=False, extension_scope=None,
+      serialized_options=_b('\222?\0028\010'), file=DESCRIPTOR),
+  ],
+  extensions=[
+  ],
+  nested_types=[],
+  enum_types=[
+  ],
+  serialized_options=None,
+  is_extendable=False,
+  syntax='proto3',
+  extension_ranges=[],
+  oneofs=[
+  ],
+  serialized_start=2598,
+  serialized_end=2640,
+)
+
+
+_BAUDRATECHANGE = _descriptor.Descriptor(
+  name='BaudRateChange',
+  full_name='PB.BaudRateChange',
+  filename=None,
+  file=DESCRIPTOR,
+  containing_type=None,
+  fields=[
+    _descriptor.FieldDescriptor(
+      name='phase', full_name='PB.BaudRateChange.phase', index=0,
+      number=1, type=14, cpp_type=8, label=1,
+      has_default_value=False, default_value=0,
+      message_type=None, enum_type=None, containing_type=None,
+      is_extension=False, extension_scope=None,
+      serialized_options=None, file=DESCRIPTOR),
+    _descriptor.FieldDescriptor(
+      name='baud_rate', full_name='PB.BaudRateChange.baud_rate', index=1,
+      number=2, type=13, cpp_type=3, label=1,
+      has_default_value=False, default_value=0,
+      message_type=None, enum_type=None, containing_type=None,
+      is_extension=False, extension_scope=None,
+      serialized_options=None, file=DESCRIPTOR),
+  ],
+  extensions=[
+  ],
+  nested_types=[],
+  enum_types=[
+    _BAUDRATECHANGE_PHASE,
+  ],
+  serialized_options=None,
+  is_extendable=False,
+  syntax='proto3',
+  extension_ranges=[],
+  oneofs=[
+  ],
+  serialized_start=2642,
+  serialized_end=2753,
+)
+
+
+_SCHEDULEUPLOAD = _descriptor.Descriptor(
+  name='ScheduleUpload',
+  full_name='PB.ScheduleUpload',
+  filename=None,
+  file=DESCRIPTOR,
+  containing_type=None,
+  fields=[
+    _descriptor.FieldDescriptor(
+      name='phase', full_name='PB.ScheduleUpload.phase', index=0,
+      number=1, type=14, cpp_type=8, label=1,
+      has_default_value=False, default_value=0,
+      message_type=None, enum_type=None, containing_type=None,
+      is_extension=False, extension_scope=None,
+      serialized_options=None, file=DESCRIPTOR),
+    _descriptor.FieldDescriptor(
+      name='size', full_name='PB.ScheduleUpload.size', index=1,
+      number=2, type=13, cpp_type=3, label=1,
+      has_default_value=False, default_value=0,
+      message_type=None, enum_type=None, containing_type=None,
+      is_extension=False, extension_scope=None,
+      serialized_options=None, file=DESCRIPTOR),
+    _descriptor.FieldDescriptor(
+      name='offset', full_name='PB.ScheduleUpload.offset', index=2,
+      number=3, type=13, cpp_type=3, label=1,
+      has_default_value=False, default_value=0,
+      message_type=None, enum_type=None, containing_type=None,
+      is_extension=False, extension_scope=None,
+      serialized_options=None, file=DESCRIPTOR),
+    _descriptor.FieldDescriptor(
+      name='data', full_name='PB.ScheduleUpload.data', index=3,
+      number=4, type=12, cpp_type=9, label=1,
+      has_default_value=False, default_value=_b(""),
+      message_type=None, enum_type=None, containing_type=None,
+      is_extension=False, extension_scope=None,
+      serialized_options=_b('\222?\003\010\200\002'), file=DESCRIPTOR),
+    _descriptor.FieldDescriptor(
+      name='crc32', full_name='PB.ScheduleUpload.crc32', index=4,
+      number=5, type=13, cpp_type=3, label=1,
+      has_default_value=False, default_value=0,
+      message_type=None, enum_type=None, containing_type=None,
+      is_extension=False, extension_scope=None,
+      serialized_options=None, file=DESCRIPTOR),
+  ],
+  extensions=[
+  ],
+  nested_types=[],
+  enum_types=[
+    _SCHEDULEUPLOAD_PHASE,
+  ],
+  serialized_options=None,
+  is_extendable=False,
+  syntax='proto3',
+  extension_ranges=[],
+  oneofs=[
+  ],
+  serialized_start=2756,
+  serialized_end=2922,
 )
 
 
@@ -726,13 +1177,41 @@ _TOSPLITFLAP = _descriptor.Descriptor(
       message_type=None, enum_type=None, containing_type=None,
       is_extension=False, extension_scope=None,
       serialized_options=None, file=DESCRIPTOR),
+    _descriptor.FieldDescriptor(
+      name='window_config', full_name='PB.ToSplitflap.window_config', index=4,
+      number=5, type=11, cpp_type=10, label=1,
+      has_default_value=False, default_value=None,
+      message_type=None, enum_type=None, containing_type=None,
+      is_extension=False, extension_scope=None,
+      serialized_options=None, file=DESCRIPTOR),
+    _descriptor.FieldDescriptor(
+      name='baud_rate_change', full_name='PB.ToSplitflap.baud_rate_change', index=5,
+      number=6, type=11, cpp_type=10, label=1,
+      has_default_value=False, default_value=None,
+      message_type=None, enum_type=None, containing_type=None,
+      is_extension=False, extension_scope=None,
+      serialized_options=None, file=DESCRIPTOR),
+    _descriptor.FieldDescriptor(
+      name='subscribe', full_name='PB.ToSplitflap.subscribe', index=6,
+      number=7, type=11, cpp_type=10, label=1,
+      has_default_value=False, default_value=None,
+      message_type=None, enum_type=None, containing_type=None,
+      is_extension=False, extension_scope=None,
+      serialized_options=None, file=DESCRIPTOR),
+    _descriptor.FieldDescriptor(
+      name='schedule_upload', full_name='PB.ToSplitflap.schedule_upload', index=7,
+      number=8, type=11, cpp_type=10, label=1,
+      has_default_value=False, default_value=None,
+      message_type=None, enum_type=None, containing_type=None,
+      is_extension=False, extension_scope=None,
+      serialized_options=None, file=DESCRIPTOR),
   ],
   extensions=[
   ],
   nested_types=[],
   enum_types=[
   ],
-  serialized_options=None,
+  serialized_options=_b('\222?\003\260\001\001'),
   is_extendable=False,
   syntax='proto3',
   extension_ranges=[],
@@ -741,14 +1220,19 @@ _TOSPLITFLAP = _descriptor.Descriptor(
       name='payload', full_name='PB.ToSplitflap.payload',
       index=0, containing_type=None, fields=[]),
   ],
-  serialized_start=1751,
-  serialized_end=1933,
+  serialized_start=2925,
+  serialized_end=3289,
 )
 
 _SPLITFLAPSTATE_MODULESTATE.fields_by_name['state'].enum_type = _SPLITFLAPSTATE_MODULESTATE_STATE
 _SPLITFLAPSTATE_MODULESTATE.containing_type = _SPLITFLAPSTATE
 _SPLITFLAPSTATE_MODULESTATE_STATE.containing_type = _SPLITFLAPSTATE_MODULESTATE
 _SPLITFLAPSTATE.fields_by_name['modules'].message_type = _SPLITFLAPSTATE_MODULESTATE
+_BAUDRATERESPONSE.fields_by_name['status'].enum_type = _BAUDRATERESPONSE_STATUS
+_BAUDRATERESPONSE_STATUS.containing_type = _BAUDRATERESPONSE
+_SCHEDULEUPLOADRESPONSE.fields_by_name['phase'].enum_type = _SCHEDULEUPLOAD_PHASE
+_SCHEDULEUPLOADRESPONSE.fields_by_name['status'].enum_type = _SCHEDULEUPLOADRESPONSE_STATUS
+_SCHEDULEUPLOADRESPONSE_STATUS.containing_type = _SCHEDULEUPLOADRESPONSE
 _SUPERVISORSTATE_POWERCHANNELSTATE.containing_type = _SUPERVISORSTATE
 _SUPERVISORSTATE_FAULTINFO.fields_by_name['type'].enum_type = _SUPERVISORSTATE_FAULTINFO_FAULTTYPE
 _SUPERVISORSTATE_FAULTINFO.containing_type = _SUPERVISORSTATE
@@ -761,6 +1245,8 @@ _FROMSPLITFLAP.fields_by_name['splitflap_state'].message_type = _SPLITFLAPSTATE
 _FROMSPLITFLAP.fields_by_name['log'].message_type = _LOG
 _FROMSPLITFLAP.fields_by_name['ack'].message_type = _ACK
 _FROMSPLITFLAP.fields_by_name['supervisor_state'].message_type = _SUPERVISORSTATE
+_FROMSPLITFLAP.fields_by_name['baud_rate_response'].message_type = _BAUDRATERESPONSE
+_FROMSPLITFLAP.fields_by_name['schedule_upload_response'].message_type = _SCHEDULEUPLOADRESPONSE
 _FROMSPLITFLAP.oneofs_by_name['payload'].fields.append(
   _FROMSPLITFLAP.fields_by_name['splitflap_state'])
 _FROMSPLITFLAP.fields_by_name['splitflap_state'].containing_oneof = _FROMSPLITFLAP.oneofs_by_name['payload']
@@ -773,15 +1259,29 @@ _FROMSPLITFLAP.fields_by_name['ack'].containing_oneof = _FROMSPLITFLAP.oneofs_by
 _FROMSPLITFLAP.oneofs_by_name['payload'].fields.append(
   _FROMSPLITFLAP.fields_by_name['supervisor_state'])
 _FROMSPLITFLAP.fields_by_name['supervisor_state'].containing_oneof = _FROMSPLITFLAP.oneofs_by_name['payload']
+_FROMSPLITFLAP.oneofs_by_name['payload'].fields.append(
+  _FROMSPLITFLAP.fields_by_name['baud_rate_response'])
+_FROMSPLITFLAP.fields_by_name['baud_rate_response'].containing_oneof = _FROMSPLITFLAP.oneofs_by_name['payload']
+_FROMSPLITFLAP.oneofs_by_name['payload'].fields.append(
+  _FROMSPLITFLAP.fields_by_name['schedule_upload_response'])
+_FROMSPLITFLAP.fields_by_name['schedule_upload_response'].containing_oneof = _FROMSPLITFLAP.oneofs_by_name['payload']
 _SPLITFLAPCOMMAND_MODULECOMMAND.fields_by_name['action'].enum_type = _SPLITFLAPCOMMAND_MODULECOMMAND_ACTION
 _SPLITFLAPCOMMAND_MODULECOMMAND.containing_type = _SPLITFLAPCOMMAND
 _SPLITFLAPCOMMAND_MODULECOMMAND_ACTION.containing_type = _SPLITFLAPCOMMAND_MODULECOMMAND
 _SPLITFLAPCOMMAND.fields_by_name['modules'].message_type = _SPLITFLAPCOMMAND_MODULECOMMAND
 _SPLITFLAPCONFIG_MODULECONFIG.containing_type = _SPLITFLAPCONFIG
 _SPLITFLAPCONFIG.fields_by_name['modules'].message_type = _SPLITFLAPCONFIG_MODULECONFIG
+_BAUDRATECHANGE.fields_by_name['phase'].enum_type = _BAUDRATECHANGE_PHASE
+_BAUDRATECHANGE_PHASE.containing_type = _BAUDRATECHANGE
+_SCHEDULEUPLOAD.fields_by_name['phase'].enum_type = _SCHEDULEUPLOAD_PHASE
+_SCHEDULEUPLOAD_PHASE.containing_type = _SCHEDULEUPLOAD
 _TOSPLITFLAP.fields_by_name['splitflap_command'].message_type = _SPLITFLAPCOMMAND
 _TOSPLITFLAP.fields_by_name['splitflap_config'].message_type = _SPLITFLAPCONFIG
 _TOSPLITFLAP.fields_by_name['request_state'].message_type = _REQUESTSTATE
+_TOSPLITFLAP.fields_by_name['window_config'].message_type = _WINDOWCONFIG
+_TOSPLITFLAP.fields_by_name['baud_rate_change'].message_type = _BAUDRATECHANGE
+_TOSPLITFLAP.fields_by_name['subscribe'].message_type = _SUBSCRIBE
+_TOSPLITFLAP.fields_by_name['schedule_upload'].message_type = _SCHEDULEUPLOAD
 _TOSPLITFLAP.oneofs_by_name['payload'].fields.append(
   _TOSPLITFLAP.fields_by_name['splitflap_command'])
 _TOSPLITFLAP.fields_by_name['splitflap_command'].containing_oneof = _TOSPLITFLAP.oneofs_by_name['payload']
@@ -791,14 +1291,32 @@ _TOSPLITFLAP.fields_by_name['splitflap_config'].containing_oneof = _TOSPLITFLAP.
 _TOSPLITFLAP.oneofs_by_name['payload'].fields.append(
   _TOSPLITFLAP.fields_by_name['request_state'])
 _TOSPLITFLAP.fields_by_name['request_state'].containing_oneof = _TOSPLITFLAP.oneofs_by_name['payload']
+_TOSPLITFLAP.oneofs_by_name['payload'].fields.append(
+  _TOSPLITFLAP.fields_by_name['window_config'])
+_TOSPLITFLAP.fields_by_name['window_config'].containing_oneof = _TOSPLITFLAP.oneofs_by_name['payload']
+_TOSPLITFLAP.oneofs_by_name['payload'].fields.append(
+  _TOSPLITFLAP.fields_by_name['baud_rate_change'])
+_TOSPLITFLAP.fields_by_name['baud_rate_change'].containing_oneof = _TOSPLITFLAP.oneofs_by_name['payload']
+_TOSPLITFLAP.oneofs_by_name['payload'].fields.append(
+  _TOSPLITFLAP.fields_by_name['subscribe'])
+_TOSPLITFLAP.fields_by_name['subscribe'].containing_oneof = _TOSPLITFLAP.oneofs_by_name['payload']
+_TOSPLITFLAP.oneofs_by_name['payload'].fields.append(
+  _TOSPLITFLAP.fields_by_name['schedule_upload'])
+_TOSPLITFLAP.fields_by_name['schedule_upload'].containing_oneof = _TOSPLITFLAP.oneofs_by_name['payload']
 DESCRIPTOR.message_types_by_name['SplitflapState'] = _SPLITFLAPSTATE
 DESCRIPTOR.message_types_by_name['Log'] = _LOG
 DESCRIPTOR.message_types_by_name['Ack'] = _ACK
+DESCRIPTOR.message_types_by_name['BaudRateResponse'] = _BAUDRATERESPONSE
+DESCRIPTOR.message_types_by_name['ScheduleUploadResponse'] = _SCHEDULEUPLOADRESPONSE
 DESCRIPTOR.message_types_by_name['SupervisorState'] = _SUPERVISORSTATE
 DESCRIPTOR.message_types_by_name['FromSplitflap'] = _FROMSPLITFLAP
 DESCRIPTOR.message_types_by_name['SplitflapCommand'] = _SPLITFLAPCOMMAND
 DESCRIPTOR.message_types_by_name['SplitflapConfig'] = _SPLITFLAPCONFIG
 DESCRIPTOR.message_types_by_name['RequestState'] = _REQUESTSTATE
+DESCRIPTOR.message_types_by_name['Subscribe'] = _SUBSCRIBE
+DESCRIPTOR.message_types_by_name['WindowConfig'] = _WINDOWCONFIG
+DESCRIPTOR.message_types_by_name['BaudRateChange'] = _BAUDRATECHANGE
+DESCRIPTOR.message_types_by_name['ScheduleUpload'] = _SCHEDULEUPLOAD
 DESCRIPTOR.message_types_by_name['ToSplitflap'] = _TOSPLITFLAP
 _sym_db.RegisterFileDescriptor(DESCRIPTOR)
 
@@ -831,6 +1349,20 @@ Ack = _reflection.GeneratedProtocolMessageType('Ack', (_message.Message,), dict(
   ))
 _sym_db.RegisterMessage(Ack)
 
+BaudRateResponse = _reflection.GeneratedProtocolMessageType('BaudRateResponse', (_message.Message,), dict(
+  DESCRIPTOR = _BAUDRATERESPONSE,
+  __module__ = 'splitflap_pb2'
+  # @@protoc_insertion_point(class_scope:PB.BaudRateResponse)
+  ))
+_sym_db.RegisterMessage(BaudRateResponse)
+
+ScheduleUploadResponse = _reflection.GeneratedProtocolMessageType('ScheduleUploadResponse', (_message.Message,), dict(
+  DESCRIPTOR = _SCHEDULEUPLOADRESPONSE,
+  __module__ = 'splitflap_pb2'
+  # @@protoc_insertion_point(class_scope:PB.ScheduleUploadResponse)
+  ))
+_sym_db.RegisterMessage(ScheduleUploadResponse)
+
 SupervisorState = _reflection.GeneratedProtocolMessageType('SupervisorState', (_message.Message,), dict(
 
   PowerChannelState = _reflection.GeneratedProtocolMessageType('PowerChannelState', (_message.Message,), dict(
@@ -898,6 +1430,34 @@ RequestState = _reflection.GeneratedProtocolMessageType('RequestState', (_messag
   ))
 _sym_db.RegisterMessage(RequestState)
 
+Subscribe = _reflection.GeneratedProtocolMessageType('Subscribe', (_message.Message,), dict(
+  DESCRIPTOR = _SUBSCRIBE,
+  __module__ = 'splitflap_pb2'
+  # @@protoc_insertion_point(class_scope:PB.Subscribe)
+  ))
+_sym_db.RegisterMessage(Subscribe)
+
+WindowConfig = _reflection.GeneratedProtocolMessageType('WindowConfig', (_message.Message,), dict(
+  DESCRIPTOR = _WINDOWCONFIG,
+  __module__ = 'splitflap_pb2'
+  # @@protoc_insertion_point(class_scope:PB.WindowConfig)
+  ))
+_sym_db.RegisterMessage(WindowConfig)
+
+BaudRateChange = _reflection.GeneratedProtocolMessageType('BaudRateChange', (_message.Message,), dict(
+  DESCRIPTOR = _BAUDRATECHANGE,
+  __module__ = 'splitflap_pb2'
+  # @@protoc_insertion_point(class_scope:PB.BaudRateChange)
+  ))
+_sym_db.RegisterMessage(BaudRateChange)
+
+ScheduleUpload = _reflection.GeneratedProtocolMessageType('ScheduleUpload', (_message.Message,), dict(
+  DESCRIPTOR = _SCHEDULEUPLOAD,
+  __module__ = 'splitflap_pb2'
+  # @@protoc_insertion_point(class_scope:PB.ScheduleUpload)
+  ))
+_sym_db.RegisterMessage(ScheduleUpload)
+
 ToSplitflap = _reflection.GeneratedProtocolMessageType('ToSplitflap', (_message.Message,), dict(
   DESCRIPTOR = _TOSPLITFLAP,
   __module__ = 'splitflap_pb2'
@@ -910,7 +1470,9 @@ _SPLITFLAPSTATE_MODULESTATE.fields_by_name['flap_index']._options = None
 _SPLITFLAPSTATE_MODULESTATE.fields_by_name['count_unexpected_home']._options = None
 _SPLITFLAPSTATE_MODULESTATE.fields_by_name['count_missed_home']._options = None
 _SPLITFLAPSTATE.fields_by_name['modules']._options = None
+_SPLITFLAPSTATE.fields_by_name['module_start']._options = None
 _LOG.fields_by_name['msg']._options = None
+_ACK.fields_by_name['window_size']._options = None
 _SUPERVISORSTATE_FAULTINFO.fields_by_name['msg']._options = None
 _SUPERVISORSTATE.fields_by_name['power_channels']._options = None
 _SPLITFLAPCOMMAND_MODULECOMMAND.fields_by_name['param']._options = None
@@ -919,4 +1481,9 @@ _SPLITFLAPCONFIG_MODULECONFIG.fields_by_name['target_flap_index']._options = Non
 _SPLITFLAPCONFIG_MODULECONFIG.fields_by_name['movement_nonce']._options = None
 _SPLITFLAPCONFIG_MODULECONFIG.fields_by_name['reset_nonce']._options = None
 _SPLITFLAPCONFIG.fields_by_name['modules']._options = None
+_SUBSCRIBE.fields_by_name['module_start']._options = None
+_SUBSCRIBE.fields_by_name['module_count']._options = None
+_WINDOWCONFIG.fields_by_name['window_size']._options = None
+_SCHEDULEUPLOAD.fields_by_name['data']._options = None
+_TOSPLITFLAP._options = None
 # @@protoc_insertion_point(module_scope)
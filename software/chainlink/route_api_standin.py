@@ -0,0 +1,119 @@
+"""
+Stand-in for the adsbdb.com callsign API used by the firmware's flight data mode, for testing its route lookups and
+route cache without depending on (or hammering) the real service. Point the firmware at it with a build flag in
+platformio.ini, e.g.:
+
+    -DROUTE_API_URL='"http://192.168.1.10:8000/v0/callsign/"'
+
+and run:
+
+    python route_api_standin.py --routes QFA1=SYD-LHR/QF1 --routes JST501=SYD-MEL
+
+Callsigns without a route get a 404, like the real API, which the firmware caches as a negative entry. Every request
+is logged with a running count per callsign, so cache hits show up as lookups that never reach the server. Pair it
+with sbs_replay.py to feed the firmware aircraft to look up.
+"""
+import argparse
+from collections import Counter
+import http.server
+import json
+import logging
+import random
+import re
+import time
+
+PATH_PATTERN = re.compile(r'^/v0/callsign/([A-Za-z0-9]{1,8})$')
+
+DEFAULT_ROUTES = {
+    'QFA1': ('SYD', 'LHR', 'QF1'),
+    'JST501': ('SYD', 'MEL', 'JQ501'),
+    'VOZ925': ('SYD', 'BNE', 'VA925'),
+}
+
+
+def _parse_route(value):
+    """Parses CALLSIGN=ORIGIN-DESTINATION[/IATA_CALLSIGN]."""
+    match = re.match(r'^([A-Za-z0-9]{1,8})=([A-Z]{3,4})-([A-Z]{3,4})(?:/([A-Za-z0-9]{1,8}))?$', value)
+    if not match:
+        raise argparse.ArgumentTypeError(f'Expected CALLSIGN=ORIGIN-DESTINATION[/IATA_CALLSIGN], got {value}')
+    callsign, origin, destination, callsign_iata = match.groups()
+    return callsign.upper(), (origin, destination, callsign_iata or callsign.upper())
+
+
+def _airport(code):
+    return {'iata_code': code, 'icao_code': None, 'name': f'Stand-in airport {code}'}
+
+
+def _flightroute_body(callsign, route):
+    origin, destination, callsign_iata = route
+    return {
+        'response': {
+            'flightroute': {
+                'callsign': callsign,
+                'callsign_iata': callsign_iata,
+                'origin': _airport(origin),
+                'destination': _airport(destination),
+            },
+        },
+    }
+
+
+def _run():
+    parser = argparse.ArgumentParser('Route API stand-in server')
+    parser.add_argument('--port', type=int, default=8000)
+    parser.add_argument('--routes', type=_parse_route, action='append', default=[],
+                        help='CALLSIGN=ORIGIN-DESTINATION[/IATA_CALLSIGN], may be repeated (replaces the defaults)')
+    parser.add_argument('--delay', type=float, default=0, help='Seconds to wait before each response')
+    parser.add_argument('--error-rate', type=float, default=0,
+                        help='Fraction of requests to fail with a 500 (which the firmware must not cache)')
+    parser.add_argument('--verbose', '-v', action='store_true', help='Enable verbose logging')
+    args = parser.parse_args()
+
+    log_level = logging.DEBUG if args.verbose else logging.INFO
+    logging.basicConfig(level=log_level, format='%(asctime)s:%(name)s:%(levelname)s:%(message)s')
+
+    routes = dict(args.routes) if args.routes else DEFAULT_ROUTES
+    request_counts = Counter()
+
+    class Handler(http.server.BaseHTTPRequestHandler):
+        def do_GET(self):
+            match = PATH_PATTERN.match(self.path)
+            if not match:
+                self._respond(400, {'response': 'invalid request'})
+                return
+
+            callsign = match.group(1).upper()
+            request_counts[callsign] += 1
+            if args.delay:
+                time.sleep(args.delay)
+
+            if random.random() < args.error_rate:
+                status, body = 500, {'response': 'internal server error'}
+            elif callsign in routes:
+                status, body = 200, _flightroute_body(callsign, routes[callsign])
+            else:
+                status, body = 404, {'response': 'unknown callsign'}
+            logging.info(f'{callsign}: {status} (request {request_counts[callsign]} for this callsign, '
+                         f'{sum(request_counts.values())} total)')
+            self._respond(status, body)
+
+        def _respond(self, status, body):
+            data = json.dumps(body).encode('utf-8')
+            self.send_response(status)
+            self.send_header('Content-Type', 'application/json')
+            self.send_header('Content-Length', str(len(data)))
+            self.end_headers()
+            self.wfile.write(data)
+            logging.debug(data)
+
+        def log_message(self, format, *args):
+            pass
+
+    http.server.ThreadingHTTPServer.allow_reuse_address = True
+    with http.server.ThreadingHTTPServer(('', args.port), Handler) as server:
+        logging.info(f'Serving route lookups for {", ".join(sorted(routes))} on port {args.port}')
+        server.serve_forever()
+
+
+if __name__ == '__main__':
+    _run()
@@ -0,0 +1,128 @@
+"""
+Serves SBS-1 ("BaseStation") lines over TCP like dump1090's port 30003, for testing the firmware's SBS flight data
+mode (ADSB_SBS in platformio.ini) without a receiver.
+
+Either replays a capture, keeping the original timing (taken from each line's generated date/time fields), e.g. one
+made with `nc raspberrypi 30003 > capture.sbs`:
+
+    python sbs_replay.py capture.sbs
+
+or simulates a single aircraft flying straight over the given point:
+
+    python sbs_replay.py --flyover=-33.9429,151.2562 --callsign QFA1
+
+Each connected client gets its own copy of the stream. The firmware's native test_sbs_replay test runs against this.
+"""
+import argparse
+from datetime import datetime
+import logging
+import socketserver
+import time
+
+FIELD_HEX = 4
+FIELD_DATE = 6
+FIELD_TIME = 7
+
+
+def _timestamp(line):
+    fields = line.split(',')
+    try:
+        return datetime.strptime(f'{fields[FIELD_DATE]} {fields[FIELD_TIME]}', '%Y/%m/%d %H:%M:%S.%f').timestamp()
+    except (IndexError, ValueError):
+        return None
+
+
+def replay(path, speed):
+    """Yields (delay_seconds, line) for each line of a capture."""
+    with open(path) as f:
+        lines = [line.rstrip('\r\n') for line in f if line.strip()]
+    previous = None
+    for line in lines:
+        timestamp = _timestamp(line)
+        delay = 0 if timestamp is None or previous is None else max(0, timestamp - previous) / speed
+        if timestamp is not None:
+            previous = timestamp
+        yield delay, line
+
+
+def _msg(transmission_type, hex_ident, callsign='', altitude='', lat='', lon=''):
+    now = datetime.now()
+    date = now.strftime('%Y/%m/%d')
+    clock = now.strftime('%H:%M:%S.%f')[:-3]
+    fields = ['MSG', str(transmission_type), '1', '1', hex_ident, '1', date, clock, date, clock, callsign,
+              str(altitude), '', '', str(lat), str(lon), '', '', '0', '0', '0', '0']
+    return ','.join(fields)
+
+
+def flyover(lat, lon, callsign, hex_ident, altitude, speed_kmh, distance_km, interval):
+    """Yields (delay_seconds, line) for an aircraft flying due north over (lat, lon), from distance_km away."""
+    km_per_degree = 111.2
+    step_km = speed_kmh / 3600 * interval
+    steps = int(2 * distance_km / step_km)
+    for i in range(steps + 1):
+        offset_km = -distance_km + i * step_km
+        if i % 10 == 0:
+            yield (interval if i else 0), _msg(1, hex_ident, callsign=callsign)
+        yield interval, _msg(3, hex_ident, altitude=altitude, lat=round(lat + offset_km / km_per_degree, 5),
+                             lon=round(lon, 5))
+    logging.info('Flyover complete')
+
+
+def _run():
+    parser = argparse.ArgumentParser('SBS-1 replay server')
+    parser.add_argument('capture', nargs='?', help='File of SBS-1 lines to replay')
+    parser.add_argument('--port', type=int, default=30003)
+    parser.add_argument('--speed', type=float, default=1.0, help='Replay speed multiplier')
+    parser.add_argument('--loop', action='store_true', help='Start again at the end')
+    parser.add_argument('--flyover', help='lat,lon to simulate an aircraft flying over, instead of a capture')
+    parser.add_argument('--callsign', default='QFA1')
+    parser.add_argument('--hex', default='7C6B2D')
+    parser.add_argument('--altitude', type=int, default=3000, help='Flyover altitude in feet')
+    parser.add_argument('--speed-kmh', type=float, default=400)
+    parser.add_argument('--distance-km', type=float, default=10, help='Flyover starts and ends this far away')
+    parser.add_argument('--interval', type=float, default=0.5, help='Seconds between flyover position messages')
+    parser.add_argument('--verbose', '-v', action='store_true', help='Enable verbose logging')
+    args = parser.parse_args()
+
+    log_level = logging.DEBUG if args.verbose else logging.INFO
+    logging.basicConfig(level=log_level, format='%(asctime)s:%(name)s:%(levelname)s:%(message)s')
+
+    if args.flyover:
+        lat, lon = (float(v) for v in args.flyover.split(','))
+
+        def source():
+            return flyover(lat, lon, args.callsign, args.hex, args.altitude, args.speed_kmh, args.distance_km,
+                           args.interval)
+    elif args.capture:
+        def source():
+            return replay(args.capture, args.speed)
+    else:
+        parser.error('Either a capture file or --flyover is required')
+
+    class Handler(socketserver.BaseRequestHandler):
+        def handle(self):
+            logging.info(f'Client connected from {self.client_address[0]}')
+            try:
+                while True:
+                    count = 0
+                    for delay, line in source():
+                        if delay:
+                            time.sleep(delay)
+                        self.request.sendall((line + '\r\n').encode('ascii'))
+                        logging.debug(line)
+                        count += 1
+                    logging.info(f'Sent {count} lines')
+                    if not args.loop:
+                        break
+            except (BrokenPipeError, ConnectionResetError):
+                pass
+            logging.info('Client disconnected')
+
+    socketserver.ThreadingTCPServer.allow_reuse_address = True
+    with socketserver.ThreadingTCPServer(('', args.port), Handler) as server:
+        logging.info(f'Serving SBS-1 on port {args.port}')
+        server.serve_forever()
+
+
+if __name__ == '__main__':
+    _run()
@@ -0,0 +1,134 @@
+"""
+Compiles timed message schedules into the binary image format read by the firmware (see ScheduleHeader in
+arduino/splitflap/esp32/splitflap/schedule_store.h), and uploads them to a splitflap.
+
+Schedules can be CSV, with columns start_time,duration_seconds,message (a header row is optional), or JSON, as a list
+of objects with those keys. start_time is either a unix timestamp or an ISO 8601 date/time (UTC unless it has an
+offset). Entries may be in any order, but must not overlap.
+
+    python schedule.py compile schedule.csv schedule.bin
+    python schedule.py upload schedule.csv
+"""
+import argparse
+import csv
+from datetime import (
+    datetime,
+    timezone,
+)
+import json
+import logging
+import os
+import struct
+import zlib
+
+MAGIC = 0x43534653  # "SFSC"
+FORMAT_VERSION = 1
+MAX_MESSAGE_LENGTH = 11
+
+HEADER = struct.Struct('<IHHII')
+RECORD = struct.Struct(f'<II{MAX_MESSAGE_LENGTH + 1}s')
+
+
+class ScheduleError(Exception):
+    pass
+
+
+def _parse_time(value):
+    value = str(value).strip()
+    if value.isdigit():
+        return int(value)
+    try:
+        parsed = datetime.fromisoformat(value)
+    except ValueError:
+        raise ScheduleError(f'Invalid start_time: {value}')
+    if parsed.tzinfo is None:
+        parsed = parsed.replace(tzinfo=timezone.utc)
+    return int(parsed.timestamp())
+
+
+def _entry(start_time, duration_seconds, message):
+    return (_parse_time(start_time), int(duration_seconds), str(message))
+
+
+def load_entries(path):
+    with open(path, newline='') as f:
+        if os.path.splitext(path)[1].lower() == '.json':
+            return [_entry(e['start_time'], e['duration_seconds'], e['message']) for e in json.load(f)]
+
+        entries = []
+        for row in csv.reader(f):
+            if not row or row[0].strip().startswith('#'):
+                continue
+            if row[0].strip() == 'start_time':
+                # Header
+                continue
+            if len(row) != 3:
+                raise ScheduleError(f'Expected 3 columns, got {len(row)}: {row}')
+            entries.append(_entry(*row))
+        return entries
+
+
+def compile_schedule(entries):
+    """Returns the binary image for a list of (start_time, duration_seconds, message) entries."""
+    entries = sorted(entries, key=lambda e: e[0])
+
+    records = bytearray()
+    for i, (start_time, duration_seconds, message) in enumerate(entries):
+        if not 0 <= start_time < 2**32 or not 0 < duration_seconds < 2**32 or start_time + duration_seconds >= 2**32:
+            raise ScheduleError(f'Time out of range: {entries[i]}')
+        if i + 1 < len(entries) and start_time + duration_seconds > entries[i + 1][0]:
+            raise ScheduleError(f'Overlapping entries: {entries[i]} and {entries[i + 1]}')
+        encoded = message.encode('ascii')
+        if len(encoded) > MAX_MESSAGE_LENGTH:
+            raise ScheduleError(f'Message longer than {MAX_MESSAGE_LENGTH} characters: {message}')
+        # struct pads the message with NULs, so it's always terminated
+        records += RECORD.pack(start_time, duration_seconds, encoded)
+
+    header = HEADER.pack(MAGIC, FORMAT_VERSION, RECORD.size, len(entries), zlib.crc32(records) & 0xffffffff)
+    return header + records
+
+
+def _run():
+    parser = argparse.ArgumentParser('Splitflap timed message schedule tool')
+    parser.add_argument('--verbose', '-v', action='store_true', help='Enable verbose logging')
+    subparsers = parser.add_subparsers(dest='command', required=True)
+
+    compile_parser = subparsers.add_parser('compile', help='Compile a CSV/JSON schedule into a binary image')
+    compile_parser.add_argument('input')
+    compile_parser.add_argument('output')
+
+    upload_parser = subparsers.add_parser('upload', help='Upload a CSV/JSON schedule (or compiled .bin) to a splitflap')
+    upload_parser.add_argument('input')
+    upload_parser.add_argument('--port', help='Serial port (prompts if not specified)')
+    upload_parser.add_argument('--baud-rate', type=int, help='Switch to this baud rate for the upload')
+
+    args = parser.parse_args()
+
+    log_level = logging.DEBUG if args.verbose else logging.INFO
+    logging.basicConfig(level=log_level, format='%(asctime)s:%(name)s:%(levelname)s:%(message)s')
+
+    if os.path.splitext(args.input)[1].lower() == '.bin':
+        with open(args.input, 'rb') as f:
+            image = f.read()
+    else:
+        entries = load_entries(args.input)
+        image = compile_schedule(entries)
+        logging.info(f'Compiled {len(entries)} entries into {len(image)} bytes')
+
+    if args.command == 'compile':
+        with open(args.output, 'wb') as f:
+            f.write(image)
+        return
+
+    # Only needed (along with pyserial etc.) for uploads
+    from splitflap_proto import (
+        ask_for_serial_port,
+        splitflap_context,
+    )
+    port = args.port or ask_for_serial_port()
+    with splitflap_context(port, baud_rate=args.baud_rate) as s:
+        s.upload_schedule(image)
+
+
+if __name__ == '__main__':
+    _run()
@@ -1,7 +1,9 @@
 import argparse
 from cobs import cobs
 from collections import (
+    OrderedDict,
     defaultdict,
+    deque,
 )
 from contextlib import contextmanager
 from enum import Enum
@@ -18,6 +20,7 @@ import serial.tools.list_ports
 import six
 import sys
 from threading import (
+    Condition,
     Thread,
     Lock,
 )
@@ -41,6 +44,21 @@ class Splitflap(object):
 
     RETRY_TIMEOUT = 0.25
 
+    # Number of unacknowledged messages to request from the splitflap. Firmware without sliding window support
+    # doesn't report a window size, in which case the transport falls back to stop-and-wait (a window of 1).
+    DEFAULT_WINDOW_SIZE = 8
+
+    # How long to wait for each phase of a baud rate change. The splitflap reverts to the previous rate if it doesn't
+    # receive a confirmation within 2 seconds of switching, so the confirmation timeout must be shorter than that.
+    BAUD_RATE_RESPONSE_TIMEOUT = 2.0
+    BAUD_RATE_CONFIRM_TIMEOUT = 1.5
+
+    # Largest ScheduleUpload data chunk the splitflap accepts (max_size in splitflap.proto)
+    SCHEDULE_CHUNK_SIZE = 256
+
+    # Verifying a large schedule on COMMIT takes a while, as does erasing flash for an upload
+    SCHEDULE_RESPONSE_TIMEOUT = 10.0
+
     # TODO: read alphabet from splitflap once this is possible
     _DEFAULT_ALPHABET = [
         ' ',
@@ -52,14 +70,25 @@ class Splitflap(object):
         '\'',
     ]
 
-    def __init__(self, serial_instance):
+    def __init__(self, serial_instance, window_size=DEFAULT_WINDOW_SIZE):
         self._serial = serial_instance
         self._logger = logging.getLogger('splitflap')
-        self._out_q = Queue()
-        self._ack_q = Queue()
+
+        # Outgoing messages and incoming acks, both consumed by the write thread
+        self._write_q = Queue()
         self._next_nonce = randint(0, 255)
         self._run = True
 
+        self._requested_window_size = window_size
+        self._window_size = 1
+
+        # Whether splitflap_state messages only cover a subset of modules
+        self._partial_subscription = False
+
+        # Number of enqueued messages that haven't been acked yet
+        self._pending_count = 0
+        self._pending_cv = Condition()
+
         self._lock = Lock()
         self._message_handlers = defaultdict(list)
 
@@ -115,9 +144,8 @@ class Splitflap(object):
 
         # If this is an ack, notify the write thread
         if payload_type == 'ack':
-            nonce = message.ack.nonce
-            self._ack_q.put(nonce)
-        elif payload_type == 'splitflap_state':
+            self._write_q.put(('ack', message.ack))
+        elif payload_type == 'splitflap_state' and not self._partial_subscription:
             num_modules_reported = len(message.splitflap_state.modules)
             if self._num_modules is None:
                 self._num_modules = num_modules_reported
@@ -135,41 +163,81 @@ class Splitflap(object):
     
     def _write_loop(self):
         self._logger.debug('Write loop started')
+
+        # Messages waiting for space in the window
+        backlog = deque()
+
+        # nonce -> [encoded_message, next_retry, is_window_config], in the order they were sent
+        in_flight = OrderedDict()
+
         while True:
-            data = self._out_q.get()
+            # Fill the window. Its span is measured from the oldest unacked nonce (not the number in flight) since the
+            # splitflap can only buffer messages within window_size of its cumulative ack.
+            while backlog and (not in_flight or
+                               (backlog[0][0] - next(iter(in_flight))) & 0xffffffff < self._window_size):
+                (nonce, encoded_message, is_window_config) = backlog.popleft()
+                self._write_frame(encoded_message)
+                in_flight[nonce] = [encoded_message, time.time() + Splitflap.RETRY_TIMEOUT, is_window_config]
+
+            if in_flight:
+                next_retry = min(entry[1] for entry in in_flight.values())
+                timeout = max(0, next_retry - time.time())
+            else:
+                timeout = None
+
+            try:
+                data = self._write_q.get(timeout=timeout)
+            except Empty:
+                data = ('timeout', None)
+
             # Check for shutdown
-            if not self._run:
-                self._logger.debug('Write loop exiting @ _out_q')
+            if not self._run or data is None:
+                self._logger.debug('Write loop exiting')
                 return
-            (nonce, encoded_message) = data
-
-            next_retry = 0
-            while True:
-                if time.time() >= next_retry:
-                    if next_retry > 0:
-                        self._logger.debug('Retry write...')
-                    self._serial.write(encoded_message)
-                    self._serial.write(b'\0')
-                    next_retry = time.time() + Splitflap.RETRY_TIMEOUT
-                
-                try:
-                    latest_ack_nonce = self._ack_q.get(timeout=next_retry - time.time())
-                except Empty:
-                    latest_ack_nonce = None
 
-                # Check for shutdown
-                if not self._run:
-                    self._logger.debug('Write loop exiting @ _ack_q')
-                    return
+            (event, value) = data
+            if event == 'message':
+                backlog.append(value)
+            elif event == 'ack':
+                acked = [nonce for nonce in in_flight if Splitflap._is_acked(nonce, value)]
+                if not acked:
+                    self._logger.debug(f'Got unexpected ack: {value.nonce}')
+                for nonce in acked:
+                    if in_flight.pop(nonce)[2]:
+                        self._window_size = max(1, value.window_size)
+                        self._logger.info(f'Using a transport window of {self._window_size} message(s)')
+                with self._pending_cv:
+                    self._pending_count -= len(acked)
+                    self._pending_cv.notify_all()
+
+            # Retry anything that's overdue
+            now = time.time()
+            for nonce, entry in in_flight.items():
+                if now >= entry[1]:
+                    self._logger.debug(f'Retry write (nonce {nonce})...')
+                    self._write_frame(entry[0])
+                    entry[1] = now + Splitflap.RETRY_TIMEOUT
+
+    def _write_frame(self, encoded_message):
+        self._serial.write(encoded_message)
+        self._serial.write(b'\0')
+
+    @staticmethod
+    def _is_acked(nonce, ack):
+        if nonce == ack.nonce:
+            return True
+        if ack.window_size == 0:
+            # Stop-and-wait acks only cover a single nonce
+            return False
+        offset = (nonce - ack.cumulative_nonce) & 0xffffffff
+        if offset == 0 or offset >= 0x80000000:
+            # At or before the cumulative ack
+            return True
+        return offset <= 32 and (ack.selective_mask >> (offset - 1)) & 1 == 1
 
-                if latest_ack_nonce == nonce:
-                    break
-                else:
-                    self._logger.debug(f'Got unexpected nonce: {latest_ack_nonce}')
-    
     def _enqueue_message(self, message):
         nonce = self._next_nonce
-        self._next_nonce += 1
+        self._next_nonce = (self._next_nonce + 1) & 0xffffffff
 
         message.nonce = nonce
 
@@ -183,13 +251,134 @@ class Splitflap(object):
 
         encoded_message = cobs.encode(payload)
 
-        self._out_q.put((nonce, encoded_message))
+        with self._pending_cv:
+            self._pending_count += 1
+            approx_q_length = self._pending_count
+        self._write_q.put(('message', (nonce, encoded_message, message.WhichOneof('payload') == 'window_config')))
 
-        approx_q_length = self._out_q.qsize()
         self._logger.debug(f'Out q length: {approx_q_length}')
-        if approx_q_length > 10:
+        if approx_q_length > 10 + self._window_size:
             self._logger.warning(f'Output queue length is high! ({approx_q_length}) Is the splitflap still connected and functional?')
 
+    def flush(self, timeout=None):
+        """Blocks until all enqueued messages have been acknowledged by the splitflap. Returns False on timeout."""
+        with self._pending_cv:
+            return self._pending_cv.wait_for(lambda: self._pending_count == 0, timeout=timeout)
+
+    def change_baud_rate(self, baud_rate):
+        """
+        Switches the serial link to a new baud rate using the two-phase handshake described in splitflap.proto.
+        Returns True if both ends are now using the new rate, or False if the splitflap rejected it or the new rate
+        didn't work (in which case both ends fall back to the previous rate).
+        """
+        previous_baud_rate = self._serial.baudrate
+
+        # Nothing else may be in flight while the rate changes
+        if not self.flush(timeout=Splitflap.BAUD_RATE_RESPONSE_TIMEOUT):
+            self._logger.warning('Timed out waiting for pending messages before changing baud rate')
+            return False
+
+        responses = Queue()
+        unregister = self.add_handler('baud_rate_response', responses.put)
+        try:
+            message = splitflap_pb2.ToSplitflap()
+            message.baud_rate_change.phase = splitflap_pb2.BaudRateChange.Phase.PROPOSE
+            message.baud_rate_change.baud_rate = baud_rate
+            self._enqueue_message(message)
+
+            try:
+                response = responses.get(timeout=Splitflap.BAUD_RATE_RESPONSE_TIMEOUT)
+            except Empty:
+                # The splitflap may have switched anyway, but it will revert without a confirmation
+                self._logger.warning(f'No response to baud rate proposal ({baud_rate})')
+                time.sleep(Splitflap.BAUD_RATE_RESPONSE_TIMEOUT)
+                return False
+
+            if response.status != splitflap_pb2.BaudRateResponse.Status.ACCEPTED:
+                self._logger.warning(f'Baud rate {baud_rate} rejected by splitflap')
+                return False
+
+            # Wait for the proposal's ack, which may arrive after the response, before leaving the previous rate
+            if not self.flush(timeout=Splitflap.BAUD_RATE_RESPONSE_TIMEOUT):
+                self._logger.warning(f'Baud rate proposal ({baud_rate}) not acknowledged')
+                time.sleep(Splitflap.BAUD_RATE_RESPONSE_TIMEOUT)
+                return False
+
+            self._serial.baudrate = baud_rate
+
+            message = splitflap_pb2.ToSplitflap()
+            message.baud_rate_change.phase = splitflap_pb2.BaudRateChange.Phase.CONFIRM
+            message.baud_rate_change.baud_rate = baud_rate
+            self._enqueue_message(message)
+
+            if not self.flush(timeout=Splitflap.BAUD_RATE_CONFIRM_TIMEOUT):
+                # The splitflap is going back to the previous rate too (any outstanding retries of the confirmation
+                # will be acked and ignored there)
+                self._logger.warning(f'Baud rate {baud_rate} not confirmed; reverting to {previous_baud_rate}')
+                self._serial.baudrate = previous_baud_rate
+                return False
+        finally:
+            unregister()
+
+        self._logger.info(f'Changed baud rate to {baud_rate}')
+        return True
+
+    def upload_schedule(self, image):
+        """
+        Replaces the splitflap's timed message schedule with an image built by schedule.py, using the chunked upload
+        described in splitflap.proto. Returns the number of entries in the new schedule, or raises RuntimeError if the
+        upload failed.
+        """
+        Status = splitflap_pb2.ScheduleUploadResponse.Status
+        Phase = splitflap_pb2.ScheduleUpload.Phase
+
+        responses = Queue()
+        unregister = self.add_handler('schedule_upload_response', responses.put)
+        try:
+            def send(**fields):
+                message = splitflap_pb2.ToSplitflap()
+                for name, value in fields.items():
+                    setattr(message.schedule_upload, name, value)
+                self._enqueue_message(message)
+
+            def check(response):
+                if response.status != Status.OK:
+                    raise RuntimeError(f'Schedule upload failed during {Phase.Name(response.phase)}: '
+                                       f'{Status.Name(response.status)} (at offset {response.next_offset})')
+
+            def wait_for_response():
+                try:
+                    response = responses.get(timeout=Splitflap.SCHEDULE_RESPONSE_TIMEOUT)
+                except Empty:
+                    raise RuntimeError('No response to schedule upload')
+                check(response)
+                return response
+
+            send(phase=Phase.BEGIN, size=len(image))
+            wait_for_response()
+
+            for offset in range(0, len(image), Splitflap.SCHEDULE_CHUNK_SIZE):
+                # Keep the window full, but don't queue up the whole image (each flash sector is erased as the upload
+                # reaches it, so the splitflap may take a while to ack some chunks)
+                with self._pending_cv:
+                    if not self._pending_cv.wait_for(lambda: self._pending_count < self._window_size,
+                                                     timeout=Splitflap.SCHEDULE_RESPONSE_TIMEOUT):
+                        raise RuntimeError('Schedule upload chunks not acknowledged')
+
+                send(phase=Phase.DATA, offset=offset, data=bytes(image[offset:offset + Splitflap.SCHEDULE_CHUNK_SIZE]))
+
+                # Successful chunks aren't responded to, so any response is a failure
+                while not responses.empty():
+                    check(responses.get())
+
+            send(phase=Phase.COMMIT, crc32=zlib.crc32(image) & 0xffffffff)
+            response = wait_for_response()
+        finally:
+            unregister()
+
+        self._logger.info(f'Uploaded schedule with {response.record_count} entries')
+        return response.record_count
+
     def get_alphabet(self):
         return self._alphabet
 
@@ -232,14 +421,22 @@ class Splitflap(object):
         self.write_thread = Thread(target=self._write_loop)
         self.read_thread.start()
         self.write_thread.start()
+
+        # Restart the transport, negotiating a sliding window if requested; messages are sent one at a time until this
+        # is acked. Even a stop-and-wait client sends it, so nothing is left over from a previous client's session.
+        message = splitflap_pb2.ToSplitflap()
+        message.window_config.window_size = self._requested_window_size
+        self._enqueue_message(message)
+
+        # Don't inherit another client's state subscription
+        self.subscribe()
     
     def shutdown(self):
         self._logger.info('Shutting down...')
         self._run = False
         self.read_thread.join()
         self._logger.debug('Read thread terminated')
-        self._out_q.put(None)
-        self._ack_q.put(None)
+        self._write_q.put(None)
         self.write_thread.join()
         self._logger.debug('Write thread terminated')
     
@@ -252,6 +449,25 @@ class Splitflap(object):
         with self._lock:
             self._message_handlers[message_type].remove(handler)
 
+    def subscribe(self, min_interval_millis=0, heartbeat_interval_millis=0, module_start=0, module_count=0, fields=None):
+        """
+        Configures the state messages pushed by the splitflap; zero values select the splitflap's defaults. fields
+        is an optional list of SplitflapState.ModuleState field names to report (default is all of them). With a
+        restricted module range, splitflap_state messages only include those modules, starting at module_start.
+        """
+        message = splitflap_pb2.ToSplitflap()
+        subscribe = message.subscribe
+        subscribe.min_interval_millis = min_interval_millis
+        subscribe.heartbeat_interval_millis = heartbeat_interval_millis
+        subscribe.module_start = module_start
+        subscribe.module_count = module_count
+        if fields is not None:
+            module_state_fields = splitflap_pb2.SplitflapState.ModuleState.DESCRIPTOR.fields_by_name
+            for field in fields:
+                subscribe.field_mask |= 1 << (module_state_fields[field].number - 1)
+        self._partial_subscription = module_start != 0 or module_count != 0
+        self._enqueue_message(message)
+
     def request_state(self):
         message = splitflap_pb2.ToSplitflap()
         message.request_state.SetInParent()
@@ -270,9 +486,9 @@ class Splitflap(object):
 
 
 @contextmanager
-def splitflap_context(serial_port, default_logging=True, wait_for_comms=True):
+def splitflap_context(serial_port, default_logging=True, wait_for_comms=True, window_size=Splitflap.DEFAULT_WINDOW_SIZE, baud_rate=None):
     with serial.Serial(serial_port, SPLITFLAP_BAUD, timeout=1.0) as ser:
-        s = Splitflap(ser)
+        s = Splitflap(ser, window_size)
         s.start()
 
         if default_logging:
@@ -293,9 +509,15 @@ def splitflap_context(serial_port, default_logging=True, wait_for_comms=True):
             unregister()
             logging.info('Connected!')
 
+        if baud_rate is not None and baud_rate != SPLITFLAP_BAUD:
+            s.change_baud_rate(baud_rate)
+
         try:
             yield s
         finally:
+            if ser.baudrate != SPLITFLAP_BAUD:
+                # Restore the default rate so the next client can connect
+                s.change_baud_rate(SPLITFLAP_BAUD)
             s.shutdown()
 
 
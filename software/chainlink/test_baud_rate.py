@@ -0,0 +1,264 @@
+"""
+Tests the baud rate handshake in splitflap_proto.py against a stand-in splitflap on a pseudo-terminal, which follows
+the firmware's side of the handshake (SerialProtoProtocol) and garbles everything in both directions while the two
+ends' rates don't match. Linux only (it reads the client's rate from the pty's termios):
+
+    python -m unittest test_baud_rate
+"""
+import logging
+import os
+import select
+import sys
+import termios
+import threading
+import time
+import tty
+import unittest
+import zlib
+
+from cobs import cobs
+import serial
+
+from splitflap_proto import (
+    SPLITFLAP_BAUD,
+    Splitflap,
+    splitflap_context,
+)
+from proto_gen import splitflap_pb2
+
+NUM_MODULES = 6
+
+# Same as the firmware (serial_proto_protocol.cpp)
+MIN_BAUD_RATE = 9600
+MAX_BAUD_RATE = 5000000
+BAUD_RATE_CONFIRM_TIMEOUT = 2.0
+MAX_CONSECUTIVE_BAD_PACKETS = 5
+
+BaudRateStatus = splitflap_pb2.BaudRateResponse.Status
+
+
+def _garble(data):
+    """
+    What the receiving end makes of data sent at the wrong rate. Frame delimiters survive, so it sees a corrupt
+    packet for every packet sent, as the firmware does when a client connects at the wrong rate.
+    """
+    return bytes(b if b == 0 else (b ^ 0x55) or 0xff for b in data)
+
+
+class FakeSplitflap(object):
+    """
+    Splitflap stand-in on the master end of a pty; clients connect to port. Only what the handshake needs is
+    implemented: the stop-and-wait transport, state requests and BaudRateChange.
+    """
+
+    def __init__(self, unusable_baud_rates=()):
+        self._master, self._slave = os.openpty()
+        tty.setraw(self._slave)
+        self.port = os.ttyname(self._slave)
+
+        # Rates that are accepted, but where nothing gets through (like a rate the link can't actually handle)
+        self._unusable_baud_rates = set(unusable_baud_rates)
+
+        self.baud_rate = SPLITFLAP_BAUD
+        self._pending_baud_rate = None
+        self._previous_baud_rate = None
+        self._baud_rate_changed_time = 0
+        self._consecutive_bad_packets = 0
+        self._last_nonce = None
+
+        # BaudRateResponse statuses sent, and other notable events
+        self.events = []
+
+        self._run = True
+        self._thread = threading.Thread(target=self._loop)
+        self._thread.start()
+
+    def close(self):
+        self._run = False
+        self._thread.join()
+        os.close(self._master)
+        os.close(self._slave)
+
+    def _client_baud_rate_matches(self):
+        client_speed = termios.tcgetattr(self._slave)[5]
+        return (client_speed == getattr(termios, f'B{self.baud_rate}')
+                and self.baud_rate not in self._unusable_baud_rates)
+
+    def _loop(self):
+        buffer = b''
+        while self._run:
+            readable, _, _ = select.select([self._master], [], [], 0.01)
+            if readable:
+                data = os.read(self._master, 4096)
+                buffer += data if self._client_baud_rate_matches() else _garble(data)
+                while b'\0' in buffer:
+                    frame, buffer = buffer.split(b'\0', 1)
+                    if frame:
+                        self._handle_frame(frame)
+
+            # Like SerialProtoProtocol::updateBaudRate(), once anything written has been sent
+            if self._pending_baud_rate is not None:
+                self._previous_baud_rate = self.baud_rate
+                self._set_baud_rate(self._pending_baud_rate)
+                self._pending_baud_rate = None
+                self._baud_rate_changed_time = time.monotonic()
+            elif (self._previous_baud_rate is not None
+                  and time.monotonic() - self._baud_rate_changed_time > BAUD_RATE_CONFIRM_TIMEOUT):
+                self._set_baud_rate(self._previous_baud_rate)
+                self._previous_baud_rate = None
+                self._send_baud_rate_response(BaudRateStatus.REVERTED, self.baud_rate)
+
+    def _handle_frame(self, frame):
+        try:
+            decoded = cobs.decode(frame)
+        except cobs.DecodeError:
+            decoded = b''
+        payload = decoded[:-4]
+        if len(decoded) <= 4 or zlib.crc32(payload) != int.from_bytes(decoded[-4:], 'little'):
+            self._handle_bad_packet()
+            return
+        self._consecutive_bad_packets = 0
+
+        message = splitflap_pb2.ToSplitflap()
+        message.ParseFromString(payload)
+        payload_type = message.WhichOneof('payload')
+
+        if payload_type == 'window_config':
+            # Windows aren't supported, so the client falls back to stop-and-wait
+            self._last_nonce = message.nonce
+            self._ack(message.nonce)
+            return
+
+        self._ack(message.nonce)
+        if message.nonce == self._last_nonce:
+            return
+        self._last_nonce = message.nonce
+
+        if payload_type == 'request_state':
+            state = splitflap_pb2.FromSplitflap()
+            for _ in range(NUM_MODULES):
+                state.splitflap_state.modules.add()
+            self._send(state)
+        elif payload_type == 'baud_rate_change':
+            self._handle_baud_rate_change(message.baud_rate_change)
+
+    def _handle_baud_rate_change(self, baud_rate_change):
+        baud_rate = baud_rate_change.baud_rate
+        if baud_rate_change.phase == splitflap_pb2.BaudRateChange.Phase.PROPOSE:
+            if (self._pending_baud_rate is not None or self._previous_baud_rate is not None
+                    or not MIN_BAUD_RATE <= baud_rate <= MAX_BAUD_RATE):
+                self._send_baud_rate_response(BaudRateStatus.REJECTED, baud_rate)
+                return
+            self._pending_baud_rate = baud_rate
+            self._send_baud_rate_response(BaudRateStatus.ACCEPTED, baud_rate)
+        elif self._previous_baud_rate is not None and baud_rate == self.baud_rate:
+            self._previous_baud_rate = None
+            self._send_baud_rate_response(BaudRateStatus.CONFIRMED, baud_rate)
+        else:
+            self.events.append('ignored confirmation')
+
+    def _handle_bad_packet(self):
+        if self.baud_rate == SPLITFLAP_BAUD or self._previous_baud_rate is not None:
+            return
+        self._consecutive_bad_packets += 1
+        if self._consecutive_bad_packets >= MAX_CONSECUTIVE_BAD_PACKETS:
+            self._set_baud_rate(SPLITFLAP_BAUD)
+            self.events.append('restored default after bad packets')
+
+    def _set_baud_rate(self, baud_rate):
+        self.baud_rate = baud_rate
+        self._consecutive_bad_packets = 0
+
+    def _ack(self, nonce):
+        message = splitflap_pb2.FromSplitflap()
+        message.ack.nonce = nonce
+        self._send(message)
+
+    def _send_baud_rate_response(self, status, baud_rate):
+        self.events.append(BaudRateStatus.Name(status))
+        message = splitflap_pb2.FromSplitflap()
+        message.baud_rate_response.status = status
+        message.baud_rate_response.baud_rate = baud_rate
+        self._send(message)
+
+    def _send(self, message):
+        payload = message.SerializeToString()
+        data = cobs.encode(payload + zlib.crc32(payload).to_bytes(4, 'little')) + b'\0'
+        os.write(self._master, data if self._client_baud_rate_matches() else _garble(data))
+
+
+@unittest.skipUnless(sys.platform.startswith('linux'), 'Needs Linux ptys')
+class BaudRateTest(unittest.TestCase):
+
+    def setUp(self):
+        self.device = None
+
+    def tearDown(self):
+        if self.device is not None:
+            self.device.close()
+
+    def _assert_connected(self, s):
+        """Checks that commands still get through (and are acknowledged)."""
+        s.request_state()
+        self.assertTrue(s.flush(timeout=2))
+
+    def test_confirmed(self):
+        self.device = FakeSplitflap()
+        with splitflap_context(self.device.port, default_logging=False, baud_rate=460800) as s:
+            self.assertEqual(460800, self.device.baud_rate)
+            self.assertEqual(460800, s._serial.baudrate)
+            self._assert_connected(s)
+
+        # Restored on exit, for the next client
+        self.assertEqual(['ACCEPTED', 'CONFIRMED', 'ACCEPTED', 'CONFIRMED'], self.device.events)
+        self.assertEqual(SPLITFLAP_BAUD, self.device.baud_rate)
+
+    def test_rejected(self):
+        self.device = FakeSplitflap()
+        with splitflap_context(self.device.port, default_logging=False) as s:
+            self.assertFalse(s.change_baud_rate(MAX_BAUD_RATE + 1))
+            self.assertEqual(SPLITFLAP_BAUD, s._serial.baudrate)
+            self._assert_connected(s)
+        self.assertEqual(['REJECTED'], self.device.events)
+
+    def test_confirm_timeout_falls_back(self):
+        # The splitflap accepts the rate, but the confirmation never gets through at it
+        self.device = FakeSplitflap(unusable_baud_rates=[921600])
+        with splitflap_context(self.device.port, default_logging=False) as s:
+            start = time.monotonic()
+            self.assertFalse(s.change_baud_rate(921600))
+            self.assertGreaterEqual(time.monotonic() - start, Splitflap.BAUD_RATE_CONFIRM_TIMEOUT)
+            self.assertEqual(SPLITFLAP_BAUD, s._serial.baudrate)
+
+            # The client gives up first; the splitflap reverts shortly after, and then acks (and ignores) the client's
+            # retried confirmation
+            self._assert_connected(s)
+            self.assertEqual(SPLITFLAP_BAUD, self.device.baud_rate)
+        self.assertEqual(['ACCEPTED', 'REVERTED', 'ignored confirmation'], self.device.events)
+
+    def test_bad_packets_restore_default(self):
+        self.device = FakeSplitflap()
+
+        # A client exits without restoring the default rate...
+        with serial.Serial(self.device.port, SPLITFLAP_BAUD, timeout=1.0) as ser:
+            s = Splitflap(ser)
+            s.start()
+            self.assertTrue(s.change_baud_rate(460800))
+            s.shutdown()
+        self.assertEqual(460800, self.device.baud_rate)
+
+        # ...so the next one's first few packets are garbage to the splitflap, until it goes back to the default
+        start = time.monotonic()
+        with splitflap_context(self.device.port, default_logging=False) as s:
+            elapsed = time.monotonic() - start
+            self._assert_connected(s)
+        self.assertEqual(['ACCEPTED', 'CONFIRMED', 'restored default after bad packets'], self.device.events)
+        self.assertEqual(SPLITFLAP_BAUD, self.device.baud_rate)
+
+        # After a retry (or a few) of the first message
+        self.assertLess(elapsed, (MAX_CONSECUTIVE_BAD_PACKETS + 2) * Splitflap.RETRY_TIMEOUT)
+
+
+if __name__ == '__main__':
+    logging.basicConfig(level=logging.INFO)
+    unittest.main()